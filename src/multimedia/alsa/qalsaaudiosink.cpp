@@ -15,6 +15,7 @@
 #include <QtCore/qcoreapplication.h>
 #include <QtCore/qvarlengtharray.h>
 #include <QtMultimedia/private/qaudiohelpers_p.h>
+#include <QtMultimedia/private/qaudio_qiodevice_support_p.h>
 #include "qalsaaudiosink_p.h"
 #include "qalsaaudiodevice_p.h"
 #include <QLoggingCategory>
@@ -42,12 +43,14 @@ QAlsaAudioSink::~QAlsaAudioSink()
 
 void QAlsaAudioSink::setVolume(qreal vol)
 {
-    m_volume = vol;
+    m_volume.setVolume(float(vol));
+    if (m_ioThread)
+        m_ioThread->setVolume(float(vol));
 }
 
 qreal QAlsaAudioSink::volume() const
 {
-    return m_volume;
+    return m_volume.volume();
 }
 
 QAudio::Error QAlsaAudioSink::error() const
@@ -156,6 +159,7 @@ void QAlsaAudioSink::start(QIODevice* device)
 
     pullMode = true;
     audioSource = device;
+    m_audioCallback = {};
 
     connect(audioSource, &QIODevice::readyRead, timer, [this] {
         if (!timer->isActive()) {
@@ -187,6 +191,7 @@ QIODevice* QAlsaAudioSink::start()
     audioSource = new AlsaOutputPrivate(this);
     audioSource->open(QIODevice::WriteOnly|QIODevice::Unbuffered);
     pullMode = false;
+    m_audioCallback = {};
 
     deviceState = QAudio::IdleState;
 
@@ -197,6 +202,39 @@ QIODevice* QAlsaAudioSink::start()
     return audioSource;
 }
 
+bool QAlsaAudioSink::start(AudioCallback &&callback)
+{
+    if(deviceState != QAudio::StoppedState)
+        deviceState = QAudio::StoppedState;
+
+    errorState = QAudio::NoError;
+
+    // Handle change of mode
+    if(audioSource && !pullMode) {
+        delete audioSource;
+        audioSource = 0;
+    }
+
+    close();
+
+    // The callback mode works like the pull mode, with the callback as the source of data.
+    // It always runs on the I/O thread, so that the callback is invoked on the audio thread.
+    pullMode = true;
+    audioSource = nullptr;
+    m_audioCallback = std::move(callback);
+
+    deviceState = QAudio::ActiveState;
+
+    if (!open()) {
+        m_audioCallback = {};
+        return false;
+    }
+
+    emit stateChanged(deviceState);
+
+    return true;
+}
+
 void QAlsaAudioSink::stop()
 {
     if(deviceState == QAudio::StoppedState)
@@ -204,6 +242,7 @@ void QAlsaAudioSink::stop()
     errorState = QAudio::NoError;
     deviceState = QAudio::StoppedState;
     close();
+    m_audioCallback = {};
     emit stateChanged(deviceState);
 }
 
@@ -273,6 +312,11 @@ bool QAlsaAudioSink::open()
         }
     }
     if ( !fatal ) {
+        // the I/O thread writes directly to the device buffer if memory mapping is supported
+        const bool useMmap = useIOThread()
+                && snd_pcm_hw_params_test_access(handle, hwparams,
+                                                 SND_PCM_ACCESS_MMAP_INTERLEAVED) == 0;
+        access = useMmap ? SND_PCM_ACCESS_MMAP_INTERLEAVED : SND_PCM_ACCESS_RW_INTERLEAVED;
         err = snd_pcm_hw_params_set_access( handle, hwparams, access );
         if ( err < 0 ) {
             fatal = true;
@@ -391,11 +435,27 @@ bool QAlsaAudioSink::open()
     if(audioBuffer == 0)
         audioBuffer = new char[snd_pcm_frames_to_bytes(handle,buffer_frames)];
     snd_pcm_prepare( handle );
-    snd_pcm_start(handle);
+
+    if (useIOThread()) {
+        m_ioThread = std::make_unique<QAlsaIOThread>(handle, SND_PCM_STREAM_PLAYBACK, access,
+                                                     settings, buffer_frames, period_time);
+        m_ioThread->setVolume(m_volume.volume());
+        if (m_audioCallback)
+            m_ioThread->setAudioCallback(m_audioCallback);
+    } else {
+        m_volume.reset();
+        snd_pcm_start(handle);
+    }
 
     // Step 5: Setup timer
     bytesAvailable = bytesFree();
 
+    if (m_ioThread) {
+        // prefill the ring buffer, playback is started by the start threshold
+        ioThreadFeed();
+        m_ioThread->start();
+    }
+
     // Step 6: Start audio processing
     timer->start(period_time/1000);
 
@@ -411,6 +471,13 @@ void QAlsaAudioSink::close()
 {
     timer->stop();
 
+    if (m_ioThread) {
+        // hand the queued audio over to the device, so that snd_pcm_drain plays it out
+        m_ioThread->drain();
+        totalTimeValue = m_ioThread->framesTransferred();
+        m_ioThread.reset();
+    }
+
     if ( handle ) {
         snd_pcm_drain( handle );
         snd_pcm_close( handle );
@@ -427,6 +494,13 @@ void QAlsaAudioSink::close()
 
 qsizetype QAlsaAudioSink::bytesFree() const
 {
+    if (m_ioThread) {
+        if (deviceState != QAudio::ActiveState && deviceState != QAudio::IdleState)
+            return 0;
+        const int free = m_ioThread->ringBuffer().free();
+        return free - free % settings.bytesPerFrame();
+    }
+
     if(resuming)
         return period_size;
 
@@ -460,6 +534,22 @@ qint64 QAlsaAudioSink::write( const char *data, qint64 len )
     qDebug()<<"frames to write out = "<<
         snd_pcm_bytes_to_frames( handle, (int)len )<<" ("<<len<<") bytes";
 #endif
+    if (m_ioThread) {
+        // the I/O thread applies the volume
+        const qint64 space = qMin<qint64>(len, bytesFree());
+        const int written = m_ioThread->ringBuffer().write(
+                QSpan{ reinterpret_cast<const std::byte *>(data), qsizetype(space) });
+        if (written > 0) {
+            resuming = false;
+            errorState = QAudio::NoError;
+            if (deviceState != QAudio::ActiveState) {
+                deviceState = QAudio::ActiveState;
+                emit stateChanged(deviceState);
+            }
+        }
+        return written;
+    }
+
     int frames, err;
     int space = bytesFree();
 
@@ -471,9 +561,11 @@ qint64 QAlsaAudioSink::write( const char *data, qint64 len )
 
     frames = snd_pcm_bytes_to_frames(handle, space);
 
-    if (m_volume < 1.0f) {
+    if (!m_volume.isUnity()) {
+        space = int(snd_pcm_frames_to_bytes(handle, frames));
         QVarLengthArray<char, 4096> out(space);
-        QAudioHelperInternal::qMultiplySamples(m_volume, settings, data, out.data(), space);
+        m_volume.apply(settings, QSpan{ reinterpret_cast<const std::byte *>(data), space },
+                       QSpan{ reinterpret_cast<std::byte *>(out.data()), space });
         err = snd_pcm_writei(handle, out.constData(), frames);
     } else {
         err = snd_pcm_writei(handle, data, frames);
@@ -514,7 +606,8 @@ qsizetype QAlsaAudioSink::bufferSize() const
 
 qint64 QAlsaAudioSink::processedUSecs() const
 {
-    return qint64(1000000) * totalTimeValue / settings.sampleRate();
+    const qint64 frames = m_ioThread ? m_ioThread->framesTransferred() : totalTimeValue;
+    return qint64(1000000) * frames / settings.sampleRate();
 }
 
 void QAlsaAudioSink::resume()
@@ -527,9 +620,13 @@ void QAlsaAudioSink::resume()
             if(err < 0)
                 xrun_recovery(err);
 
-            err = snd_pcm_start(handle);
-            if(err < 0)
-                xrun_recovery(err);
+            if (m_ioThread) {
+                m_ioThread->start();
+            } else {
+                err = snd_pcm_start(handle);
+                if(err < 0)
+                    xrun_recovery(err);
+            }
 
             bytesAvailable = (int)snd_pcm_frames_to_bytes(handle, buffer_frames);
         }
@@ -556,6 +653,8 @@ void QAlsaAudioSink::suspend()
 {
     if(deviceState == QAudio::ActiveState || deviceState == QAudio::IdleState || resuming) {
         suspendedInState = deviceState;
+        if (m_ioThread)
+            m_ioThread->stop();
         snd_pcm_drain(handle);
         timer->stop();
         deviceState = QAudio::SuspendedState;
@@ -572,6 +671,11 @@ void QAlsaAudioSink::userFeed()
     QTime now(QTime::currentTime());
     qDebug()<<now.second()<<"s "<<now.msec()<<"ms :userFeed() OUT";
 #endif
+    if (m_ioThread) {
+        ioThreadFeed();
+        return;
+    }
+
     if(deviceState ==  QAudio::IdleState)
         bytesAvailable = bytesFree();
 
@@ -605,7 +709,7 @@ bool QAlsaAudioSink::deviceReady()
             if (deviceState != QAudio::ActiveState && deviceState != QAudio::IdleState)
                 return true;
             qint64 bytesWritten = write(audioBuffer,l);
-            if (bytesWritten != l)
+            if (bytesWritten != l && audioSource)
                 audioSource->seek(audioSource->pos()-(l-bytesWritten));
             bytesAvailable = bytesFree();
 
@@ -650,8 +754,52 @@ bool QAlsaAudioSink::deviceReady()
     return true;
 }
 
+void QAlsaAudioSink::ioThreadFeed()
+{
+    const uint events = m_ioThread->takeEvents();
+    if (events & uint(QAlsaIOThread::Event::Fatal)) {
+        qCWarning(lcAlsaOutput) << "Failed to recover the pcm:"
+                                << snd_strerror(m_ioThread->lastError());
+        close();
+        errorState = QAudio::FatalError;
+        emit errorChanged(errorState);
+        deviceState = QAudio::StoppedState;
+        emit stateChanged(deviceState);
+        return;
+    }
+
+    auto &ringBuffer = m_ioThread->ringBuffer();
+
+    if (pullMode && audioSource
+        && QtPrivate::fillRingBufferFromDevice(*audioSource, ringBuffer, settings.bytesPerFrame())
+                < 0) {
+        close();
+        deviceState = QAudio::StoppedState;
+        errorState = QAudio::IOError;
+        emit errorChanged(errorState);
+        emit stateChanged(deviceState);
+        return;
+    }
+
+    const bool starved = events & uint(QAlsaIOThread::Event::Starved);
+    if (deviceState == QAudio::ActiveState && starved && ringBuffer.used() == 0) {
+        const bool atEnd = pullMode && audioSource && audioSource->atEnd();
+        errorState = atEnd ? QAudio::NoError : QAudio::UnderrunError;
+        emit errorChanged(errorState);
+        deviceState = QAudio::IdleState;
+        emit stateChanged(deviceState);
+    } else if (deviceState == QAudio::IdleState && ringBuffer.used() > 0) {
+        errorState = QAudio::NoError;
+        deviceState = QAudio::ActiveState;
+        emit stateChanged(deviceState);
+    }
+}
+
 void QAlsaAudioSink::reset()
 {
+    // discard the queued audio instead of draining it
+    if (m_ioThread)
+        m_ioThread->stop();
     if(handle)
         snd_pcm_reset(handle);
 
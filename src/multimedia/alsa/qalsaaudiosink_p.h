@@ -28,6 +28,11 @@
 #include <QtMultimedia/qaudio.h>
 #include <QtMultimedia/qaudiodevice.h>
 #include <private/qaudiosystem_p.h>
+#include <private/qaudio_rtsan_support_p.h>
+
+#include "qalsaiothread_p.h"
+
+#include <memory>
 
 QT_BEGIN_NAMESPACE
 
@@ -43,6 +48,7 @@ public:
 
     void start(QIODevice* device) override;
     QIODevice* start() override;
+    bool start(AudioCallback &&callback) override;
     void stop() override;
     void reset() override;
     void suspend() override;
@@ -88,8 +94,11 @@ private:
     int setFormat();
     bool open();
     void close();
+    void ioThreadFeed();
 
     QTimer* timer = nullptr;
+    // callback mode: invoked by m_ioThread instead of reading audioSource
+    AudioCallback m_audioCallback;
     QByteArray m_device;
     int bytesAvailable = 0;
     qint64 elapsedTimeOffset = 0;
@@ -97,7 +106,14 @@ private:
     snd_pcm_t* handle = nullptr;
     snd_pcm_access_t access = SND_PCM_ACCESS_RW_INTERLEAVED;
     snd_pcm_hw_params_t *hwparams = nullptr;
-    qreal m_volume = 1.0f;
+    // applied by write() in the legacy mode, and by m_ioThread otherwise
+    QAudioHelperInternal::SmoothedVolume m_volume;
+
+    // I/O thread mode: the device is serviced by m_ioThread, and the timer only refills
+    // its ring buffer and polls for state changes. The callback mode always uses it.
+    bool useIOThread() const { return m_useIOThread || m_audioCallback; }
+    const bool m_useIOThread = QAlsaIOThread::isEnabled();
+    std::unique_ptr<QAlsaIOThread> m_ioThread;
 };
 
 class AlsaOutputPrivate : public QIODevice
@@ -15,6 +15,7 @@
 #include <QtCore/qcoreapplication.h>
 #include <QtCore/qvarlengtharray.h>
 #include <QtMultimedia/private/qaudiohelpers_p.h>
+#include <QtMultimedia/private/qaudio_qiodevice_support_p.h>
 #include "qalsaaudiosource_p.h"
 
 QT_BEGIN_NAMESPACE
@@ -39,8 +40,6 @@ QAlsaAudioSource::QAlsaAudioSource(const QByteArray &device, QObject *parent)
     pullMode = true;
     resuming = false;
 
-    m_volume = 1.0f;
-
     m_device = device;
 
     timer = new QTimer(this);
@@ -56,12 +55,14 @@ QAlsaAudioSource::~QAlsaAudioSource()
 
 void QAlsaAudioSource::setVolume(qreal vol)
 {
-    m_volume = vol;
+    m_volume.setVolume(float(vol));
+    if (m_ioThread)
+        m_ioThread->setVolume(float(vol));
 }
 
 qreal QAlsaAudioSource::volume() const
 {
-    return m_volume;
+    return m_volume.volume();
 }
 
 QAudio::Error QAlsaAudioSource::error() const
@@ -176,6 +177,7 @@ void QAlsaAudioSource::start(QIODevice* device)
 
     pullMode = true;
     audioSource = device;
+    m_audioCallback = {};
 
     deviceState = QAudio::ActiveState;
 
@@ -196,6 +198,7 @@ QIODevice* QAlsaAudioSource::start()
     pullMode = false;
     audioSource = new AlsaInputPrivate(this);
     audioSource->open(QIODevice::ReadOnly | QIODevice::Unbuffered);
+    m_audioCallback = {};
 
     deviceState = QAudio::IdleState;
 
@@ -207,6 +210,33 @@ QIODevice* QAlsaAudioSource::start()
     return audioSource;
 }
 
+bool QAlsaAudioSource::start(AudioCallback &&callback)
+{
+    if(deviceState != QAudio::StoppedState)
+        close();
+
+    if(!pullMode && audioSource)
+        delete audioSource;
+
+    // The callback mode works like the pull mode, with the callback as the destination of
+    // data. It always runs on the I/O thread, so that the callback is invoked on the audio
+    // thread.
+    pullMode = true;
+    audioSource = nullptr;
+    m_audioCallback = std::move(callback);
+
+    deviceState = QAudio::ActiveState;
+
+    if (!open()) {
+        m_audioCallback = {};
+        return false;
+    }
+
+    emit stateChanged(deviceState);
+
+    return true;
+}
+
 void QAlsaAudioSource::stop()
 {
     if(deviceState == QAudio::StoppedState)
@@ -215,6 +245,7 @@ void QAlsaAudioSource::stop()
     deviceState = QAudio::StoppedState;
 
     close();
+    m_audioCallback = {};
     emit stateChanged(deviceState);
 }
 
@@ -282,6 +313,11 @@ bool QAlsaAudioSource::open()
         }
     }
     if ( !fatal ) {
+        // the I/O thread reads directly from the device buffer if memory mapping is supported
+        const bool useMmap = useIOThread()
+                && snd_pcm_hw_params_test_access(handle, hwparams,
+                                                 SND_PCM_ACCESS_MMAP_INTERLEAVED) == 0;
+        access = useMmap ? SND_PCM_ACCESS_MMAP_INTERLEAVED : SND_PCM_ACCESS_RW_INTERLEAVED;
         err = snd_pcm_hw_params_set_access( handle, hwparams, access );
         if ( err < 0 ) {
             fatal = true;
@@ -361,19 +397,30 @@ bool QAlsaAudioSource::open()
     snd_pcm_sw_params(handle, swparams);
 
     // Step 4: Prepare audio
-    ringBuffer.resize(buffer_size);
     snd_pcm_prepare( handle );
-    snd_pcm_start(handle);
+    if (useIOThread()) {
+        // the I/O thread starts the capture
+        m_ioThread = std::make_unique<QAlsaIOThread>(handle, SND_PCM_STREAM_CAPTURE, access,
+                                                     settings, buffer_frames, period_time);
+        m_ioThread->setVolume(m_volume.volume());
+        if (m_audioCallback)
+            m_ioThread->setCaptureCallback(m_audioCallback);
+        m_ioThread->start();
+    } else {
+        m_volume.reset();
+        ringBuffer.emplace(buffer_size);
+        snd_pcm_start(handle);
+    }
 
     // Step 5: Setup timer
     bytesAvailable = checkBytesReady();
 
-    if(pullMode)
+    if(pullMode && audioSource)
         connect(audioSource, &QIODevice::readyRead, this, &QAlsaAudioSource::userFeed);
 
     // Step 6: Start audio processing
     chunks = buffer_size/period_size;
-    timer->start(period_time*chunks/2000);
+    timer->start(m_ioThread ? period_time / 1000 : period_time * chunks / 2000);
 
     errorState  = QAudio::NoError;
 
@@ -386,6 +433,8 @@ void QAlsaAudioSource::close()
 {
     timer->stop();
 
+    m_ioThread.reset();
+
     if ( handle ) {
         snd_pcm_drop( handle );
         snd_pcm_close( handle );
@@ -395,7 +444,11 @@ void QAlsaAudioSource::close()
 
 int QAlsaAudioSource::checkBytesReady()
 {
-    if(resuming)
+    if (m_ioThread) {
+        const bool running = deviceState == QAudio::ActiveState
+                || deviceState == QAudio::IdleState;
+        bytesAvailable = running ? m_ioThread->ringBuffer().used() : 0;
+    } else if(resuming)
         bytesAvailable = period_size;
     else if(deviceState != QAudio::ActiveState
             && deviceState != QAudio::IdleState)
@@ -415,6 +468,8 @@ int QAlsaAudioSource::checkBytesReady()
 
 qsizetype QAlsaAudioSource::bytesReady() const
 {
+    if (m_ioThread && (deviceState == QAudio::ActiveState || deviceState == QAudio::IdleState))
+        return m_ioThread->ringBuffer().used();
     return qMax(bytesAvailable, 0);
 }
 
@@ -424,10 +479,13 @@ qint64 QAlsaAudioSource::read(char* data, qint64 len)
     if ( !handle )
         return 0;
 
+    if (m_ioThread)
+        return readFromIOThread(data, len);
+
     int bytesRead = 0;
-    int bytesInRingbufferBeforeRead = ringBuffer.bytesOfDataInBuffer();
+    int bytesInRingbufferBeforeRead = int(ringBuffer->used());
 
-    if (ringBuffer.bytesOfDataInBuffer() < len) {
+    if (ringBuffer->used() < len) {
 
         // bytesAvaiable is saved as a side effect of checkBytesReady().
         int bytesToRead = checkBytesReady();
@@ -447,7 +505,7 @@ qint64 QAlsaAudioSource::read(char* data, qint64 len)
         }
 
         bytesToRead = qMin<qint64>(len, bytesToRead);
-        bytesToRead = qMin<qint64>(ringBuffer.freeBytes(), bytesToRead);
+        bytesToRead = qMin<qint64>(ringBuffer->free(), bytesToRead);
         bytesToRead -= bytesToRead % period_size;
 
         int count=0;
@@ -461,13 +519,11 @@ qint64 QAlsaAudioSource::read(char* data, qint64 len)
 
             int readFrames = snd_pcm_readi(handle, buffer.data(), frames);
             bytesRead = snd_pcm_frames_to_bytes(handle, readFrames);
-            if (m_volume < 1.0f)
-                QAudioHelperInternal::qMultiplySamples(m_volume, settings,
-                                                       buffer.constData(),
-                                                       buffer.data(), bytesRead);
 
             if (readFrames >= 0) {
-                ringBuffer.write(buffer.data(), bytesRead);
+                m_volume.apply(settings,
+                               QSpan{ reinterpret_cast<std::byte *>(buffer.data()), bytesRead });
+                ringBuffer->write(QSpan<const char>(buffer.constData(), bytesRead));
 #ifdef DEBUG_AUDIO
                 qDebug() << QString::fromLatin1("read in bytes = %1 (frames=%2)").arg(bytesRead).arg(readFrames).toLatin1().constData();
 #endif
@@ -504,24 +560,14 @@ qint64 QAlsaAudioSource::read(char* data, qint64 len)
             return 0;
 
         if (pullMode) {
-            qint64 l = 0;
-            qint64 bytesWritten = 0;
-            while (ringBuffer.bytesOfDataInBuffer() > 0) {
-                l = audioSource->write(ringBuffer.availableData(), ringBuffer.availableDataBlockSize());
-                if (l > 0) {
-                    ringBuffer.readBytes(l);
-                    bytesWritten += l;
-                } else {
-                    break;
-                }
-            }
-
-            if (l < 0) {
+            const qint64 bytesWritten = QtPrivate::drainRingBufferToDevice(*ringBuffer,
+                                                                           *audioSource);
+            if (bytesWritten < 0) {
                 close();
                 errorState = QAudio::IOError;
                 deviceState = QAudio::StoppedState;
                 emit stateChanged(deviceState);
-            } else if (l == 0 && bytesWritten == 0) {
+            } else if (bytesWritten == 0) {
                 if (deviceState != QAudio::IdleState) {
                     errorState = QAudio::NoError;
                     deviceState = QAudio::IdleState;
@@ -538,14 +584,13 @@ qint64 QAlsaAudioSource::read(char* data, qint64 len)
                 }
             }
 
-            return bytesWritten;
+            return qMax<qint64>(bytesWritten, 0);
         } else {
-            while (ringBuffer.bytesOfDataInBuffer() > 0) {
-                int size = ringBuffer.availableDataBlockSize();
-                memcpy(data, ringBuffer.availableData(), size);
-                data += size;
-                ringBuffer.readBytes(size);
-            }
+            // don't hand over more than requested; the rest stays in the ring buffer
+            bytesRead = int(ringBuffer->consume(len, [&](QSpan<const char> region) {
+                memcpy(data, region.data(), region.size());
+                data += region.size();
+            }));
 
             bytesAvailable -= bytesRead;
             totalTimeValue += bytesRead;
@@ -563,6 +608,55 @@ qint64 QAlsaAudioSource::read(char* data, qint64 len)
     return 0;
 }
 
+qint64 QAlsaAudioSource::readFromIOThread(char *data, qint64 len)
+{
+    if (deviceState != QAudio::ActiveState && deviceState != QAudio::IdleState)
+        return 0;
+
+    auto &ringBuffer = m_ioThread->ringBuffer();
+    qint64 bytesRead = 0;
+
+    if (pullMode) {
+        // hand over everything captured so far to the QIODevice
+        bytesRead = QtPrivate::drainRingBufferToDevice(ringBuffer, *audioSource);
+        if (bytesRead < 0) {
+            close();
+            errorState = QAudio::IOError;
+            deviceState = QAudio::StoppedState;
+            emit stateChanged(deviceState);
+            return 0;
+        }
+
+        if (bytesRead == 0 && ringBuffer.used() > 0) {
+            if (deviceState != QAudio::IdleState) {
+                errorState = QAudio::NoError;
+                deviceState = QAudio::IdleState;
+                emit stateChanged(deviceState);
+            }
+            return 0;
+        }
+    } else {
+        ringBuffer.consume(int(qMin<qint64>(len, ringBuffer.used())),
+                           [&](QSpan<const std::byte> region) {
+            memcpy(data + bytesRead, region.data(), region.size());
+            bytesRead += region.size();
+        });
+    }
+
+    if (bytesRead > 0) {
+        bytesAvailable = ringBuffer.used();
+        totalTimeValue += bytesRead;
+        resuming = false;
+        if (deviceState != QAudio::ActiveState) {
+            errorState = QAudio::NoError;
+            deviceState = QAudio::ActiveState;
+            emit stateChanged(deviceState);
+        }
+    }
+
+    return bytesRead;
+}
+
 void QAlsaAudioSource::resume()
 {
     if(deviceState == QAudio::SuspendedState) {
@@ -573,16 +667,20 @@ void QAlsaAudioSource::resume()
             if(err < 0)
                 xrun_recovery(err);
 
-            err = snd_pcm_start(handle);
-            if(err < 0)
-                xrun_recovery(err);
+            if (m_ioThread) {
+                m_ioThread->start();
+            } else {
+                err = snd_pcm_start(handle);
+                if(err < 0)
+                    xrun_recovery(err);
+            }
 
-            bytesAvailable = buffer_size;
+            bytesAvailable = m_ioThread ? m_ioThread->ringBuffer().used() : buffer_size;
         }
-        resuming = true;
+        resuming = !m_ioThread;
         deviceState = QAudio::ActiveState;
         int chunks = buffer_size/period_size;
-        timer->start(period_time*chunks/2000);
+        timer->start(m_ioThread ? period_time / 1000 : period_time * chunks / 2000);
         emit stateChanged(deviceState);
     }
 }
@@ -609,6 +707,8 @@ qint64 QAlsaAudioSource::processedUSecs() const
 void QAlsaAudioSource::suspend()
 {
     if(deviceState == QAudio::ActiveState||resuming) {
+        if (m_ioThread)
+            m_ioThread->stop();
         snd_pcm_drain(handle);
         timer->stop();
         deviceState = QAudio::SuspendedState;
@@ -629,6 +729,11 @@ void QAlsaAudioSource::userFeed()
 
 bool QAlsaAudioSource::deviceReady()
 {
+    if (m_ioThread) {
+        ioThreadFeed();
+        return true;
+    }
+
     if(pullMode) {
         // reads some audio data and writes it to QIODevice
         read(0, buffer_size);
@@ -659,6 +764,37 @@ bool QAlsaAudioSource::deviceReady()
     return true;
 }
 
+void QAlsaAudioSource::ioThreadFeed()
+{
+    const uint events = m_ioThread->takeEvents();
+    if (events & uint(QAlsaIOThread::Event::Fatal)) {
+        qWarning() << "QAudioSource: failed to recover the pcm:"
+                   << snd_strerror(m_ioThread->lastError());
+        close();
+        errorState = QAudio::IOError;
+        deviceState = QAudio::StoppedState;
+        emit stateChanged(deviceState);
+        return;
+    }
+
+    if (m_audioCallback) {
+        // the captured data has been handed over to the callback by the I/O thread
+        return;
+    }
+
+    if (pullMode) {
+        // writes the captured data to QIODevice
+        readFromIOThread(nullptr, 0);
+    } else if (m_ioThread->ringBuffer().used() > 0) {
+        // emits readyRead() so user will call read() on QIODevice to get some audio data
+        AlsaInputPrivate* a = qobject_cast<AlsaInputPrivate*>(audioSource);
+        a->trigger();
+    }
+
+    if (m_ioThread)
+        bytesAvailable = checkBytesReady();
+}
+
 void QAlsaAudioSource::reset()
 {
     if(handle)
@@ -699,71 +835,6 @@ void AlsaInputPrivate::trigger()
     emit readyRead();
 }
 
-RingBuffer::RingBuffer() :
-        m_head(0),
-        m_tail(0)
-{
-}
-
-void RingBuffer::resize(int size)
-{
-    m_data.resize(size);
-}
-
-int RingBuffer::bytesOfDataInBuffer() const
-{
-    if (m_head < m_tail)
-        return m_tail - m_head;
-    else if (m_tail < m_head)
-        return m_data.size() + m_tail - m_head;
-    else
-        return 0;
-}
-
-int RingBuffer::freeBytes() const
-{
-    if (m_head > m_tail)
-        return m_head - m_tail - 1;
-    else if (m_tail > m_head)
-        return m_data.size() - m_tail + m_head - 1;
-    else
-        return m_data.size() - 1;
-}
-
-const char *RingBuffer::availableData() const
-{
-    return (m_data.constData() + m_head);
-}
-
-int RingBuffer::availableDataBlockSize() const
-{
-    if (m_head > m_tail)
-        return m_data.size() - m_head;
-    else if (m_tail > m_head)
-        return m_tail - m_head;
-    else
-        return 0;
-}
-
-void RingBuffer::readBytes(int bytes)
-{
-    m_head = (m_head + bytes) % m_data.size();
-}
-
-void RingBuffer::write(char *data, int len)
-{
-    if (m_tail + len < m_data.size()) {
-        memcpy(m_data.data() + m_tail, data, len);
-        m_tail += len;
-    } else {
-        int bytesUntilEnd = m_data.size() - m_tail;
-        memcpy(m_data.data() + m_tail, data, bytesUntilEnd);
-        if (len - bytesUntilEnd > 0)
-            memcpy(m_data.data(), data + bytesUntilEnd, len - bytesUntilEnd);
-        m_tail = len - bytesUntilEnd;
-    }
-}
-
 QT_END_NAMESPACE
 
 #include "moc_qalsaaudiosource_p.cpp"
@@ -30,33 +30,15 @@
 #include <QtMultimedia/qaudiodevice.h>
 #include <private/qaudiosystem_p.h>
 
-QT_BEGIN_NAMESPACE
-
-
-class AlsaInputPrivate;
-
-class RingBuffer
-{
-public:
-    RingBuffer();
-
-    void resize(int size);
+#include "qalsaiothread_p.h"
 
-    int bytesOfDataInBuffer() const;
-    int freeBytes() const;
+#include <memory>
+#include <optional>
 
-    const char *availableData() const;
-    int availableDataBlockSize() const;
-    void readBytes(int bytes);
-
-    void write(char *data, int len);
+QT_BEGIN_NAMESPACE
 
-private:
-    int m_head;
-    int m_tail;
 
-    QByteArray m_data;
-};
+class AlsaInputPrivate;
 
 class QAlsaAudioSource : public QPlatformAudioSource
 {
@@ -69,6 +51,7 @@ public:
 
     void start(QIODevice* device) override;
     QIODevice* start() override;
+    bool start(AudioCallback &&callback) override;
     void stop() override;
     void reset() override;
     void suspend() override;
@@ -102,10 +85,13 @@ private:
     bool open();
     void close();
     void drain();
+    qint64 readFromIOThread(char *data, qint64 len);
+    void ioThreadFeed();
 
     QTimer* timer;
     qint64 elapsedTimeOffset;
-    RingBuffer ringBuffer;
+    // legacy mode: captured data not handed over to the application yet
+    std::optional<QtPrivate::QAudioRingBuffer<char>> ringBuffer;
     qsizetype bytesAvailable;
     QByteArray m_device;
     bool pullMode;
@@ -118,7 +104,17 @@ private:
     snd_pcm_access_t access;
     snd_pcm_format_t pcmformat;
     snd_pcm_hw_params_t *hwparams;
-    qreal m_volume;
+    // applied by read() in the legacy mode, and by m_ioThread otherwise
+    QAudioHelperInternal::SmoothedVolume m_volume;
+
+    // callback mode: invoked by m_ioThread instead of writing to its ring buffer
+    AudioCallback m_audioCallback;
+
+    // I/O thread mode: the device is serviced by m_ioThread, and the timer only hands
+    // the captured data over to the application. The callback mode always uses it.
+    bool useIOThread() const { return m_useIOThread || m_audioCallback; }
+    const bool m_useIOThread = QAlsaIOThread::isEnabled();
+    std::unique_ptr<QAlsaIOThread> m_ioThread;
 };
 
 class AlsaInputPrivate : public QIODevice
@@ -0,0 +1,290 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qalsaiothread_p.h"
+
+#include <QtCore/qdeadlinetimer.h>
+#include <QtCore/qthread.h>
+
+#include <algorithm>
+
+QT_BEGIN_NAMESPACE
+
+bool QAlsaIOThread::isEnabled()
+{
+    static const bool enabled = [] {
+        bool ok = false;
+        const int value = qEnvironmentVariableIntValue("QT_ALSA_USE_IO_THREAD", &ok);
+        return ok && value > 0;
+    }();
+    return enabled;
+}
+
+QAlsaIOThread::QAlsaIOThread(snd_pcm_t *handle, snd_pcm_stream_t stream, snd_pcm_access_t access,
+                             const QAudioFormat &format, snd_pcm_uframes_t bufferFrames,
+                             unsigned int periodTimeUs)
+    : m_handle(handle),
+      m_stream(stream),
+      m_mmap(access == SND_PCM_ACCESS_MMAP_INTERLEAVED),
+      m_format(format),
+      m_bytesPerFrame(format.bytesPerFrame()),
+      // wake up regularly to check for stop requests, even if the device stalls
+      m_waitTimeoutMs(std::max(int(periodTimeUs / 1000) * 4, 20)),
+      m_ringBuffer(int(bufferFrames) * format.bytesPerFrame())
+{
+    Q_ASSERT(access == SND_PCM_ACCESS_MMAP_INTERLEAVED
+             || access == SND_PCM_ACCESS_RW_INTERLEAVED);
+
+    if (!m_mmap)
+        m_transferBuffer.resize(bufferFrames * m_bytesPerFrame);
+}
+
+QAlsaIOThread::~QAlsaIOThread()
+{
+    stop();
+}
+
+void QAlsaIOThread::setAudioCallback(AudioCallback callback)
+{
+    Q_ASSERT(!isRunning());
+    Q_ASSERT(m_stream == SND_PCM_STREAM_PLAYBACK);
+    m_audioCallback = std::move(callback);
+}
+
+void QAlsaIOThread::setCaptureCallback(CaptureCallback callback)
+{
+    Q_ASSERT(!isRunning());
+    Q_ASSERT(m_stream == SND_PCM_STREAM_CAPTURE);
+    m_captureCallback = std::move(callback);
+}
+
+void QAlsaIOThread::start()
+{
+    if (isRunning())
+        return;
+
+    m_stopRequested.store(false, std::memory_order_relaxed);
+    m_drainRequested.store(false, std::memory_order_relaxed);
+    m_lastError.store(0, std::memory_order_relaxed);
+
+    m_thread.reset(QThread::create([this] { run(); }));
+    m_thread->setObjectName(m_stream == SND_PCM_STREAM_PLAYBACK ? "QAlsaAudioSink"
+                                                                : "QAlsaAudioSource");
+    m_thread->start(QThread::TimeCriticalPriority);
+}
+
+void QAlsaIOThread::stop()
+{
+    if (!m_thread)
+        return;
+
+    m_stopRequested.store(true, std::memory_order_relaxed);
+    m_thread->wait();
+    m_thread.reset();
+}
+
+void QAlsaIOThread::drain()
+{
+    Q_ASSERT(m_stream == SND_PCM_STREAM_PLAYBACK);
+
+    if (!m_thread)
+        return;
+
+    if (!m_audioCallback) {
+        // the device can't take the buffered audio faster than it plays it
+        const qint64 timeoutMs =
+                m_format.durationForBytes(qint32(m_ringBuffer.used())) / 1000 + m_waitTimeoutMs;
+        m_drainRequested.store(true, std::memory_order_relaxed);
+        m_thread->wait(QDeadlineTimer(timeoutMs));
+    }
+
+    stop();
+}
+
+bool QAlsaIOThread::isRunning() const
+{
+    return m_thread && m_thread->isRunning();
+}
+
+void QAlsaIOThread::run()
+{
+    const bool isCapture = m_stream == SND_PCM_STREAM_CAPTURE;
+
+    // start with the volume set before the thread was started, without a ramp
+    m_volume.reset();
+
+    // playback is started by the start threshold once the first period has been written
+    if (isCapture && snd_pcm_state(m_handle) == SND_PCM_STATE_PREPARED) {
+        if (int err = snd_pcm_start(m_handle); err < 0 && !recover(err))
+            return;
+    }
+
+    const auto framesToDrain = [this] {
+        return snd_pcm_uframes_t(m_ringBuffer.used() / m_bytesPerFrame);
+    };
+
+    while (!m_stopRequested.load(std::memory_order_relaxed)) {
+        const bool draining = m_drainRequested.load(std::memory_order_relaxed);
+        // the rest is played out by snd_pcm_drain on the owner thread
+        if (draining && framesToDrain() == 0)
+            return;
+
+        const int ready = snd_pcm_wait(m_handle, m_waitTimeoutMs);
+        if (ready < 0) {
+            if (!recover(ready))
+                return;
+            continue;
+        }
+        if (ready == 0)
+            continue; // timeout
+
+        snd_pcm_sframes_t avail = snd_pcm_avail_update(m_handle);
+        if (avail < 0) {
+            if (!recover(int(avail)))
+                return;
+            continue;
+        }
+        if (draining)
+            avail = std::min<snd_pcm_sframes_t>(avail, framesToDrain());
+        if (avail == 0)
+            continue;
+
+        snd_pcm_uframes_t audioFrames = 0;
+        const snd_pcm_sframes_t transferred = m_mmap ? transferMmap(avail, audioFrames)
+                                                     : transferReadWrite(avail, audioFrames);
+        m_framesTransferred.fetch_add(qint64(audioFrames), std::memory_order_relaxed);
+
+        if (transferred < 0 && !recover(int(transferred)))
+            return;
+    }
+}
+
+bool QAlsaIOThread::recover(int err)
+{
+    if (err == -EAGAIN)
+        return true;
+
+    err = snd_pcm_recover(m_handle, err, /*silent=*/1);
+    if (err >= 0 && m_stream == SND_PCM_STREAM_CAPTURE)
+        err = snd_pcm_start(m_handle);
+
+    if (err < 0) {
+        // logging isn't realtime safe, the owner thread reports the error
+        m_lastError.store(err, std::memory_order_relaxed);
+        raise(Event::Fatal);
+        return false;
+    }
+
+    raise(Event::Xrun);
+    return true;
+}
+
+snd_pcm_sframes_t QAlsaIOThread::transferMmap(snd_pcm_uframes_t frames,
+                                               snd_pcm_uframes_t &audioFrames)
+{
+    snd_pcm_sframes_t transferred = 0;
+
+    while (frames > 0) {
+        const snd_pcm_channel_area_t *areas = nullptr;
+        snd_pcm_uframes_t offset = 0;
+        snd_pcm_uframes_t count = frames;
+
+        if (int err = snd_pcm_mmap_begin(m_handle, &areas, &offset, &count); err < 0)
+            return err;
+        if (count == 0)
+            break;
+
+        // interleaved access: all channels share the first area
+        std::byte *base = static_cast<std::byte *>(areas[0].addr) + areas[0].first / 8
+                + offset * areas[0].step / 8;
+        const QSpan<std::byte> region{ base, qsizetype(count) * m_bytesPerFrame };
+
+        snd_pcm_uframes_t regionAudioFrames = count;
+        if (m_stream == SND_PCM_STREAM_PLAYBACK)
+            regionAudioFrames = fillPlayback(region);
+        else
+            consumeCapture(region);
+
+        const snd_pcm_sframes_t committed = snd_pcm_mmap_commit(m_handle, offset, count);
+        if (committed < 0)
+            return committed;
+        audioFrames += std::min(regionAudioFrames, snd_pcm_uframes_t(committed));
+        if (snd_pcm_uframes_t(committed) != count)
+            return -EPIPE;
+
+        frames -= count;
+        transferred += committed;
+    }
+
+    return transferred;
+}
+
+snd_pcm_sframes_t QAlsaIOThread::transferReadWrite(snd_pcm_uframes_t frames,
+                                                    snd_pcm_uframes_t &audioFrames)
+{
+    frames = std::min<snd_pcm_uframes_t>(frames, m_transferBuffer.size() / m_bytesPerFrame);
+    const QSpan<std::byte> region{ m_transferBuffer.data(), qsizetype(frames) * m_bytesPerFrame };
+
+    if (m_stream == SND_PCM_STREAM_PLAYBACK) {
+        const snd_pcm_uframes_t regionAudioFrames = fillPlayback(region);
+        const snd_pcm_sframes_t framesWritten = snd_pcm_writei(m_handle, region.data(), frames);
+        if (framesWritten > 0)
+            audioFrames = std::min(regionAudioFrames, snd_pcm_uframes_t(framesWritten));
+        return framesWritten;
+    }
+
+    const snd_pcm_sframes_t framesRead = snd_pcm_readi(m_handle, region.data(), frames);
+    if (framesRead > 0) {
+        consumeCapture(region.first(framesRead * m_bytesPerFrame));
+        audioFrames = snd_pcm_uframes_t(framesRead);
+    }
+    return framesRead;
+}
+
+snd_pcm_uframes_t QAlsaIOThread::fillPlayback(QSpan<std::byte> buffer) QT_MM_NONBLOCKING
+{
+    if (m_audioCallback) {
+        QtMultimediaPrivate::invokeNonBlocking(m_audioCallback, buffer);
+        m_volume.apply(m_format, buffer);
+        return snd_pcm_uframes_t(buffer.size() / m_bytesPerFrame);
+    }
+
+    qsizetype bytesConsumed = 0;
+    m_ringBuffer.consume(int(buffer.size()), [&](QSpan<const std::byte> region) {
+        m_volume.apply(m_format, region, buffer.subspan(bytesConsumed, region.size()));
+        bytesConsumed += region.size();
+    });
+
+    if (bytesConsumed < buffer.size()) {
+        // keep the device running with silence rather than provoking an xrun
+        const std::byte silence = m_format.sampleFormat() == QAudioFormat::UInt8
+                ? std::byte{ 0x80 }
+                : std::byte{ 0 };
+        std::fill(buffer.begin() + bytesConsumed, buffer.end(), silence);
+        raise(Event::Starved);
+    }
+
+    return snd_pcm_uframes_t(bytesConsumed / m_bytesPerFrame);
+}
+
+void QAlsaIOThread::consumeCapture(QSpan<std::byte> buffer) QT_MM_NONBLOCKING
+{
+    m_volume.apply(m_format, buffer);
+
+    if (m_captureCallback) {
+        QtMultimediaPrivate::invokeNonBlocking(m_captureCallback,
+                                               QSpan<const std::byte>{ buffer });
+        return;
+    }
+
+    // the application doesn't read fast enough: drop the captured data
+    if (m_ringBuffer.write(buffer) < buffer.size())
+        raise(Event::Starved);
+}
+
+void QAlsaIOThread::raise(Event event) QT_MM_NONBLOCKING
+{
+    m_events.fetch_or(uint(event), std::memory_order_relaxed);
+}
+
+QT_END_NAMESPACE
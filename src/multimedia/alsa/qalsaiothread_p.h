@@ -0,0 +1,132 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QALSAIOTHREAD_P_H
+#define QALSAIOTHREAD_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <alsa/asoundlib.h>
+
+#include <QtCore/qspan.h>
+#include <QtMultimedia/qaudioformat.h>
+#include <QtMultimedia/private/qaudio_rtsan_support_p.h>
+#include <QtMultimedia/private/qaudiohelpers_p.h>
+#include <QtMultimedia/private/qaudioringbuffer_p.h>
+#include <QtMultimedia/private/qaudiosystem_p.h>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+QT_BEGIN_NAMESPACE
+
+class QThread;
+
+// Transfers audio between an ALSA pcm and a lock-free ring buffer on a dedicated thread,
+// which blocks in snd_pcm_wait instead of being polled by a timer on the owner thread.
+// The owner thread exchanges data with the application through the ring buffer and polls
+// the events raised by the I/O thread.
+class Q_MULTIMEDIA_EXPORT QAlsaIOThread
+{
+public:
+    using RingBuffer = QtPrivate::QAudioRingBuffer<std::byte>;
+    using AudioCallback = QPlatformAudioSink::AudioCallback;
+    using CaptureCallback = QPlatformAudioSource::AudioCallback;
+
+    enum class Event : uint {
+        None = 0,
+        // playback: the ring buffer ran dry, capture: the ring buffer overflowed
+        Starved = 1 << 0,
+        Xrun = 1 << 1,
+        // the pcm couldn't be recovered, the thread has exited; see lastError()
+        Fatal = 1 << 2,
+    };
+
+    // Enabled if QT_ALSA_USE_IO_THREAD is set to 1; the callback mode uses the thread anyway
+    static bool isEnabled();
+
+    // handle has to be prepared; access is either SND_PCM_ACCESS_MMAP_INTERLEAVED or
+    // SND_PCM_ACCESS_RW_INTERLEAVED
+    QAlsaIOThread(snd_pcm_t *handle, snd_pcm_stream_t stream, snd_pcm_access_t access,
+                  const QAudioFormat &format, snd_pcm_uframes_t bufferFrames,
+                  unsigned int periodTimeUs);
+    ~QAlsaIOThread();
+
+    Q_DISABLE_COPY_MOVE(QAlsaIOThread)
+
+    RingBuffer &ringBuffer() { return m_ringBuffer; }
+
+    // playback only: the callback is invoked instead of reading from the ring buffer.
+    // Must not be called while the thread is running.
+    void setAudioCallback(AudioCallback callback);
+    // capture only: the callback is invoked instead of writing to the ring buffer.
+    // Must not be called while the thread is running.
+    void setCaptureCallback(CaptureCallback callback);
+
+    void start();
+    // blocks until the thread has exited
+    void stop();
+    // playback only: blocks until the thread has handed the ring buffer over to the device,
+    // at most for the duration of the buffered audio, then stops the thread
+    void drain();
+    bool isRunning() const;
+
+    void setVolume(float volume) { m_volume.setVolume(volume); }
+
+    // The audio frames handed over to the device or captured from it; the silence written
+    // while the playback ring buffer is starved doesn't count
+    qint64 framesTransferred() const { return m_framesTransferred.load(std::memory_order_relaxed); }
+
+    // returns and clears the events raised since the last call
+    uint takeEvents() { return m_events.exchange(0, std::memory_order_relaxed); }
+    // the ALSA error code that made the thread exit
+    int lastError() const { return m_lastError.load(std::memory_order_relaxed); }
+
+private:
+    void run();
+    bool recover(int err);
+    // return the frames transferred to or from the device, or an error code;
+    // audioFrames is set to the frames of audio among them
+    snd_pcm_sframes_t transferMmap(snd_pcm_uframes_t frames, snd_pcm_uframes_t &audioFrames);
+    snd_pcm_sframes_t transferReadWrite(snd_pcm_uframes_t frames, snd_pcm_uframes_t &audioFrames);
+
+    // returns the frames of audio, the rest of the buffer is filled with silence
+    snd_pcm_uframes_t fillPlayback(QSpan<std::byte> buffer) QT_MM_NONBLOCKING;
+    void consumeCapture(QSpan<std::byte> buffer) QT_MM_NONBLOCKING;
+    void raise(Event event) QT_MM_NONBLOCKING;
+
+    snd_pcm_t *const m_handle;
+    const snd_pcm_stream_t m_stream;
+    const bool m_mmap;
+    const QAudioFormat m_format;
+    const int m_bytesPerFrame;
+    const int m_waitTimeoutMs;
+
+    RingBuffer m_ringBuffer;
+    // scratch memory for snd_pcm_writei/snd_pcm_readi, allocated up front
+    std::vector<std::byte> m_transferBuffer;
+    AudioCallback m_audioCallback;
+    CaptureCallback m_captureCallback;
+
+    std::unique_ptr<QThread> m_thread;
+    std::atomic_bool m_stopRequested{ false };
+    std::atomic_bool m_drainRequested{ false };
+    QAudioHelperInternal::SmoothedVolume m_volume;
+    std::atomic<qint64> m_framesTransferred{ 0 };
+    std::atomic_uint m_events{ 0 };
+    std::atomic_int m_lastError{ 0 };
+};
+
+QT_END_NAMESPACE
+
+#endif // QALSAIOTHREAD_P_H
@@ -110,7 +110,7 @@ private:
         qint64 totalBytesRead = 0;
 
         while (!outputRegion.isEmpty()) {
-            int maxSizeToRead = outputRegion.size_bytes() / sizeof(SampleType);
+            qsizetype maxSizeToRead = outputRegion.size_bytes() / sizeof(SampleType);
             QSpan readRegion = m_ringbuffer->acquireReadRegion(maxSizeToRead);
             if (readRegion.isEmpty())
                 return totalBytesRead;
@@ -176,6 +176,60 @@ inline qint64 readFromDevice(QIODevice &device, QSpan<std::byte> outputBuffer)
     return device.read(reinterpret_cast<char *>(outputBuffer.data()), outputBuffer.size());
 }
 
+// Reads from the device straight into the free space of a byte ring buffer, in multiples of
+// alignment bytes (e.g. whole frames), until the device or the ring buffer is exhausted.
+// Returns the number of bytes read, or -1 if the device reported an error.
+template <typename T>
+qint64 fillRingBufferFromDevice(QIODevice &device, QAudioRingBuffer<T> &ringBuffer,
+                                qsizetype alignment = 1)
+{
+    static_assert(sizeof(T) == 1, "Only byte ring buffers are supported");
+
+    qint64 totalBytesRead = 0;
+    while (true) {
+        QSpan<T> region = ringBuffer.acquireWriteRegion(ringBuffer.free());
+        region = region.first(region.size() - region.size() % alignment);
+        if (region.isEmpty())
+            break;
+
+        const qint64 bytesRead = readFromDevice(device, as_writable_bytes(region));
+        if (bytesRead < 0)
+            return -1;
+
+        ringBuffer.releaseWriteRegion(bytesRead);
+        totalBytesRead += bytesRead;
+        if (bytesRead < region.size())
+            break;
+    }
+    return totalBytesRead;
+}
+
+// Writes the content of a byte ring buffer straight to the device, until the ring buffer is
+// empty or the device doesn't accept more data. Returns the number of bytes written, or -1 if
+// the device reported an error.
+template <typename T>
+qint64 drainRingBufferToDevice(QAudioRingBuffer<T> &ringBuffer, QIODevice &device)
+{
+    static_assert(sizeof(T) == 1, "Only byte ring buffers are supported");
+
+    qint64 totalBytesWritten = 0;
+    while (true) {
+        const QSpan<const T> region = ringBuffer.acquireReadRegion(ringBuffer.used());
+        if (region.isEmpty())
+            break;
+
+        const qint64 bytesWritten = writeToDevice(device, as_bytes(region));
+        if (bytesWritten < 0)
+            return -1;
+
+        ringBuffer.releaseReadRegion(bytesWritten);
+        totalBytesWritten += bytesWritten;
+        if (bytesWritten < region.size())
+            break;
+    }
+    return totalBytesWritten;
+}
+
 } // namespace QtPrivate
 
 QT_END_NAMESPACE
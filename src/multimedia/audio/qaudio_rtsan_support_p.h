@@ -15,11 +15,41 @@
 // We mean it.
 //
 
+#include <QtCore/qcompilerdetection.h>
+#include <QtCore/qtconfigmacros.h>
+
+#include <utility>
+
 // rtsan
 #if defined(__has_cpp_attribute) && __has_cpp_attribute(clang::nonblocking)
 #  define QT_MM_NONBLOCKING [[clang::nonblocking]]
+#  define QT_MM_HAS_NONBLOCKING
 #else
 #  define QT_MM_NONBLOCKING
 #endif
 
+QT_BEGIN_NAMESPACE
+
+namespace QtMultimediaPrivate {
+
+// Invokes a callable provided by the application, e.g. a std::function, from a
+// QT_MM_NONBLOCKING context. The compiler cannot verify such callables, however rtsan
+// still reports any blocking call they make at runtime.
+#ifdef QT_MM_HAS_NONBLOCKING
+QT_WARNING_PUSH
+QT_WARNING_DISABLE_CLANG("-Wfunction-effects")
+#endif
+template <typename Callable, typename... Args>
+void invokeNonBlocking(Callable &&callable, Args &&...args) QT_MM_NONBLOCKING
+{
+    std::forward<Callable>(callable)(std::forward<Args>(args)...);
+}
+#ifdef QT_MM_HAS_NONBLOCKING
+QT_WARNING_POP
+#endif
+
+} // namespace QtMultimediaPrivate
+
+QT_END_NAMESPACE
+
 #endif // QAUDIO_RTSAN_SUPPORT_P_H
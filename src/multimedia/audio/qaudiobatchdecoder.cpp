@@ -0,0 +1,268 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qaudiobatchdecoder_p.h"
+
+#include <QtCore/qloggingcategory.h>
+#include <QtCore/qthread.h>
+
+QT_BEGIN_NAMESPACE
+
+Q_STATIC_LOGGING_CATEGORY(qLcAudioBatchDecoder, "qt.multimedia.audiobatchdecoder");
+
+namespace {
+
+constexpr qint64 ReadChunkDurationUs = 200'000;
+
+} // namespace
+
+QAudioBatchDecoder::QAudioBatchDecoder(QObject *parent)
+    : QObject(parent), m_maxConcurrency(QThread::idealThreadCount())
+{
+    m_threadPool.setObjectName(QStringLiteral("QAudioBatchDecoder"));
+}
+
+QAudioBatchDecoder::~QAudioBatchDecoder()
+{
+    cancel();
+}
+
+void QAudioBatchDecoder::setMaxConcurrency(int concurrency)
+{
+    m_maxConcurrency = std::max(concurrency, 1);
+}
+
+void QAudioBatchDecoder::setMaxPendingBytes(qsizetype bytes)
+{
+    m_maxPendingBytes = std::max<qsizetype>(bytes, 0);
+}
+
+void QAudioBatchDecoder::setDeliveryOrder(DeliveryOrder order)
+{
+    m_deliveryOrder = order;
+}
+
+void QAudioBatchDecoder::setAudioFormat(const QAudioFormat &format)
+{
+    m_format = format;
+}
+
+void QAudioBatchDecoder::start(const QList<QUrl> &sources)
+{
+    cancel();
+
+    {
+        QMutexLocker locker(&m_mutex);
+        m_sourceCount = sources.size();
+        m_batchMaxPendingBytes = m_maxPendingBytes;
+        m_batchDeliveryOrder = m_deliveryOrder;
+        m_batchFormat = m_format;
+    }
+
+    if (sources.isEmpty()) {
+        emit finished();
+        return;
+    }
+
+    m_threadPool.setMaxThreadCount(m_maxConcurrency);
+
+    const quint64 batchId = m_batchId.load(std::memory_order_relaxed);
+    // the pool runs the tasks in the order they are started, so the source that has
+    // to be delivered next is always running or next in the queue
+    for (qsizetype i = 0; i < sources.size(); ++i) {
+        m_threadPool.start([this, i, source = sources[i], batchId] {
+            decode(i, source, batchId);
+        });
+    }
+}
+
+void QAudioBatchDecoder::cancel()
+{
+    {
+        QMutexLocker locker(&m_mutex);
+        m_batchId.fetch_add(1, std::memory_order_relaxed);
+        m_budgetAvailable.wakeAll();
+        m_resultAvailable.wakeAll();
+    }
+
+    m_threadPool.clear();
+    m_threadPool.waitForDone();
+
+    QMutexLocker locker(&m_mutex);
+    m_ready.clear();
+    m_outOfOrder.clear();
+    m_nextIndex = 0;
+    m_sourceCount = 0;
+    m_resultsTaken = 0;
+    m_pendingBytes = 0;
+}
+
+bool QAudioBatchDecoder::isRunning() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_resultsTaken < m_sourceCount;
+}
+
+std::optional<QAudioBatchDecoder::Result> QAudioBatchDecoder::takeResult()
+{
+    QMutexLocker locker(&m_mutex);
+    return takeResultLocked();
+}
+
+std::optional<QAudioBatchDecoder::Result>
+QAudioBatchDecoder::waitForResult(QDeadlineTimer deadline)
+{
+    QMutexLocker locker(&m_mutex);
+    const quint64 batchId = m_batchId.load(std::memory_order_relaxed);
+
+    while (m_ready.empty() && m_resultsTaken < m_sourceCount && !isCancelled(batchId)) {
+        if (!m_resultAvailable.wait(&m_mutex, deadline))
+            break;
+    }
+
+    return takeResultLocked();
+}
+
+std::optional<QAudioBatchDecoder::Result> QAudioBatchDecoder::takeResultLocked()
+{
+    if (m_ready.empty())
+        return std::nullopt;
+
+    Result result = std::move(m_ready.front());
+    m_ready.pop_front();
+    ++m_resultsTaken;
+
+    m_pendingBytes -= result.buffer.byteCount();
+    m_budgetAvailable.wakeAll();
+
+    return result;
+}
+
+bool QAudioBatchDecoder::isCancelled(quint64 batchId) const
+{
+    return m_batchId.load(std::memory_order_relaxed) != batchId;
+}
+
+void QAudioBatchDecoder::decode(qsizetype index, const QUrl &source, quint64 batchId)
+{
+    if (!waitForBudget(index, batchId))
+        return;
+
+    Result result = decodeSource(index, source, batchId);
+    if (isCancelled(batchId))
+        return;
+
+    addResult(std::move(result), batchId);
+}
+
+bool QAudioBatchDecoder::waitForBudget(qsizetype index, quint64 batchId)
+{
+    QMutexLocker locker(&m_mutex);
+
+    auto exceedsBudget = [&] {
+        if (m_pendingBytes == 0 || m_pendingBytes < m_batchMaxPendingBytes)
+            return false;
+        // the held back results can't be delivered before this one
+        return m_batchDeliveryOrder == DeliveryOrder::Completion || index != m_nextIndex;
+    };
+
+    while (!isCancelled(batchId) && exceedsBudget())
+        m_budgetAvailable.wait(&m_mutex);
+
+    return !isCancelled(batchId);
+}
+
+QAudioBatchDecoder::Result QAudioBatchDecoder::decodeSource(qsizetype index, const QUrl &source,
+                                                            quint64 batchId) const
+{
+    Result result;
+    result.index = index;
+    result.source = source;
+
+    // the decoder lives in the worker thread; the synchronous mode doesn't need its event loop
+    QAudioDecoder decoder;
+    decoder.setSource(source);
+    decoder.setAudioFormat(m_batchFormat);
+
+    auto setError = [&] {
+        result.error = decoder.error();
+        result.errorString = decoder.errorString();
+        qCDebug(qLcAudioBatchDecoder) << "Failed to decode" << source << result.errorString;
+    };
+
+    if (!decoder.startSynchronous()) {
+        setError();
+        return result;
+    }
+
+    const QAudioFormat format = decoder.audioFormat();
+    const qint64 duration = decoder.duration();
+
+    QByteArray data;
+    if (duration > 0)
+        data.reserve(format.bytesForDuration(duration * 1000));
+
+    const qsizetype chunkSize = format.bytesForDuration(ReadChunkDurationUs);
+
+    while (!isCancelled(batchId)) {
+        const qsizetype size = data.size();
+        data.resize(size + chunkSize);
+
+        const qint64 bytesRead = decoder.readInto(
+                QSpan<std::byte>{ reinterpret_cast<std::byte *>(data.data()) + size, chunkSize });
+        if (bytesRead < 0) {
+            setError();
+            return result;
+        }
+
+        data.resize(size + bytesRead);
+        if (bytesRead == 0)
+            break;
+    }
+
+    data.squeeze();
+    result.buffer = QAudioBuffer(data, format);
+    return result;
+}
+
+void QAudioBatchDecoder::addResult(Result result, quint64 batchId)
+{
+    bool allDecoded = false;
+
+    {
+        QMutexLocker locker(&m_mutex);
+        if (isCancelled(batchId))
+            return;
+
+        m_pendingBytes += result.buffer.byteCount();
+
+        if (m_batchDeliveryOrder == DeliveryOrder::Completion) {
+            m_ready.push_back(std::move(result));
+        } else {
+            const qsizetype index = result.index;
+            m_outOfOrder.emplace(index, std::move(result));
+
+            auto it = m_outOfOrder.begin();
+            while (it != m_outOfOrder.end() && it->first == m_nextIndex) {
+                m_ready.push_back(std::move(it->second));
+                it = m_outOfOrder.erase(it);
+                ++m_nextIndex;
+            }
+
+            // the worker of the next index may be waiting for the budget
+            m_budgetAvailable.wakeAll();
+        }
+
+        m_resultAvailable.wakeAll();
+        allDecoded = m_outOfOrder.empty()
+                && m_resultsTaken + qsizetype(m_ready.size()) == m_sourceCount;
+    }
+
+    emit resultReady();
+    if (allDecoded)
+        emit finished();
+}
+
+QT_END_NAMESPACE
+
+#include "moc_qaudiobatchdecoder_p.cpp"
@@ -0,0 +1,136 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QAUDIOBATCHDECODER_P_H
+#define QAUDIOBATCHDECODER_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/qdeadlinetimer.h>
+#include <QtCore/qmutex.h>
+#include <QtCore/qobject.h>
+#include <QtCore/qthreadpool.h>
+#include <QtCore/qurl.h>
+#include <QtCore/qwaitcondition.h>
+#include <QtMultimedia/qaudiobuffer.h>
+#include <QtMultimedia/qaudiodecoder.h>
+#include <QtMultimedia/qtmultimediaexports.h>
+
+#include <atomic>
+#include <deque>
+#include <map>
+#include <optional>
+
+QT_BEGIN_NAMESPACE
+
+// Decodes a list of sources concurrently on a dedicated thread pool, using the
+// synchronous mode of QAudioDecoder, so that no event loop is needed per decoder.
+//
+// Results can be taken from any thread, either after resultReady() has been emitted
+// or by blocking in waitForResult(). Decoding of new sources is held back while the
+// decoded data that hasn't been taken exceeds maxPendingBytes().
+class Q_MULTIMEDIA_EXPORT QAudioBatchDecoder : public QObject
+{
+    Q_OBJECT
+public:
+    enum class DeliveryOrder {
+        // results are delivered as soon as they are decoded
+        Completion,
+        // results are delivered in the order of the sources
+        Submission,
+    };
+
+    struct Result
+    {
+        // index of the source in the list passed to start()
+        qsizetype index = -1;
+        QUrl source;
+        // the whole decoded source, invalid on error
+        QAudioBuffer buffer;
+        QAudioDecoder::Error error = QAudioDecoder::NoError;
+        QString errorString;
+    };
+
+    explicit QAudioBatchDecoder(QObject *parent = nullptr);
+    // cancels the batch and waits for the workers
+    ~QAudioBatchDecoder() override;
+
+    // the settings apply to the next call of start()
+    void setMaxConcurrency(int concurrency);
+    int maxConcurrency() const { return m_maxConcurrency; }
+
+    void setMaxPendingBytes(qsizetype bytes);
+    qsizetype maxPendingBytes() const { return m_maxPendingBytes; }
+
+    void setDeliveryOrder(DeliveryOrder order);
+    DeliveryOrder deliveryOrder() const { return m_deliveryOrder; }
+
+    // an invalid format keeps the native format of each source
+    void setAudioFormat(const QAudioFormat &format);
+    QAudioFormat audioFormat() const { return m_format; }
+
+    // cancels the running batch, if any
+    void start(const QList<QUrl> &sources);
+    // drops the results that haven't been taken and waits for the workers
+    void cancel();
+
+    // true until the results of all sources have been taken
+    bool isRunning() const;
+
+    std::optional<Result> takeResult();
+    // blocks until a result is available, the batch is done, or the deadline expires
+    std::optional<Result> waitForResult(QDeadlineTimer deadline = QDeadlineTimer::Forever);
+
+Q_SIGNALS:
+    // emitted from the worker threads
+    void resultReady();
+    void finished();
+
+private:
+    void decode(qsizetype index, const QUrl &source, quint64 batchId);
+    Result decodeSource(qsizetype index, const QUrl &source, quint64 batchId) const;
+    bool waitForBudget(qsizetype index, quint64 batchId);
+    void addResult(Result result, quint64 batchId);
+    std::optional<Result> takeResultLocked();
+    bool isCancelled(quint64 batchId) const;
+
+    int m_maxConcurrency;
+    qsizetype m_maxPendingBytes = 64 * 1024 * 1024;
+    DeliveryOrder m_deliveryOrder = DeliveryOrder::Completion;
+    QAudioFormat m_format;
+
+    QThreadPool m_threadPool;
+
+    // incremented by cancel(), lets the workers of a cancelled batch bail out
+    std::atomic<quint64> m_batchId{ 0 };
+
+    mutable QMutex m_mutex;
+    QWaitCondition m_resultAvailable;
+    QWaitCondition m_budgetAvailable;
+    // results ready to be taken
+    std::deque<Result> m_ready;
+    // Submission order: results waiting for their predecessors
+    std::map<qsizetype, Result> m_outOfOrder;
+    // the settings of the running batch
+    qsizetype m_batchMaxPendingBytes = 0;
+    DeliveryOrder m_batchDeliveryOrder = DeliveryOrder::Completion;
+    QAudioFormat m_batchFormat;
+    qsizetype m_nextIndex = 0;
+    qsizetype m_sourceCount = 0;
+    qsizetype m_resultsTaken = 0;
+    // bytes of the decoded results that haven't been taken
+    qsizetype m_pendingBytes = 0;
+};
+
+QT_END_NAMESPACE
+
+#endif // QAUDIOBATCHDECODER_P_H
@@ -125,6 +125,87 @@ void QAudioDecoder::start()
     d->decoder->start();
 }
 
+/*!
+    \since 6.10
+
+    Prepares the decoder for synchronous decoding of the part of the audio
+    resource between \a from and \a to, in milliseconds. A negative \a to
+    decodes up to the end of the resource.
+
+    In this mode, no signals are emitted when data gets decoded, and no
+    event loop is required. Instead, the decoded data is pulled with
+    \l readInto(), which blocks until the given buffer is filled
+    or the end of the range is reached. \l seek() changes the read position
+    within the range. This is convenient for batch processing, such as
+    analyzing or transcoding many files from worker threads.
+
+    The format of the decoded data, the read position and the duration of the
+    resource are not signaled either; they are returned by \l audioFormat(),
+    \l position() and \l duration().
+
+    Returns \c true on success. Otherwise, returns \c false and sets
+    \l error(); \l NotSupportedError is set if the backend doesn't support
+    synchronous decoding. Calling \l stop() ends synchronous decoding.
+
+    \sa readInto(), seek()
+*/
+bool QAudioDecoder::startSynchronous(qint64 from, qint64 to)
+{
+    Q_D(QAudioDecoder);
+
+    if (!d->decoder)
+        return false;
+
+    d->decoder->clearError();
+    if (d->decoder->startSynchronous(from, to))
+        return true;
+
+    if (d->decoder->error() == NoError)
+        d->decoder->error(NotSupportedError,
+                          tr("Synchronous decoding is not supported by the backend"));
+    return false;
+}
+
+/*!
+    \since 6.10
+
+    Decodes audio data into \a data, after \l startSynchronous() has been
+    called. The data is in \l audioFormat(), which reports the native format
+    of the resource in synchronous mode if no format has been set; only whole
+    frames are written.
+
+    Blocks until \a data is filled, and returns the number of bytes written.
+    Fewer bytes are written only at the end of the range; once it's reached,
+    returns 0. Returns -1 on failure, or if synchronous decoding hasn't been
+    started.
+
+    \sa startSynchronous(), seek()
+*/
+qint64 QAudioDecoder::readInto(QSpan<std::byte> data)
+{
+    Q_D(QAudioDecoder);
+    return d->decoder ? d->decoder->readSynchronous(data) : -1;
+}
+
+/*!
+    \since 6.10
+
+    Moves the read position of synchronous decoding to \a position, in
+    milliseconds. The position is clamped to the range passed to
+    \l startSynchronous(). The next \l readInto() returns the
+    data starting at \a position.
+
+    Returns \c true on success, or \c false if the resource is not seekable
+    or synchronous decoding hasn't been started.
+
+    \sa startSynchronous()
+*/
+bool QAudioDecoder::seek(qint64 position)
+{
+    Q_D(QAudioDecoder);
+    return d->decoder && d->decoder->seekSynchronous(position);
+}
+
 /*!
     Stop decoding audio.  Calling \l start() again will resume decoding from the beginning.
 */
@@ -257,6 +338,9 @@ bool QAudioDecoder::bufferAvailable() const
 /*!
     Returns position (in milliseconds) of the last buffer read from
     the decoder or -1 if no buffers have been read.
+
+    In synchronous mode, returns the position of the data returned by the
+    next call to \l readInto().
 */
 
 qint64 QAudioDecoder::position() const
@@ -5,6 +5,7 @@
 #define QAUDIODECODER_H
 
 #include <QtCore/qobject.h>
+#include <QtCore/qspan.h>
 #include <QtMultimedia/qaudiobuffer.h>
 
 QT_BEGIN_NAMESPACE
@@ -53,6 +54,10 @@ public:
     qint64 position() const;
     qint64 duration() const;
 
+    bool startSynchronous(qint64 from = 0, qint64 to = -1);
+    qint64 readInto(QSpan<std::byte> data);
+    bool seek(qint64 position);
+
 public Q_SLOTS:
     void start();
     void stop();
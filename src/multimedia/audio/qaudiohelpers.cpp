@@ -3,8 +3,18 @@
 
 #include "qaudiohelpers_p.h"
 
+#include <QtCore/private/qsimd_p.h>
+
+#include <algorithm>
+#include <cmath>
 #include <limits>
 
+#if defined(__SSE2__)
+#  define QT_MM_AUDIO_SSE2
+#elif defined(__ARM_NEON) && defined(Q_PROCESSOR_ARM_64)
+#  define QT_MM_AUDIO_NEON
+#endif
+
 QT_BEGIN_NAMESPACE
 
 namespace QAudioHelperInternal
@@ -23,7 +33,10 @@ namespace {
 template<class T>
 inline T applyVolumeOnSample(T sample, float factor)
 {
-    if constexpr (std::is_signed_v<T>) {
+    if constexpr (std::is_same_v<T, qint32>) {
+        // a float has too few mantissa bits for 32-bit samples
+        return T(double(sample) * factor);
+    } else if constexpr (std::is_signed_v<T>) {
         return sample * factor;
     } else {
         using SignedT = std::make_signed_t<T>;
@@ -46,6 +59,241 @@ void adjustSamples(float factor,
         pDst[i] = applyVolumeOnSample(pSrc[i], factor);
 }
 
+template<class T>
+void adjustSamplesInPlace(float factor, void *buffer, int samples)
+{
+    T *pBuffer = (T *)buffer;
+
+    for (int i = 0; i < samples; i++)
+        pBuffer[i] = applyVolumeOnSample(pBuffer[i], factor);
+}
+
+// Integer samples are processed as floats, in chunks of this size on the stack
+constexpr qsizetype ChunkSamples = 512;
+
+template <typename T>
+inline float sampleToFloat(T sample)
+{
+    if constexpr (std::is_same_v<T, float>)
+        return sample;
+    else if constexpr (std::is_same_v<T, quint8>)
+        return (int(sample) - 0x80) * (1.f / 0x80);
+    else if constexpr (std::is_same_v<T, qint16>)
+        return sample * (1.f / 0x8000);
+    else
+        return float(sample * (1. / 0x80000000));
+}
+
+template <typename T>
+inline T sampleFromFloat(float sample)
+{
+    // rounds to nearest, like the vectorized conversions
+    if constexpr (std::is_same_v<T, float>) {
+        return sample;
+    } else if constexpr (std::is_same_v<T, quint8>) {
+        return T(std::lrint(std::clamp(sample * 0x80, -128.f, 127.f)) + 0x80);
+    } else if constexpr (std::is_same_v<T, qint16>) {
+        return T(std::lrint(std::clamp(sample * 0x8000, -32768.f, 32767.f)));
+    } else {
+        return T(std::llrint(std::clamp(double(sample) * 0x80000000, -2147483648., 2147483647.)));
+    }
+}
+
+void int16ToFloat(const qint16 *QT_MM_RESTRICT src, float *QT_MM_RESTRICT dst, qsizetype count)
+{
+    qsizetype i = 0;
+#if defined(QT_MM_AUDIO_SSE2)
+    const __m128 scale = _mm_set1_ps(1.f / 0x8000);
+    for (; i + 8 <= count; i += 8) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+        // sign extend by unpacking into the upper halves and shifting back
+        const __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16);
+        const __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(v, v), 16);
+        _mm_storeu_ps(dst + i, _mm_mul_ps(_mm_cvtepi32_ps(lo), scale));
+        _mm_storeu_ps(dst + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(hi), scale));
+    }
+#elif defined(QT_MM_AUDIO_NEON)
+    const float32x4_t scale = vdupq_n_f32(1.f / 0x8000);
+    for (; i + 8 <= count; i += 8) {
+        const int16x8_t v = vld1q_s16(src + i);
+        vst1q_f32(dst + i, vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(v))), scale));
+        vst1q_f32(dst + i + 4, vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(v))), scale));
+    }
+#endif
+    for (; i < count; ++i)
+        dst[i] = sampleToFloat(src[i]);
+}
+
+void floatToInt16(const float *QT_MM_RESTRICT src, qint16 *QT_MM_RESTRICT dst, qsizetype count)
+{
+    qsizetype i = 0;
+#if defined(QT_MM_AUDIO_SSE2)
+    const __m128 scale = _mm_set1_ps(0x8000);
+    const __m128 minValue = _mm_set1_ps(-32768.f);
+    const __m128 maxValue = _mm_set1_ps(32767.f);
+    auto convert = [&](const float *p) {
+        // clamp before the conversion, which yields INT_MIN for out of range values
+        const __m128 v = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(p), scale), minValue),
+                                    maxValue);
+        return _mm_cvtps_epi32(v);
+    };
+    for (; i + 8 <= count; i += 8) {
+        const __m128i packed = _mm_packs_epi32(convert(src + i), convert(src + i + 4));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), packed);
+    }
+#elif defined(QT_MM_AUDIO_NEON)
+    const float32x4_t scale = vdupq_n_f32(0x8000);
+    for (; i + 8 <= count; i += 8) {
+        // the conversion and the narrowing saturate
+        const int32x4_t lo = vcvtnq_s32_f32(vmulq_f32(vld1q_f32(src + i), scale));
+        const int32x4_t hi = vcvtnq_s32_f32(vmulq_f32(vld1q_f32(src + i + 4), scale));
+        vst1q_s16(dst + i, vcombine_s16(vqmovn_s32(lo), vqmovn_s32(hi)));
+    }
+#endif
+    for (; i < count; ++i)
+        dst[i] = sampleFromFloat<qint16>(src[i]);
+}
+
+template <typename T>
+void toFloat(const T *src, float *dst, qsizetype count)
+{
+    if constexpr (std::is_same_v<T, qint16>) {
+        int16ToFloat(src, dst, count);
+    } else {
+        for (qsizetype i = 0; i < count; ++i)
+            dst[i] = sampleToFloat(src[i]);
+    }
+}
+
+template <typename T>
+void fromFloat(const float *src, T *dst, qsizetype count)
+{
+    if constexpr (std::is_same_v<T, qint16>) {
+        floatToInt16(src, dst, count);
+    } else {
+        for (qsizetype i = 0; i < count; ++i)
+            dst[i] = sampleFromFloat<T>(src[i]);
+    }
+}
+
+// dst += src * gain
+void accumulate(const float *QT_MM_RESTRICT src, float *QT_MM_RESTRICT dst, qsizetype count,
+                float gain)
+{
+    qsizetype i = 0;
+#if defined(QT_MM_AUDIO_SSE2)
+    const __m128 g = _mm_set1_ps(gain);
+    for (; i + 4 <= count; i += 4) {
+        const __m128 sum = _mm_add_ps(_mm_loadu_ps(dst + i), _mm_mul_ps(_mm_loadu_ps(src + i), g));
+        _mm_storeu_ps(dst + i, sum);
+    }
+#elif defined(QT_MM_AUDIO_NEON)
+    const float32x4_t g = vdupq_n_f32(gain);
+    for (; i + 4 <= count; i += 4)
+        vst1q_f32(dst + i, vmlaq_f32(vld1q_f32(dst + i), vld1q_f32(src + i), g));
+#endif
+    for (; i < count; ++i)
+        dst[i] += src[i] * gain;
+}
+
+// dst = src * (startGain + frame * step), frame counted from firstFrame
+void ramp(const float *src, float *dst, qsizetype frames, int channelCount, float startGain,
+          float step, qsizetype firstFrame)
+{
+    for (qsizetype frame = 0; frame < frames; ++frame) {
+        const float gain = startGain + step * float(firstFrame + frame);
+        for (int channel = 0; channel < channelCount; ++channel, ++src, ++dst)
+            *dst = *src * gain;
+    }
+}
+
+void int16SaturatingAdd(const qint16 *QT_MM_RESTRICT src, qint16 *QT_MM_RESTRICT dst,
+                        qsizetype count)
+{
+    qsizetype i = 0;
+#if defined(QT_MM_AUDIO_SSE2)
+    for (; i + 8 <= count; i += 8) {
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(dst + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm_adds_epi16(a, b));
+    }
+#elif defined(QT_MM_AUDIO_NEON)
+    for (; i + 8 <= count; i += 8)
+        vst1q_s16(dst + i, vqaddq_s16(vld1q_s16(src + i), vld1q_s16(dst + i)));
+#endif
+    for (; i < count; ++i)
+        dst[i] = qint16(std::clamp(int(src[i]) + int(dst[i]), -32768, 32767));
+}
+
+// A float keeps only 24 bits of 32-bit samples, so they are mixed in 64-bit integers and
+// scaled as doubles instead
+inline qint32 saturateToInt32(qint64 sample)
+{
+    return qint32(std::clamp<qint64>(sample, std::numeric_limits<qint32>::min(),
+                                     std::numeric_limits<qint32>::max()));
+}
+
+// dst = saturate(dst + src * gain)
+void int32Accumulate(const qint32 *QT_MM_RESTRICT src, qint32 *QT_MM_RESTRICT dst,
+                     qsizetype count, float gain)
+{
+    if (gain == 1.f) {
+        for (qsizetype i = 0; i < count; ++i)
+            dst[i] = saturateToInt32(qint64(dst[i]) + src[i]);
+        return;
+    }
+
+    const double g = gain;
+    for (qsizetype i = 0; i < count; ++i)
+        dst[i] = saturateToInt32(qint64(dst[i]) + std::llrint(src[i] * g));
+}
+
+// dst = saturate(src * (startGain + frame * step))
+void int32Ramp(const qint32 *src, qint32 *dst, qsizetype frames, int channelCount,
+               double startGain, double step)
+{
+    for (qsizetype frame = 0; frame < frames; ++frame) {
+        const double gain = startGain + step * double(frame);
+        for (int channel = 0; channel < channelCount; ++channel, ++src, ++dst)
+            *dst = saturateToInt32(std::llrint(*src * gain));
+    }
+}
+
+// Calls f with a value of the sample type of the format
+template <typename Functor>
+void dispatchSampleType(QAudioFormat::SampleFormat format, Functor &&f)
+{
+    switch (format) {
+    case QAudioFormat::UInt8:
+        return f(quint8{});
+    case QAudioFormat::Int16:
+        return f(qint16{});
+    case QAudioFormat::Int32:
+        return f(qint32{});
+    case QAudioFormat::Float:
+        return f(float{});
+    default:
+        Q_UNREACHABLE_RETURN();
+    }
+}
+
+std::byte silenceFor(QAudioFormat::SampleFormat format)
+{
+    return format == QAudioFormat::UInt8 ? std::byte{ 0x80 } : std::byte{ 0 };
+}
+
+template <typename T>
+const T *typedData(QSpan<const std::byte> span)
+{
+    return reinterpret_cast<const T *>(span.data());
+}
+
+template <typename T>
+T *typedData(QSpan<std::byte> span)
+{
+    return reinterpret_cast<T *>(span.data());
+}
+
 } // namespace
 
 void qMultiplySamples(float factor,
@@ -95,8 +343,339 @@ void applyVolume(float volume,
     }
 }
 
+void applyVolume(float volume, const QAudioFormat &format, QSpan<std::byte> buffer) QT_MM_NONBLOCKING
+{
+    if (Q_LIKELY(volume == 1.f))
+        return;
+
+    if (volume == 0) {
+        std::byte zero =
+                format.sampleFormat() == QAudioFormat::UInt8 ? std::byte{ 0x80 } : std::byte{ 0 };
+
+        std::fill(buffer.begin(), buffer.end(), zero);
+        return;
+    }
+
+    const int samplesCount = buffer.size() / qMax(1, format.bytesPerSample());
+    const float factor = std::clamp(volume, 0.f, 1.f);
+
+    switch (format.sampleFormat()) {
+    case QAudioFormat::UInt8:
+        return adjustSamplesInPlace<quint8>(factor, buffer.data(), samplesCount);
+    case QAudioFormat::Int16:
+        return adjustSamplesInPlace<qint16>(factor, buffer.data(), samplesCount);
+    case QAudioFormat::Int32:
+        return adjustSamplesInPlace<qint32>(factor, buffer.data(), samplesCount);
+    case QAudioFormat::Float:
+        return adjustSamplesInPlace<float>(volume, buffer.data(), samplesCount);
+    default:
+        Q_UNREACHABLE_RETURN();
+    }
+}
+
+void applyVolumeRamp(float startVolume, float endVolume, const QAudioFormat &format,
+                     QSpan<const std::byte> source, QSpan<std::byte> destination) QT_MM_NONBLOCKING
+{
+    Q_ASSERT(source.size() == destination.size());
+
+    const int bytesPerFrame = format.bytesPerFrame();
+    if (bytesPerFrame <= 0)
+        return;
+
+    const int channelCount = format.channelCount();
+    const qsizetype frameCount = source.size() / bytesPerFrame;
+    if (frameCount == 0)
+        return;
+
+    const float step = (endVolume - startVolume) / float(frameCount);
+
+    dispatchSampleType(format.sampleFormat(), [&](auto sample) {
+        using T = decltype(sample);
+        const T *src = typedData<T>(source);
+        T *dst = typedData<T>(destination);
+
+        if constexpr (std::is_same_v<T, float>) {
+            ramp(src, dst, frameCount, channelCount, startVolume, step, 0);
+        } else if constexpr (std::is_same_v<T, qint32>) {
+            int32Ramp(src, dst, frameCount, channelCount, startVolume,
+                      (double(endVolume) - startVolume) / double(frameCount));
+        } else {
+            float chunk[ChunkSamples];
+            const qsizetype chunkFrames = std::max<qsizetype>(ChunkSamples / channelCount, 1);
+            Q_ASSERT(chunkFrames * channelCount <= ChunkSamples);
+
+            for (qsizetype frame = 0; frame < frameCount; frame += chunkFrames) {
+                const qsizetype frames = std::min(chunkFrames, frameCount - frame);
+                const qsizetype offset = frame * channelCount;
+                const qsizetype count = frames * channelCount;
+                toFloat(src + offset, chunk, count);
+                ramp(chunk, chunk, frames, channelCount, startVolume, step, frame);
+                fromFloat(chunk, dst + offset, count);
+            }
+        }
+    });
+}
+
+void applyVolumeRamp(float startVolume, float endVolume, const QAudioFormat &format,
+                     QSpan<std::byte> buffer) QT_MM_NONBLOCKING
+{
+    // the kernels read each sample before writing it
+    applyVolumeRamp(startVolume, endVolume, format, QSpan<const std::byte>{ buffer }, buffer);
+}
+
+void SmoothedVolume::apply(const QAudioFormat &format, QSpan<const std::byte> source,
+                           QSpan<std::byte> destination) QT_MM_NONBLOCKING
+{
+    const float target = volume();
+    const int bytesPerFrame = format.bytesPerFrame();
+
+    if (m_current == target || bytesPerFrame <= 0) {
+        applyVolume(target, format, source, destination);
+        return;
+    }
+
+    const qsizetype frames = source.size() / bytesPerFrame;
+    const qsizetype rampBytes =
+            std::min<qsizetype>(frames, format.framesForDuration(RampDurationUs)) * bytesPerFrame;
+
+    applyVolumeRamp(m_current, target, format, source.first(rampBytes),
+                    destination.first(rampBytes));
+    applyVolume(target, format, source.subspan(rampBytes), destination.subspan(rampBytes));
+    m_current = target;
+}
+
+void SmoothedVolume::apply(const QAudioFormat &format, QSpan<std::byte> buffer) QT_MM_NONBLOCKING
+{
+    const float target = volume();
+    const int bytesPerFrame = format.bytesPerFrame();
+
+    if (m_current == target || bytesPerFrame <= 0) {
+        applyVolume(target, format, buffer);
+        return;
+    }
+
+    const qsizetype frames = buffer.size() / bytesPerFrame;
+    const qsizetype rampBytes =
+            std::min<qsizetype>(frames, format.framesForDuration(RampDurationUs)) * bytesPerFrame;
+
+    applyVolumeRamp(m_current, target, format, buffer.first(rampBytes));
+    applyVolume(target, format, buffer.subspan(rampBytes));
+    m_current = target;
+}
+
+void convertSamples(QSpan<const std::byte> source, QAudioFormat::SampleFormat sourceFormat,
+                    QSpan<std::byte> destination,
+                    QAudioFormat::SampleFormat destinationFormat) QT_MM_NONBLOCKING
+{
+    if (sourceFormat == destinationFormat) {
+        Q_ASSERT(destination.size() >= source.size());
+        std::copy(source.begin(), source.end(), destination.begin());
+        return;
+    }
+
+    dispatchSampleType(sourceFormat, [&](auto sourceSample) {
+        using S = decltype(sourceSample);
+        dispatchSampleType(destinationFormat, [&](auto destinationSample) {
+            using D = decltype(destinationSample);
+
+            const qsizetype count = source.size() / qsizetype(sizeof(S));
+            Q_ASSERT(destination.size() >= count * qsizetype(sizeof(D)));
+            const S *src = typedData<S>(source);
+            D *dst = typedData<D>(destination);
+
+            if constexpr (std::is_same_v<S, float>) {
+                fromFloat(src, dst, count);
+            } else if constexpr (std::is_same_v<D, float>) {
+                toFloat(src, dst, count);
+            } else {
+                float chunk[ChunkSamples];
+                for (qsizetype i = 0; i < count; i += ChunkSamples) {
+                    const qsizetype n = std::min(ChunkSamples, count - i);
+                    toFloat(src + i, chunk, n);
+                    fromFloat(chunk, dst + i, n);
+                }
+            }
+        });
+    });
+}
+
+void convertSamples(QSpan<const qint16> source, QSpan<float> destination) QT_MM_NONBLOCKING
+{
+    Q_ASSERT(destination.size() >= source.size());
+    int16ToFloat(source.data(), destination.data(), source.size());
+}
+
+void convertSamples(QSpan<const float> source, QSpan<qint16> destination) QT_MM_NONBLOCKING
+{
+    Q_ASSERT(destination.size() >= source.size());
+    floatToInt16(source.data(), destination.data(), source.size());
+}
+
+void deinterleave(QSpan<const float> interleaved, QSpan<float *const> channels) QT_MM_NONBLOCKING
+{
+    const qsizetype channelCount = channels.size();
+    if (channelCount == 0)
+        return;
+
+    const qsizetype frameCount = interleaved.size() / channelCount;
+    const float *src = interleaved.data();
+    qsizetype frame = 0;
+
+    if (channelCount == 2) {
+        float *left = channels[0];
+        float *right = channels[1];
+#if defined(QT_MM_AUDIO_SSE2)
+        for (; frame + 4 <= frameCount; frame += 4) {
+            const __m128 a = _mm_loadu_ps(src + frame * 2);
+            const __m128 b = _mm_loadu_ps(src + frame * 2 + 4);
+            _mm_storeu_ps(left + frame, _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)));
+            _mm_storeu_ps(right + frame, _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+        }
+#elif defined(QT_MM_AUDIO_NEON)
+        for (; frame + 4 <= frameCount; frame += 4) {
+            const float32x4x2_t v = vld2q_f32(src + frame * 2);
+            vst1q_f32(left + frame, v.val[0]);
+            vst1q_f32(right + frame, v.val[1]);
+        }
+#endif
+        for (; frame < frameCount; ++frame) {
+            left[frame] = src[frame * 2];
+            right[frame] = src[frame * 2 + 1];
+        }
+        return;
+    }
+
+    for (; frame < frameCount; ++frame) {
+        for (qsizetype channel = 0; channel < channelCount; ++channel)
+            channels[channel][frame] = *src++;
+    }
+}
+
+void interleave(QSpan<const float *const> channels, QSpan<float> interleaved) QT_MM_NONBLOCKING
+{
+    const qsizetype channelCount = channels.size();
+    if (channelCount == 0)
+        return;
+
+    const qsizetype frameCount = interleaved.size() / channelCount;
+    float *dst = interleaved.data();
+    qsizetype frame = 0;
+
+    if (channelCount == 2) {
+        const float *left = channels[0];
+        const float *right = channels[1];
+#if defined(QT_MM_AUDIO_SSE2)
+        for (; frame + 4 <= frameCount; frame += 4) {
+            const __m128 l = _mm_loadu_ps(left + frame);
+            const __m128 r = _mm_loadu_ps(right + frame);
+            _mm_storeu_ps(dst + frame * 2, _mm_unpacklo_ps(l, r));
+            _mm_storeu_ps(dst + frame * 2 + 4, _mm_unpackhi_ps(l, r));
+        }
+#elif defined(QT_MM_AUDIO_NEON)
+        for (; frame + 4 <= frameCount; frame += 4)
+            vst2q_f32(dst + frame * 2, float32x4x2_t{ { vld1q_f32(left + frame),
+                                                        vld1q_f32(right + frame) } });
+#endif
+        for (; frame < frameCount; ++frame) {
+            dst[frame * 2] = left[frame];
+            dst[frame * 2 + 1] = right[frame];
+        }
+        return;
+    }
+
+    for (; frame < frameCount; ++frame) {
+        for (qsizetype channel = 0; channel < channelCount; ++channel)
+            *dst++ = channels[channel][frame];
+    }
+}
+
+void mixAccumulate(const QAudioFormat &format, QSpan<const std::byte> source,
+                   QSpan<std::byte> destination, float gain) QT_MM_NONBLOCKING
+{
+    Q_ASSERT(source.size() == destination.size());
+
+    dispatchSampleType(format.sampleFormat(), [&](auto sample) {
+        using T = decltype(sample);
+        const qsizetype count = source.size() / qsizetype(sizeof(T));
+        const T *src = typedData<T>(source);
+        T *dst = typedData<T>(destination);
+
+        if constexpr (std::is_same_v<T, float>) {
+            accumulate(src, dst, count, gain);
+        } else if constexpr (std::is_same_v<T, qint32>) {
+            int32Accumulate(src, dst, count, gain);
+        } else {
+            if constexpr (std::is_same_v<T, qint16>) {
+                if (gain == 1.f)
+                    return int16SaturatingAdd(src, dst, count);
+            }
+
+            float sourceChunk[ChunkSamples];
+            float destinationChunk[ChunkSamples];
+            for (qsizetype i = 0; i < count; i += ChunkSamples) {
+                const qsizetype n = std::min(ChunkSamples, count - i);
+                toFloat(src + i, sourceChunk, n);
+                toFloat(dst + i, destinationChunk, n);
+                accumulate(sourceChunk, destinationChunk, n, gain);
+                fromFloat(destinationChunk, dst + i, n);
+            }
+        }
+    });
+}
+
+void mix(const QAudioFormat &format, QSpan<const QSpan<const std::byte>> sources,
+         QSpan<std::byte> destination) QT_MM_NONBLOCKING
+{
+    if (sources.empty()) {
+        std::fill(destination.begin(), destination.end(), silenceFor(format.sampleFormat()));
+        return;
+    }
+
+    dispatchSampleType(format.sampleFormat(), [&](auto sample) {
+        using T = decltype(sample);
+        const qsizetype count = destination.size() / qsizetype(sizeof(T));
+        T *dst = typedData<T>(destination);
+
+        if constexpr (std::is_same_v<T, float>) {
+            std::copy_n(typedData<float>(sources[0]), count, dst);
+            for (QSpan<const std::byte> source : sources.subspan(1)) {
+                Q_ASSERT(source.size() == destination.size());
+                accumulate(typedData<float>(source), dst, count, 1.f);
+            }
+        } else if constexpr (std::is_same_v<T, qint32>) {
+            qint64 sum[ChunkSamples];
+            for (qsizetype i = 0; i < count; i += ChunkSamples) {
+                const qsizetype n = std::min(ChunkSamples, count - i);
+                std::copy_n(typedData<qint32>(sources[0]) + i, n, sum);
+                for (QSpan<const std::byte> source : sources.subspan(1)) {
+                    Q_ASSERT(source.size() == destination.size());
+                    const qint32 *src = typedData<qint32>(source) + i;
+                    for (qsizetype j = 0; j < n; ++j)
+                        sum[j] += src[j];
+                }
+                std::transform(sum, sum + n, dst + i, saturateToInt32);
+            }
+        } else {
+            float sum[ChunkSamples];
+            float chunk[ChunkSamples];
+            for (qsizetype i = 0; i < count; i += ChunkSamples) {
+                const qsizetype n = std::min(ChunkSamples, count - i);
+                toFloat(typedData<T>(sources[0]) + i, sum, n);
+                for (QSpan<const std::byte> source : sources.subspan(1)) {
+                    Q_ASSERT(source.size() == destination.size());
+                    toFloat(typedData<T>(source) + i, chunk, n);
+                    accumulate(chunk, sum, n, 1.f);
+                }
+                fromFloat(sum, dst + i, n);
+            }
+        }
+    });
+}
+
 } // namespace QAudioHelperInternal
 
 #undef QT_MM_RESTRICT
+#undef QT_MM_AUDIO_SSE2
+#undef QT_MM_AUDIO_NEON
 
 QT_END_NAMESPACE
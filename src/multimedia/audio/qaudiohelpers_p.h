@@ -20,6 +20,8 @@
 #include <QtMultimedia/private/qtmultimediaglobal_p.h>
 #include <QtMultimedia/private/qaudio_rtsan_support_p.h>
 
+#include <atomic>
+
 QT_BEGIN_NAMESPACE
 
 namespace QAudioHelperInternal {
@@ -35,6 +37,75 @@ void applyVolume(float volume,
                  QSpan<const std::byte> source,
                  QSpan<std::byte> destination) QT_MM_NONBLOCKING;
 
+// in-place variant, e.g. for buffers filled by an application callback
+Q_MULTIMEDIA_EXPORT
+void applyVolume(float volume, const QAudioFormat &, QSpan<std::byte> buffer) QT_MM_NONBLOCKING;
+
+// Applies a volume changing linearly from startVolume to endVolume over the frames of the
+// buffer, to avoid the clicks of a sudden change
+Q_MULTIMEDIA_EXPORT
+void applyVolumeRamp(float startVolume, float endVolume, const QAudioFormat &,
+                     QSpan<const std::byte> source, QSpan<std::byte> destination) QT_MM_NONBLOCKING;
+Q_MULTIMEDIA_EXPORT
+void applyVolumeRamp(float startVolume, float endVolume, const QAudioFormat &,
+                     QSpan<std::byte> buffer) QT_MM_NONBLOCKING;
+
+// Volume that can be set from any thread, and is applied by the audio thread with a short
+// ramp whenever it changes
+class Q_MULTIMEDIA_EXPORT SmoothedVolume
+{
+public:
+    static constexpr qint64 RampDurationUs = 5'000;
+
+    explicit SmoothedVolume(float volume = 1.f) : m_target(volume), m_current(volume) { }
+
+    void setVolume(float volume) { m_target.store(volume, std::memory_order_relaxed); }
+    float volume() const { return m_target.load(std::memory_order_relaxed); }
+
+    // skips the ramp to the current volume, e.g. when the stream (re)starts; audio thread only
+    void reset() { m_current = volume(); }
+    // true if apply() leaves the samples unchanged; audio thread only
+    bool isUnity() const { return m_current == 1.f && volume() == 1.f; }
+
+    void apply(const QAudioFormat &, QSpan<const std::byte> source,
+               QSpan<std::byte> destination) QT_MM_NONBLOCKING;
+    void apply(const QAudioFormat &, QSpan<std::byte> buffer) QT_MM_NONBLOCKING;
+
+private:
+    std::atomic<float> m_target;
+    // only accessed by the audio thread
+    float m_current;
+};
+
+// Converts samples between the sample formats of QAudioFormat. The number of samples is
+// given by the source; float samples are clamped to [-1, 1] when converted to integers.
+Q_MULTIMEDIA_EXPORT
+void convertSamples(QSpan<const std::byte> source, QAudioFormat::SampleFormat sourceFormat,
+                    QSpan<std::byte> destination,
+                    QAudioFormat::SampleFormat destinationFormat) QT_MM_NONBLOCKING;
+
+Q_MULTIMEDIA_EXPORT void convertSamples(QSpan<const qint16> source,
+                                        QSpan<float> destination) QT_MM_NONBLOCKING;
+Q_MULTIMEDIA_EXPORT void convertSamples(QSpan<const float> source,
+                                        QSpan<qint16> destination) QT_MM_NONBLOCKING;
+
+// Splits interleaved frames into one buffer per channel, and back
+Q_MULTIMEDIA_EXPORT void deinterleave(QSpan<const float> interleaved,
+                                      QSpan<float *const> channels) QT_MM_NONBLOCKING;
+Q_MULTIMEDIA_EXPORT void interleave(QSpan<const float *const> channels,
+                                    QSpan<float> interleaved) QT_MM_NONBLOCKING;
+
+// Adds gain * source to destination. Integer samples saturate; float samples are not clamped.
+Q_MULTIMEDIA_EXPORT
+void mixAccumulate(const QAudioFormat &, QSpan<const std::byte> source,
+                   QSpan<std::byte> destination, float gain = 1.f) QT_MM_NONBLOCKING;
+
+// Writes the sum of the sources to destination, saturating integer samples only once,
+// after all the sources have been summed. The sources have the size of destination.
+Q_MULTIMEDIA_EXPORT
+void mix(const QAudioFormat &, QSpan<const QSpan<const std::byte>> sources,
+         QSpan<std::byte> destination) QT_MM_NONBLOCKING;
+
 } // namespace QAudioHelperInternal
 
 QT_END_NAMESPACE
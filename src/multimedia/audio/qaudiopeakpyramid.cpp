@@ -0,0 +1,369 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qaudiopeakpyramid_p.h"
+
+#include <QtCore/qdatastream.h>
+#include <QtCore/qvarlengtharray.h>
+#include <QtCore/private/qsimd_p.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
+QT_BEGIN_NAMESPACE
+
+namespace {
+
+constexpr quint32 SerializationMagic = 0x51504b50; // "QPKP"
+constexpr quint16 SerializationVersion = 1;
+constexpr int MaxLevelCount = 32;
+
+struct PeakAccumulator
+{
+    void add(const QAudioPeakPyramid::Peak &peak, float weight)
+    {
+        min = std::min(min, peak.min);
+        max = std::max(max, peak.max);
+        sumOfSquares += double(peak.rms) * peak.rms * weight;
+        totalWeight += weight;
+    }
+
+    QAudioPeakPyramid::Peak result() const
+    {
+        if (totalWeight <= 0)
+            return {};
+        return { min, max, float(std::sqrt(sumOfSquares / totalWeight)) };
+    }
+
+    float min = std::numeric_limits<float>::max();
+    float max = std::numeric_limits<float>::lowest();
+    double sumOfSquares = 0;
+    double totalWeight = 0;
+};
+
+} // namespace
+
+QAudioPeakPyramid::QAudioPeakPyramid(int channelCount, int sampleRate, int blockFrames)
+    : m_channelCount(std::max(channelCount, 0)),
+      m_sampleRate(sampleRate),
+      m_blockFrames(std::max(blockFrames, 0))
+{
+}
+
+qint64 QAudioPeakPyramid::framesPerPeak(int level) const
+{
+    qint64 frames = m_blockFrames;
+    for (int i = 0; i < level; ++i)
+        frames *= ReductionFactor;
+    return frames;
+}
+
+qsizetype QAudioPeakPyramid::peakCount(int level) const
+{
+    if (level < 0 || level >= levelCount())
+        return 0;
+    return qsizetype(m_levels[level].size()) / m_channelCount;
+}
+
+QAudioPeakPyramid::Peak QAudioPeakPyramid::peak(int level, qsizetype index, int channel) const
+{
+    Q_ASSERT(index >= 0 && index < peakCount(level));
+    Q_ASSERT(channel >= 0 && channel < m_channelCount);
+    return m_levels[level][index * m_channelCount + channel];
+}
+
+float QAudioPeakPyramid::peakWeight(int level, qsizetype index) const
+{
+    // the last peak of a level may cover fewer frames
+    const qint64 frames = framesPerPeak(level);
+    return float(std::min(frames, m_frameCount - index * frames));
+}
+
+QAudioPeakPyramid::Peak QAudioPeakPyramid::peakForRange(qint64 startFrame, qint64 endFrame,
+                                                        int channel) const
+{
+    startFrame = std::max<qint64>(startFrame, 0);
+    endFrame = std::min(endFrame, m_frameCount);
+    if (!isValid() || m_levels.empty() || endFrame <= startFrame)
+        return {};
+
+    int level = 0;
+    while (level + 1 < levelCount() && framesPerPeak(level + 1) * 2 <= endFrame - startFrame)
+        ++level;
+
+    // While the pyramid is being built, the coarse levels don't cover the last frames yet;
+    // the remainder of the range is then taken from the finer levels.
+    PeakAccumulator accumulator;
+    qint64 position = startFrame;
+    for (; level >= 0 && position < endFrame; --level) {
+        const qint64 frames = framesPerPeak(level);
+        const qsizetype first = position / frames;
+        const qsizetype last = std::min<qsizetype>((endFrame + frames - 1) / frames,
+                                                   peakCount(level));
+        for (qsizetype i = first; i < last; ++i)
+            accumulator.add(peak(level, i, channel), peakWeight(level, i));
+
+        if (last > first)
+            position = last * frames;
+    }
+
+    return accumulator.result();
+}
+
+void QAudioPeakPyramid::appendBlock(QSpan<const Peak> peaks, qint64 frames)
+{
+    Q_ASSERT(!m_complete);
+    Q_ASSERT(peaks.size() == m_channelCount);
+
+    if (m_levels.empty())
+        m_levels.emplace_back();
+
+    m_levels[0].insert(m_levels[0].end(), peaks.begin(), peaks.end());
+    m_frameCount += frames;
+
+    for (int level = 0; level < MaxLevelCount - 1; ++level) {
+        const qsizetype count = peakCount(level);
+        if (count % ReductionFactor != 0)
+            break;
+        reduceInto(level, count - ReductionFactor, ReductionFactor);
+    }
+}
+
+void QAudioPeakPyramid::complete()
+{
+    for (int level = 0; level < levelCount() && level < MaxLevelCount - 1; ++level) {
+        const qsizetype count = peakCount(level);
+        if (count <= 1 && level + 1 == levelCount())
+            break;
+
+        const qsizetype covered = peakCount(level + 1) * ReductionFactor;
+        if (count > covered)
+            reduceInto(level, covered, count - covered);
+    }
+
+    m_complete = true;
+}
+
+void QAudioPeakPyramid::reduceInto(int level, qsizetype firstPeak, qsizetype peakCount)
+{
+    if (level + 1 == levelCount())
+        m_levels.emplace_back();
+
+    std::vector<Peak> &target = m_levels[level + 1];
+    for (int channel = 0; channel < m_channelCount; ++channel) {
+        PeakAccumulator accumulator;
+        for (qsizetype i = firstPeak; i < firstPeak + peakCount; ++i)
+            accumulator.add(peak(level, i, channel), peakWeight(level, i));
+        target.push_back(accumulator.result());
+    }
+}
+
+QByteArray QAudioPeakPyramid::toByteArray() const
+{
+    QByteArray data;
+    QDataStream stream(&data, QIODevice::WriteOnly);
+    stream.setVersion(QDataStream::Qt_6_0);
+    stream.setByteOrder(QDataStream::LittleEndian);
+    stream.setFloatingPointPrecision(QDataStream::SinglePrecision);
+
+    stream << SerializationMagic << SerializationVersion << qint32(m_channelCount)
+           << qint32(m_sampleRate) << qint32(m_blockFrames) << m_frameCount << m_complete
+           << qint32(levelCount());
+
+    for (const std::vector<Peak> &level : m_levels) {
+        stream << quint64(level.size());
+        for (const Peak &peak : level)
+            stream << peak.min << peak.max << peak.rms;
+    }
+
+    return data;
+}
+
+std::optional<QAudioPeakPyramid> QAudioPeakPyramid::fromByteArray(QByteArrayView data)
+{
+    const QByteArray bytes = data.toByteArray();
+    QDataStream stream(bytes);
+    stream.setVersion(QDataStream::Qt_6_0);
+    stream.setByteOrder(QDataStream::LittleEndian);
+    stream.setFloatingPointPrecision(QDataStream::SinglePrecision);
+
+    quint32 magic = 0;
+    quint16 version = 0;
+    stream >> magic >> version;
+    if (magic != SerializationMagic || version != SerializationVersion)
+        return std::nullopt;
+
+    qint32 channelCount = 0;
+    qint32 sampleRate = 0;
+    qint32 blockFrames = 0;
+    qint32 levelCount = 0;
+    QAudioPeakPyramid result;
+    stream >> channelCount >> sampleRate >> blockFrames >> result.m_frameCount
+            >> result.m_complete >> levelCount;
+
+    if (stream.status() != QDataStream::Ok || channelCount <= 0 || blockFrames <= 0
+        || result.m_frameCount < 0 || levelCount < 0 || levelCount > MaxLevelCount)
+        return std::nullopt;
+
+    result.m_channelCount = channelCount;
+    result.m_sampleRate = sampleRate;
+    result.m_blockFrames = blockFrames;
+
+    constexpr qsizetype BytesPerPeak = 3 * sizeof(float);
+
+    for (int level = 0; level < levelCount; ++level) {
+        quint64 size = 0;
+        stream >> size;
+
+        // reject sizes that don't match the remaining data before allocating
+        const qsizetype remaining = bytes.size() - stream.device()->pos();
+        if (stream.status() != QDataStream::Ok || size % channelCount != 0
+            || size > quint64(remaining / BytesPerPeak))
+            return std::nullopt;
+
+        std::vector<Peak> &peaks = result.m_levels.emplace_back(size);
+        for (Peak &peak : peaks)
+            stream >> peak.min >> peak.max >> peak.rms;
+    }
+
+    if (stream.status() != QDataStream::Ok)
+        return std::nullopt;
+
+    const qint64 expectedBlocks = (result.m_frameCount + blockFrames - 1) / blockFrames;
+    if (result.peakCount(0) != expectedBlocks)
+        return std::nullopt;
+
+    return result;
+}
+
+QAudioPeakPyramidBuilder::QAudioPeakPyramidBuilder(int channelCount, int sampleRate,
+                                                   int blockFrames)
+    : m_pyramid(channelCount, sampleRate, blockFrames),
+      m_blockPeaks(m_pyramid.channelCount())
+{
+    Q_ASSERT(m_pyramid.isValid());
+    m_partialBlock.reserve(qsizetype(m_pyramid.blockFrames()) * m_pyramid.channelCount());
+}
+
+void QAudioPeakPyramidBuilder::addFrames(QSpan<const float> samples)
+{
+    Q_ASSERT(samples.size() % m_pyramid.channelCount() == 0);
+
+    const qsizetype blockSize = qsizetype(m_pyramid.blockFrames()) * m_pyramid.channelCount();
+
+    if (!m_partialBlock.empty()) {
+        const qsizetype toCopy =
+                std::min(blockSize - qsizetype(m_partialBlock.size()), samples.size());
+        m_partialBlock.insert(m_partialBlock.end(), samples.begin(), samples.begin() + toCopy);
+        samples = samples.subspan(toCopy);
+
+        if (qsizetype(m_partialBlock.size()) < blockSize)
+            return;
+
+        addBlock(m_partialBlock);
+        m_partialBlock.clear();
+    }
+
+    // reduce the whole blocks in place, without copying them
+    for (; samples.size() >= blockSize; samples = samples.subspan(blockSize))
+        addBlock(samples.first(blockSize));
+
+    m_partialBlock.assign(samples.begin(), samples.end());
+}
+
+void QAudioPeakPyramidBuilder::finish()
+{
+    if (!m_partialBlock.empty()) {
+        addBlock(m_partialBlock);
+        m_partialBlock.clear();
+    }
+
+    m_pyramid.complete();
+}
+
+void QAudioPeakPyramidBuilder::addBlock(QSpan<const float> samples)
+{
+    reduceBlock(samples, m_pyramid.channelCount(), m_blockPeaks);
+    m_pyramid.appendBlock(m_blockPeaks, samples.size() / m_pyramid.channelCount());
+}
+
+void QAudioPeakPyramidBuilder::reduceBlock(QSpan<const float> samples, int channelCount,
+                                           QSpan<Peak> peaks)
+{
+    Q_ASSERT(channelCount > 0 && peaks.size() == channelCount);
+
+    const qsizetype frameCount = samples.size() / channelCount;
+    if (frameCount == 0) {
+        std::fill(peaks.begin(), peaks.end(), Peak{});
+        return;
+    }
+
+    QVarLengthArray<float, 8> min(channelCount, std::numeric_limits<float>::max());
+    QVarLengthArray<float, 8> max(channelCount, std::numeric_limits<float>::lowest());
+    QVarLengthArray<float, 8> sumOfSquares(channelCount, 0.f);
+
+    const float *data = samples.data();
+    const qsizetype size = frameCount * channelCount;
+    qsizetype i = 0;
+
+#if defined(__SSE2__) || defined(__ARM_NEON)
+    // With 1, 2 or 4 channels, each lane of a 4-float vector always holds the same channel
+    if (4 % channelCount == 0) {
+#  if defined(__SSE2__)
+        __m128 vmin = _mm_set1_ps(std::numeric_limits<float>::max());
+        __m128 vmax = _mm_set1_ps(std::numeric_limits<float>::lowest());
+        __m128 vsum = _mm_setzero_ps();
+        for (; i + 4 <= size; i += 4) {
+            const __m128 v = _mm_loadu_ps(data + i);
+            vmin = _mm_min_ps(vmin, v);
+            vmax = _mm_max_ps(vmax, v);
+            vsum = _mm_add_ps(vsum, _mm_mul_ps(v, v));
+        }
+
+        std::array<float, 4> lanesMin, lanesMax, lanesSum;
+        _mm_storeu_ps(lanesMin.data(), vmin);
+        _mm_storeu_ps(lanesMax.data(), vmax);
+        _mm_storeu_ps(lanesSum.data(), vsum);
+#  else
+        float32x4_t vmin = vdupq_n_f32(std::numeric_limits<float>::max());
+        float32x4_t vmax = vdupq_n_f32(std::numeric_limits<float>::lowest());
+        float32x4_t vsum = vdupq_n_f32(0.f);
+        for (; i + 4 <= size; i += 4) {
+            const float32x4_t v = vld1q_f32(data + i);
+            vmin = vminq_f32(vmin, v);
+            vmax = vmaxq_f32(vmax, v);
+            vsum = vmlaq_f32(vsum, v, v);
+        }
+
+        std::array<float, 4> lanesMin, lanesMax, lanesSum;
+        vst1q_f32(lanesMin.data(), vmin);
+        vst1q_f32(lanesMax.data(), vmax);
+        vst1q_f32(lanesSum.data(), vsum);
+#  endif
+        for (int lane = 0; lane < 4; ++lane) {
+            const int channel = lane % channelCount;
+            min[channel] = std::min(min[channel], lanesMin[lane]);
+            max[channel] = std::max(max[channel], lanesMax[lane]);
+            sumOfSquares[channel] += lanesSum[lane];
+        }
+    }
+#endif
+
+    // i is a multiple of the channel count here
+    for (int channel = 0; i < size; ++i) {
+        const float value = data[i];
+        min[channel] = std::min(min[channel], value);
+        max[channel] = std::max(max[channel], value);
+        sumOfSquares[channel] += value * value;
+        if (++channel == channelCount)
+            channel = 0;
+    }
+
+    for (int channel = 0; channel < channelCount; ++channel)
+        peaks[channel] = { min[channel], max[channel],
+                           std::sqrt(sumOfSquares[channel] / float(frameCount)) };
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,122 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QAUDIOPEAKPYRAMID_P_H
+#define QAUDIOPEAKPYRAMID_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/qbytearray.h>
+#include <QtCore/qbytearrayview.h>
+#include <QtCore/qspan.h>
+#include <QtMultimedia/qtmultimediaexports.h>
+
+#include <optional>
+#include <vector>
+
+QT_BEGIN_NAMESPACE
+
+// Multi-resolution min/max/RMS overview of an audio signal, as used to draw waveforms.
+//
+// Level 0 holds one peak per channel for every blockFrames() frames; each following
+// level reduces ReductionFactor peaks of the previous one into a single peak, up to a
+// level with a single peak. The peaks of a level are interleaved by channel.
+class Q_MULTIMEDIA_EXPORT QAudioPeakPyramid
+{
+public:
+    struct Peak
+    {
+        float min = 0.f;
+        float max = 0.f;
+        float rms = 0.f;
+
+        friend bool operator==(const Peak &lhs, const Peak &rhs) noexcept
+        {
+            return lhs.min == rhs.min && lhs.max == rhs.max && lhs.rms == rhs.rms;
+        }
+    };
+
+    static constexpr int ReductionFactor = 4;
+    static constexpr int DefaultBlockFrames = 256;
+
+    QAudioPeakPyramid() = default;
+    QAudioPeakPyramid(int channelCount, int sampleRate, int blockFrames = DefaultBlockFrames);
+
+    bool isValid() const { return m_channelCount > 0 && m_blockFrames > 0; }
+
+    int channelCount() const { return m_channelCount; }
+    int sampleRate() const { return m_sampleRate; }
+    int blockFrames() const { return m_blockFrames; }
+    // number of frames covered by level 0
+    qint64 frameCount() const { return m_frameCount; }
+
+    int levelCount() const { return int(m_levels.size()); }
+    qint64 framesPerPeak(int level) const;
+    qsizetype peakCount(int level) const;
+    Peak peak(int level, qsizetype index, int channel) const;
+
+    // Combines the peaks of frames [startFrame, endFrame), using the coarsest level whose
+    // resolution is at least half of the range. Meant for one call per pixel column.
+    Peak peakForRange(qint64 startFrame, qint64 endFrame, int channel) const;
+
+    // Compact binary representation, meant to be cached next to the media
+    QByteArray toByteArray() const;
+    static std::optional<QAudioPeakPyramid> fromByteArray(QByteArrayView data);
+
+private:
+    friend class QAudioPeakPyramidBuilder;
+
+    // appends one level 0 peak per channel, covering frames frames
+    void appendBlock(QSpan<const Peak> peaks, qint64 frames);
+    // reduces the incomplete groups at the end of each level into the next one
+    void complete();
+    void reduceInto(int level, qsizetype firstPeak, qsizetype peakCount);
+    float peakWeight(int level, qsizetype index) const;
+
+    int m_channelCount = 0;
+    int m_sampleRate = 0;
+    int m_blockFrames = 0;
+    qint64 m_frameCount = 0;
+    bool m_complete = false;
+    std::vector<std::vector<Peak>> m_levels;
+};
+
+// Builds a QAudioPeakPyramid incrementally from interleaved float samples.
+class Q_MULTIMEDIA_EXPORT QAudioPeakPyramidBuilder
+{
+public:
+    using Peak = QAudioPeakPyramid::Peak;
+
+    QAudioPeakPyramidBuilder(int channelCount, int sampleRate,
+                             int blockFrames = QAudioPeakPyramid::DefaultBlockFrames);
+
+    void addFrames(QSpan<const float> samples);
+    // flushes the last incomplete block; no frames can be added afterwards
+    void finish();
+
+    const QAudioPeakPyramid &pyramid() const { return m_pyramid; }
+
+    // Computes the peak of each channel of interleaved frames; exposed for testing
+    static void reduceBlock(QSpan<const float> samples, int channelCount, QSpan<Peak> peaks);
+
+private:
+    void addBlock(QSpan<const float> samples);
+
+    QAudioPeakPyramid m_pyramid;
+    // samples of the incomplete block
+    std::vector<float> m_partialBlock;
+    std::vector<Peak> m_blockPeaks;
+};
+
+QT_END_NAMESPACE
+
+#endif // QAUDIOPEAKPYRAMID_P_H
@@ -21,36 +21,50 @@
 #include <algorithm>
 #include <atomic>
 #include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
 
 QT_BEGIN_NAMESPACE
 
 namespace QtPrivate {
 
-// Single-producer, single-consumer wait-free queue
+// Single-producer, single-consumer wait-free queue.
+//
+// The reader and the writer each own a cache line, holding a 64-bit index counting the
+// elements transferred since construction and a cached copy of the other side's index: the
+// shared indices are only touched when the cached ones don't allow the request to complete.
+//
+// Acquired regions are contiguous, and never wrap around the end of the buffer: if the buffer
+// size is a multiple of the request size, and all requests have that size (e.g. periods of an
+// audio device), each region covers the full request.
 template <typename T>
 class QAudioRingBuffer
 {
+    static constexpr size_t CacheLineSize = 64;
+
 public:
     using ValueType = T;
     using Region = QSpan<T>;
     using ConstRegion = QSpan<const T>;
 
-    explicit QAudioRingBuffer(int bufferSize) : m_bufferSize(bufferSize)
+    explicit QAudioRingBuffer(qsizetype bufferSize) : m_bufferSize(bufferSize)
     {
+        Q_ASSERT(bufferSize > 0);
         m_buffer.reset(new T[bufferSize]); // no value-initialization for trivial types
     }
 
-    int write(ConstRegion region)
+    qsizetype write(ConstRegion region)
     {
         using namespace QtMultimediaPrivate; // drop
 
-        int elementsWritten = 0;
+        qsizetype elementsWritten = 0;
         while (!region.isEmpty()) {
             Region writeRegion = acquireWriteRegion(region.size());
             if (writeRegion.isEmpty())
                 break;
 
-            int toWrite = qMin(writeRegion.size(), region.size());
+            qsizetype toWrite = qMin(writeRegion.size(), region.size());
             std::copy_n(region.data(), toWrite, writeRegion.data());
             region = drop(region, toWrite);
             releaseWriteRegion(toWrite);
@@ -60,9 +74,9 @@ public:
     }
 
     template <typename Functor>
-    int consume(int elements, Functor &&consumer)
+    qsizetype consume(qsizetype elements, Functor &&consumer)
     {
-        int elementsConsumed = 0;
+        qsizetype elementsConsumed = 0;
 
         while (elements > elementsConsumed) {
             ConstRegion readRegion = acquireReadRegion(elements - elementsConsumed);
@@ -78,69 +92,218 @@ public:
     }
 
     template <typename Functor>
-    int consumeAll(Functor &&consumer)
+    qsizetype consumeAll(Functor &&consumer)
     {
-        return consume(std::numeric_limits<int>::max(), std::forward<Functor>(consumer));
+        return consume(std::numeric_limits<qsizetype>::max(), std::forward<Functor>(consumer));
     }
 
     // CAVEAT: beware of the thread safety
-    int used() const { return m_bufferUsed.load(std::memory_order_relaxed); }
-    int free() const { return m_bufferSize - m_bufferUsed.load(std::memory_order_relaxed); }
+    qsizetype used() const
+    {
+        // loading the read index first guarantees to see a write index that isn't older
+        const quint64 readIndex = m_reader.index.load(std::memory_order_acquire);
+        const quint64 writeIndex = m_writer.index.load(std::memory_order_acquire);
+        return qsizetype(writeIndex - readIndex);
+    }
+    qsizetype free() const { return m_bufferSize - used(); }
+
+    qsizetype size() const { return m_bufferSize; };
 
-    int size() const { return m_bufferSize; };
+    // number of elements written and read since the construction or the last reset
+    quint64 totalWritten() const { return m_writer.index.load(std::memory_order_acquire); }
+    quint64 totalRead() const { return m_reader.index.load(std::memory_order_acquire); }
 
     void reset()
     {
-        m_readPos = 0;
-        m_writePos = 0;
-        m_bufferUsed.store(0, std::memory_order_relaxed);
+        m_writer.position = 0;
+        m_writer.cachedIndex = 0;
+        m_writer.index.store(0, std::memory_order_relaxed);
+        m_reader.position = 0;
+        m_reader.cachedIndex = 0;
+        m_reader.index.store(0, std::memory_order_relaxed);
     }
 
-    Region acquireWriteRegion(int size)
+    Region acquireWriteRegion(qsizetype size)
     {
-        const int free = m_bufferSize - m_bufferUsed.load(std::memory_order_acquire);
+        const quint64 writeIndex = m_writer.index.load(std::memory_order_relaxed);
 
-        Region output;
-        if (free > 0) {
-            const int writeSize = qMin(size, qMin(m_bufferSize - m_writePos, free));
-            output = writeSize > 0 ? Region(m_buffer.get() + m_writePos, writeSize) : Region();
-        } else {
-            output = Region();
+        qsizetype free = m_bufferSize - qsizetype(writeIndex - m_writer.cachedIndex);
+        if (free < size) {
+            m_writer.cachedIndex = m_reader.index.load(std::memory_order_acquire);
+            free = m_bufferSize - qsizetype(writeIndex - m_writer.cachedIndex);
         }
-        return output;
+
+        const qsizetype writeSize = std::min({ size, m_bufferSize - m_writer.position, free });
+        return writeSize > 0 ? Region(m_buffer.get() + m_writer.position, writeSize) : Region();
     }
 
-    void releaseWriteRegion(int elementsRead)
+    void releaseWriteRegion(qsizetype elementsWritten)
     {
-        m_writePos = (m_writePos + elementsRead) % m_bufferSize;
-        m_bufferUsed.fetch_add(elementsRead, std::memory_order_release);
+        m_writer.position = advance(m_writer.position, elementsWritten);
+        m_writer.index.store(m_writer.index.load(std::memory_order_relaxed) + elementsWritten,
+                             std::memory_order_release);
     }
 
-    ConstRegion acquireReadRegion(int size)
+    ConstRegion acquireReadRegion(qsizetype size)
     {
-        const int used = m_bufferUsed.load(std::memory_order_acquire);
+        const quint64 readIndex = m_reader.index.load(std::memory_order_relaxed);
 
-        if (used > 0) {
-            const int readSize = qMin(size, qMin(m_bufferSize - m_readPos, used));
-            return readSize > 0 ? Region(m_buffer.get() + m_readPos, readSize) : Region();
+        qsizetype used = qsizetype(m_reader.cachedIndex - readIndex);
+        if (used < size) {
+            m_reader.cachedIndex = m_writer.index.load(std::memory_order_acquire);
+            used = qsizetype(m_reader.cachedIndex - readIndex);
         }
 
-        return Region();
+        const qsizetype readSize = std::min({ size, m_bufferSize - m_reader.position, used });
+        return readSize > 0 ? ConstRegion(m_buffer.get() + m_reader.position, readSize)
+                            : ConstRegion();
     }
 
-    void releaseReadRegion(int elementsWritten)
+    void releaseReadRegion(qsizetype elementsRead)
     {
-        m_readPos = (m_readPos + elementsWritten) % m_bufferSize;
-        m_bufferUsed.fetch_sub(elementsWritten, std::memory_order_release);
+        m_reader.position = advance(m_reader.position, elementsRead);
+        m_reader.index.store(m_reader.index.load(std::memory_order_relaxed) + elementsRead,
+                             std::memory_order_release);
     }
 
-
 private:
-    const int m_bufferSize;
-    int m_readPos{};
-    int m_writePos{};
+    qsizetype advance(qsizetype position, qsizetype elements) const
+    {
+        // regions never wrap, so the position reaches the end at most
+        position += elements;
+        return position >= m_bufferSize ? position - m_bufferSize : position;
+    }
+
+    // state of one side: only the index is read by the other side
+    struct alignas(CacheLineSize) Side
+    {
+        std::atomic<quint64> index{};
+        quint64 cachedIndex{}; // last known index of the other side
+        qsizetype position{};
+    };
+
+    const qsizetype m_bufferSize;
     std::unique_ptr<T[]> m_buffer;
-    std::atomic_int m_bufferUsed{};
+    Side m_writer;
+    Side m_reader;
+};
+
+// Multi-producer, single-consumer queue, made of one single-producer lane per producer.
+//
+// A producer claims a lane, and doesn't contend with the other producers afterwards: writing
+// and consuming are wait-free, like for QAudioRingBuffer. The consumer reads the lanes
+// separately, which suits mixing: each producer is accumulated into the mix buffer.
+template <typename T>
+class QAudioMpscRingBuffer
+{
+    struct Lane
+    {
+        explicit Lane(qsizetype size) : ringBuffer(size) { }
+
+        QAudioRingBuffer<T> ringBuffer;
+        std::atomic_bool claimed{ false };
+    };
+
+public:
+    using ValueType = T;
+    using Region = QSpan<T>;
+    using ConstRegion = QSpan<const T>;
+
+    // Handle to a claimed lane, giving the lane back when destroyed. Data that hasn't been
+    // consumed yet is still consumed afterwards.
+    class Producer
+    {
+    public:
+        Producer() = default;
+        Producer(Producer &&other) noexcept : m_lane(std::exchange(other.m_lane, nullptr)) { }
+        Producer &operator=(Producer &&other) noexcept
+        {
+            if (this != &other) {
+                release();
+                m_lane = std::exchange(other.m_lane, nullptr);
+            }
+            return *this;
+        }
+        ~Producer() { release(); }
+
+        bool isValid() const { return m_lane != nullptr; }
+
+        qsizetype write(ConstRegion region) { return m_lane->ringBuffer.write(region); }
+        Region acquireWriteRegion(qsizetype size)
+        {
+            return m_lane->ringBuffer.acquireWriteRegion(size);
+        }
+        void releaseWriteRegion(qsizetype elementsWritten)
+        {
+            m_lane->ringBuffer.releaseWriteRegion(elementsWritten);
+        }
+        qsizetype free() const { return m_lane->ringBuffer.free(); }
+
+        void release()
+        {
+            if (m_lane)
+                std::exchange(m_lane, nullptr)->claimed.store(false, std::memory_order_release);
+        }
+
+    private:
+        friend class QAudioMpscRingBuffer;
+        explicit Producer(Lane *lane) : m_lane(lane) { }
+
+        Lane *m_lane = nullptr;
+    };
+
+    QAudioMpscRingBuffer(int maxProducers, qsizetype laneSize)
+    {
+        Q_ASSERT(maxProducers > 0);
+        m_lanes.reserve(maxProducers);
+        for (int i = 0; i < maxProducers; ++i)
+            m_lanes.push_back(std::make_unique<Lane>(laneSize));
+    }
+
+    // Claims a lane, with at most one attempt per lane; returns an invalid producer if all
+    // the lanes are claimed. The producers must be released before the queue is destroyed.
+    Producer acquireProducer()
+    {
+        for (const std::unique_ptr<Lane> &lane : m_lanes) {
+            bool claimed = false;
+            if (lane->claimed.compare_exchange_strong(claimed, true, std::memory_order_acquire))
+                return Producer(lane.get());
+        }
+        return Producer();
+    }
+
+    // Consumes up to elements from each lane. The consumer is called with the index of the
+    // lane, the offset of the region from the first element consumed from the lane, and the
+    // region. Returns the largest number of elements consumed from a lane.
+    template <typename Functor>
+    qsizetype consume(qsizetype elements, Functor &&consumer)
+    {
+        qsizetype maxElementsConsumed = 0;
+        for (int index = 0; index < laneCount(); ++index) {
+            qsizetype offset = 0;
+            m_lanes[index]->ringBuffer.consume(elements, [&](ConstRegion region) {
+                consumer(index, offset, region);
+                offset += region.size();
+            });
+            maxElementsConsumed = std::max(maxElementsConsumed, offset);
+        }
+        return maxElementsConsumed;
+    }
+
+    int laneCount() const { return int(m_lanes.size()); }
+    qsizetype laneSize() const { return m_lanes.front()->ringBuffer.size(); }
+
+    // CAVEAT: beware of the thread safety
+    qsizetype used(int lane) const { return m_lanes[lane]->ringBuffer.used(); }
+    int producerCount() const
+    {
+        return int(std::count_if(m_lanes.begin(), m_lanes.end(), [](const auto &lane) {
+            return lane->claimed.load(std::memory_order_relaxed);
+        }));
+    }
+
+private:
+    std::vector<std::unique_ptr<Lane>> m_lanes;
 };
 
 } // namespace QtPrivate
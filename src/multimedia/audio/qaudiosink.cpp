@@ -12,6 +12,19 @@
 
 QT_BEGIN_NAMESPACE
 
+namespace {
+
+template <typename SampleType>
+QPlatformAudioSink::AudioCallback asByteCallback(QAudioSink::AudioCallback<SampleType> &&callback)
+{
+    return [callback = std::move(callback)](QSpan<std::byte> buffer) {
+        callback(QSpan{ reinterpret_cast<SampleType *>(buffer.data()),
+                        buffer.size() / qsizetype(sizeof(SampleType)) });
+    };
+}
+
+} // namespace
+
 /*!
     \class QAudioSink
     \brief The QAudioSink class provides an interface for sending audio data to
@@ -172,6 +185,80 @@ QIODevice* QAudioSink::start()
     return d->start();
 }
 
+/*!
+    \typealias QAudioSink::AudioCallback
+    \since 6.10
+
+    Alias for \c{std::function<void(QSpan<SampleType>)>}, the type of the callbacks
+    accepted by start().
+*/
+
+/*!
+    \fn void QAudioSink::start(AudioCallback<float> callback)
+    \fn void QAudioSink::start(AudioCallback<qint32> callback)
+    \fn void QAudioSink::start(AudioCallback<qint16> callback)
+    \fn void QAudioSink::start(AudioCallback<quint8> callback)
+    \since 6.10
+
+    Starts the audio output in callback mode. Instead of reading from a QIODevice,
+    the sink invokes \a callback whenever the audio device requests more data, and
+    the callback fills the given span with interleaved samples in format().
+
+    The sample type of the callback has to match the \l{QAudioFormat::sampleFormat()}{sample
+    format} of format(). Otherwise, a warning is printed and the sink is not started.
+
+    The callback is invoked directly on the realtime audio thread of the backend. It must
+    not block, allocate memory, or take locks that may be held by other threads; otherwise,
+    audio dropouts occur. The callback is not invoked anymore once stop() or reset() returns.
+
+    The buffer size set with setBufferSize() before starting controls the latency: the span
+    passed to the callback is never larger than bufferSize().
+
+    If the QAudioSink is able to output audio data, state() returns QtAudio::ActiveState,
+    error() returns QtAudio::NoError and the stateChanged() signal is emitted.
+    If the audio device can't be opened, error() returns QtAudio::OpenError.
+
+    \note Callback mode is supported by the ALSA, PulseAudio and PipeWire backends.
+    On other backends, a warning is printed and the sink is not started.
+*/
+void QAudioSink::start(AudioCallback<float> callback)
+{
+    startWithCallback(QAudioFormat::Float, asByteCallback(std::move(callback)));
+}
+
+void QAudioSink::start(AudioCallback<qint32> callback)
+{
+    startWithCallback(QAudioFormat::Int32, asByteCallback(std::move(callback)));
+}
+
+void QAudioSink::start(AudioCallback<qint16> callback)
+{
+    startWithCallback(QAudioFormat::Int16, asByteCallback(std::move(callback)));
+}
+
+void QAudioSink::start(AudioCallback<quint8> callback)
+{
+    startWithCallback(QAudioFormat::UInt8, asByteCallback(std::move(callback)));
+}
+
+void QAudioSink::startWithCallback(QAudioFormat::SampleFormat sampleFormat,
+                                   std::function<void(QSpan<std::byte>)> &&callback)
+{
+    if (!d)
+        return;
+
+    if (d->format().sampleFormat() != sampleFormat) {
+        qWarning() << "QAudioSink::start: the sample type of the callback doesn't match"
+                   << d->format();
+        return;
+    }
+
+    d->elapsedTime.restart();
+    // on failure, the backend sets the error unless it doesn't implement the callback mode
+    if (!d->start(std::move(callback)) && d->error() == QtAudio::NoError)
+        qWarning() << "QAudioSink::start: callback mode is not supported by the audio backend";
+}
+
 /*!
     Stops the audio output, detaching from the system resource.
 
@@ -6,6 +6,7 @@
 #define QAUDIOOUTPUT_H
 
 #include <QtCore/qiodevice.h>
+#include <QtCore/qspan.h>
 
 #include <QtMultimedia/qtmultimediaglobal.h>
 
@@ -13,6 +14,8 @@
 #include <QtMultimedia/qaudioformat.h>
 #include <QtMultimedia/qaudiodevice.h>
 
+#include <functional>
+
 
 QT_BEGIN_NAMESPACE
 
@@ -33,9 +36,17 @@ public:
 
     QAudioFormat format() const;
 
+    template <typename SampleType>
+    using AudioCallback = std::function<void(QSpan<SampleType>)>;
+
     void start(QIODevice *device);
     QIODevice* start();
 
+    void start(AudioCallback<float> callback);
+    void start(AudioCallback<qint32> callback);
+    void start(AudioCallback<qint16> callback);
+    void start(AudioCallback<quint8> callback);
+
     void stop();
     void reset();
     void suspend();
@@ -66,6 +77,9 @@ Q_SIGNALS:
 private:
     Q_DISABLE_COPY(QAudioSink)
 
+    void startWithCallback(QAudioFormat::SampleFormat,
+                           std::function<void(QSpan<std::byte>)> &&callback);
+
     QPlatformAudioSink* d;
 };
 
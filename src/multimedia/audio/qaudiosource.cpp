@@ -12,6 +12,20 @@
 
 QT_BEGIN_NAMESPACE
 
+namespace {
+
+template <typename SampleType>
+QPlatformAudioSource::AudioCallback
+asByteCallback(QAudioSource::AudioCallback<SampleType> &&callback)
+{
+    return [callback = std::move(callback)](QSpan<const std::byte> buffer) {
+        callback(QSpan{ reinterpret_cast<const SampleType *>(buffer.data()),
+                        buffer.size() / qsizetype(sizeof(SampleType)) });
+    };
+}
+
+} // namespace
+
 /*!
     \class QAudioSource
     \brief The QAudioSource class provides an interface for receiving audio data from an audio input device.
@@ -174,6 +188,77 @@ QIODevice* QAudioSource::start()
     return d->start();
 }
 
+/*!
+    \typealias QAudioSource::AudioCallback
+    \since 6.10
+
+    Alias for \c{std::function<void(QSpan<const SampleType>)>}, the type of the callbacks
+    accepted by start().
+*/
+
+/*!
+    \fn void QAudioSource::start(AudioCallback<float> callback)
+    \fn void QAudioSource::start(AudioCallback<qint32> callback)
+    \fn void QAudioSource::start(AudioCallback<qint16> callback)
+    \fn void QAudioSource::start(AudioCallback<quint8> callback)
+    \since 6.10
+
+    Starts the audio input in callback mode. Instead of writing to a QIODevice, the
+    source invokes \a callback with interleaved samples in format() as soon as the
+    audio device has captured them.
+
+    The sample type of the callback has to match the \l{QAudioFormat::sampleFormat()}{sample
+    format} of format(). Otherwise, a warning is printed and the source is not started.
+
+    The callback is invoked directly on the realtime audio thread of the backend. It must
+    not block, allocate memory, or take locks that may be held by other threads; otherwise,
+    captured data is lost. The callback is not invoked anymore once stop() or reset() returns.
+
+    If the QAudioSource is able to capture audio data, state() returns QtAudio::ActiveState,
+    error() returns QtAudio::NoError and the stateChanged() signal is emitted.
+    If the audio device can't be opened, error() returns QtAudio::OpenError.
+
+    \note Callback mode is supported by the ALSA, PulseAudio and PipeWire backends.
+    On other backends, a warning is printed and the source is not started.
+*/
+void QAudioSource::start(AudioCallback<float> callback)
+{
+    startWithCallback(QAudioFormat::Float, asByteCallback(std::move(callback)));
+}
+
+void QAudioSource::start(AudioCallback<qint32> callback)
+{
+    startWithCallback(QAudioFormat::Int32, asByteCallback(std::move(callback)));
+}
+
+void QAudioSource::start(AudioCallback<qint16> callback)
+{
+    startWithCallback(QAudioFormat::Int16, asByteCallback(std::move(callback)));
+}
+
+void QAudioSource::start(AudioCallback<quint8> callback)
+{
+    startWithCallback(QAudioFormat::UInt8, asByteCallback(std::move(callback)));
+}
+
+void QAudioSource::startWithCallback(QAudioFormat::SampleFormat sampleFormat,
+                                     std::function<void(QSpan<const std::byte>)> &&callback)
+{
+    if (!d)
+        return;
+
+    if (d->format().sampleFormat() != sampleFormat) {
+        qWarning() << "QAudioSource::start: the sample type of the callback doesn't match"
+                   << d->format();
+        return;
+    }
+
+    d->elapsedTime.start();
+    // on failure, the backend sets the error unless it doesn't implement the callback mode
+    if (!d->start(std::move(callback)) && d->error() == QtAudio::NoError)
+        qWarning() << "QAudioSource::start: callback mode is not supported by the audio backend";
+}
+
 /*!
     Returns the QAudioFormat being used.
 */
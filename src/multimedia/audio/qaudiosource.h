@@ -6,6 +6,7 @@
 #define QAUDIOINPUT_H
 
 #include <QtCore/qiodevice.h>
+#include <QtCore/qspan.h>
 
 #include <QtMultimedia/qtmultimediaglobal.h>
 
@@ -13,6 +14,8 @@
 #include <QtMultimedia/qaudioformat.h>
 #include <QtMultimedia/qaudiodevice.h>
 
+#include <functional>
+
 
 QT_BEGIN_NAMESPACE
 
@@ -31,9 +34,17 @@ public:
 
     QAudioFormat format() const;
 
+    template <typename SampleType>
+    using AudioCallback = std::function<void(QSpan<const SampleType>)>;
+
     void start(QIODevice *device);
     QIODevice* start();
 
+    void start(AudioCallback<float> callback);
+    void start(AudioCallback<qint32> callback);
+    void start(AudioCallback<qint16> callback);
+    void start(AudioCallback<quint8> callback);
+
     void stop();
     void reset();
     void suspend();
@@ -64,6 +75,9 @@ Q_SIGNALS:
 private:
     Q_DISABLE_COPY(QAudioSource)
 
+    void startWithCallback(QAudioFormat::SampleFormat,
+                           std::function<void(QSpan<const std::byte>)> &&callback);
+
     QPlatformAudioSource *d;
 };
 
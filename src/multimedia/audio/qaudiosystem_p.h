@@ -22,8 +22,11 @@
 #include <QtMultimedia/qaudiodevice.h>
 
 #include <QtCore/qelapsedtimer.h>
+#include <QtCore/qspan.h>
 #include <QtCore/private/qglobal_p.h>
 
+#include <functional>
+
 QT_BEGIN_NAMESPACE
 
 class QIODevice;
@@ -44,9 +47,14 @@ class Q_MULTIMEDIA_EXPORT QPlatformAudioSink : public QAudioStateChangeNotifier
     Q_OBJECT
 
 public:
+    // Fills the buffer with interleaved samples in format(); invoked on the audio thread
+    using AudioCallback = std::function<void(QSpan<std::byte>)>;
+
     QPlatformAudioSink(QObject *parent);
     virtual void start(QIODevice *device) = 0;
     virtual QIODevice* start() = 0;
+    // Returns false if the backend doesn't support the callback mode
+    virtual bool start(AudioCallback &&callback);
     virtual void stop() = 0;
     virtual void reset() = 0;
     virtual void suspend() = 0;
@@ -70,9 +78,14 @@ class Q_MULTIMEDIA_EXPORT QPlatformAudioSource : public QAudioStateChangeNotifie
     Q_OBJECT
 
 public:
+    // Receives interleaved samples in format(); invoked on the audio thread
+    using AudioCallback = std::function<void(QSpan<const std::byte>)>;
+
     QPlatformAudioSource(QObject *parent);
     virtual void start(QIODevice *device) = 0;
     virtual QIODevice* start() = 0;
+    // Returns false if the backend doesn't support the callback mode
+    virtual bool start(AudioCallback &&callback);
     virtual void stop() = 0;
     virtual void reset() = 0;
     virtual void suspend()  = 0;
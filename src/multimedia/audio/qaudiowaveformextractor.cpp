@@ -0,0 +1,195 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qaudiowaveformextractor_p.h"
+
+#include <QtCore/qelapsedtimer.h>
+#include <QtCore/qloggingcategory.h>
+#include <QtCore/qthread.h>
+
+#include <vector>
+
+QT_BEGIN_NAMESPACE
+
+Q_STATIC_LOGGING_CATEGORY(qLcAudioWaveformExtractor, "qt.multimedia.audiowaveformextractor");
+
+namespace {
+
+constexpr qint64 ReadChunkDurationUs = 100'000;
+constexpr qint64 PeaksAvailableIntervalMs = 50;
+
+struct DecodeError
+{
+    QAudioDecoder::Error error;
+    QString description;
+};
+
+// Decodes the source as interleaved floats, passing the format to onFormat before
+// passing the decoded chunks to onFrames
+template <typename FormatCallback, typename FramesCallback>
+std::optional<DecodeError> decodeAsFloat(const QUrl &source, const std::atomic_bool &cancelled,
+                                         FormatCallback &&onFormat, FramesCallback &&onFrames)
+{
+    QAudioDecoder decoder;
+    decoder.setSource(source);
+
+    auto decoderError = [&] { return DecodeError{ decoder.error(), decoder.errorString() }; };
+
+    if (!decoder.startSynchronous())
+        return decoderError();
+
+    QAudioFormat format = decoder.audioFormat();
+    if (format.sampleFormat() != QAudioFormat::Float) {
+        // keep the native sample rate and channels, so the backend doesn't need to resample
+        format.setSampleFormat(QAudioFormat::Float);
+        decoder.setAudioFormat(format);
+        if (!decoder.startSynchronous())
+            return decoderError();
+    }
+
+    onFormat(format);
+
+    std::vector<float> buffer(
+            qsizetype(format.framesForDuration(ReadChunkDurationUs)) * format.channelCount());
+    const QSpan<std::byte> bytes{ reinterpret_cast<std::byte *>(buffer.data()),
+                                  qsizetype(buffer.size() * sizeof(float)) };
+
+    while (!cancelled.load(std::memory_order_relaxed)) {
+        const qint64 bytesRead = decoder.readInto(bytes);
+        if (bytesRead < 0)
+            return decoderError();
+        if (bytesRead == 0)
+            break;
+
+        onFrames(QSpan<const float>{ buffer.data(), qsizetype(bytesRead / sizeof(float)) });
+    }
+
+    return std::nullopt;
+}
+
+} // namespace
+
+QAudioWaveformExtractor::QAudioWaveformExtractor(QObject *parent) : QObject(parent) { }
+
+QAudioWaveformExtractor::~QAudioWaveformExtractor()
+{
+    cancel();
+}
+
+void QAudioWaveformExtractor::setSource(const QUrl &source)
+{
+    m_source = source;
+}
+
+void QAudioWaveformExtractor::setBlockFrames(int frames)
+{
+    m_blockFrames = std::max(frames, 1);
+}
+
+void QAudioWaveformExtractor::start()
+{
+    cancel();
+
+    {
+        QMutexLocker locker(&m_mutex);
+        m_builder.reset();
+    }
+
+    m_cancelled.store(false, std::memory_order_relaxed);
+    m_thread.reset(QThread::create(
+            [this, source = m_source, blockFrames = m_blockFrames] { run(source, blockFrames); }));
+    m_thread->setObjectName(QStringLiteral("QAudioWaveformExtractor"));
+    m_thread->start(QThread::LowPriority);
+}
+
+void QAudioWaveformExtractor::cancel()
+{
+    if (!m_thread)
+        return;
+
+    m_cancelled.store(true, std::memory_order_relaxed);
+    m_thread->wait();
+    m_thread.reset();
+}
+
+bool QAudioWaveformExtractor::isRunning() const
+{
+    return m_thread && m_thread->isRunning();
+}
+
+QAudioPeakPyramid QAudioWaveformExtractor::pyramid() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_builder ? m_builder->pyramid() : QAudioPeakPyramid{};
+}
+
+void QAudioWaveformExtractor::run(const QUrl &source, int blockFrames)
+{
+    QElapsedTimer sinceNotification;
+    sinceNotification.start();
+
+    auto onFormat = [&](const QAudioFormat &format) {
+        QMutexLocker locker(&m_mutex);
+        m_builder.emplace(format.channelCount(), format.sampleRate(), blockFrames);
+    };
+
+    auto onFrames = [&](QSpan<const float> samples) {
+        qint64 frameCount = 0;
+        {
+            QMutexLocker locker(&m_mutex);
+            m_builder->addFrames(samples);
+            frameCount = m_builder->pyramid().frameCount();
+        }
+
+        if (sinceNotification.elapsed() >= PeaksAvailableIntervalMs) {
+            sinceNotification.restart();
+            emit peaksAvailable(frameCount);
+        }
+    };
+
+    if (auto error = decodeAsFloat(source, m_cancelled, onFormat, onFrames)) {
+        qCDebug(qLcAudioWaveformExtractor) << "Failed to extract the peaks of" << source
+                                           << error->description;
+        emit errorOccurred(error->error, error->description);
+        return;
+    }
+
+    if (m_cancelled.load(std::memory_order_relaxed))
+        return;
+
+    qint64 frameCount = 0;
+    {
+        QMutexLocker locker(&m_mutex);
+        m_builder->finish();
+        frameCount = m_builder->pyramid().frameCount();
+    }
+
+    emit peaksAvailable(frameCount);
+    emit finished();
+}
+
+std::optional<QAudioPeakPyramid> QAudioWaveformExtractor::extract(const QUrl &source,
+                                                                  int blockFrames,
+                                                                  QString *errorString)
+{
+    const std::atomic_bool cancelled{ false };
+    std::optional<QAudioPeakPyramidBuilder> builder;
+
+    auto onFormat = [&](const QAudioFormat &format) {
+        builder.emplace(format.channelCount(), format.sampleRate(), std::max(blockFrames, 1));
+    };
+    auto onFrames = [&](QSpan<const float> samples) { builder->addFrames(samples); };
+
+    if (auto error = decodeAsFloat(source, cancelled, onFormat, onFrames)) {
+        if (errorString)
+            *errorString = error->description;
+        return std::nullopt;
+    }
+
+    builder->finish();
+    return builder->pyramid();
+}
+
+QT_END_NAMESPACE
+
+#include "moc_qaudiowaveformextractor_p.cpp"
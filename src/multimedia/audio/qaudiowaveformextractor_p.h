@@ -0,0 +1,85 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QAUDIOWAVEFORMEXTRACTOR_P_H
+#define QAUDIOWAVEFORMEXTRACTOR_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/qmutex.h>
+#include <QtCore/qobject.h>
+#include <QtCore/qurl.h>
+#include <QtMultimedia/qaudiodecoder.h>
+#include <QtMultimedia/private/qaudiopeakpyramid_p.h>
+
+#include <atomic>
+#include <memory>
+#include <optional>
+
+QT_BEGIN_NAMESPACE
+
+class QThread;
+
+// Decodes a source on a worker thread, using the synchronous mode of QAudioDecoder,
+// and reduces it into a QAudioPeakPyramid without keeping the decoded data.
+//
+// The pyramid grows while decoding; peaksAvailable() is emitted regularly, and pyramid()
+// returns a snapshot of the peaks computed so far.
+class Q_MULTIMEDIA_EXPORT QAudioWaveformExtractor : public QObject
+{
+    Q_OBJECT
+public:
+    explicit QAudioWaveformExtractor(QObject *parent = nullptr);
+    // cancels the extraction and waits for the worker thread
+    ~QAudioWaveformExtractor() override;
+
+    void setSource(const QUrl &source);
+    QUrl source() const { return m_source; }
+
+    void setBlockFrames(int frames);
+    int blockFrames() const { return m_blockFrames; }
+
+    // cancels the running extraction, if any
+    void start();
+    void cancel();
+    bool isRunning() const;
+
+    QAudioPeakPyramid pyramid() const;
+
+    // Extracts the pyramid in the calling thread
+    static std::optional<QAudioPeakPyramid>
+    extract(const QUrl &source, int blockFrames = QAudioPeakPyramid::DefaultBlockFrames,
+            QString *errorString = nullptr);
+
+Q_SIGNALS:
+    // the signals are emitted from the worker thread
+    void peaksAvailable(qint64 frameCount);
+    void finished();
+    void errorOccurred(QAudioDecoder::Error error, const QString &errorString);
+
+private:
+    void run(const QUrl &source, int blockFrames);
+
+    QUrl m_source;
+    int m_blockFrames = QAudioPeakPyramid::DefaultBlockFrames;
+
+    std::unique_ptr<QThread> m_thread;
+    std::atomic_bool m_cancelled{ false };
+
+    // guards the builder, which is fed by the worker thread
+    mutable QMutex m_mutex;
+    std::optional<QAudioPeakPyramidBuilder> m_builder;
+};
+
+QT_END_NAMESPACE
+
+#endif // QAUDIOWAVEFORMEXTRACTOR_P_H
@@ -12,6 +12,7 @@
 #include <private/qplatformaudiodevices_p.h>
 #include <private/qplatformmediaintegration_p.h>
 #include <private/qplatformaudioresampler_p.h>
+#include <private/qaudiohelpers_p.h>
 
 Q_STATIC_LOGGING_CATEGORY(qLcSoundEffect, "qt.multimedia.soundeffect")
 
@@ -71,6 +72,7 @@ public:
     void setStatus(QSoundEffect::Status status);
     void setPlaying(bool playing);
     bool updateAudioOutput();
+    void convertToSupportedSampleFormat(const QAudioDevice &audioDevice);
 
 public Q_SLOTS:
     void sampleReady(QSample *);
@@ -195,6 +197,8 @@ bool QSoundEffectPrivate::updateAudioOutput()
     if (!m_audioBuffer.isValid())
         m_audioBuffer = QAudioBuffer(m_sample->data(), m_sample->format());
 
+    convertToSupportedSampleFormat(audioDevice);
+
     m_audioSink.reset(new QAudioSink(audioDevice, m_audioBuffer.format()));
 
     connect(m_audioSink.get(), &QAudioSink::stateChanged, this, &QSoundEffectPrivate::stateChanged);
@@ -206,6 +210,32 @@ bool QSoundEffectPrivate::updateAudioOutput()
     return true;
 }
 
+void QSoundEffectPrivate::convertToSupportedSampleFormat(const QAudioDevice &audioDevice)
+{
+    const QAudioFormat bufferFormat = m_audioBuffer.format();
+    if (audioDevice.isNull() || audioDevice.isFormatSupported(bufferFormat))
+        return;
+
+    // Converting the sample format once up front is cheap, and spares the backend a
+    // conversion on every period
+    QAudioFormat format = bufferFormat;
+    format.setSampleFormat(audioDevice.preferredFormat().sampleFormat());
+    if (format.sampleFormat() == bufferFormat.sampleFormat()
+        || !audioDevice.isFormatSupported(format))
+        return;
+
+    qCDebug(qLcSoundEffect) << "Converting the sample format" << bufferFormat.sampleFormat()
+                            << "=>" << format.sampleFormat();
+
+    QByteArray data(format.bytesForFrames(m_audioBuffer.frameCount()), Qt::Uninitialized);
+    QAudioHelperInternal::convertSamples(
+            QSpan<const std::byte>{ m_audioBuffer.constData<std::byte>(), m_audioBuffer.byteCount() },
+            bufferFormat.sampleFormat(),
+            QSpan<std::byte>{ reinterpret_cast<std::byte *>(data.data()), data.size() },
+            format.sampleFormat());
+    m_audioBuffer = QAudioBuffer(data, format);
+}
+
 qint64 QSoundEffectPrivate::readData(char *data, qint64 len)
 {
     qCDebug(qLcSoundEffect) << this << "readData" << len << m_runningCount;
@@ -94,6 +94,14 @@ PwNodeHandle QAudioContextManager::bindNode(ObjectId id)
     };
 }
 
+PwStreamHandle QAudioContextManager::createStream(const char *name, PwPropertiesHandle props)
+{
+    Q_ASSERT(isConnected());
+    return PwStreamHandle{
+        pw_stream_new(m_coreConnection.get(), name, props.release()),
+    };
+}
+
 void QAudioContextManager::prepareEventLoop()
 {
     m_eventLoop = PwThreadLoopHandle{
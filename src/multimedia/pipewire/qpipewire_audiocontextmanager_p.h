@@ -59,6 +59,9 @@ public:
 
     PwNodeHandle bindNode(ObjectId id);
 
+    // needs to be called with the event loop lock held
+    PwStreamHandle createStream(const char *name, PwPropertiesHandle props);
+
 private:
     std::shared_ptr<QPipeWireInstance> m_libraryInstance;
 
@@ -4,6 +4,8 @@
 #include "qpipewire_audiodevices_p.h"
 
 #include "qpipewire_audiocontextmanager_p.h"
+#include "qpipewire_audiosink_p.h"
+#include "qpipewire_audiosource_p.h"
 #include "qpipewire_instance_p.h"
 
 QT_BEGIN_NAMESPACE
@@ -55,14 +57,15 @@ QList<QAudioDevice> QAudioDevices::findAudioOutputs() const
     return m_sinkDeviceList;
 }
 
-QPlatformAudioSource *QAudioDevices::createAudioSource(const QAudioDevice &, QObject *)
+QPlatformAudioSource *QAudioDevices::createAudioSource(const QAudioDevice &device,
+                                                      QObject *parent)
 {
-    return {};
+    return new QPipewireAudioSource(device, parent);
 }
 
-QPlatformAudioSink *QAudioDevices::createAudioSink(const QAudioDevice &, QObject *)
+QPlatformAudioSink *QAudioDevices::createAudioSink(const QAudioDevice &device, QObject *parent)
 {
-    return {};
+    return new QPipewireAudioSink(device, parent);
 }
 
 } // namespace QtPipeWire
@@ -0,0 +1,347 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qpipewire_audiosink_p.h"
+
+#include <QtCore/qdebug.h>
+#include <QtCore/qloggingcategory.h>
+#include <QtMultimedia/private/qaudio_qiodevice_support_p.h>
+#include <QtMultimedia/private/qaudiohelpers_p.h>
+
+#include <algorithm>
+
+QT_BEGIN_NAMESPACE
+
+namespace QtPipeWire {
+
+Q_STATIC_LOGGING_CATEGORY(lcPipewireAudioSink, "qt.multimedia.pipewire.audiosink");
+
+namespace {
+
+constexpr qint64 DefaultBufferDurationUs = 40'000;
+constexpr int MinQuantumFrames = 32;
+constexpr int DrainTimeoutMs = 500;
+
+} // namespace
+
+QPipewireAudioSink::QPipewireAudioSink(const QAudioDevice &device, QObject *parent)
+    : QPlatformAudioSink(parent), m_nodeName(device.id()), m_stateMachine(*this)
+{
+    m_timer.setTimerType(Qt::PreciseTimer);
+    connect(&m_timer, &QTimer::timeout, this, [this] {
+        if (m_pullDevice)
+            pullFromDevice();
+        updateState();
+    });
+}
+
+QPipewireAudioSink::~QPipewireAudioSink()
+{
+    close();
+}
+
+void QPipewireAudioSink::start(QIODevice *device)
+{
+    reset();
+
+    if (!device) {
+        m_stateMachine.setError(QAudio::IOError);
+        return;
+    }
+
+    if (!open())
+        return;
+
+    m_pullDevice = device;
+    connect(device, &QIODevice::readyRead, this, &QPipewireAudioSink::pullFromDevice);
+
+    // prefill the buffer before the first graph cycle
+    pullFromDevice();
+
+    m_stateMachine.start();
+}
+
+QIODevice *QPipewireAudioSink::start()
+{
+    reset();
+
+    if (!open())
+        return nullptr;
+
+    m_pushDevice = std::make_unique<QtPrivate::QIODeviceRingBufferWriter<std::byte>>(
+            m_ringBuffer.get());
+    m_pushDevice->open(QIODevice::WriteOnly | QIODevice::Unbuffered);
+
+    m_stateMachine.start(QAudioStateMachine::RunningState::Idle);
+
+    return m_pushDevice.get();
+}
+
+bool QPipewireAudioSink::start(AudioCallback &&callback)
+{
+    reset();
+
+    // set before the stream is connected, so the data thread never observes a change
+    m_audioCallback = std::move(callback);
+
+    if (!open()) {
+        m_audioCallback = {};
+        return false;
+    }
+
+    m_stateMachine.start();
+    return true;
+}
+
+void QPipewireAudioSink::stop()
+{
+    // in callback mode, there is no buffered data to drain
+    const bool shouldDrain = !m_audioCallback;
+    if (auto notifier = m_stateMachine.stop(QAudio::NoError, shouldDrain)) {
+        if (notifier.isDraining() && !m_drainSemaphore.tryAcquire(1, DrainTimeoutMs)) {
+            const bool wasDraining = m_stateMachine.onDrained();
+
+            qCWarning(lcPipewireAudioSink)
+                    << "Failed wait for getting sink drained; was draining:" << wasDraining;
+
+            // the data thread has released the semaphore between tryAcquire and onDrained
+            if (!wasDraining)
+                m_drainSemaphore.acquire();
+        }
+
+        close();
+    }
+}
+
+void QPipewireAudioSink::reset()
+{
+    if (auto notifier = m_stateMachine.stopOrUpdateError())
+        close();
+}
+
+void QPipewireAudioSink::suspend()
+{
+    if (auto notifier = m_stateMachine.suspend()) {
+        m_timer.stop();
+        m_stream->setActive(false);
+    }
+}
+
+void QPipewireAudioSink::resume()
+{
+    if (auto notifier = m_stateMachine.resume()) {
+        m_stream->setActive(true);
+        m_timer.start();
+    }
+}
+
+qsizetype QPipewireAudioSink::bytesFree() const
+{
+    if (!m_ringBuffer || !m_stateMachine.isActiveOrIdle())
+        return 0;
+
+    return m_ringBuffer->free();
+}
+
+void QPipewireAudioSink::setBufferSize(qsizetype value)
+{
+    m_userBufferSize = value;
+}
+
+qsizetype QPipewireAudioSink::bufferSize() const
+{
+    if (m_bufferSize > 0)
+        return m_bufferSize;
+    if (m_userBufferSize > 0)
+        return m_userBufferSize;
+    return m_format.isValid() ? m_format.bytesForDuration(DefaultBufferDurationUs) : 0;
+}
+
+qint64 QPipewireAudioSink::processedUSecs() const
+{
+    if (!m_stream)
+        return 0;
+
+    const qint64 framesConsumed = m_processedFrames.load(std::memory_order_relaxed);
+    const qint64 usecsConsumed = framesConsumed * 1'000'000 / m_format.sampleRate();
+
+    // the data handed over to the graph is played back after the graph latency
+    const qint64 latency = m_stream->graphLatencyUSecs().value_or(0);
+    return std::max<qint64>(usecsConsumed - latency, 0);
+}
+
+QAudio::Error QPipewireAudioSink::error() const
+{
+    return m_stateMachine.error();
+}
+
+QAudio::State QPipewireAudioSink::state() const
+{
+    return m_stateMachine.state();
+}
+
+void QPipewireAudioSink::setFormat(const QAudioFormat &format)
+{
+    m_format = format;
+}
+
+QAudioFormat QPipewireAudioSink::format() const
+{
+    return m_format;
+}
+
+void QPipewireAudioSink::setVolume(qreal volume)
+{
+    m_volume.setVolume(float(qBound(qreal(0), volume, qreal(1))));
+}
+
+qreal QPipewireAudioSink::volume() const
+{
+    return m_volume.volume();
+}
+
+bool QPipewireAudioSink::open()
+{
+    if (!m_format.isValid()) {
+        m_stateMachine.stopOrUpdateError(QAudio::OpenError);
+        return false;
+    }
+
+    const int bytesPerFrame = m_format.bytesPerFrame();
+    m_bufferSize = bufferSize();
+    m_bufferSize = std::max<qsizetype>(m_bufferSize - m_bufferSize % bytesPerFrame, bytesPerFrame);
+
+    m_ringBuffer = std::make_unique<RingBuffer>(int(m_bufferSize));
+    m_processedFrames.store(0, std::memory_order_relaxed);
+    // the data thread isn't running yet; start without a ramp
+    m_volume.reset();
+    m_underrun.store(false, std::memory_order_relaxed);
+
+    // request graph cycles of a quarter of the buffer, so that the buffer can be refilled
+    // on time by the application
+    const int quantumFrames =
+            std::max(m_format.framesForBytes(qint32(m_bufferSize)) / 4, MinQuantumFrames);
+
+    m_stream = std::make_unique<QAudioStream>(*this, SPA_DIRECTION_OUTPUT, m_format);
+    if (!m_stream->connect(m_nodeName, quantumFrames)) {
+        m_stream.reset();
+        m_ringBuffer.reset();
+        m_bufferSize = 0;
+        m_stateMachine.stopOrUpdateError(QAudio::OpenError);
+        return false;
+    }
+
+    const qint64 quantumDurationMs = m_format.durationForFrames(quantumFrames) / 1000;
+    m_timer.start(std::max<int>(int(quantumDurationMs / 2), 1));
+
+    return true;
+}
+
+void QPipewireAudioSink::close()
+{
+    m_timer.stop();
+
+    // disconnecting the stream waits for the data thread, so the ring buffer is not
+    // accessed anymore afterwards
+    m_stream.reset();
+
+    if (m_pullDevice) {
+        disconnect(m_pullDevice, &QIODevice::readyRead, this, nullptr);
+        m_pullDevice = nullptr;
+    }
+
+    m_pushDevice.reset();
+    m_audioCallback = {};
+    m_ringBuffer.reset();
+    m_bufferSize = 0;
+}
+
+void QPipewireAudioSink::pullFromDevice()
+{
+    if (!m_pullDevice || !m_ringBuffer)
+        return;
+
+    const qint64 bytesRead =
+            QtPrivate::fillRingBufferFromDevice(*m_pullDevice, *m_ringBuffer,
+                                                m_format.bytesPerFrame());
+    if (bytesRead < 0)
+        m_stateMachine.updateActiveOrIdle(QAudioStateMachine::RunningState::Idle,
+                                          QAudio::IOError);
+}
+
+void QPipewireAudioSink::updateState()
+{
+    if (m_underrun.exchange(false, std::memory_order_relaxed)) {
+        const bool atEnd = m_pullDevice && m_pullDevice->atEnd();
+        m_stateMachine.updateActiveOrIdle(QAudioStateMachine::RunningState::Idle,
+                                          atEnd ? QAudio::NoError : QAudio::UnderrunError);
+        return;
+    }
+
+    if (m_ringBuffer && m_ringBuffer->used() > 0)
+        m_stateMachine.activateFromIdle();
+}
+
+void QPipewireAudioSink::invokeCallbackRT(QSpan<std::byte> buffer) QT_MM_NONBLOCKING
+{
+    QtMultimediaPrivate::invokeNonBlocking(m_audioCallback, buffer);
+    m_volume.apply(m_format, buffer);
+}
+
+qsizetype QPipewireAudioSink::processRT(QSpan<std::byte> buffer)
+{
+    const auto [drained, stopped] = m_stateMachine.getDrainedAndStopped();
+    const bool running = !stopped && m_stateMachine.state() != QAudio::SuspendedState;
+    const bool draining = stopped && !drained;
+
+    qsizetype bytesConsumed = 0;
+
+    if (m_audioCallback && running) {
+        invokeCallbackRT(buffer);
+        bytesConsumed = buffer.size();
+        m_processedFrames.fetch_add(buffer.size() / m_format.bytesPerFrame(),
+                                    std::memory_order_relaxed);
+    } else if (running || draining) {
+        m_ringBuffer->consume(int(buffer.size()), [&](QSpan<const std::byte> region) {
+            m_volume.apply(m_format, region, buffer.subspan(bytesConsumed, region.size()));
+            bytesConsumed += region.size();
+        });
+
+        m_processedFrames.fetch_add(bytesConsumed / m_format.bytesPerFrame(),
+                                    std::memory_order_relaxed);
+    }
+
+    if (bytesConsumed < buffer.size()) {
+        const std::byte silence = m_format.sampleFormat() == QAudioFormat::UInt8
+                ? std::byte{ 0x80 }
+                : std::byte{ 0 };
+        std::fill(buffer.begin() + bytesConsumed, buffer.end(), silence);
+
+        if (running && !m_audioCallback)
+            m_underrun.store(true, std::memory_order_relaxed);
+    }
+
+    if (draining && m_ringBuffer->used() == 0 && m_stateMachine.onDrained())
+        m_drainSemaphore.release();
+
+    return buffer.size();
+}
+
+void QPipewireAudioSink::streamStateChanged(pw_stream_state state, const char *error)
+{
+    if (state != PW_STREAM_STATE_ERROR)
+        return;
+
+    qCWarning(lcPipewireAudioSink) << "Stream error:" << (error ? error : "unknown");
+
+    QMetaObject::invokeMethod(this, [this] {
+        if (auto notifier = m_stateMachine.stopOrUpdateError(QAudio::IOError))
+            close();
+    });
+}
+
+} // namespace QtPipeWire
+
+QT_END_NAMESPACE
+
+#include "moc_qpipewire_audiosink_p.cpp"
@@ -0,0 +1,112 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QPIPEWIRE_AUDIOSINK_P_H
+#define QPIPEWIRE_AUDIOSINK_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API. It exists purely as an
+// implementation detail. This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/qpointer.h>
+#include <QtCore/qsemaphore.h>
+#include <QtCore/qtimer.h>
+#include <QtMultimedia/private/qaudio_rtsan_support_p.h>
+#include <QtMultimedia/private/qaudiohelpers_p.h>
+#include <QtMultimedia/private/qaudioringbuffer_p.h>
+#include <QtMultimedia/private/qaudiostatemachine_p.h>
+#include <QtMultimedia/private/qaudiosystem_p.h>
+
+#include "qpipewire_audiostream_p.h"
+
+#include <atomic>
+#include <memory>
+
+QT_BEGIN_NAMESPACE
+
+namespace QtPipeWire {
+
+// The data thread of the stream only consumes the lock-free ring buffer, or invokes the callback.
+// In pull mode, the user's device has the affinity of the owner thread, so the ring buffer is
+// refilled there, on readyRead() and on each tick of m_timer. Only the callback mode renders
+// the audio on the data thread, independently of the load of the owner thread.
+class QPipewireAudioSink final : public QPlatformAudioSink, private QAudioStream::Handler
+{
+    Q_OBJECT
+
+public:
+    QPipewireAudioSink(const QAudioDevice &, QObject *parent);
+    ~QPipewireAudioSink() override;
+
+    void start(QIODevice *device) override;
+    QIODevice *start() override;
+    bool start(AudioCallback &&callback) override;
+    void stop() override;
+    void reset() override;
+    void suspend() override;
+    void resume() override;
+    qsizetype bytesFree() const override;
+    void setBufferSize(qsizetype value) override;
+    qsizetype bufferSize() const override;
+    qint64 processedUSecs() const override;
+    QAudio::Error error() const override;
+    QAudio::State state() const override;
+    void setFormat(const QAudioFormat &format) override;
+    QAudioFormat format() const override;
+
+    void setVolume(qreal volume) override;
+    qreal volume() const override;
+
+private:
+    using RingBuffer = QtPrivate::QAudioRingBuffer<std::byte>;
+
+    bool open();
+    void close();
+
+    void pullFromDevice();
+    void updateState();
+
+    void invokeCallbackRT(QSpan<std::byte> buffer) QT_MM_NONBLOCKING;
+
+    // QAudioStream::Handler
+    qsizetype processRT(QSpan<std::byte> buffer) override;
+    void streamStateChanged(pw_stream_state state, const char *error) override;
+
+    const QByteArray m_nodeName;
+    QAudioFormat m_format;
+    qsizetype m_userBufferSize = 0;
+    qsizetype m_bufferSize = 0;
+    QAudioHelperInternal::SmoothedVolume m_volume;
+
+    std::unique_ptr<QAudioStream> m_stream;
+    std::unique_ptr<RingBuffer> m_ringBuffer;
+
+    // pull mode: the ring buffer is refilled from the user's device on the owner thread
+    QPointer<QIODevice> m_pullDevice;
+    // push mode: the user writes to a device backed by the ring buffer
+    std::unique_ptr<QIODevice> m_pushDevice;
+    // callback mode: the data thread invokes the callback instead of using the ring buffer
+    AudioCallback m_audioCallback;
+
+    // polls the data thread for state changes, and refills the ring buffer in pull mode
+    QTimer m_timer;
+
+    std::atomic<qint64> m_processedFrames{ 0 };
+    std::atomic_bool m_underrun{ false };
+    QSemaphore m_drainSemaphore;
+
+    QAudioStateMachine m_stateMachine;
+};
+
+} // namespace QtPipeWire
+
+QT_END_NAMESPACE
+
+#endif // QPIPEWIRE_AUDIOSINK_P_H
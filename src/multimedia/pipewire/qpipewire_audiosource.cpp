@@ -0,0 +1,318 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qpipewire_audiosource_p.h"
+
+#include <QtCore/qdebug.h>
+#include <QtCore/qloggingcategory.h>
+#include <QtMultimedia/private/qaudio_qiodevice_support_p.h>
+#include <QtMultimedia/private/qaudiohelpers_p.h>
+
+#include <algorithm>
+
+QT_BEGIN_NAMESPACE
+
+namespace QtPipeWire {
+
+Q_STATIC_LOGGING_CATEGORY(lcPipewireAudioSource, "qt.multimedia.pipewire.audiosource");
+
+namespace {
+
+constexpr qint64 DefaultBufferDurationUs = 40'000;
+constexpr int MinQuantumFrames = 32;
+
+} // namespace
+
+QPipewireAudioSource::QPipewireAudioSource(const QAudioDevice &device, QObject *parent)
+    : QPlatformAudioSource(parent), m_nodeName(device.id()), m_stateMachine(*this)
+{
+    m_timer.setTimerType(Qt::PreciseTimer);
+    connect(&m_timer, &QTimer::timeout, this, &QPipewireAudioSource::updateState);
+}
+
+QPipewireAudioSource::~QPipewireAudioSource()
+{
+    close();
+}
+
+void QPipewireAudioSource::start(QIODevice *device)
+{
+    reset();
+
+    if (!device) {
+        m_stateMachine.setError(QAudio::IOError);
+        return;
+    }
+
+    if (!open())
+        return;
+
+    m_pushDevice = device;
+
+    m_stateMachine.start();
+}
+
+QIODevice *QPipewireAudioSource::start()
+{
+    reset();
+
+    if (!open())
+        return nullptr;
+
+    m_pullDevice = std::make_unique<QtPrivate::QIODeviceRingBufferReader<std::byte>>(
+            m_ringBuffer.get());
+    m_pullDevice->open(QIODevice::ReadOnly | QIODevice::Unbuffered);
+
+    m_stateMachine.start(QAudioStateMachine::RunningState::Idle);
+
+    return m_pullDevice.get();
+}
+
+bool QPipewireAudioSource::start(AudioCallback &&callback)
+{
+    reset();
+
+    // set before the stream is connected, so the data thread never observes a change
+    m_audioCallback = std::move(callback);
+
+    if (!open()) {
+        m_audioCallback = {};
+        return false;
+    }
+
+    m_stateMachine.start();
+    return true;
+}
+
+void QPipewireAudioSource::stop()
+{
+    if (auto notifier = m_stateMachine.stop()) {
+        // hand over the data captured so far before closing the stream
+        if (m_pushDevice)
+            pushToDevice();
+
+        close();
+    }
+}
+
+void QPipewireAudioSource::reset()
+{
+    if (auto notifier = m_stateMachine.stopOrUpdateError())
+        close();
+}
+
+void QPipewireAudioSource::suspend()
+{
+    if (auto notifier = m_stateMachine.suspend()) {
+        m_timer.stop();
+        m_stream->setActive(false);
+    }
+}
+
+void QPipewireAudioSource::resume()
+{
+    if (auto notifier = m_stateMachine.resume()) {
+        m_stream->setActive(true);
+        m_timer.start();
+    }
+}
+
+qsizetype QPipewireAudioSource::bytesReady() const
+{
+    if (!m_ringBuffer || !m_stateMachine.isActiveOrIdle())
+        return 0;
+
+    return m_ringBuffer->used();
+}
+
+void QPipewireAudioSource::setBufferSize(qsizetype value)
+{
+    m_userBufferSize = value;
+}
+
+qsizetype QPipewireAudioSource::bufferSize() const
+{
+    if (m_bufferSize > 0)
+        return m_bufferSize;
+    if (m_userBufferSize > 0)
+        return m_userBufferSize;
+    return m_format.isValid() ? m_format.bytesForDuration(DefaultBufferDurationUs) : 0;
+}
+
+qint64 QPipewireAudioSource::processedUSecs() const
+{
+    const qint64 framesCaptured = m_processedFrames.load(std::memory_order_relaxed);
+    return m_format.isValid() ? framesCaptured * 1'000'000 / m_format.sampleRate() : 0;
+}
+
+QAudio::Error QPipewireAudioSource::error() const
+{
+    return m_stateMachine.error();
+}
+
+QAudio::State QPipewireAudioSource::state() const
+{
+    return m_stateMachine.state();
+}
+
+void QPipewireAudioSource::setFormat(const QAudioFormat &format)
+{
+    m_format = format;
+}
+
+QAudioFormat QPipewireAudioSource::format() const
+{
+    return m_format;
+}
+
+void QPipewireAudioSource::setVolume(qreal volume)
+{
+    m_volume.setVolume(float(qBound(qreal(0), volume, qreal(1))));
+}
+
+qreal QPipewireAudioSource::volume() const
+{
+    return m_volume.volume();
+}
+
+bool QPipewireAudioSource::open()
+{
+    if (!m_format.isValid()) {
+        m_stateMachine.stopOrUpdateError(QAudio::OpenError);
+        return false;
+    }
+
+    const int bytesPerFrame = m_format.bytesPerFrame();
+    m_bufferSize = bufferSize();
+    m_bufferSize = std::max<qsizetype>(m_bufferSize - m_bufferSize % bytesPerFrame, bytesPerFrame);
+
+    m_ringBuffer = std::make_unique<RingBuffer>(int(m_bufferSize));
+    m_processedFrames.store(0, std::memory_order_relaxed);
+    // the data thread isn't running yet; start without a ramp
+    m_volume.reset();
+    m_overrun.store(false, std::memory_order_relaxed);
+
+    // request graph cycles of a quarter of the buffer, so that the buffer can be drained
+    // on time by the application
+    const int quantumFrames =
+            std::max(m_format.framesForBytes(qint32(m_bufferSize)) / 4, MinQuantumFrames);
+
+    m_stream = std::make_unique<QAudioStream>(*this, SPA_DIRECTION_INPUT, m_format);
+    if (!m_stream->connect(m_nodeName, quantumFrames)) {
+        m_stream.reset();
+        m_ringBuffer.reset();
+        m_bufferSize = 0;
+        m_stateMachine.stopOrUpdateError(QAudio::OpenError);
+        return false;
+    }
+
+    const qint64 quantumDurationMs = m_format.durationForFrames(quantumFrames) / 1000;
+    m_timer.start(std::max<int>(int(quantumDurationMs / 2), 1));
+
+    return true;
+}
+
+void QPipewireAudioSource::close()
+{
+    m_timer.stop();
+
+    // disconnecting the stream waits for the data thread, so the ring buffer is not
+    // accessed anymore afterwards
+    m_stream.reset();
+
+    m_pushDevice = nullptr;
+    m_pullDevice.reset();
+    m_audioCallback = {};
+    m_ringBuffer.reset();
+    m_bufferSize = 0;
+}
+
+void QPipewireAudioSource::pushToDevice()
+{
+    if (!m_pushDevice || !m_ringBuffer)
+        return;
+
+    m_ringBuffer->consumeAll([&](QSpan<const std::byte> region) {
+        const qint64 bytesWritten = QtPrivate::writeToDevice(*m_pushDevice, region);
+        if (bytesWritten != region.size())
+            qCDebug(lcPipewireAudioSource) << "Dropped" << region.size() - bytesWritten
+                                           << "bytes not accepted by the device";
+    });
+}
+
+void QPipewireAudioSource::updateState()
+{
+    if (m_overrun.exchange(false, std::memory_order_relaxed))
+        qCDebug(lcPipewireAudioSource) << "Buffer overrun, captured data has been dropped";
+
+    if (!m_ringBuffer || m_ringBuffer->used() == 0)
+        return;
+
+    if (m_pushDevice) {
+        pushToDevice();
+    } else if (m_pullDevice) {
+        m_stateMachine.activateFromIdle();
+        emit m_pullDevice->readyRead();
+    }
+}
+
+void QPipewireAudioSource::invokeCallbackRT(QSpan<std::byte> buffer) QT_MM_NONBLOCKING
+{
+    // the captured buffer is owned by the stream until it is queued again
+    m_volume.apply(m_format, buffer);
+    QtMultimediaPrivate::invokeNonBlocking(m_audioCallback, QSpan<const std::byte>{ buffer });
+}
+
+qsizetype QPipewireAudioSource::processRT(QSpan<std::byte> buffer)
+{
+    const auto [drained, stopped] = m_stateMachine.getDrainedAndStopped();
+    Q_UNUSED(drained);
+    if (stopped || m_stateMachine.state() == QAudio::SuspendedState)
+        return 0;
+
+    const int bytesPerFrame = m_format.bytesPerFrame();
+
+    if (m_audioCallback) {
+        invokeCallbackRT(buffer);
+        m_processedFrames.fetch_add(buffer.size() / bytesPerFrame, std::memory_order_relaxed);
+        return buffer.size();
+    }
+
+    qsizetype bytesWritten = 0;
+    while (bytesWritten < buffer.size()) {
+        QSpan<std::byte> region =
+                m_ringBuffer->acquireWriteRegion(int(buffer.size() - bytesWritten));
+        if (region.isEmpty())
+            break;
+
+        m_volume.apply(m_format, buffer.subspan(bytesWritten, region.size()), region);
+        m_ringBuffer->releaseWriteRegion(int(region.size()));
+        bytesWritten += region.size();
+    }
+
+    if (bytesWritten < buffer.size())
+        m_overrun.store(true, std::memory_order_relaxed);
+
+    m_processedFrames.fetch_add(buffer.size() / bytesPerFrame, std::memory_order_relaxed);
+
+    return bytesWritten;
+}
+
+void QPipewireAudioSource::streamStateChanged(pw_stream_state state, const char *error)
+{
+    if (state != PW_STREAM_STATE_ERROR)
+        return;
+
+    qCWarning(lcPipewireAudioSource) << "Stream error:" << (error ? error : "unknown");
+
+    QMetaObject::invokeMethod(this, [this] {
+        if (auto notifier = m_stateMachine.stopOrUpdateError(QAudio::IOError))
+            close();
+    });
+}
+
+} // namespace QtPipeWire
+
+QT_END_NAMESPACE
+
+#include "moc_qpipewire_audiosource_p.cpp"
@@ -0,0 +1,106 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QPIPEWIRE_AUDIOSOURCE_P_H
+#define QPIPEWIRE_AUDIOSOURCE_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API. It exists purely as an
+// implementation detail. This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/qpointer.h>
+#include <QtCore/qtimer.h>
+#include <QtMultimedia/private/qaudio_rtsan_support_p.h>
+#include <QtMultimedia/private/qaudiohelpers_p.h>
+#include <QtMultimedia/private/qaudioringbuffer_p.h>
+#include <QtMultimedia/private/qaudiostatemachine_p.h>
+#include <QtMultimedia/private/qaudiosystem_p.h>
+
+#include "qpipewire_audiostream_p.h"
+
+#include <atomic>
+#include <memory>
+
+QT_BEGIN_NAMESPACE
+
+namespace QtPipeWire {
+
+class QPipewireAudioSource final : public QPlatformAudioSource, private QAudioStream::Handler
+{
+    Q_OBJECT
+
+public:
+    QPipewireAudioSource(const QAudioDevice &, QObject *parent);
+    ~QPipewireAudioSource() override;
+
+    void start(QIODevice *device) override;
+    QIODevice *start() override;
+    bool start(AudioCallback &&callback) override;
+    void stop() override;
+    void reset() override;
+    void suspend() override;
+    void resume() override;
+    qsizetype bytesReady() const override;
+    void setBufferSize(qsizetype value) override;
+    qsizetype bufferSize() const override;
+    qint64 processedUSecs() const override;
+    QAudio::Error error() const override;
+    QAudio::State state() const override;
+    void setFormat(const QAudioFormat &format) override;
+    QAudioFormat format() const override;
+
+    void setVolume(qreal volume) override;
+    qreal volume() const override;
+
+private:
+    using RingBuffer = QtPrivate::QAudioRingBuffer<std::byte>;
+
+    bool open();
+    void close();
+
+    void pushToDevice();
+    void updateState();
+
+    void invokeCallbackRT(QSpan<std::byte> buffer) QT_MM_NONBLOCKING;
+
+    // QAudioStream::Handler
+    qsizetype processRT(QSpan<std::byte> buffer) override;
+    void streamStateChanged(pw_stream_state state, const char *error) override;
+
+    const QByteArray m_nodeName;
+    QAudioFormat m_format;
+    qsizetype m_userBufferSize = 0;
+    qsizetype m_bufferSize = 0;
+    QAudioHelperInternal::SmoothedVolume m_volume;
+
+    std::unique_ptr<QAudioStream> m_stream;
+    std::unique_ptr<RingBuffer> m_ringBuffer;
+
+    // push mode: the ring buffer is drained into the user's device on the owner thread
+    QPointer<QIODevice> m_pushDevice;
+    // pull mode: the user reads from a device backed by the ring buffer
+    std::unique_ptr<QIODevice> m_pullDevice;
+    // callback mode: the data thread invokes the callback instead of using the ring buffer
+    AudioCallback m_audioCallback;
+
+    // polls the data thread for state changes, and drains the ring buffer in push mode
+    QTimer m_timer;
+
+    std::atomic<qint64> m_processedFrames{ 0 };
+    std::atomic_bool m_overrun{ false };
+
+    QAudioStateMachine m_stateMachine;
+};
+
+} // namespace QtPipeWire
+
+QT_END_NAMESPACE
+
+#endif // QPIPEWIRE_AUDIOSOURCE_P_H
@@ -0,0 +1,216 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qpipewire_audiostream_p.h"
+
+#include "qpipewire_audiocontextmanager_p.h"
+#include "qpipewire_propertydict_p.h"
+#include "qpipewire_spa_pod_support_p.h"
+
+#include <QtCore/qdebug.h>
+#include <QtCore/qloggingcategory.h>
+
+#include <spa/pod/builder.h>
+
+#include <vector>
+
+#if __has_include(<spa/param/audio/raw-utils.h>)
+#  include <spa/param/audio/raw-utils.h>
+#else
+#  include "qpipewire_spa_compat_p.h"
+#endif
+
+QT_BEGIN_NAMESPACE
+
+namespace QtPipeWire {
+
+Q_STATIC_LOGGING_CATEGORY(lcPipewireAudioStream, "qt.multimedia.pipewire.audiostream");
+
+QAudioStream::QAudioStream(Handler &handler, spa_direction direction, const QAudioFormat &format)
+    : m_handler(handler),
+      m_direction(direction),
+      m_format(format),
+      m_bytesPerFrame(format.bytesPerFrame())
+{
+    Q_ASSERT(m_bytesPerFrame > 0);
+}
+
+QAudioStream::~QAudioStream()
+{
+    disconnect();
+}
+
+bool QAudioStream::connect(const QByteArray &targetNodeName, int quantumFrames)
+{
+    Q_ASSERT(!m_stream);
+
+    static const pw_stream_events streamEvents = [] {
+        pw_stream_events events{};
+        events.version = PW_VERSION_STREAM_EVENTS;
+        events.state_changed = [](void *data, pw_stream_state old, pw_stream_state state,
+                                  const char *error) {
+            reinterpret_cast<QAudioStream *>(data)->stateChanged(old, state, error);
+        };
+        events.process = [](void *data) {
+            reinterpret_cast<QAudioStream *>(data)->process();
+        };
+        return events;
+    }();
+
+    const QByteArray latency =
+            QByteArray::number(quantumFrames) + '/' + QByteArray::number(m_format.sampleRate());
+    const bool isPlayback = m_direction == SPA_DIRECTION_OUTPUT;
+
+    std::vector<spa_dict_item> items{
+        { PW_KEY_MEDIA_TYPE, "Audio" },
+        { PW_KEY_MEDIA_CATEGORY, isPlayback ? "Playback" : "Capture" },
+        { PW_KEY_NODE_LATENCY, latency.constData() },
+    };
+#ifdef PW_KEY_TARGET_OBJECT
+    if (!targetNodeName.isEmpty())
+        items.push_back({ PW_KEY_TARGET_OBJECT, targetNodeName.constData() });
+#else
+    Q_UNUSED(targetNodeName);
+#endif
+
+    return QAudioContextManager::withEventLoopLock([&] {
+        m_stream = QAudioContextManager::instance()->createStream(
+                isPlayback ? "QAudioSink" : "QAudioSource", makeProperties(items));
+        if (!m_stream) {
+            qCWarning(lcPipewireAudioStream)
+                    << "pw_stream_new failed" << make_error_code().message();
+            return false;
+        }
+
+        m_streamListener = {};
+        pw_stream_add_listener(m_stream.get(), &m_streamListener, &streamEvents, this);
+
+        spa_audio_info_raw info = asSpaAudioInfoRaw(m_format);
+
+        uint8_t buffer[1024];
+        spa_pod_builder builder = SPA_POD_BUILDER_INIT(buffer, sizeof(buffer));
+        const spa_pod *params[] = {
+            spa_format_audio_raw_build(&builder, SPA_PARAM_EnumFormat, &info),
+        };
+
+        // The process callback runs on the realtime data thread instead of the event loop
+        const auto flags = pw_stream_flags(PW_STREAM_FLAG_AUTOCONNECT | PW_STREAM_FLAG_MAP_BUFFERS
+                                           | PW_STREAM_FLAG_RT_PROCESS);
+
+        const int status = pw_stream_connect(m_stream.get(), pw_direction(m_direction), PW_ID_ANY,
+                                             flags, params, std::size(params));
+        if (status < 0) {
+            qCWarning(lcPipewireAudioStream)
+                    << "pw_stream_connect failed" << make_error_code(-status).message();
+            m_stream = {};
+            return false;
+        }
+
+        qCDebug(lcPipewireAudioStream) << "Connected stream to" << targetNodeName
+                                       << "with requested latency" << latency;
+        return true;
+    });
+}
+
+void QAudioStream::disconnect()
+{
+    if (!m_stream)
+        return;
+
+    // pw_stream_disconnect synchronizes with the data thread, so no process callback is
+    // running once it returns
+    QAudioContextManager::withEventLoopLock([&] {
+        pw_stream_disconnect(m_stream.get());
+        spa_hook_remove(&m_streamListener);
+        m_stream = {};
+    });
+
+    m_quantumFrames.store(0, std::memory_order_relaxed);
+}
+
+void QAudioStream::setActive(bool active)
+{
+    if (!m_stream)
+        return;
+
+    QAudioContextManager::withEventLoopLock([&] {
+        pw_stream_set_active(m_stream.get(), active);
+    });
+}
+
+std::optional<qint64> QAudioStream::graphLatencyUSecs() const
+{
+    if (!m_stream)
+        return std::nullopt;
+
+    pw_time time{};
+#if PW_CHECK_VERSION(0, 3, 50)
+    if (pw_stream_get_time_n(m_stream.get(), &time, sizeof(time)) < 0)
+        return std::nullopt;
+#else
+    if (pw_stream_get_time(m_stream.get(), &time) < 0)
+        return std::nullopt;
+#endif
+
+    if (time.rate.denom == 0)
+        return std::nullopt;
+
+    // delay is expressed in ticks of the graph clock, queued in bytes of the stream format
+    const qint64 delayUSecs = time.delay * 1'000'000 * time.rate.num / time.rate.denom;
+    const qint64 queuedUSecs = m_format.durationForBytes(qint32(time.queued));
+
+    return std::max<qint64>(delayUSecs, 0) + queuedUSecs;
+}
+
+void QAudioStream::process()
+{
+    pw_buffer *buffer = pw_stream_dequeue_buffer(m_stream.get());
+    if (!buffer)
+        return;
+
+    spa_data &data = buffer->buffer->datas[0];
+    if (!data.data || !data.chunk) {
+        pw_stream_queue_buffer(m_stream.get(), buffer);
+        return;
+    }
+
+    std::byte *memory = static_cast<std::byte *>(data.data);
+
+    if (m_direction == SPA_DIRECTION_OUTPUT) {
+        uint32_t frames = data.maxsize / uint32_t(m_bytesPerFrame);
+#if PW_CHECK_VERSION(0, 3, 49)
+        // honour the quantum of the graph
+        if (buffer->requested)
+            frames = std::min<uint32_t>(frames, buffer->requested);
+#endif
+        m_quantumFrames.store(int(frames), std::memory_order_relaxed);
+
+        const qsizetype bytesWritten =
+                m_handler.processRT(QSpan{ memory, qsizetype(frames) * m_bytesPerFrame });
+
+        data.chunk->offset = 0;
+        data.chunk->stride = m_bytesPerFrame;
+        data.chunk->size = uint32_t(bytesWritten);
+    } else {
+        const uint32_t offset = std::min(data.chunk->offset, data.maxsize);
+        const uint32_t size = std::min(data.chunk->size, data.maxsize - offset);
+        m_quantumFrames.store(int(size) / m_bytesPerFrame, std::memory_order_relaxed);
+
+        m_handler.processRT(QSpan{ memory + offset, qsizetype(size) });
+    }
+
+    pw_stream_queue_buffer(m_stream.get(), buffer);
+}
+
+void QAudioStream::stateChanged(pw_stream_state oldState, pw_stream_state state,
+                                const char *error)
+{
+    qCDebug(lcPipewireAudioStream) << "Stream state changed:" << oldState << "->" << state
+                                   << (error ? error : "");
+
+    m_handler.streamStateChanged(state, error);
+}
+
+} // namespace QtPipeWire
+
+QT_END_NAMESPACE
@@ -0,0 +1,92 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QPIPEWIRE_AUDIOSTREAM_P_H
+#define QPIPEWIRE_AUDIOSTREAM_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API. It exists purely as an
+// implementation detail. This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/qbytearray.h>
+#include <QtCore/qspan.h>
+#include <QtMultimedia/qaudioformat.h>
+
+#include "qpipewire_support_p.h"
+
+#include <pipewire/pipewire.h>
+
+#include <optional>
+
+QT_BEGIN_NAMESPACE
+
+namespace QtPipeWire {
+
+// Wrapper around a pw_stream transporting interleaved audio in a fixed QAudioFormat.
+// The stream is processed on the realtime data thread of pipewire, so the handler is
+// supposed to exchange the data with the application via a lock-free ring buffer.
+class QAudioStream
+{
+public:
+    class Handler
+    {
+    public:
+        // Invoked on the data thread once per graph cycle.
+        // For playback streams, the handler fills the buffer and returns the number of
+        // bytes written. For capture streams, it consumes the captured data.
+        virtual qsizetype processRT(QSpan<std::byte> buffer) = 0;
+
+        // Invoked on the event loop thread
+        virtual void streamStateChanged(pw_stream_state state, const char *error) = 0;
+
+    protected:
+        ~Handler() = default;
+    };
+
+    QAudioStream(Handler &, spa_direction, const QAudioFormat &);
+    ~QAudioStream();
+
+    Q_DISABLE_COPY_MOVE(QAudioStream)
+
+    // Connects the stream to the node with the given name, or to the default node
+    // if the name is empty. quantumFrames is the requested number of frames per cycle.
+    bool connect(const QByteArray &targetNodeName, int quantumFrames);
+    void disconnect();
+    bool isConnected() const { return bool(m_stream); }
+
+    void setActive(bool active);
+
+    // Number of frames per cycle of the graph, as observed in the process callback
+    int quantumFrames() const { return m_quantumFrames.load(std::memory_order_relaxed); }
+
+    // Time until a frame queued now is played back (playback) or since the most recent
+    // captured frame has been recorded (capture)
+    std::optional<qint64> graphLatencyUSecs() const;
+
+private:
+    void process();
+    void stateChanged(pw_stream_state oldState, pw_stream_state state, const char *error);
+
+    Handler &m_handler;
+    const spa_direction m_direction;
+    const QAudioFormat m_format;
+    const int m_bytesPerFrame;
+
+    PwStreamHandle m_stream;
+    spa_hook m_streamListener{};
+
+    std::atomic_int m_quantumFrames{ 0 };
+};
+
+} // namespace QtPipeWire
+
+QT_END_NAMESPACE
+
+#endif // QPIPEWIRE_AUDIOSTREAM_P_H
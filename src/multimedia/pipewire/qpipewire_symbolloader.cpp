@@ -5,6 +5,8 @@
 
 #include <pipewire/pipewire.h>
 
+#include <cerrno>
+
 #if !PW_CHECK_VERSION(0, 3, 75)
 extern "C" {
 bool pw_check_library_version(int major, int minor, int micro);
@@ -41,6 +43,12 @@ INIT_FUNC(pw_stream_connect);
 INIT_FUNC(pw_stream_disconnect);
 INIT_FUNC(pw_stream_dequeue_buffer);
 INIT_FUNC(pw_stream_queue_buffer);
+INIT_FUNC(pw_stream_set_active);
+#if PW_CHECK_VERSION(0, 3, 50)
+INIT_OPT_FUNC(pw_stream_get_time_n);
+#else
+INIT_FUNC(pw_stream_get_time);
+#endif
 INIT_FUNC(pw_proxy_destroy);
 INIT_FUNC(pw_get_library_version);
 
@@ -73,6 +81,12 @@ DEFINE_FUNC(pw_stream_connect, 6);
 DEFINE_FUNC(pw_stream_disconnect, 1);
 DEFINE_FUNC(pw_stream_dequeue_buffer, 1);
 DEFINE_FUNC(pw_stream_queue_buffer, 2);
+DEFINE_FUNC(pw_stream_set_active, 2);
+#if PW_CHECK_VERSION(0, 3, 50)
+DEFINE_FUNC(pw_stream_get_time_n, 3, -ENOTSUP);
+#else
+DEFINE_FUNC(pw_stream_get_time, 2);
+#endif
 DEFINE_FUNC(pw_proxy_destroy, 1);
 DEFINE_FUNC(pw_get_library_version, 0);
 
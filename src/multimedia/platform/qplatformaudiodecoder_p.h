@@ -18,6 +18,7 @@
 #include <QtMultimedia/qaudiobuffer.h>
 #include <QtMultimedia/qaudiodecoder.h>
 #include <QtCore/qpair.h>
+#include <QtCore/qspan.h>
 #include <QtCore/qurl.h>
 #include <QtCore/private/qglobal_p.h>
 
@@ -47,6 +48,25 @@ public:
     virtual qint64 position() const { return m_position; }
     virtual qint64 duration() const { return m_duration; }
 
+    // Synchronous decoding, times in milliseconds. Backends that don't support it
+    // return false from startSynchronous().
+    virtual bool startSynchronous(qint64 from, qint64 to)
+    {
+        Q_UNUSED(from);
+        Q_UNUSED(to);
+        return false;
+    }
+    virtual qint64 readSynchronous(QSpan<std::byte> data)
+    {
+        Q_UNUSED(data);
+        return -1;
+    }
+    virtual bool seekSynchronous(qint64 position)
+    {
+        Q_UNUSED(position);
+        return false;
+    }
+
     void formatChanged(const QAudioFormat &format);
 
     void sourceChanged();
@@ -3,6 +3,8 @@
 
 #include "qplatformimagecapture_p.h"
 #include <QtCore/qstringlist.h>
+#include <QtCore/private/qmetaobject_p.h>
+#include <QtCore/private/qobject_p.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -12,6 +14,17 @@ QPlatformImageCapture::QPlatformImageCapture(QImageCapture *parent)
 {
 }
 
+bool QPlatformImageCapture::isPreviewRequested() const
+{
+    // QImageCapture connects to our own imageCaptured signal, so check its receivers instead
+    if (!m_imageCapture)
+        return isSignalConnected(QMetaMethod::fromSignal(&QPlatformImageCapture::imageCaptured));
+
+    static const int signalIndex = QMetaObjectPrivate::signalIndex(
+            QMetaMethod::fromSignal(&QImageCapture::imageCaptured));
+    return QObjectPrivate::get(m_imageCapture)->isSignalConnected(signalIndex);
+}
+
 QString QPlatformImageCapture::msgCameraNotReady()
 {
     return QImageCapture::tr("Camera is not ready.");
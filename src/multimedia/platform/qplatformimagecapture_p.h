@@ -69,6 +69,10 @@ public:
 
     QImageCapture *imageCapture() { return m_imageCapture; }
 
+    // Whether QImageCapture::imageCaptured has receivers, so that backends
+    // can skip building the preview image if nobody takes it
+    bool isPreviewRequested() const;
+
     static QString msgCameraNotReady();
     static QString msgImageCaptureNotSet();
 
@@ -9,6 +9,7 @@
 #include <qplatformaudiooutput_p.h>
 #include <qplatformaudioresampler_p.h>
 #include <qplatformvideodevices_p.h>
+#include <qplatformvideothumbnailextractor_p.h>
 #include <qmediadevices.h>
 #include <qcameradevice.h>
 #include <qloggingcategory.h>
@@ -121,6 +122,12 @@ QPlatformMediaIntegration::createAudioResampler(const QAudioFormat &, const QAud
     return notAvailable;
 }
 
+QMaybe<std::unique_ptr<QPlatformVideoThumbnailExtractor>>
+QPlatformMediaIntegration::createVideoThumbnailExtractor()
+{
+    return notAvailable;
+}
+
 QMaybe<QPlatformAudioInput *> QPlatformMediaIntegration::createAudioInput(QAudioInput *q)
 {
     return new QPlatformAudioInput(q);
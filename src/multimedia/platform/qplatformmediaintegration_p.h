@@ -52,6 +52,7 @@ class QPlatformMediaRecorder;
 class QPlatformSurfaceCapture;
 class QPlatformVideoDevices;
 class QPlatformVideoSink;
+class QPlatformVideoThumbnailExtractor;
 class QScreenCapture;
 class QVideoFrame;
 class QVideoSink;
@@ -92,6 +93,10 @@ public:
 
     virtual QMaybe<QPlatformVideoSink *> createVideoSink(QVideoSink *) { return notAvailable; }
 
+    // One extractor per thread; see QVideoThumbnailExtractor
+    virtual QMaybe<std::unique_ptr<QPlatformVideoThumbnailExtractor>>
+    createVideoThumbnailExtractor();
+
     QList<QCapturableWindow> capturableWindowsList();
     bool isCapturableWindowValid(const QCapturableWindowPrivate &);
 
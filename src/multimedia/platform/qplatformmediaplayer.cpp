@@ -59,4 +59,15 @@ void QPlatformMediaPlayer::pitchCompensationChanged(bool enabled) const
     emit player->pitchCompensationChanged(enabled);
 }
 
+bool QPlatformMediaPlayer::setFreeRunning(bool /*enabled*/)
+{
+    qWarning() << "Free-running playback is not supported on this QtMultimedia backend";
+    return false;
+}
+
+bool QPlatformMediaPlayer::isFreeRunning() const
+{
+    return false;
+}
+
 QT_END_NAMESPACE
@@ -19,6 +19,7 @@
 #include <QtMultimedia/qmediatimerange.h>
 #include <QtMultimedia/qaudiodevice.h>
 #include <QtMultimedia/qmediametadata.h>
+#include <QtMultimedia/qplaybackstatistics.h>
 
 #include <QtCore/qpair.h>
 #include <QtCore/private/qglobal_p.h>
@@ -138,6 +139,16 @@ public:
     virtual bool pitchCompensation() const;
     void pitchCompensationChanged(bool enabled) const;
 
+    // Free-running playback renders the frames as soon as the outputs took the previous ones,
+    // without pacing them against the wall clock or an audio device. It's meant for offline
+    // processing through QVideoSink and QAudioBufferOutput. Returns false if not supported.
+    virtual bool setFreeRunning(bool enabled);
+    virtual bool isFreeRunning() const;
+
+    // Polled by the application; the backends are supposed to take a snapshot
+    // of counters updated by the pipeline, without blocking it.
+    virtual QPlaybackStatistics statistics() const { return {}; }
+
 protected:
     explicit QPlatformMediaPlayer(QMediaPlayer *parent = nullptr);
 
@@ -39,6 +39,15 @@ void QPlatformMediaRecorder::durationChanged(qint64 duration)
     emit q->durationChanged(duration);
 }
 
+void QPlatformMediaRecorder::encoderLoadChanged(qreal load, qint64 droppedVideoFrames)
+{
+    if (qFuzzyCompare(m_encoderLoad, load) && m_droppedVideoFrames == droppedVideoFrames)
+        return;
+    m_encoderLoad = load;
+    m_droppedVideoFrames = droppedVideoFrames;
+    emit q->encoderLoadChanged();
+}
+
 void QPlatformMediaRecorder::actualLocationChanged(const QUrl &location)
 {
     if (m_actualLocation == location)
@@ -26,6 +26,7 @@
 #include <QtMultimedia/qmediarecorder.h>
 #include <QtMultimedia/qmediametadata.h>
 #include <QtMultimedia/qmediaformat.h>
+#include <QtMultimedia/qrecordingstatistics.h>
 #include <QtMultimedia/private/qerrorinfo_p.h>
 #include <QtCore/private/qglobal_p.h>
 
@@ -127,6 +128,12 @@ public:
 
     virtual qint64 duration() const { return m_duration; }
 
+    qreal encoderLoad() const { return m_encoderLoad; }
+    qint64 droppedVideoFrames() const { return m_droppedVideoFrames; }
+
+    // Polled by the application; see QPlatformMediaPlayer::statistics
+    virtual QRecordingStatistics statistics() const { return {}; }
+
     virtual void setMetaData(const QMediaMetaData &) {}
     virtual QMediaMetaData metaData() const { return {}; }
 
@@ -149,6 +156,7 @@ protected:
 
     void stateChanged(QMediaRecorder::RecorderState state);
     void durationChanged(qint64 position);
+    void encoderLoadChanged(qreal load, qint64 droppedVideoFrames);
     void actualLocationChanged(const QUrl &location);
     void updateError(QMediaRecorder::Error error, const QString &errorString);
     void metaDataChanged();
@@ -164,6 +172,8 @@ private:
     QUrl m_outputLocation;
     QPointer<QIODevice> m_outputDevice;
     qint64 m_duration = 0;
+    qreal m_encoderLoad = 0.;
+    qint64 m_droppedVideoFrames = 0;
 
     QMediaRecorder::RecorderState m_state = QMediaRecorder::StoppedState;
 };
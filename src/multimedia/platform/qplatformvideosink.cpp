@@ -6,9 +6,21 @@
 
 QT_BEGIN_NAMESPACE
 
-QPlatformVideoSink::QPlatformVideoSink(QVideoSink *parent) : QObject(parent), m_sink(parent) { }
+QPlatformVideoSink::QPlatformVideoSink(QVideoSink *parent)
+    : QObject(parent),
+      m_sink(parent),
+      m_frameCallbackState(std::make_shared<FrameCallbackState>(this))
+{
+}
 
-QPlatformVideoSink::~QPlatformVideoSink() = default;
+QPlatformVideoSink::~QPlatformVideoSink()
+{
+    // Waits for a running delivery; the producers may keep the state for a while
+    QMutexLocker locker(&m_frameCallbackState->m_mutex);
+    m_frameCallbackState->m_sink = nullptr;
+    m_frameCallbackState->m_callback = {};
+    m_frameCallbackState->m_hasCallback.store(false, std::memory_order_release);
+}
 
 QSize QPlatformVideoSink::nativeSize() const
 {
@@ -29,27 +41,85 @@ void QPlatformVideoSink::setNativeSize(QSize s)
 
 void QPlatformVideoSink::setVideoFrame(const QVideoFrame &frame)
 {
-    bool sizeChanged = false;
+    if (deliverVideoFrameDirectly(frame))
+        return;
 
-    {
-        QMutexLocker locker(&m_mutex);
-        if (frame == m_currentVideoFrame)
-            return;
-        m_currentVideoFrame = frame;
-        m_currentVideoFrame.setSubtitleText(m_subtitleText);
-        const QSize size = qRotatedFramePresentationSize(frame);
-        if (size != m_nativeSize) {
-            m_nativeSize = size;
-            sizeChanged = true;
-        }
-    }
+    const FrameUpdate update = updateCurrentVideoFrame(frame);
+    if (update == FrameUpdate::Unchanged)
+        return;
 
     // emit signals outside the mutex to avoid deadlocks on the user side
-    if (sizeChanged)
+    if (update == FrameUpdate::SizeChanged)
         emit m_sink->videoSizeChanged();
     emit m_sink->videoFrameChanged(frame);
 }
 
+void QPlatformVideoSink::setFrameCallback(QVideoSink::FrameCallback callback)
+{
+    const bool hasCallback = bool(callback);
+
+    {
+        // Waits for the running invocation of the previous callback, if any
+        QMutexLocker locker(&m_frameCallbackState->m_mutex);
+        m_frameCallbackState->m_callback = std::move(callback);
+        m_frameCallbackState->m_hasCallback.store(hasCallback, std::memory_order_release);
+    }
+
+    emit frameCallbackChanged(hasCallback);
+}
+
+bool QPlatformVideoSink::FrameCallbackState::invokeCallback(const QVideoFrame &frame)
+{
+    if (!hasCallback())
+        return false;
+
+    QMutexLocker locker(&m_mutex);
+    if (!m_sink || !m_callback)
+        return false;
+
+    const FrameUpdate update = m_sink->updateCurrentVideoFrame(frame);
+    if (update == FrameUpdate::SizeChanged) {
+        // the sink is alive while the mutex is locked, and the posted call is dropped
+        // if it's destroyed afterwards
+        QMetaObject::invokeMethod(m_sink->m_sink, &QVideoSink::videoSizeChanged,
+                                  Qt::QueuedConnection);
+    }
+
+    if (update != FrameUpdate::Unchanged)
+        m_callback(frame);
+
+    return true;
+}
+
+void QPlatformVideoSink::FrameCallbackState::deliver(const QVideoFrame &frame)
+{
+    if (invokeCallback(frame))
+        return;
+
+    QMutexLocker locker(&m_mutex);
+    if (!m_sink)
+        return;
+
+    QMetaObject::invokeMethod(m_sink, [sink = m_sink, frame] { sink->setVideoFrame(frame); },
+                              Qt::QueuedConnection);
+}
+
+QPlatformVideoSink::FrameUpdate QPlatformVideoSink::updateCurrentVideoFrame(const QVideoFrame &frame)
+{
+    QMutexLocker locker(&m_mutex);
+    if (frame == m_currentVideoFrame)
+        return FrameUpdate::Unchanged;
+
+    m_currentVideoFrame = frame;
+    m_currentVideoFrame.setSubtitleText(m_subtitleText);
+    const QSize size = qRotatedFramePresentationSize(frame);
+    if (size == m_nativeSize)
+        return FrameUpdate::Changed;
+
+    m_nativeSize = size;
+    return FrameUpdate::SizeChanged;
+}
+
 QVideoFrame QPlatformVideoSink::currentVideoFrame() const
 {
     QMutexLocker locker(&m_mutex);
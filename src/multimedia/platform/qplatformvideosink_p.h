@@ -26,6 +26,9 @@
 #include <qdebug.h>
 #include <private/qglobal_p.h>
 
+#include <atomic>
+#include <memory>
+
 QT_BEGIN_NAMESPACE
 
 // Required for QDoc workaround
@@ -60,6 +63,48 @@ public:
 
     QVideoFrame currentVideoFrame() const;
 
+    // The frame callback of the sink, shared with the threads producing the frames.
+    // Producers keep it instead of the sink: it stays valid while the sink is being
+    // destroyed, and the destructor of the sink waits for a running delivery.
+    class Q_MULTIMEDIA_EXPORT FrameCallbackState
+    {
+    public:
+        explicit FrameCallbackState(QPlatformVideoSink *sink) : m_sink(sink) { }
+
+        bool hasCallback() const { return m_hasCallback.load(std::memory_order_acquire); }
+
+        // Thread-safe; invokes the callback on the calling thread. Returns false if
+        // no callback is set or the sink is destroyed.
+        bool invokeCallback(const QVideoFrame &frame);
+
+        // Thread-safe; like invokeCallback, but hands the frame over to setVideoFrame
+        // on the sink's thread if the callback has been cleared in the meantime.
+        void deliver(const QVideoFrame &frame);
+
+    private:
+        friend class QPlatformVideoSink;
+
+        QMutex m_mutex;
+        QPlatformVideoSink *m_sink = nullptr;
+        QVideoSink::FrameCallback m_callback;
+        std::atomic_bool m_hasCallback{ false };
+    };
+
+    void setFrameCallback(QVideoSink::FrameCallback callback);
+    bool hasFrameCallback() const { return m_frameCallbackState->hasCallback(); }
+    std::shared_ptr<FrameCallbackState> frameCallbackState() const
+    {
+        return m_frameCallbackState;
+    }
+
+    // Thread-safe; to be called by backends on the thread producing the frame.
+    // Returns false if no frame callback is set, so that the frame has to be
+    // delivered via setVideoFrame on the sink's thread.
+    bool deliverVideoFrameDirectly(const QVideoFrame &frame)
+    {
+        return m_frameCallbackState->invokeCallback(frame);
+    }
+
     void setSubtitleText(const QString &subtitleText);
 
     QString subtitleText() const;
@@ -69,10 +114,17 @@ protected:
 
 Q_SIGNALS:
     void rhiChanged(QRhi *rhi);
+    // emitted on the sink's thread when a frame callback is set or cleared
+    void frameCallbackChanged(bool hasCallback);
+
+private:
+    enum class FrameUpdate { Unchanged, Changed, SizeChanged };
+    FrameUpdate updateCurrentVideoFrame(const QVideoFrame &frame);
 
 private:
     QVideoSink *m_sink = nullptr;
     mutable QMutex m_mutex;
+    const std::shared_ptr<FrameCallbackState> m_frameCallbackState;
     QSize m_nativeSize;
     QString m_subtitleText;
     QVideoFrame m_currentVideoFrame;
@@ -0,0 +1,43 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QPLATFORMVIDEOTHUMBNAILEXTRACTOR_P_H
+#define QPLATFORMVIDEOTHUMBNAILEXTRACTOR_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <private/qtmultimediaglobal_p.h>
+#include <private/qvideothumbnailextractor_p.h>
+
+#include <functional>
+
+QT_BEGIN_NAMESPACE
+
+class QIODevice;
+
+class QPlatformVideoThumbnailExtractor
+{
+public:
+    virtual ~QPlatformVideoThumbnailExtractor() = default;
+
+    // Extracts the thumbnails of the source from url or device synchronously, on the calling
+    // thread. isCancelled is polled while the source is opened and between the thumbnails.
+    // The index and the source of the result are set by the caller.
+    virtual QVideoThumbnailExtractor::Result
+    extract(const QUrl &url, QIODevice *device,
+            const QVideoThumbnailExtractor::Settings &settings,
+            const std::function<bool()> &isCancelled) = 0;
+};
+
+QT_END_NAMESPACE
+
+#endif // QPLATFORMVIDEOTHUMBNAILEXTRACTOR_P_H
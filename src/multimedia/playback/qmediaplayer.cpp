@@ -1100,6 +1100,23 @@ bool QMediaPlayer::pitchCompensation() const
     return d->control->pitchCompensation();
 }
 
+/*!
+    Returns a snapshot of the state of the playback pipeline, for example
+    how much data is buffered and how late the video frames are rendered.
+    The statistics are meant to be polled periodically to monitor the playback;
+    polling them doesn't affect the playback.
+
+    Returns null statistics if the backend doesn't support them.
+    \since 6.10
+
+    \sa QPlaybackStatistics
+*/
+QPlaybackStatistics QMediaPlayer::statistics() const
+{
+    Q_D(const QMediaPlayer);
+    return d->control ? d->control->statistics() : QPlaybackStatistics{};
+}
+
 /*!
     \fn QMediaPlayer::setPitchCompensation(bool enabled)
 
@@ -17,6 +17,7 @@ class QAudioDevice;
 class QMediaMetaData;
 class QMediaTimeRange;
 class QAudioBufferOutput;
+class QPlaybackStatistics;
 
 class QMediaPlayerPrivate;
 class Q_MULTIMEDIA_EXPORT QMediaPlayer : public QObject
@@ -168,6 +169,8 @@ public:
     PitchCompensationAvailability pitchCompensationAvailability() const;
     bool pitchCompensation() const;
 
+    QPlaybackStatistics statistics() const;
+
 public Q_SLOTS:
     void play();
     void pause();
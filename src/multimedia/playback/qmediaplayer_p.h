@@ -69,6 +69,9 @@ public:
     void setStatus(QMediaPlayer::MediaStatus status);
     void setError(QMediaPlayer::Error error, const QString &errorString);
 
+    // see QPlatformMediaPlayer::setFreeRunning
+    bool setFreeRunning(bool enabled) { return control && control->setFreeRunning(enabled); }
+
     void setVideoSink(QVideoSink *sink)
     {
         Q_Q(QMediaPlayer);
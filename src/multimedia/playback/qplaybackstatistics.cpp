@@ -0,0 +1,202 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qplaybackstatistics_p.h"
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QPlaybackStatistics
+    \since 6.10
+    \brief The QPlaybackStatistics class holds a snapshot of the state of the
+    media player's pipeline.
+    \inmodule QtMultimedia
+    \ingroup multimedia
+    \ingroup multimedia_playback
+
+    QPlaybackStatistics objects are returned by QMediaPlayer::statistics().
+    They describe how much data is buffered, how full the queues between the
+    decoders and the outputs are, and how well the outputs keep up with the
+    playback. Poll them periodically to monitor the playback.
+
+    The counters are updated by the playback pipeline as it goes, so polling
+    doesn't affect the playback. The backends don't measure all the values;
+    values that are not measured are \c 0. Durations are in microseconds.
+
+    \note Only the FFmpeg media backend reports the queue lengths and the audio
+    underruns. The GStreamer media backend reports the buffered duration and
+    the rendered and dropped video frames.
+
+    \sa QMediaPlayer::statistics(), QRecordingStatistics
+*/
+
+/*!
+    Constructs a null statistics object.
+
+    \sa isNull()
+*/
+QPlaybackStatistics::QPlaybackStatistics() noexcept = default;
+
+/*!
+    Copy constructs statistics from the \a other statistics.
+*/
+QPlaybackStatistics::QPlaybackStatistics(const QPlaybackStatistics &other) noexcept = default;
+
+/*!
+    \fn QPlaybackStatistics::QPlaybackStatistics(QPlaybackStatistics &&other)
+
+    Move constructs statistics from the \a other statistics.
+*/
+
+/*!
+    \fn void QPlaybackStatistics::swap(QPlaybackStatistics &other) noexcept
+
+    Swaps the statistics with the \a other statistics.
+*/
+
+/*!
+    Assigns \a other to this.
+*/
+QPlaybackStatistics &
+QPlaybackStatistics::operator=(const QPlaybackStatistics &other) noexcept = default;
+
+/*!
+    \fn QPlaybackStatistics &QPlaybackStatistics::operator=(QPlaybackStatistics &&other)
+
+    Moves \a other into this.
+*/
+
+/*!
+    Destructs the statistics object.
+*/
+QPlaybackStatistics::~QPlaybackStatistics() = default;
+
+/*! \fn bool QPlaybackStatistics::isNull() const noexcept
+
+    Returns true if the backend doesn't report any statistics, for example
+    if no media is loaded.
+*/
+
+/*!
+    \property QPlaybackStatistics::bufferedDuration
+
+    Returns the duration of the demuxed data that the decoders haven't processed yet.
+    If several streams are played, this is the duration of the least buffered stream.
+*/
+qint64 QPlaybackStatistics::bufferedDuration() const noexcept
+{
+    return d ? d->bufferedDuration : 0;
+}
+
+/*!
+    \property QPlaybackStatistics::bufferedBytes
+
+    Returns the size of the demuxed data that the decoders haven't processed yet.
+*/
+qint64 QPlaybackStatistics::bufferedBytes() const noexcept
+{
+    return d ? d->bufferedBytes : 0;
+}
+
+/*!
+    \property QPlaybackStatistics::videoDecoderQueueLength
+
+    Returns the number of decoded video frames waiting to be rendered.
+    If the queue is constantly full, the rendering is the bottleneck;
+    if it is constantly empty, the decoding is.
+
+    \sa videoDecoderQueueCapacity
+*/
+int QPlaybackStatistics::videoDecoderQueueLength() const noexcept
+{
+    return d ? d->videoDecoderQueueLength : 0;
+}
+
+/*!
+    \property QPlaybackStatistics::videoDecoderQueueCapacity
+
+    Returns the maximum number of decoded video frames waiting to be rendered.
+    The decoder pauses when the queue is full.
+
+    \sa videoDecoderQueueLength
+*/
+int QPlaybackStatistics::videoDecoderQueueCapacity() const noexcept
+{
+    return d ? d->videoDecoderQueueCapacity : 0;
+}
+
+/*!
+    \property QPlaybackStatistics::audioDecoderQueueLength
+
+    Returns the number of decoded audio frames waiting to be rendered.
+
+    \sa audioDecoderQueueCapacity
+*/
+int QPlaybackStatistics::audioDecoderQueueLength() const noexcept
+{
+    return d ? d->audioDecoderQueueLength : 0;
+}
+
+/*!
+    \property QPlaybackStatistics::audioDecoderQueueCapacity
+
+    Returns the maximum number of decoded audio frames waiting to be rendered.
+
+    \sa audioDecoderQueueLength
+*/
+int QPlaybackStatistics::audioDecoderQueueCapacity() const noexcept
+{
+    return d ? d->audioDecoderQueueCapacity : 0;
+}
+
+/*!
+    \property QPlaybackStatistics::renderedVideoFrames
+
+    Returns the number of video frames rendered since the media was loaded.
+*/
+qint64 QPlaybackStatistics::renderedVideoFrames() const noexcept
+{
+    return d ? d->renderedVideoFrames : 0;
+}
+
+/*!
+    \property QPlaybackStatistics::droppedVideoFrames
+
+    Returns the number of decoded video frames that were replaced by newer
+    frames before they could be presented, since the media was loaded.
+
+    \note Only the GStreamer media backend reports the dropped frames, when the
+    latest-frame-only mode of its video sink is enabled.
+*/
+qint64 QPlaybackStatistics::droppedVideoFrames() const noexcept
+{
+    return d ? d->droppedVideoFrames : 0;
+}
+
+/*!
+    \property QPlaybackStatistics::videoRenderLateness
+
+    Returns how late the most recent video frame was rendered compared to
+    its presentation time. Negative values mean that the frame was rendered early.
+*/
+qint64 QPlaybackStatistics::videoRenderLateness() const noexcept
+{
+    return d ? d->videoRenderLateness : 0;
+}
+
+/*!
+    \property QPlaybackStatistics::audioUnderruns
+
+    Returns the number of times the audio output ran out of data
+    since the media was loaded. Each underrun is audible as a gap.
+*/
+qint64 QPlaybackStatistics::audioUnderruns() const noexcept
+{
+    return d ? d->audioUnderruns : 0;
+}
+
+QPlaybackStatistics::QPlaybackStatistics(QPlaybackStatisticsPrivate *p) : d(p) { }
+
+QT_END_NAMESPACE
+
+#include "moc_qplaybackstatistics.cpp"
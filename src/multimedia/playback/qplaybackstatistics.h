@@ -0,0 +1,63 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QPLAYBACKSTATISTICS_H
+#define QPLAYBACKSTATISTICS_H
+
+#include <QtMultimedia/qtmultimediaglobal.h>
+#include <QtCore/qobjectdefs.h>
+#include <QtCore/qshareddata.h>
+
+QT_BEGIN_NAMESPACE
+
+class QPlaybackStatisticsPrivate;
+class Q_MULTIMEDIA_EXPORT QPlaybackStatistics
+{
+    Q_GADGET
+    Q_PROPERTY(qint64 bufferedDuration READ bufferedDuration CONSTANT)
+    Q_PROPERTY(qint64 bufferedBytes READ bufferedBytes CONSTANT)
+    Q_PROPERTY(int videoDecoderQueueLength READ videoDecoderQueueLength CONSTANT)
+    Q_PROPERTY(int videoDecoderQueueCapacity READ videoDecoderQueueCapacity CONSTANT)
+    Q_PROPERTY(int audioDecoderQueueLength READ audioDecoderQueueLength CONSTANT)
+    Q_PROPERTY(int audioDecoderQueueCapacity READ audioDecoderQueueCapacity CONSTANT)
+    Q_PROPERTY(qint64 renderedVideoFrames READ renderedVideoFrames CONSTANT)
+    Q_PROPERTY(qint64 droppedVideoFrames READ droppedVideoFrames CONSTANT)
+    Q_PROPERTY(qint64 videoRenderLateness READ videoRenderLateness CONSTANT)
+    Q_PROPERTY(qint64 audioUnderruns READ audioUnderruns CONSTANT)
+public:
+    QPlaybackStatistics() noexcept;
+    QPlaybackStatistics(const QPlaybackStatistics &other) noexcept;
+    QPlaybackStatistics(QPlaybackStatistics &&other) noexcept = default;
+    QPlaybackStatistics &operator=(const QPlaybackStatistics &other) noexcept;
+    QT_MOVE_ASSIGNMENT_OPERATOR_IMPL_VIA_PURE_SWAP(QPlaybackStatistics)
+    void swap(QPlaybackStatistics &other) noexcept
+    { d.swap(other.d); }
+    ~QPlaybackStatistics();
+
+    bool isNull() const noexcept { return !d; }
+
+    qint64 bufferedDuration() const noexcept;
+    qint64 bufferedBytes() const noexcept;
+
+    int videoDecoderQueueLength() const noexcept;
+    int videoDecoderQueueCapacity() const noexcept;
+    int audioDecoderQueueLength() const noexcept;
+    int audioDecoderQueueCapacity() const noexcept;
+
+    qint64 renderedVideoFrames() const noexcept;
+    qint64 droppedVideoFrames() const noexcept;
+    qint64 videoRenderLateness() const noexcept;
+
+    qint64 audioUnderruns() const noexcept;
+
+private:
+    friend class QPlaybackStatisticsPrivate;
+    QPlaybackStatistics(QPlaybackStatisticsPrivate *p);
+    QExplicitlySharedDataPointer<QPlaybackStatisticsPrivate> d;
+};
+
+Q_DECLARE_SHARED(QPlaybackStatistics)
+
+QT_END_NAMESPACE
+
+#endif // QPLAYBACKSTATISTICS_H
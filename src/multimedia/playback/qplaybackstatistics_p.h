@@ -0,0 +1,42 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QPLAYBACKSTATISTICS_P_H
+#define QPLAYBACKSTATISTICS_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtMultimedia/qplaybackstatistics.h>
+#include <QtCore/private/qglobal_p.h>
+
+QT_BEGIN_NAMESPACE
+
+class QPlaybackStatisticsPrivate : public QSharedData
+{
+public:
+    qint64 bufferedDuration = 0;
+    qint64 bufferedBytes = 0;
+    int videoDecoderQueueLength = 0;
+    int videoDecoderQueueCapacity = 0;
+    int audioDecoderQueueLength = 0;
+    int audioDecoderQueueCapacity = 0;
+    qint64 renderedVideoFrames = 0;
+    qint64 droppedVideoFrames = 0;
+    qint64 videoRenderLateness = 0;
+    qint64 audioUnderruns = 0;
+
+    QPlaybackStatistics create() { return QPlaybackStatistics(this); }
+};
+
+QT_END_NAMESPACE
+
+#endif // QPLAYBACKSTATISTICS_P_H
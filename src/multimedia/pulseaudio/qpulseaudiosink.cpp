@@ -27,6 +27,13 @@ static void outputStreamWriteCallback(pa_stream *stream, size_t length, void *us
     pa_threaded_mainloop_signal(pulseEngine->mainloop(), 0);
 }
 
+static void outputStreamRealtimeWriteCallback(pa_stream *stream, size_t length, void *userdata)
+{
+    Q_UNUSED(stream);
+    if (userdata)
+        static_cast<QPulseAudioSink *>(userdata)->streamRealtimeWriteCallback(length);
+}
+
 static void outputStreamStateCallback(pa_stream *stream, void *userdata)
 {
     Q_UNUSED(userdata);
@@ -161,11 +168,18 @@ void QPulseAudioSink::streamDrainedCallback()
         return;
 }
 
+void QPulseAudioSink::streamRealtimeWriteCallback(size_t length)
+{
+    // invoked on the mainloop thread with the mainloop lock held
+    pullIntoStream(length);
+}
+
 void QPulseAudioSink::start(QIODevice *device)
 {
     reset();
 
     m_pullMode = true;
+    m_realtimePull = false;
     m_audioSource = device;
 
     if (!open()) {
@@ -185,6 +199,20 @@ void QPulseAudioSink::start(QIODevice *device)
 void QPulseAudioSink::startPulling()
 {
     Q_ASSERT(m_pullMode);
+
+    if (m_realtimePull) {
+        // The server doesn't request data again until the requested amount has been written,
+        // so fill the stream when it has just been started or resumed.
+        if (!m_stateMachine.isActiveOrIdle())
+            return;
+
+        std::lock_guard lock(*QPulseAudioContextManager::instance());
+        if (const size_t writableSize = pa_stream_writable_size(m_stream.get());
+            writableSize != size_t(-1) && writableSize > 0)
+            pullIntoStream(writableSize);
+        return;
+    }
+
     if (m_tickTimer.isActive())
         return;
 
@@ -197,11 +225,37 @@ void QPulseAudioSink::stopTimer()
         m_tickTimer.stop();
 }
 
+bool QPulseAudioSink::start(AudioCallback &&callback)
+{
+    reset();
+
+    // the callback is always invoked from the write callback of the stream
+    m_pullMode = true;
+    m_realtimePull = true;
+    m_audioCallback = std::move(callback);
+
+    if (!open()) {
+        m_audioCallback = {};
+        return false;
+    }
+
+    // ensure we only process timing infos that are up to date
+    gettimeofday(&lastTimingInfo, nullptr);
+    lastProcessedUSecs = 0;
+
+    m_stateMachine.start();
+
+    startPulling();
+
+    return true;
+}
+
 QIODevice *QPulseAudioSink::start()
 {
     reset();
 
     m_pullMode = false;
+    m_realtimePull = false;
 
     if (!open())
         return nullptr;
@@ -223,6 +277,9 @@ bool QPulseAudioSink::open()
     if (m_opened)
         return true;
 
+    // the stream starts at the current volume, without a ramp
+    m_volume.reset();
+
     QPulseAudioContextManager *pulseEngine = QPulseAudioContextManager::instance();
 
     if (!pulseEngine->context()
@@ -294,7 +351,10 @@ bool QPulseAudioSink::open()
     }
 
     pa_stream_set_state_callback(m_stream.get(), outputStreamStateCallback, this);
-    pa_stream_set_write_callback(m_stream.get(), outputStreamWriteCallback, this);
+    pa_stream_set_write_callback(m_stream.get(),
+                                 m_realtimePull ? outputStreamRealtimeWriteCallback
+                                                : outputStreamWriteCallback,
+                                 this);
 
     pa_stream_set_underflow_callback(m_stream.get(), outputStreamUnderflowCallback, this);
     pa_stream_set_overflow_callback(m_stream.get(), outputStreamOverflowCallback, this);
@@ -311,6 +371,16 @@ bool QPulseAudioSink::open()
     requestedBuffer.minreq = static_cast<uint32_t>(-1);
     requestedBuffer.prebuf = static_cast<uint32_t>(-1);
 
+    if (m_realtimePull) {
+        // Let the server request data once per period, and keep two periods buffered. The period
+        // follows the buffer size set by the user, which controls the latency.
+        const uint32_t periodSize = m_userBufferSize
+                ? uint32_t(*m_userBufferSize / 2)
+                : uint32_t(pa_usec_to_bytes(SinkPeriodTimeMs * 1000, &m_spec));
+        requestedBuffer.minreq = periodSize;
+        requestedBuffer.tlength = 2 * periodSize;
+    }
+
     pa_stream_flags flags =
             pa_stream_flags(PA_STREAM_AUTO_TIMING_UPDATE | PA_STREAM_ADJUST_LATENCY);
     if (pa_stream_connect_playback(m_stream.get(), m_device.data(), &requestedBuffer, flags,
@@ -367,7 +437,7 @@ bool QPulseAudioSink::open()
 
     m_opened = true;
 
-    if (m_pullMode)
+    if (m_pullMode && !m_realtimePull)
         startPulling();
 
     m_elapsedTimeOffset = 0;
@@ -409,6 +479,8 @@ void QPulseAudioSink::close()
     disconnect(pulseEngine, &QPulseAudioContextManager::contextFailed, this,
                &QPulseAudioSink::onPulseContextFailed);
 
+    m_audioCallback = {};
+
     if (m_audioSource) {
         if (m_pullMode) {
             disconnect(m_audioSource, &QIODevice::readyRead, this, nullptr);
@@ -471,6 +543,59 @@ void QPulseAudioSink::userFeed()
     }
 }
 
+void QPulseAudioSink::pullIntoStream(size_t length)
+{
+    // Called with the mainloop lock held. In order to keep the mainloop thread realtime-safe,
+    // the callback renders directly into the memory of the stream, and neither memory is
+    // allocated nor anything is logged as long as the stream accepts data.
+    using namespace QPulseAudioInternal;
+
+    if (!m_stream || !m_audioCallback || !m_stateMachine.isActiveOrIdle())
+        return;
+
+    const size_t frameSize = pa_frame_size(&m_spec);
+    length -= length % frameSize;
+
+    while (length > 0) {
+        void *dest = nullptr;
+        size_t nbytes = length;
+        if (pa_stream_begin_write(m_stream.get(), &dest, &nbytes) < 0 || !dest) {
+            qCWarning(qLcPulseAudioOut)
+                    << "pa_stream_begin_write error:" << currentError(m_stream.get());
+            m_stateMachine.updateActiveOrIdle(QAudioStateMachine::RunningState::Idle,
+                                              QAudio::IOError);
+            return;
+        }
+
+        nbytes = std::min(length, nbytes);
+        nbytes -= nbytes % frameSize;
+        if (nbytes == 0) {
+            pa_stream_cancel_write(m_stream.get());
+            return;
+        }
+
+        invokeCallbackRT(QSpan{ static_cast<std::byte *>(dest), qsizetype(nbytes) });
+
+        if (pa_stream_write(m_stream.get(), dest, nbytes, nullptr, 0, PA_SEEK_RELATIVE) < 0) {
+            qCWarning(qLcPulseAudioOut) << "pa_stream_write error:" << currentError(m_stream.get());
+            m_stateMachine.updateActiveOrIdle(QAudioStateMachine::RunningState::Idle,
+                                              QAudio::IOError);
+            return;
+        }
+
+        m_totalTimeValue += nbytes;
+        length -= nbytes;
+    }
+}
+
+void QPulseAudioSink::invokeCallbackRT(QSpan<std::byte> buffer) QT_MM_NONBLOCKING
+{
+    QtMultimediaPrivate::invokeNonBlocking(m_audioCallback, buffer);
+
+    // Don't use PulseAudio volume, as it might affect all other streams of the same category
+    m_volume.apply(m_format, buffer);
+}
+
 qint64 QPulseAudioSink::write(const char *data, qint64 len)
 {
     using namespace QPulseAudioInternal;
@@ -495,9 +620,8 @@ qint64 QPulseAudioSink::write(const char *data, qint64 len)
     // Don't use PulseAudio volume, as it might affect all other streams of the same category
     // or even affect the system volume if flat volumes are enabled
 
-    QAudioHelperInternal::applyVolume(m_volume, m_format,
-                                      QSpan{ reinterpret_cast<const std::byte *>(data), len },
-                                      QSpan{ reinterpret_cast<std::byte *>(dest), len });
+    m_volume.apply(m_format, QSpan{ reinterpret_cast<const std::byte *>(data), len },
+                   QSpan{ reinterpret_cast<std::byte *>(dest), len });
 
     if ((pa_stream_write(m_stream.get(), dest, len, nullptr, 0, PA_SEEK_RELATIVE)) < 0) {
         engineLock.unlock();
@@ -724,15 +848,15 @@ qint64 PulseOutputPrivate::writeData(const char *data, qint64 len)
 
 void QPulseAudioSink::setVolume(qreal vol)
 {
-    if (qFuzzyCompare(m_volume, vol))
+    if (qFuzzyCompare(qreal(m_volume.volume()), vol))
         return;
 
-    m_volume = qBound(qreal(0), vol, qreal(1));
+    m_volume.setVolume(float(qBound(qreal(0), vol, qreal(1))));
 }
 
 qreal QPulseAudioSink::volume() const
 {
-    return m_volume;
+    return m_volume.volume();
 }
 
 void QPulseAudioSink::onPulseContextFailed()
@@ -26,10 +26,14 @@
 #include "qaudiodevice.h"
 #include "pulseaudio/qpulsehelpers_p.h"
 
+#include <private/qaudio_rtsan_support_p.h>
+#include <private/qaudiohelpers_p.h>
 #include <private/qaudiosystem_p.h>
 #include <private/qaudiostatemachine_p.h>
 #include <pulse/pulseaudio.h>
 
+#include <atomic>
+
 QT_BEGIN_NAMESPACE
 
 class QPulseAudioSink : public QPlatformAudioSink
@@ -43,6 +47,7 @@ public:
 
     void start(QIODevice *device) override;
     QIODevice *start() override;
+    bool start(AudioCallback &&callback) override;
     void stop() override;
     void reset() override;
     void suspend() override;
@@ -61,6 +66,7 @@ public:
 
     void streamUnderflowCallback();
     void streamDrainedCallback();
+    void streamRealtimeWriteCallback(size_t length);
 
 protected:
     void timerEvent(QTimerEvent *event) override;
@@ -72,6 +78,8 @@ private:
     bool open();
     void close();
     qint64 write(const char *data, qint64 len);
+    void pullIntoStream(size_t length);
+    void invokeCallbackRT(QSpan<std::byte> buffer) QT_MM_NONBLOCKING;
 
 private Q_SLOTS:
     void userFeed();
@@ -96,6 +104,8 @@ private:
     QBasicTimer m_tickTimer;
 
     QIODevice *m_audioSource = nullptr;
+    // callback mode: invoked on the mainloop thread instead of reading m_audioSource
+    AudioCallback m_audioCallback;
     PAStreamHandle m_stream;
     std::vector<char> m_audioBuffer;
 
@@ -103,7 +113,8 @@ private:
     qint64 m_elapsedTimeOffset = 0;
     mutable qint64 averageLatency = 0; // average latency
     mutable qint64 lastProcessedUSecs = 0;
-    qreal m_volume = 1.0;
+    // applied by write() or by the realtime callback, which don't run concurrently
+    QAudioHelperInternal::SmoothedVolume m_volume;
 
     std::atomic<pa_operation *> m_drainOperation = nullptr;
     qsizetype m_bufferSize = 0;
@@ -111,6 +122,10 @@ private:
     int m_pullingPeriodSize = 0;
     int m_pullingPeriodTime = 0;
     bool m_pullMode = true;
+    // In callback mode, the callback renders on the PulseAudio mainloop thread directly into the
+    // stream's write buffer, instead of m_tickTimer polling the source device. The source device
+    // has the affinity of the owner thread, so it is never read on the mainloop thread.
+    bool m_realtimePull = false;
     bool m_opened = false;
 
     QAudioStateMachine m_stateMachine;
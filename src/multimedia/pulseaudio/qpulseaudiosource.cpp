@@ -26,6 +26,14 @@ static void inputStreamReadCallback(pa_stream *stream, size_t length, void *user
     pa_threaded_mainloop_signal(pulseEngine->mainloop(), 0);
 }
 
+static void inputStreamRealtimeReadCallback(pa_stream *stream, size_t length, void *userdata)
+{
+    Q_UNUSED(stream);
+    Q_UNUSED(length);
+    if (userdata)
+        static_cast<QPulseAudioSource *>(userdata)->streamRealtimeReadCallback();
+}
+
 static void inputStreamStateCallback(pa_stream *stream, void *userdata)
 {
     using namespace QPulseAudioInternal;
@@ -94,7 +102,6 @@ QPulseAudioSource::QPulseAudioSource(const QByteArray &device, QObject *parent)
     : QPlatformAudioSource(parent),
       m_totalTimeValue(0),
       m_audioSource(nullptr),
-      m_volume(qreal(1.0f)),
       m_pullMode(true),
       m_opened(false),
       m_bufferSize(0),
@@ -162,6 +169,23 @@ QIODevice *QPulseAudioSource::start()
     return m_audioSource;
 }
 
+bool QPulseAudioSource::start(AudioCallback &&callback)
+{
+    reset();
+
+    m_pullMode = true;
+    m_audioCallback = std::move(callback);
+
+    if (!open()) {
+        m_audioCallback = {};
+        return true;
+    }
+
+    m_stateMachine.start();
+
+    return true;
+}
+
 void QPulseAudioSource::stop()
 {
     if (auto notifier = m_stateMachine.stop())
@@ -173,6 +197,9 @@ bool QPulseAudioSource::open()
     if (m_opened)
         return true;
 
+    // the stream starts at the current volume, without a ramp
+    m_volume.reset();
+
     QPulseAudioContextManager *pulseEngine = QPulseAudioContextManager::instance();
 
     if (!pulseEngine->context()
@@ -216,7 +243,10 @@ bool QPulseAudioSource::open()
     };
 
     pa_stream_set_state_callback(m_stream.get(), inputStreamStateCallback, this);
-    pa_stream_set_read_callback(m_stream.get(), inputStreamReadCallback, this);
+    pa_stream_set_read_callback(m_stream.get(),
+                                m_audioCallback ? inputStreamRealtimeReadCallback
+                                                : inputStreamReadCallback,
+                                this);
 
     pa_stream_set_underflow_callback(m_stream.get(), inputStreamUnderflowCallback, this);
     pa_stream_set_overflow_callback(m_stream.get(), inputStreamOverflowCallback, this);
@@ -265,13 +295,17 @@ bool QPulseAudioSource::open()
     if (actualBufferAttr->tlength != static_cast<uint32_t>(-1))
         m_bufferSize = actualBufferAttr->tlength;
 
+    if (m_audioCallback)
+        m_callbackBuffer.resize(std::max(actualBufferAttr->fragsize, uint32_t(m_periodSize)));
+
     engineLock.unlock();
 
     connect(pulseEngine, &QPulseAudioContextManager::contextFailed, this,
             &QPulseAudioSource::onPulseContextFailed);
 
     m_opened = true;
-    m_timer.start(m_periodTime, this);
+    if (!m_audioCallback)
+        m_timer.start(m_periodTime, this);
 
     m_elapsedTimeOffset = 0;
     m_totalTimeValue = 0;
@@ -307,6 +341,8 @@ void QPulseAudioSource::close()
         delete m_audioSource;
         m_audioSource = nullptr;
     }
+    m_audioCallback = {};
+    m_callbackBuffer.clear();
     m_opened = false;
 }
 
@@ -426,11 +462,61 @@ qint64 QPulseAudioSource::read(char *data, qint64 len)
     return readBytes;
 }
 
-void QPulseAudioSource::applyVolume(const void *src, void *dest, int len) const
+void QPulseAudioSource::streamRealtimeReadCallback()
 {
-    QAudioHelperInternal::applyVolume(m_volume, m_format,
-                                      QSpan{ reinterpret_cast<const std::byte *>(src), len },
-                                      QSpan{ reinterpret_cast<std::byte *>(dest), len });
+    // invoked on the mainloop thread with the mainloop lock held
+    using namespace QPulseAudioInternal;
+
+    if (!m_stateMachine.isActiveOrIdle())
+        return;
+
+    while (pa_stream_readable_size(m_stream.get()) > 0) {
+        const void *audioBuffer = nullptr;
+        size_t readLength = 0;
+
+        if (pa_stream_peek(m_stream.get(), &audioBuffer, &readLength) < 0) {
+            qWarning() << "pa_stream_peek() failed:" << currentError(m_stream.get());
+            return;
+        }
+
+        // audioBuffer is null if there is a hole in the stream, which is skipped
+        if (audioBuffer) {
+            invokeCallbackRT(QSpan{ static_cast<const std::byte *>(audioBuffer),
+                                    qsizetype(readLength) });
+            m_totalTimeValue += readLength;
+        }
+
+        pa_stream_drop(m_stream.get());
+    }
+}
+
+void QPulseAudioSource::invokeCallbackRT(QSpan<const std::byte> buffer) QT_MM_NONBLOCKING
+{
+    using namespace QtMultimediaPrivate;
+
+    if (m_volume.isUnity()) {
+        invokeNonBlocking(m_audioCallback, buffer);
+        return;
+    }
+
+    // the peeked memory is read-only, so the volume is applied in chunks of the scratch buffer
+    const qsizetype frameSize = m_format.bytesPerFrame();
+    const qsizetype chunkSize = qsizetype(m_callbackBuffer.size()) / frameSize * frameSize;
+    while (!buffer.isEmpty()) {
+        const QSpan<const std::byte> chunk = buffer.first(std::min(buffer.size(), chunkSize));
+        const QSpan<std::byte> output = QSpan{ m_callbackBuffer }.first(chunk.size());
+
+        m_volume.apply(m_format, chunk, output);
+        invokeNonBlocking(m_audioCallback, QSpan<const std::byte>{ output });
+
+        buffer = buffer.subspan(chunk.size());
+    }
+}
+
+void QPulseAudioSource::applyVolume(const void *src, void *dest, int len)
+{
+    m_volume.apply(m_format, QSpan{ reinterpret_cast<const std::byte *>(src), len },
+                   QSpan{ reinterpret_cast<std::byte *>(dest), len });
 }
 
 void QPulseAudioSource::resume()
@@ -448,21 +534,22 @@ void QPulseAudioSource::resume()
             pulseEngine->wait(operation);
         }
 
-        m_timer.start(m_periodTime, this);
+        if (!m_audioCallback)
+            m_timer.start(m_periodTime, this);
     }
 }
 
 void QPulseAudioSource::setVolume(qreal vol)
 {
-    if (qFuzzyCompare(m_volume, vol))
+    if (qFuzzyCompare(qreal(m_volume.volume()), vol))
         return;
 
-    m_volume = qBound(qreal(0), vol, qreal(1));
+    m_volume.setVolume(float(qBound(qreal(0), vol, qreal(1))));
 }
 
 qreal QPulseAudioSource::volume() const
 {
-    return m_volume;
+    return m_volume.volume();
 }
 
 void QPulseAudioSource::setBufferSize(qsizetype value)
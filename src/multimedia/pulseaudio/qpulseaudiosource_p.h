@@ -25,11 +25,16 @@
 #include "qaudio.h"
 #include "qaudiodevice.h"
 #include <QtMultimedia/private/qpulsehelpers_p.h>
+#include <QtMultimedia/private/qaudio_rtsan_support_p.h>
+#include <QtMultimedia/private/qaudiohelpers_p.h>
 #include <QtMultimedia/private/qaudiosystem_p.h>
 #include <QtMultimedia/private/qaudiostatemachine_p.h>
 
 #include <pulse/pulseaudio.h>
 
+#include <atomic>
+#include <vector>
+
 QT_BEGIN_NAMESPACE
 
 class PulseInputPrivate;
@@ -46,6 +51,7 @@ public:
 
     void start(QIODevice *device) override;
     QIODevice *start() override;
+    bool start(AudioCallback &&callback) override;
     void stop() override;
     void reset() override;
     void suspend() override;
@@ -62,10 +68,13 @@ public:
     void setVolume(qreal volume) override;
     qreal volume() const override;
 
+    void streamRealtimeReadCallback();
+
     qint64 m_totalTimeValue;
     QIODevice *m_audioSource;
     QAudioFormat m_format;
-    qreal m_volume;
+    // applied by read() or by the realtime callback, which don't run concurrently
+    QAudioHelperInternal::SmoothedVolume m_volume;
 
 protected:
     void timerEvent(QTimerEvent *event) override;
@@ -75,7 +84,8 @@ private slots:
     void onPulseContextFailed();
 
 private:
-    void applyVolume(const void *src, void *dest, int len) const;
+    void applyVolume(const void *src, void *dest, int len);
+    void invokeCallbackRT(QSpan<const std::byte> buffer) QT_MM_NONBLOCKING;
 
     bool open();
     void close();
@@ -94,6 +104,10 @@ private:
     QByteArray m_streamName;
     QByteArray m_device;
     QByteArray m_tempBuffer;
+    // callback mode: invoked on the mainloop thread with the captured data
+    AudioCallback m_audioCallback;
+    // scratch memory for applying the volume in callback mode, allocated when opening
+    std::vector<std::byte> m_callbackBuffer;
     pa_sample_spec m_spec;
 
     QAudioStateMachine m_stateMachine;
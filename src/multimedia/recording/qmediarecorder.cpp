@@ -747,6 +747,86 @@ void QMediaRecorder::setAutoStop(bool autoStop)
     emit autoStopChanged();
 }
 
+/*!
+    \qmlproperty real QtMultimedia::MediaRecorder::encoderLoad
+    \since 6.10
+
+    \brief This property holds the load of the video encoder.
+
+    See QMediaRecorder::encoderLoad for details.
+*/
+
+/*!
+    \property QMediaRecorder::encoderLoad
+    \since 6.10
+
+    \brief the load of the video encoder.
+
+    The load is the ratio of the time needed to encode a video frame
+    to the frame interval of the video source, smoothed over recent frames.
+    Values close to or above \c 1 mean that the encoder can't keep up with
+    the source. In this case, the recorder drops frames coming from live
+    sources, such as QCamera, QScreenCapture and QWindowCapture, lowering
+    the recorded frame rate until the encoder has recovered.
+    Frames sent via QVideoFrameInput are never dropped; use
+    QVideoFrameInput::readyToSendVideoFrame to pace them instead.
+
+    If several video inputs are recorded, the highest load is reported.
+
+    The property is updated at most twice per second while recording and
+    only supported with the FFmpeg backend; other backends report \c 0.
+
+    \sa droppedVideoFrames
+*/
+qreal QMediaRecorder::encoderLoad() const
+{
+    Q_D(const QMediaRecorder);
+    return d->control ? d->control->encoderLoad() : 0.;
+}
+
+/*!
+    \qmlproperty qint64 QtMultimedia::MediaRecorder::droppedVideoFrames
+    \since 6.10
+
+    \brief This property holds the number of video frames dropped by the recorder.
+
+    See QMediaRecorder::droppedVideoFrames for details.
+*/
+
+/*!
+    \property QMediaRecorder::droppedVideoFrames
+    \since 6.10
+
+    \brief the number of video frames dropped during the current recording
+    because the encoder couldn't keep up with the video sources.
+
+    The counter is reset when recording starts.
+
+    \sa encoderLoad
+*/
+qint64 QMediaRecorder::droppedVideoFrames() const
+{
+    Q_D(const QMediaRecorder);
+    return d->control ? d->control->droppedVideoFrames() : 0;
+}
+
+/*!
+    Returns a snapshot of the state of the recording pipeline, for example
+    how many frames wait for the encoders and how much data has been written.
+    The statistics are meant to be polled periodically to monitor the recording;
+    polling them doesn't affect the recording.
+
+    Returns null statistics if the backend doesn't support them.
+    \since 6.10
+
+    \sa QRecordingStatistics, encoderLoad
+*/
+QRecordingStatistics QMediaRecorder::statistics() const
+{
+    Q_D(const QMediaRecorder);
+    return d->control ? d->control->statistics() : QRecordingStatistics{};
+}
+
 /*!
     \qmlsignal QtMultimedia::MediaRecorder::metaDataChanged()
 
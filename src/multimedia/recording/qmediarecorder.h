@@ -17,6 +17,7 @@ class QUrl;
 class QMediaFormat;
 class QMediaCaptureSession;
 class QPlatformMediaRecorder;
+class QRecordingStatistics;
 
 class QMediaRecorderPrivate;
 class Q_MULTIMEDIA_EXPORT QMediaRecorder : public QObject
@@ -39,6 +40,9 @@ class Q_MULTIMEDIA_EXPORT QMediaRecorder : public QObject
     Q_PROPERTY(int audioChannelCount READ audioChannelCount WRITE setAudioChannelCount NOTIFY audioChannelCountChanged)
     Q_PROPERTY(int audioSampleRate READ audioSampleRate WRITE setAudioSampleRate NOTIFY audioSampleRateChanged)
     Q_PROPERTY(bool autoStop READ autoStop WRITE setAutoStop NOTIFY autoStopChanged REVISION(6, 8))
+    Q_PROPERTY(qreal encoderLoad READ encoderLoad NOTIFY encoderLoadChanged REVISION(6, 10))
+    Q_PROPERTY(qint64 droppedVideoFrames READ droppedVideoFrames NOTIFY encoderLoadChanged
+                       REVISION(6, 10))
 public:
     enum Quality
     {
@@ -132,6 +136,10 @@ public:
     bool autoStop() const;
     void setAutoStop(bool autoStop);
 
+    qreal encoderLoad() const;
+    qint64 droppedVideoFrames() const;
+    QRecordingStatistics statistics() const;
+
     QMediaCaptureSession *captureSession() const;
     QPlatformMediaRecorder *platformRecoder() const;
 
@@ -165,6 +173,7 @@ Q_SIGNALS:
     void audioChannelCountChanged();
     void audioSampleRateChanged();
     Q_REVISION(6, 8) void autoStopChanged();
+    Q_REVISION(6, 10) void encoderLoadChanged();
 
 private:
     QMediaRecorderPrivate *d_ptr;
@@ -0,0 +1,154 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qrecordingstatistics_p.h"
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QRecordingStatistics
+    \since 6.10
+    \brief The QRecordingStatistics class holds a snapshot of the state of the
+    media recorder's pipeline.
+    \inmodule QtMultimedia
+    \ingroup multimedia
+    \ingroup multimedia_recording
+
+    QRecordingStatistics objects are returned by QMediaRecorder::statistics().
+    They describe how full the queues in front of the encoders and the muxer are,
+    and how much data has been written to the output. Poll them periodically to
+    monitor the recording; the write throughput is the difference of
+    muxedBytes() between two polls divided by the time between them.
+
+    The counters are updated by the recording pipeline as it goes, so polling
+    doesn't affect the recording. The backends don't measure all the values;
+    values that are not measured are \c 0.
+
+    \note Only the FFmpeg media backend reports the queue lengths and the
+    muxed packets. The GStreamer media backend reports the muxed bytes.
+
+    \sa QMediaRecorder::statistics(), QMediaRecorder::encoderLoad, QPlaybackStatistics
+*/
+
+/*!
+    Constructs a null statistics object.
+
+    \sa isNull()
+*/
+QRecordingStatistics::QRecordingStatistics() noexcept = default;
+
+/*!
+    Copy constructs statistics from the \a other statistics.
+*/
+QRecordingStatistics::QRecordingStatistics(const QRecordingStatistics &other) noexcept = default;
+
+/*!
+    \fn QRecordingStatistics::QRecordingStatistics(QRecordingStatistics &&other)
+
+    Move constructs statistics from the \a other statistics.
+*/
+
+/*!
+    \fn void QRecordingStatistics::swap(QRecordingStatistics &other) noexcept
+
+    Swaps the statistics with the \a other statistics.
+*/
+
+/*!
+    Assigns \a other to this.
+*/
+QRecordingStatistics &
+QRecordingStatistics::operator=(const QRecordingStatistics &other) noexcept = default;
+
+/*!
+    \fn QRecordingStatistics &QRecordingStatistics::operator=(QRecordingStatistics &&other)
+
+    Moves \a other into this.
+*/
+
+/*!
+    Destructs the statistics object.
+*/
+QRecordingStatistics::~QRecordingStatistics() = default;
+
+/*! \fn bool QRecordingStatistics::isNull() const noexcept
+
+    Returns true if the backend doesn't report any statistics, for example
+    if the recorder is stopped.
+*/
+
+/*!
+    \property QRecordingStatistics::videoEncoderQueueLength
+
+    Returns the number of video frames waiting to be encoded.
+    If several video inputs are recorded, the longest queue is reported.
+
+    \sa videoEncoderQueueCapacity
+*/
+int QRecordingStatistics::videoEncoderQueueLength() const noexcept
+{
+    return d ? d->videoEncoderQueueLength : 0;
+}
+
+/*!
+    \property QRecordingStatistics::videoEncoderQueueCapacity
+
+    Returns the maximum number of video frames waiting to be encoded.
+    Frames from live sources are dropped when the queue is full.
+
+    \sa videoEncoderQueueLength, QMediaRecorder::droppedVideoFrames
+*/
+int QRecordingStatistics::videoEncoderQueueCapacity() const noexcept
+{
+    return d ? d->videoEncoderQueueCapacity : 0;
+}
+
+/*!
+    \property QRecordingStatistics::audioEncoderQueueLength
+
+    Returns the number of audio buffers waiting to be encoded.
+    If several audio inputs are recorded, the longest queue is reported.
+*/
+int QRecordingStatistics::audioEncoderQueueLength() const noexcept
+{
+    return d ? d->audioEncoderQueueLength : 0;
+}
+
+/*!
+    \property QRecordingStatistics::muxerQueueLength
+
+    Returns the number of encoded packets waiting to be written to the output.
+    A growing queue means that the output can't keep up with the encoders.
+*/
+int QRecordingStatistics::muxerQueueLength() const noexcept
+{
+    return d ? d->muxerQueueLength : 0;
+}
+
+/*!
+    \property QRecordingStatistics::muxedPackets
+
+    Returns the number of encoded packets written to the output
+    since the recording started.
+*/
+qint64 QRecordingStatistics::muxedPackets() const noexcept
+{
+    return d ? d->muxedPackets : 0;
+}
+
+/*!
+    \property QRecordingStatistics::muxedBytes
+
+    Returns the size of the encoded data written to the output
+    since the recording started.
+*/
+qint64 QRecordingStatistics::muxedBytes() const noexcept
+{
+    return d ? d->muxedBytes : 0;
+}
+
+QRecordingStatistics::QRecordingStatistics(QRecordingStatisticsPrivate *p) : d(p) { }
+
+QT_END_NAMESPACE
+
+#include "moc_qrecordingstatistics.cpp"
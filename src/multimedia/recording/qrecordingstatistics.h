@@ -0,0 +1,53 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QRECORDINGSTATISTICS_H
+#define QRECORDINGSTATISTICS_H
+
+#include <QtMultimedia/qtmultimediaglobal.h>
+#include <QtCore/qobjectdefs.h>
+#include <QtCore/qshareddata.h>
+
+QT_BEGIN_NAMESPACE
+
+class QRecordingStatisticsPrivate;
+class Q_MULTIMEDIA_EXPORT QRecordingStatistics
+{
+    Q_GADGET
+    Q_PROPERTY(int videoEncoderQueueLength READ videoEncoderQueueLength CONSTANT)
+    Q_PROPERTY(int videoEncoderQueueCapacity READ videoEncoderQueueCapacity CONSTANT)
+    Q_PROPERTY(int audioEncoderQueueLength READ audioEncoderQueueLength CONSTANT)
+    Q_PROPERTY(int muxerQueueLength READ muxerQueueLength CONSTANT)
+    Q_PROPERTY(qint64 muxedPackets READ muxedPackets CONSTANT)
+    Q_PROPERTY(qint64 muxedBytes READ muxedBytes CONSTANT)
+public:
+    QRecordingStatistics() noexcept;
+    QRecordingStatistics(const QRecordingStatistics &other) noexcept;
+    QRecordingStatistics(QRecordingStatistics &&other) noexcept = default;
+    QRecordingStatistics &operator=(const QRecordingStatistics &other) noexcept;
+    QT_MOVE_ASSIGNMENT_OPERATOR_IMPL_VIA_PURE_SWAP(QRecordingStatistics)
+    void swap(QRecordingStatistics &other) noexcept
+    { d.swap(other.d); }
+    ~QRecordingStatistics();
+
+    bool isNull() const noexcept { return !d; }
+
+    int videoEncoderQueueLength() const noexcept;
+    int videoEncoderQueueCapacity() const noexcept;
+    int audioEncoderQueueLength() const noexcept;
+
+    int muxerQueueLength() const noexcept;
+    qint64 muxedPackets() const noexcept;
+    qint64 muxedBytes() const noexcept;
+
+private:
+    friend class QRecordingStatisticsPrivate;
+    QRecordingStatistics(QRecordingStatisticsPrivate *p);
+    QExplicitlySharedDataPointer<QRecordingStatisticsPrivate> d;
+};
+
+Q_DECLARE_SHARED(QRecordingStatistics)
+
+QT_END_NAMESPACE
+
+#endif // QRECORDINGSTATISTICS_H
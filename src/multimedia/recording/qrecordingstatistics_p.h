@@ -0,0 +1,38 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QRECORDINGSTATISTICS_P_H
+#define QRECORDINGSTATISTICS_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtMultimedia/qrecordingstatistics.h>
+#include <QtCore/private/qglobal_p.h>
+
+QT_BEGIN_NAMESPACE
+
+class QRecordingStatisticsPrivate : public QSharedData
+{
+public:
+    int videoEncoderQueueLength = 0;
+    int videoEncoderQueueCapacity = 0;
+    int audioEncoderQueueLength = 0;
+    int muxerQueueLength = 0;
+    qint64 muxedPackets = 0;
+    qint64 muxedBytes = 0;
+
+    QRecordingStatistics create() { return QRecordingStatistics(this); }
+};
+
+QT_END_NAMESPACE
+
+#endif // QRECORDINGSTATISTICS_P_H
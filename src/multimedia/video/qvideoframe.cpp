@@ -893,13 +893,21 @@ void QVideoFrame::setSubtitleText(const QString &text)
 */
 void QVideoFrame::paint(QPainter *painter, const QRectF &rect, const PaintOptions &options)
 {
-    if (!isValid()) {
+    QVideoTextureHelper::SubtitleLayout subtitleLayout;
+    qPaintVideoFrame(*this, painter, rect, options, subtitleLayout);
+}
+
+void qPaintVideoFrame(QVideoFrame &frame, QPainter *painter, const QRectF &rect,
+                      const QVideoFrame::PaintOptions &options,
+                      QVideoTextureHelper::SubtitleLayout &subtitleLayout)
+{
+    if (!frame.isValid()) {
         painter->fillRect(rect, options.backgroundColor);
         return;
     }
 
     QRectF targetRect = rect;
-    QSizeF size = qRotatedFramePresentationSize(*this);
+    QSizeF size = qRotatedFramePresentationSize(frame);
 
     size.scale(targetRect.size(), options.aspectRatioMode);
 
@@ -927,7 +935,7 @@ void QVideoFrame::paint(QPainter *painter, const QRectF &rect, const PaintOption
         }
     }
 
-    if (map(QVideoFrame::ReadOnly)) {
+    if (frame.map(QVideoFrame::ReadOnly)) {
         const QTransform oldTransform = painter->transform();
         QTransform transform = oldTransform;
         transform.translate(targetRect.center().x() - size.width()/2,
@@ -935,33 +943,32 @@ void QVideoFrame::paint(QPainter *painter, const QRectF &rect, const PaintOption
         painter->setTransform(transform);
 
         const bool hasPresentationTransformation =
-                d->presentationTransformation != VideoTransformation{};
+                QVideoFramePrivate::handle(frame)->presentationTransformation
+                != VideoTransformation{};
 
         // Use cache for images without presentation transform
         const QImage image = hasPresentationTransformation
-                ? qImageFromVideoFrame(*this, qNormalizedFrameTransformation(*this))
-                : toImage();
+                ? qImageFromVideoFrame(frame, qNormalizedFrameTransformation(frame))
+                : frame.toImage();
 
         painter->drawImage({{}, size}, image, {{},image.size()});
         painter->setTransform(oldTransform);
 
-        unmap();
-    } else if (isValid()) {
+        frame.unmap();
+    } else if (frame.isValid()) {
         // #### error handling
     } else {
         painter->fillRect(rect, Qt::black);
     }
 
-    if ((options.paintFlags & PaintOptions::DontDrawSubtitles) || d->subtitleText.isEmpty())
+    const QString subtitleText = frame.subtitleText();
+    if ((options.paintFlags & QVideoFrame::PaintOptions::DontDrawSubtitles)
+        || subtitleText.isEmpty())
         return;
 
-    // draw subtitles
-    auto text = d->subtitleText;
-    text.replace(QLatin1Char('\n'), QChar::LineSeparator);
-
-    QVideoTextureHelper::SubtitleLayout layout;
-    layout.update(targetRect.size().toSize(), this->subtitleText());
-    layout.draw(painter, targetRect.topLeft());
+    // draw subtitles; the layout is only shaped again if the text or the size changes
+    subtitleLayout.update(targetRect.size().toSize(), subtitleText);
+    subtitleLayout.draw(painter, targetRect.topLeft());
 }
 
 #ifndef QT_NO_DEBUG_STREAM
@@ -23,6 +23,10 @@
 
 QT_BEGIN_NAMESPACE
 
+namespace QVideoTextureHelper {
+struct SubtitleLayout;
+}
+
 class QVideoFramePrivate : public QSharedData
 {
 public:
@@ -90,6 +94,12 @@ private:
     Q_DISABLE_COPY(QVideoFramePrivate)
 };
 
+// Same as QVideoFrame::paint, but keeps the shaped subtitles in subtitleLayout,
+// so that outputs painting frame after frame don't shape the same subtitle again.
+Q_MULTIMEDIA_EXPORT void qPaintVideoFrame(QVideoFrame &frame, QPainter *painter, const QRectF &rect,
+                                          const QVideoFrame::PaintOptions &options,
+                                          QVideoTextureHelper::SubtitleLayout &subtitleLayout);
+
 QT_END_NAMESPACE
 
 #endif // QVIDEOFRAMEPRIVATE_P_H
@@ -599,6 +599,24 @@ void qCopyPixelsWithMask(uint32_t *dst, const uint32_t *src, size_t size, uint32
     qPixelsCopyFunc(dst, src, size, mask);
 }
 
+QList<PixelsCopyFuncVariant> qPixelsCopyFuncVariants()
+{
+    QList<PixelsCopyFuncVariant> variants{ { "generic", qt_copy_pixels_with_mask<uint32_t> } };
+
+#ifdef QT_COMPILER_SUPPORTS_SSE2
+    extern void QT_FASTCALL  qt_copy_pixels_with_mask_sse2(uint32_t * dst, const uint32_t *src, size_t size, uint32_t mask);
+    if (qCpuHasFeature(SSE2))
+        variants.push_back({ "sse2", qt_copy_pixels_with_mask_sse2 });
+#endif
+#ifdef QT_COMPILER_SUPPORTS_AVX2
+    extern void QT_FASTCALL  qt_copy_pixels_with_mask_avx2(uint32_t * dst, const uint32_t *src, size_t size, uint32_t mask);
+    if (qCpuHasFeature(AVX2))
+        variants.push_back({ "avx2", qt_copy_pixels_with_mask_avx2 });
+#endif
+
+    return variants;
+}
+
 uint32_t qAlphaMask(QVideoFrameFormat::PixelFormat format)
 {
     switch (format) {
@@ -16,6 +16,7 @@
 //
 
 #include <qvideoframe.h>
+#include <QtCore/qlist.h>
 #include <private/qsimd_p.h>
 
 QT_BEGIN_NAMESPACE
@@ -24,7 +25,7 @@ QT_BEGIN_NAMESPACE
 typedef void (QT_FASTCALL *VideoFrameConvertFunc)(const QVideoFrame &frame, uchar *output);
 typedef void(QT_FASTCALL *PixelsCopyFunc)(uint32_t *dst, const uint32_t *src, size_t size, uint32_t mask);
 
-VideoFrameConvertFunc qConverterForFormat(QVideoFrameFormat::PixelFormat format);
+VideoFrameConvertFunc Q_MULTIMEDIA_EXPORT qConverterForFormat(QVideoFrameFormat::PixelFormat format);
 
 void Q_MULTIMEDIA_EXPORT qCopyPixelsWithAlphaMask(uint32_t *dst,
                                                   const uint32_t *src,
@@ -36,6 +37,16 @@ void Q_MULTIMEDIA_EXPORT qCopyPixelsWithMask(uint32_t *dst, const uint32_t *src,
 
 uint32_t Q_MULTIMEDIA_EXPORT qAlphaMask(QVideoFrameFormat::PixelFormat format);
 
+struct PixelsCopyFuncVariant
+{
+    const char *name;
+    PixelsCopyFunc func;
+};
+
+// The implementations qCopyPixelsWithMask chooses from, limited to the ones
+// supported by the CPU; for benchmarking.
+QList<PixelsCopyFuncVariant> Q_MULTIMEDIA_EXPORT qPixelsCopyFuncVariants();
+
 template<int a, int r, int g, int b>
 struct ArgbPixel
 {
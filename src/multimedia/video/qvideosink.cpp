@@ -148,6 +148,60 @@ void QVideoSink::setVideoFrame(const QVideoFrame &frame)
         d->videoSink->setVideoFrame(frame);
 }
 
+/*!
+    \typealias QVideoSink::FrameCallback
+    \since 6.10
+
+    Synonym for \c{std::function<void(const QVideoFrame &)>}.
+*/
+
+/*!
+    \since 6.10
+
+    Sets a \a callback that receives video frames directly on the thread
+    that produces them, instead of the videoFrameChanged() signal.
+
+    By default, media backends hand video frames over to the thread of the
+    video sink, typically the GUI thread, before videoFrameChanged() is
+    emitted. Applications that only process the pixel data, for example for
+    analysis, can set a frame callback to avoid the latency and jitter of
+    this event loop round trip.
+
+    While a frame callback is set, each new video frame is passed to the
+    callback, and videoFrameChanged() is not emitted. videoFrame() and
+    videoSize() keep being updated before the callback is invoked, and
+    videoSizeChanged() is still emitted on the thread of the sink.
+    Passing an empty callback restores the signal-based delivery.
+
+    The following guarantees apply to the callback:
+
+    \list
+    \li It is invoked on an unspecified thread owned by the media backend,
+        for example, a decoder or camera streaming thread. Backends that
+        cannot deliver frames directly invoke it on the thread of the sink.
+    \li Invocations are serialized; the callback is never invoked
+        concurrently for the same sink.
+    \li After setFrameCallback() returns, the previous callback is no longer
+        invoked. If the previous callback is running on another thread at
+        this moment, setFrameCallback() waits until it returns. The same
+        applies to the destruction of the video sink.
+    \li The backend doesn't receive further frames until the callback returns,
+        so the callback should return quickly. Copy the frame and process it
+        asynchronously if processing takes longer than the frame interval.
+    \endlist
+
+    The callback must not call setFrameCallback() or destroy the video sink.
+    Depending on the backend, frames backed by GPU memory might still be
+    delivered on the thread of the sink.
+
+    \sa videoFrameChanged()
+*/
+void QVideoSink::setFrameCallback(FrameCallback callback)
+{
+    if (d->videoSink)
+        d->videoSink->setFrameCallback(std::move(callback));
+}
+
 /*!
     \property QVideoSink::subtitleText
 
@@ -8,6 +8,8 @@
 #include <QtCore/qobject.h>
 #include <QtGui/qwindowdefs.h>
 
+#include <functional>
+
 QT_BEGIN_NAMESPACE
 
 class QRectF;
@@ -24,6 +26,8 @@ class Q_MULTIMEDIA_EXPORT QVideoSink : public QObject
     Q_PROPERTY(QString subtitleText READ subtitleText WRITE setSubtitleText NOTIFY subtitleTextChanged)
     Q_PROPERTY(QSize videoSize READ videoSize NOTIFY videoSizeChanged)
 public:
+    using FrameCallback = std::function<void(const QVideoFrame &)>;
+
     QVideoSink(QObject *parent = nullptr);
     ~QVideoSink() override;
 
@@ -38,6 +42,8 @@ public:
     void setVideoFrame(const QVideoFrame &frame);
     QVideoFrame videoFrame() const;
 
+    void setFrameCallback(FrameCallback callback);
+
     QPlatformVideoSink *platformVideoSink() const;
 Q_SIGNALS:
     void videoFrameChanged(const QVideoFrame &frame) QT6_ONLY(const);
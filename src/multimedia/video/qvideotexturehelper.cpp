@@ -863,6 +863,7 @@ bool SubtitleLayout::update(const QSize &frameSize, QString text)
         return false;
 
     videoSize = frameSize;
+    image = {};
     QFont font;
     // 0.045 - based on this https://www.md-subs.com/saa-subtitle-font-size
     qreal fontSize = frameSize.height() * 0.045;
@@ -916,6 +917,15 @@ void SubtitleLayout::draw(QPainter *painter, const QPointF &translate) const
     painter->translate(translate);
     painter->setCompositionMode(QPainter::CompositionMode_SourceOver);
 
+    // Blit the cached image if it maps 1:1 to the device pixels;
+    // otherwise draw the glyphs, so that they stay sharp when scaled.
+    if (painter->worldTransform().type() <= QTransform::TxTranslate
+        && painter->device()->devicePixelRatio() == 1.) {
+        painter->drawImage(bounds.topLeft(), toImage());
+        painter->restore();
+        return;
+    }
+
     QColor bgColor = Qt::black;
     bgColor.setAlpha(128);
     painter->setBrush(bgColor);
@@ -932,6 +942,9 @@ void SubtitleLayout::draw(QPainter *painter, const QPointF &translate) const
 
 QImage SubtitleLayout::toImage() const
 {
+    if (!image.isNull())
+        return image;
+
     auto size = bounds.size().toSize();
     if (size.isEmpty())
         return QImage();
@@ -947,6 +960,9 @@ QImage SubtitleLayout::toImage() const
     range.length = layout.text().size();
     range.format.setForeground(Qt::white);
     layout.draw(&painter, {}, { range });
+    painter.end();
+
+    image = img;
     return img;
 }
 
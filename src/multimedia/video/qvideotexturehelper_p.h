@@ -155,6 +155,8 @@ struct Q_MULTIMEDIA_EXPORT SubtitleLayout
     QSize videoSize;
     QRectF bounds;
     QTextLayout layout;
+    // rasterized layout, created by toImage() and reset when the layout changes
+    mutable QImage image;
 
     bool update(const QSize &frameSize, QString text);
     void draw(QPainter *painter, const QPointF &translate) const;
@@ -0,0 +1,188 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qvideothumbnailextractor_p.h"
+
+#include <QtCore/qfile.h>
+#include <QtCore/qloggingcategory.h>
+#include <QtCore/qthread.h>
+#include <QtMultimedia/private/qplatformmediaintegration_p.h>
+#include <QtMultimedia/private/qplatformvideothumbnailextractor_p.h>
+
+QT_BEGIN_NAMESPACE
+
+Q_STATIC_LOGGING_CATEGORY(qLcVideoThumbnailExtractor, "qt.multimedia.videothumbnailextractor");
+
+QVideoThumbnailExtractor::QVideoThumbnailExtractor(QObject *parent)
+    : QObject(parent), m_maxConcurrency(QThread::idealThreadCount())
+{
+    m_threadPool.setObjectName(QStringLiteral("QVideoThumbnailExtractor"));
+}
+
+QVideoThumbnailExtractor::~QVideoThumbnailExtractor()
+{
+    cancel();
+}
+
+void QVideoThumbnailExtractor::setMaxConcurrency(int concurrency)
+{
+    m_maxConcurrency = std::max(concurrency, 1);
+}
+
+void QVideoThumbnailExtractor::setSettings(const Settings &settings)
+{
+    m_settings = settings;
+}
+
+void QVideoThumbnailExtractor::start(const QList<QUrl> &sources)
+{
+    cancel();
+
+    {
+        QMutexLocker locker(&m_mutex);
+        m_sourceCount = sources.size();
+        m_batchSettings = m_settings;
+    }
+
+    if (sources.isEmpty()) {
+        emit finished();
+        return;
+    }
+
+    m_threadPool.setMaxThreadCount(m_maxConcurrency);
+
+    const quint64 batchId = m_batchId.load(std::memory_order_relaxed);
+    for (qsizetype i = 0; i < sources.size(); ++i) {
+        m_threadPool.start([this, i, source = sources[i], batchId] {
+            extract(i, source, batchId);
+        });
+    }
+}
+
+void QVideoThumbnailExtractor::cancel()
+{
+    {
+        QMutexLocker locker(&m_mutex);
+        m_batchId.fetch_add(1, std::memory_order_relaxed);
+        m_resultAvailable.wakeAll();
+    }
+
+    m_threadPool.clear();
+    m_threadPool.waitForDone();
+
+    QMutexLocker locker(&m_mutex);
+    m_ready.clear();
+    m_sourceCount = 0;
+    m_resultCount = 0;
+    m_resultsTaken = 0;
+}
+
+bool QVideoThumbnailExtractor::isRunning() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_resultsTaken < m_sourceCount;
+}
+
+std::optional<QVideoThumbnailExtractor::Result> QVideoThumbnailExtractor::takeResult()
+{
+    QMutexLocker locker(&m_mutex);
+    return takeResultLocked();
+}
+
+std::optional<QVideoThumbnailExtractor::Result>
+QVideoThumbnailExtractor::waitForResult(QDeadlineTimer deadline)
+{
+    QMutexLocker locker(&m_mutex);
+    const quint64 batchId = m_batchId.load(std::memory_order_relaxed);
+
+    while (m_ready.empty() && m_resultsTaken < m_sourceCount && !isCancelled(batchId)) {
+        if (!m_resultAvailable.wait(&m_mutex, deadline))
+            break;
+    }
+
+    return takeResultLocked();
+}
+
+std::optional<QVideoThumbnailExtractor::Result> QVideoThumbnailExtractor::takeResultLocked()
+{
+    if (m_ready.empty())
+        return std::nullopt;
+
+    Result result = std::move(m_ready.front());
+    m_ready.pop_front();
+    ++m_resultsTaken;
+    return result;
+}
+
+bool QVideoThumbnailExtractor::isCancelled(quint64 batchId) const
+{
+    return m_batchId.load(std::memory_order_relaxed) != batchId;
+}
+
+void QVideoThumbnailExtractor::extract(qsizetype index, const QUrl &source, quint64 batchId)
+{
+    if (isCancelled(batchId))
+        return;
+
+    Result result = extractSource(index, source, batchId);
+
+    bool allExtracted = false;
+
+    {
+        QMutexLocker locker(&m_mutex);
+        if (isCancelled(batchId))
+            return;
+
+        m_ready.push_back(std::move(result));
+        m_resultAvailable.wakeAll();
+        allExtracted = ++m_resultCount == m_sourceCount;
+    }
+
+    emit resultReady();
+    if (allExtracted)
+        emit finished();
+}
+
+QVideoThumbnailExtractor::Result
+QVideoThumbnailExtractor::extractSource(qsizetype index, const QUrl &source,
+                                        quint64 batchId) const
+{
+    auto setIndexAndSource = [&](Result result) {
+        result.index = index;
+        result.source = source;
+        if (result.error != QMediaPlayer::NoError) {
+            qCDebug(qLcVideoThumbnailExtractor)
+                    << "Failed to extract the thumbnails of" << source << result.errorString;
+        }
+        return result;
+    };
+
+    auto extractor = QPlatformMediaIntegration::instance()->createVideoThumbnailExtractor();
+    if (!extractor) {
+        return setIndexAndSource(
+                { -1, {}, {}, QMediaPlayer::ResourceError, extractor.error() });
+    }
+
+    // the backends can't open qrc files directly
+    std::unique_ptr<QFile> qrcFile;
+    if (source.scheme() == QLatin1String("qrc")) {
+        qrcFile = std::make_unique<QFile>(u':' + source.path());
+        if (!qrcFile->open(QFile::ReadOnly)) {
+            return setIndexAndSource(
+                    { -1, {}, {}, QMediaPlayer::ResourceError, qrcFile->errorString() });
+        }
+    }
+
+    const Settings settings = [&] {
+        QMutexLocker locker(&m_mutex);
+        return m_batchSettings;
+    }();
+
+    return setIndexAndSource(extractor.value()->extract(source, qrcFile.get(), settings, [&] {
+        return isCancelled(batchId);
+    }));
+}
+
+QT_END_NAMESPACE
+
+#include "moc_qvideothumbnailextractor_p.cpp"
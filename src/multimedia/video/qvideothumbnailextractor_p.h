@@ -0,0 +1,134 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QVIDEOTHUMBNAILEXTRACTOR_P_H
+#define QVIDEOTHUMBNAILEXTRACTOR_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/qdeadlinetimer.h>
+#include <QtCore/qmutex.h>
+#include <QtCore/qobject.h>
+#include <QtCore/qthreadpool.h>
+#include <QtCore/qurl.h>
+#include <QtCore/qwaitcondition.h>
+#include <QtGui/qimage.h>
+#include <QtMultimedia/qmediaplayer.h>
+#include <QtMultimedia/qtmultimediaexports.h>
+
+#include <atomic>
+#include <deque>
+#include <optional>
+
+QT_BEGIN_NAMESPACE
+
+// Extracts thumbnails from a list of video sources concurrently on a dedicated thread pool.
+// The backend seeks directly to the requested positions and decodes only the frames needed
+// for the thumbnails, without a media player or a video sink.
+//
+// Results can be taken from any thread, either after resultReady() has been emitted
+// or by blocking in waitForResult(). They are delivered as soon as they are extracted.
+class Q_MULTIMEDIA_EXPORT QVideoThumbnailExtractor : public QObject
+{
+    Q_OBJECT
+public:
+    struct Settings
+    {
+        // the number of thumbnails, evenly spaced over the duration; ignored if
+        // positions are set
+        int count = 1;
+        // the positions of the thumbnails in microseconds
+        QList<qint64> positions;
+        // the thumbnails are scaled down to fit the size, keeping the aspect ratio;
+        // an invalid size keeps the size of the video
+        QSize size;
+        // takes the key frame at or before each position instead of the exact frame,
+        // which only decodes one frame per thumbnail
+        bool keyFramesOnly = true;
+    };
+
+    struct Thumbnail
+    {
+        // the requested position, in microseconds
+        qint64 requestedPosition = 0;
+        // the presentation time of the frame, in microseconds
+        qint64 position = 0;
+        QImage image;
+    };
+
+    struct Result
+    {
+        // index of the source in the list passed to start()
+        qsizetype index = -1;
+        QUrl source;
+        // in the order of the positions; empty on error
+        QList<Thumbnail> thumbnails;
+        QMediaPlayer::Error error = QMediaPlayer::NoError;
+        QString errorString;
+    };
+
+    explicit QVideoThumbnailExtractor(QObject *parent = nullptr);
+    // cancels the batch and waits for the workers
+    ~QVideoThumbnailExtractor() override;
+
+    // the settings apply to the next call of start()
+    void setMaxConcurrency(int concurrency);
+    int maxConcurrency() const { return m_maxConcurrency; }
+
+    void setSettings(const Settings &settings);
+    const Settings &settings() const { return m_settings; }
+
+    // cancels the running batch, if any
+    void start(const QList<QUrl> &sources);
+    // drops the results that haven't been taken and waits for the workers
+    void cancel();
+
+    // true until the results of all sources have been taken
+    bool isRunning() const;
+
+    std::optional<Result> takeResult();
+    // blocks until a result is available, the batch is done, or the deadline expires
+    std::optional<Result> waitForResult(QDeadlineTimer deadline = QDeadlineTimer::Forever);
+
+Q_SIGNALS:
+    // emitted from the worker threads
+    void resultReady();
+    void finished();
+
+private:
+    void extract(qsizetype index, const QUrl &source, quint64 batchId);
+    Result extractSource(qsizetype index, const QUrl &source, quint64 batchId) const;
+    std::optional<Result> takeResultLocked();
+    bool isCancelled(quint64 batchId) const;
+
+    int m_maxConcurrency;
+    Settings m_settings;
+
+    QThreadPool m_threadPool;
+
+    // incremented by cancel(), lets the workers of a cancelled batch bail out
+    std::atomic<quint64> m_batchId{ 0 };
+
+    mutable QMutex m_mutex;
+    QWaitCondition m_resultAvailable;
+    // results ready to be taken
+    std::deque<Result> m_ready;
+    // the settings of the running batch
+    Settings m_batchSettings;
+    qsizetype m_sourceCount = 0;
+    qsizetype m_resultCount = 0;
+    qsizetype m_resultsTaken = 0;
+};
+
+QT_END_NAMESPACE
+
+#endif // QVIDEOTHUMBNAILEXTRACTOR_P_H
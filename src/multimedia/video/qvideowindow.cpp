@@ -250,13 +250,19 @@ void QVideoWindowPrivate::updateSubtitle(QRhiResourceUpdateBatch *rub, const QSi
     if (!m_hasSubtitle)
         return;
 
-    m_subtitleLayout.update(frameSize, m_texturePool.currentFrame().subtitleText());
+    // the texture stays valid as long as the layout doesn't change
+    if (!m_subtitleLayout.update(frameSize, m_texturePool.currentFrame().subtitleText())
+        && m_subtitleTexture)
+        return;
+
     QSize size = m_subtitleLayout.bounds.size().toSize();
 
     QImage img = m_subtitleLayout.toImage();
 
-    m_subtitleTexture.reset(m_rhi->newTexture(QRhiTexture::RGBA8, size));
-    m_subtitleTexture->create();
+    if (!m_subtitleTexture || m_subtitleTexture->pixelSize() != size) {
+        m_subtitleTexture.reset(m_rhi->newTexture(QRhiTexture::RGBA8, size));
+        m_subtitleTexture->create();
+    }
     rub->uploadTexture(m_subtitleTexture.get(), img);
 
     QRhiShaderResourceBinding bindings[2];
@@ -328,7 +334,7 @@ void QVideoWindowPrivate::render()
         QPainter painter(device);
 
         QVideoFrame frame = m_texturePool.currentFrame();
-        frame.paint(&painter, rect, { Qt::black, aspectRatioMode });
+        qPaintVideoFrame(frame, &painter, rect, { Qt::black, aspectRatioMode }, m_subtitleLayout);
         painter.end();
 
         backingStore->endPaint();
@@ -11,6 +11,9 @@
 #include <QtCore/qcoreevent.h>
 #include <QtCore/qpointer.h>
 
+#include <private/qvideoframe_p.h>
+#include <private/qvideotexturehelper_p.h>
+
 QT_BEGIN_NAMESPACE
 
 class QGraphicsVideoItemPrivate
@@ -28,6 +31,7 @@ public:
     QRectF boundingRect;
     QSizeF nativeSize;
     QVideoFrame m_frame;
+    QVideoTextureHelper::SubtitleLayout m_subtitleLayout;
     Qt::AspectRatioMode m_aspectRatioMode = Qt::KeepAspectRatio;
 
     void updateRects();
@@ -216,7 +220,8 @@ void QGraphicsVideoItem::paint(QPainter *painter, const QStyleOptionGraphicsItem
     Q_UNUSED(option);
     Q_UNUSED(widget);
 
-    d->m_frame.paint(painter, d->rect, { Qt::transparent, d->m_aspectRatioMode });
+    qPaintVideoFrame(d->m_frame, painter, d->rect, { Qt::transparent, d->m_aspectRatioMode },
+                     d->m_subtitleLayout);
 }
 
 /*!
@@ -14,6 +14,8 @@
 #include "qffmpegresampler_p.h"
 #include "qffmpegmediaformatinfo_p.h"
 
+#include <qtmultimedia_ffmpeg_tracepoints_p.h>
+
 // TODO: namespace 3p library to prevent odr violations
 #include <signalsmith-stretch.h>
 
@@ -21,6 +23,10 @@ QT_BEGIN_NAMESPACE
 
 Q_STATIC_LOGGING_CATEGORY(qLcAudioRenderer, "qt.multimedia.ffmpeg.audiorenderer");
 
+Q_TRACE_POINT(qtmultimedia_ffmpeg, QFFmpegAudioRenderer_write_entry, quint64 id, qint64 bytes,
+              qint64 bytesFree);
+Q_TRACE_POINT(qtmultimedia_ffmpeg, QFFmpegAudioRenderer_write_exit, qint64 bytesWritten);
+
 namespace QFFmpeg {
 
 using namespace std::chrono_literals;
@@ -76,6 +82,20 @@ std::unique_ptr<QFFmpegResampler> createResampler(const Frame &frame,
     return std::make_unique<QFFmpegResampler>(frame.codecContext(), outputFormat, frame.startTime());
 }
 
+QSpan<std::byte> asWritableBytes(QByteArray &array)
+{
+    return { reinterpret_cast<std::byte *>(array.data()), array.size() };
+}
+
+// Resizing within the capacity of a detached array doesn't reallocate,
+// so the output only grows if a frame is larger than the previous ones.
+void resampleInto(QFFmpegResampler &resampler, const AVFrame *frame, QByteArray &output)
+{
+    const QAudioFormat &format = resampler.outputFormat();
+    output.resize(format.bytesForFrames(resampler.maxOutputFrames(frame->nb_samples)));
+    output.resize(format.bytesForFrames(resampler.resample(frame, asWritableBytes(output))));
+}
+
 struct TrivialAudioFrameConverter : AbstactAudioFrameConverter
 {
     explicit TrivialAudioFrameConverter(const Frame &frame, QAudioFormat outputFormat,
@@ -86,7 +106,10 @@ struct TrivialAudioFrameConverter : AbstactAudioFrameConverter
         m_converter = createResampler(frame, outputFormat);
     }
 
-    QAudioBuffer convert(AVFrame *frame) override { return m_converter->resample(frame); }
+    void convert(AVFrame *frame, QByteArray &output) override
+    {
+        resampleInto(*m_converter, frame, output);
+    }
 
 private:
     std::unique_ptr<QFFmpegResampler> m_converter;
@@ -121,12 +144,12 @@ struct PitchShiftingAudioFrameConverter : AbstactAudioFrameConverter
                                                                        outputFormat, frame.startTime());
     }
 
-    QAudioBuffer convert(AVFrame *frame) override
+    void convert(AVFrame *frame, QByteArray &output) override
     {
         using namespace QtPrivate;
 
-        // convert to pcm buffer
-        QAudioBuffer wordConverted = m_toPCMDecoder->resample(frame);
+        // convert to pcm buffer; the resampler recycles the data of the released buffers
+        const QAudioBuffer wordConverted = m_toPCMDecoder->resample(frame);
 
         // compute stretch amount
         int mediaFrameCount = wordConverted.frameCount();
@@ -134,10 +157,11 @@ struct PitchShiftingAudioFrameConverter : AbstactAudioFrameConverter
         int numberOfFullExpectedFrames = qFloor(expectedNumberOfFrames);
         m_pendingFractionalFrames = expectedNumberOfFrames - numberOfFullExpectedFrames;
 
-        auto timeStretcherOutput = QAudioBuffer{
-            numberOfFullExpectedFrames,
-            wordConverted.format(),
-        };
+        // the stretcher writes the first numberOfFullExpectedFrames frames,
+        // so the buffer is only recreated if it's too small
+        if (m_timeStretcherOutput.frameCount() < numberOfFullExpectedFrames)
+            m_timeStretcherOutput = QAudioBuffer{ numberOfFullExpectedFrames,
+                                                  wordConverted.format() };
 
         // stretch
         m_stretcher.process(
@@ -146,21 +170,27 @@ struct PitchShiftingAudioFrameConverter : AbstactAudioFrameConverter
                 },
                 mediaFrameCount,
                 QAudioBufferDeinterleaveAdaptor<float>{
-                        timeStretcherOutput,
+                        m_timeStretcherOutput,
                 },
                 numberOfFullExpectedFrames);
 
         // convert to audio output format
-        QAudioBuffer outputBuffer = m_toOutputFormatConverter->resample(
-                timeStretcherOutput.constData<const char>(), timeStretcherOutput.byteCount());
-
-        return outputBuffer;
+        const auto stretchedData = QSpan{ m_timeStretcherOutput.constData<std::byte>(),
+                                          m_timeStretcherOutput.byteCount() }.first(
+                wordConverted.format().bytesForFrames(numberOfFullExpectedFrames));
+
+        const QAudioFormat &outputFormat = m_toOutputFormatConverter->outputFormat();
+        output.resize(outputFormat.bytesForFrames(
+                m_toOutputFormatConverter->maxOutputFrames(numberOfFullExpectedFrames)));
+        output.resize(outputFormat.bytesForFrames(
+                m_toOutputFormatConverter->resample(stretchedData, asWritableBytes(output))));
     }
 
 private:
     std::unique_ptr<QFFmpegResampler> m_toPCMDecoder;
     signalsmith::stretch::SignalsmithStretch<float> m_stretcher;
     std::unique_ptr<QFFmpegResampler> m_toOutputFormatConverter;
+    QAudioBuffer m_timeStretcherOutput;
     float m_playbackRate;
     float m_pendingFractionalFrames = 0.f;
 };
@@ -264,21 +294,24 @@ AudioRenderer::RenderingResult AudioRenderer::pushFrameToOutput(const Frame &fra
             return { time.count() == 0, time };
         }
 
-        m_bufferedData = {
-            m_audioFrameConverter->convert(frame.avFrame()),
-        };
+        m_bufferedData.offset = 0;
+        m_audioFrameConverter->convert(frame.avFrame(), m_bufferedData.buffer);
     }
 
     if (m_bufferedData.isValid()) {
         // synchronize after "QIODevice::write" to deliver audio data to the sink ASAP.
         auto syncGuard = qScopeGuard([&]() { updateSynchronization(syncStamp, frame); });
 
+        // bytesFree is what the sink could take; a short write means the sink is saturated
+        Q_TRACE(QFFmpegAudioRenderer_write_entry, id(), qint64(m_bufferedData.size()),
+                qint64(syncStamp.audioSinkBytesFree));
         const auto bytesWritten = m_ioDevice->write(m_bufferedData.data(), m_bufferedData.size());
+        Q_TRACE(QFFmpegAudioRenderer_write_exit, qint64(bytesWritten));
 
         m_bufferedData.offset += bytesWritten;
 
         if (m_bufferedData.size() <= 0) {
-            m_bufferedData = {};
+            m_bufferedData.clear();
 
             return {};
         }
@@ -326,6 +359,11 @@ std::chrono::milliseconds AudioRenderer::timerInterval() const
     return 0ms;
 }
 
+QObject *AudioRenderer::frameConsumer() const
+{
+    return m_bufferOutput;
+}
+
 void AudioRenderer::onPauseChanged()
 {
     m_firstFrameToSink = true;
@@ -384,7 +422,8 @@ void AudioRenderer::updateOutputs(const Frame &frame)
         }
     }
 
-    if (!m_output)
+    // free-running playback isn't paced by an audio device
+    if (!m_output || isFreeRunning())
         return;
 
     if (!m_sinkFormat.isValid()) {
@@ -506,8 +545,13 @@ microseconds AudioRenderer::bufferLoadingTime(const SynchronizationStamp &syncSt
 
 void AudioRenderer::onAudioSinkStateChanged(QAudio::State state)
 {
-    if (state == QAudio::IdleState && !m_firstFrameToSink && !m_deviceChanged)
+    if (state == QAudio::IdleState && !m_firstFrameToSink && !m_deviceChanged) {
+        // the sink has played out all the data before the renderer provided more
+        if (PlaybackStatistics *stats = statistics(); stats && !isAtEnd())
+            stats->audioUnderruns.fetchAndAddRelaxed(1);
+
         scheduleNextStep();
+    }
 }
 
 microseconds AudioRenderer::durationForBytes(qsizetype bytes) const
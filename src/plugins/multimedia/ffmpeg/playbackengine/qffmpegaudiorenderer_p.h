@@ -30,7 +30,8 @@ namespace QFFmpeg {
 struct AbstactAudioFrameConverter
 {
     virtual ~AbstactAudioFrameConverter();
-    virtual QAudioBuffer convert(AVFrame *) = 0;
+    // Converts the frame into the output, reusing its capacity
+    virtual void convert(AVFrame *, QByteArray &output) = 0;
 };
 
 class AudioRenderer : public Renderer
@@ -75,12 +76,18 @@ protected:
 
     struct BufferedDataWithOffset
     {
-        QAudioBuffer buffer;
+        // keeps its capacity between frames, so that steady-state playback doesn't allocate
+        QByteArray buffer;
         qsizetype offset = 0;
 
-        bool isValid() const { return buffer.isValid(); }
-        qsizetype size() const { return buffer.byteCount() - offset; }
-        const char *data() const { return buffer.constData<char>() + offset; }
+        bool isValid() const { return offset < buffer.size(); }
+        qsizetype size() const { return buffer.size() - offset; }
+        const char *data() const { return buffer.constData() + offset; }
+        void clear()
+        {
+            buffer.resize(0);
+            offset = 0;
+        }
     };
 
     RenderingResult renderInternal(Frame frame) override;
@@ -93,6 +100,8 @@ protected:
 
     std::chrono::milliseconds timerInterval() const override;
 
+    QObject *frameConsumer() const override;
+
     void onPauseChanged() override;
 
     void freeOutput();
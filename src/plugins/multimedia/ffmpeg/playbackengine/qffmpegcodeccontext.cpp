@@ -3,6 +3,7 @@
 
 #include "playbackengine/qffmpegcodeccontext_p.h"
 #include "qffmpegcodecstorage_p.h"
+#include "qffmpegswframeconverter_p.h"
 
 #include <QtCore/qloggingcategory.h>
 
@@ -18,8 +19,10 @@ CodecContext::Data::Data(AVCodecContextUPtr context, AVStream *avStream,
                          AVFormatContext *formatContext, std::unique_ptr<QFFmpeg::HWAccel> hwAccel)
     : context(std::move(context)), stream(avStream), hwAccel(std::move(hwAccel))
 {
-    if (stream->codecpar->codec_type == AVMEDIA_TYPE_VIDEO)
+    if (stream->codecpar->codec_type == AVMEDIA_TYPE_VIDEO) {
         pixelAspectRatio = av_guess_sample_aspect_ratio(formatContext, stream, nullptr);
+        swFrameConverter = std::make_shared<SwFrameConverter>();
+    }
 }
 
 QMaybe<CodecContext> CodecContext::create(AVStream *stream, AVFormatContext *formatContext)
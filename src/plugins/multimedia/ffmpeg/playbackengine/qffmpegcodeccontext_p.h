@@ -21,10 +21,14 @@
 #include <QtMultimedia/private/qmaybe_p.h>
 #include <QtCore/qshareddata.h>
 
+#include <memory>
+
 QT_BEGIN_NAMESPACE
 
 namespace QFFmpeg {
 
+class SwFrameConverter;
+
 class CodecContext
 {
     struct Data : QSharedData
@@ -35,6 +39,8 @@ class CodecContext
         AVStream *stream = nullptr;
         AVRational pixelAspectRatio = { 0, 1 };
         std::unique_ptr<QFFmpeg::HWAccel> hwAccel;
+        // shared with the video buffers, which may outlive the codec context
+        std::shared_ptr<SwFrameConverter> swFrameConverter;
     };
 
 public:
@@ -46,6 +52,11 @@ public:
     AVStream *stream() const { return d->stream; }
     uint streamIndex() const { return d->stream->index; }
     HWAccel *hwAccel() const { return d->hwAccel.get(); }
+    // converts the decoded software frames that Qt cannot use as is; video streams only
+    const std::shared_ptr<SwFrameConverter> &swFrameConverter() const
+    {
+        return d->swFrameConverter;
+    }
     qint64 toMs(qint64 ts) const { return timeStampMs(ts, d->stream->time_base).value_or(0); }
     qint64 toUs(qint64 ts) const { return timeStampUs(ts, d->stream->time_base).value_or(0); }
 
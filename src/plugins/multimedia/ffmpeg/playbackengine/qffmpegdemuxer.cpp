@@ -4,6 +4,9 @@
 #include "playbackengine/qffmpegdemuxer_p.h"
 #include <qloggingcategory.h>
 #include <chrono>
+#include <optional>
+
+#include <qtmultimedia_ffmpeg_tracepoints_p.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -13,6 +16,13 @@ static constexpr qint64 MaxBufferedDurationUs = 4'000'000;
 // around 4 sec of hdr video
 static constexpr qint64 MaxBufferedSize = 32 * 1024 * 1024;
 
+Q_TRACE_POINT(qtmultimedia_ffmpeg, QFFmpegDemuxer_doNextStep_entry, quint64 id);
+Q_TRACE_POINT(qtmultimedia_ffmpeg, QFFmpegDemuxer_doNextStep_exit);
+Q_TRACE_POINT(qtmultimedia_ffmpeg, QFFmpegDemuxer_packetRead, quint64 id, int streamIndex,
+              qint64 ptsUs, int size);
+Q_TRACE_POINT(qtmultimedia_ffmpeg, QFFmpegDemuxer_bufferedData, quint64 id, int streamIndex,
+              qint64 durationUs, qint64 size);
+
 namespace QFFmpeg {
 
 Q_STATIC_LOGGING_CATEGORY(qLcDemuxer, "qt.multimedia.ffmpeg.demuxer");
@@ -65,6 +75,8 @@ Demuxer::Demuxer(AVFormatContext *context, qint64 initialPosUs, const LoopOffset
 
 void Demuxer::doNextStep()
 {
+    Q_TRACE_SCOPE(QFFmpegDemuxer_doNextStep, id());
+
     ensureSeeked();
 
     Packet packet(m_loopOffset, AVPacketUPtr{ av_packet_alloc() }, id());
@@ -146,6 +158,12 @@ void Demuxer::doNextStep()
         streamData.maxSentPacketsPos = qMax(streamData.maxSentPacketsPos, endPos);
         updateStreamDataLimitFlag(streamData);
 
+        Q_TRACE(QFFmpegDemuxer_packetRead, id(), streamIndex,
+                traceTimeStampUs(avPacket.pts, stream->time_base), avPacket.size);
+        Q_TRACE(QFFmpegDemuxer_bufferedData, id(), streamIndex, streamData.bufferedDuration,
+                streamData.bufferedSize);
+        updateStatistics();
+
         if (!m_buffered && streamData.isDataLimitReached) {
             m_buffered = true;
             emit packetsBuffered();
@@ -191,6 +209,10 @@ void Demuxer::onPacketProcessed(Packet packet)
         Q_ASSERT(it->second.bufferedSize >= 0);
 
         updateStreamDataLimitFlag(streamData);
+
+        Q_TRACE(QFFmpegDemuxer_bufferedData, id(), streamIndex, streamData.bufferedDuration,
+                streamData.bufferedSize);
+        updateStatistics();
     }
 
     scheduleNextStep();
@@ -281,6 +303,26 @@ void Demuxer::updateStreamDataLimitFlag(StreamData &streamData)
         || streamData.bufferedSize >= MaxBufferedSize;
 }
 
+void Demuxer::updateStatistics()
+{
+    PlaybackStatistics *stats = statistics();
+    if (!stats)
+        return;
+
+    // subtitle packets are sparse; their buffered duration says nothing about stalls
+    std::optional<qint64> bufferedDuration;
+    qint64 bufferedSize = 0;
+    for (const auto &[index, streamData] : m_streams) {
+        bufferedSize += streamData.bufferedSize;
+        if (streamData.trackType != QPlatformMediaPlayer::SubtitleStream)
+            bufferedDuration = qMin(bufferedDuration.value_or(streamData.bufferedDuration),
+                                    streamData.bufferedDuration);
+    }
+
+    stats->bufferedDuration.storeRelaxed(bufferedDuration.value_or(0));
+    stats->bufferedBytes.storeRelaxed(bufferedSize);
+}
+
 } // namespace QFFmpeg
 
 QT_END_NAMESPACE
@@ -72,6 +72,8 @@ private:
 
     void updateStreamDataLimitFlag(StreamData &streamData);
 
+    void updateStatistics();
+
 private:
     AVFormatContext *m_context = nullptr;
     bool m_seeked = false;
@@ -0,0 +1,120 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "playbackengine/qffmpegfreerunningclock_p.h"
+
+#include <algorithm>
+#include <utility>
+
+QT_BEGIN_NAMESPACE
+
+namespace QFFmpeg {
+
+void FreeRunningClock::addRenderer(Id id, Role role, qint64 position, QObject *context,
+                                   std::function<void()> notify)
+{
+    QMutexLocker locker(&m_mutex);
+    Q_ASSERT(!findEntry(id));
+    m_entries.push_back({ id, role, position, false, context, std::move(notify) });
+}
+
+void FreeRunningClock::removeRenderer(Id id)
+{
+    QMutexLocker locker(&m_mutex);
+    auto it = std::find_if(m_entries.begin(), m_entries.end(),
+                           [id](const Entry &entry) { return entry.id == id; });
+    if (it == m_entries.end())
+        return;
+
+    const bool wasLeading = it->role == Role::Leading;
+    m_entries.erase(it);
+
+    // the renderer doesn't hold the others back anymore
+    if (wasLeading)
+        std::for_each(m_entries.begin(), m_entries.end(), &FreeRunningClock::notifyRenderer);
+}
+
+void FreeRunningClock::setPendingPosition(Id id, qint64 position)
+{
+    QMutexLocker locker(&m_mutex);
+    Entry *entry = findEntry(id);
+    if (!entry || entry->position == position)
+        return;
+
+    entry->position = position;
+
+    if (entry->role == Role::Leading) {
+        for (const Entry &other : m_entries) {
+            if (other.id != id)
+                notifyRenderer(other);
+        }
+    }
+}
+
+bool FreeRunningClock::canRender(Id id, qint64 position) const
+{
+    QMutexLocker locker(&m_mutex);
+    const Entry *entry = findEntry(id);
+    if (!entry)
+        return true;
+
+    if (entry->waitingForConsumer)
+        return false;
+
+    return std::none_of(m_entries.begin(), m_entries.end(), [&](const Entry &other) {
+        return other.id != id && other.role == Role::Leading && other.position < position;
+    });
+}
+
+void FreeRunningClock::waitForConsumer(Id id, QObject *consumer)
+{
+    {
+        QMutexLocker locker(&m_mutex);
+        Entry *entry = findEntry(id);
+        if (!entry)
+            return;
+
+        entry->waitingForConsumer = true;
+    }
+
+    // The call is queued after the frame delivery, which the consumer's thread
+    // processes first; the clock might be gone by then if the playback is stopped.
+    QMetaObject::invokeMethod(
+            consumer,
+            [weakClock = weak_from_this(), id] {
+                if (auto clock = weakClock.lock())
+                    clock->cancelWaitForConsumer(id);
+            },
+            Qt::QueuedConnection);
+}
+
+void FreeRunningClock::cancelWaitForConsumer(Id id)
+{
+    QMutexLocker locker(&m_mutex);
+    Entry *entry = findEntry(id);
+    if (entry && std::exchange(entry->waitingForConsumer, false))
+        notifyRenderer(*entry);
+}
+
+FreeRunningClock::Entry *FreeRunningClock::findEntry(Id id)
+{
+    auto it = std::find_if(m_entries.begin(), m_entries.end(),
+                           [id](const Entry &entry) { return entry.id == id; });
+    return it == m_entries.end() ? nullptr : &*it;
+}
+
+const FreeRunningClock::Entry *FreeRunningClock::findEntry(Id id) const
+{
+    return const_cast<FreeRunningClock *>(this)->findEntry(id);
+}
+
+void FreeRunningClock::notifyRenderer(const Entry &entry)
+{
+    // The renderer unregisters itself in its destructor, under the mutex that the callers
+    // hold, so the context is alive here; the queued call is dropped if it's deleted later.
+    QMetaObject::invokeMethod(entry.context, entry.notify, Qt::QueuedConnection);
+}
+
+} // namespace QFFmpeg
+
+QT_END_NAMESPACE
@@ -0,0 +1,100 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+#ifndef QFFMPEGFREERUNNINGCLOCK_P_H
+#define QFFMPEGFREERUNNINGCLOCK_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API. It exists purely as an
+// implementation detail. This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/qmutex.h>
+#include <QtCore/qobject.h>
+
+#include <functional>
+#include <limits>
+#include <memory>
+#include <vector>
+
+QT_BEGIN_NAMESPACE
+
+namespace QFFmpeg {
+
+/*!
+    Paces the renderers of a free-running playback against each other
+    instead of the wall clock.
+
+    Each renderer publishes the position of the next data it is going to render.
+    A renderer may render a frame once no leading renderer (audio or video) has
+    pending data before the frame, and once the consumer has taken its previous
+    frame. This keeps the outputs in lock-step, however fast they are consumed.
+    Following renderers (subtitles) wait for the leading ones, but don't hold them back.
+
+    The clock is shared between the renderer threads; a renderer is notified through
+    a queued call whenever the conditions it waits for might have changed.
+ */
+class FreeRunningClock : public std::enable_shared_from_this<FreeRunningClock>
+{
+public:
+    using Id = quint64;
+
+    enum class Role { Leading, Following };
+
+    static constexpr qint64 EndPosition = std::numeric_limits<qint64>::max();
+
+    /*!
+        Registers a renderer; \a notify is invoked in the thread of \a context
+        when the renderer might be able to render its next frame.
+     */
+    void addRenderer(Id id, Role role, qint64 position, QObject *context,
+                     std::function<void()> notify);
+
+    void removeRenderer(Id id);
+
+    /*!
+        Sets the position of the next data the renderer is going to render,
+        EndPosition if it has reached the end.
+     */
+    void setPendingPosition(Id id, qint64 position);
+
+    bool canRender(Id id, qint64 position) const;
+
+    /*!
+        Holds the renderer back until the thread of \a consumer has processed
+        the events posted so far, including the delivery of the frame just rendered.
+     */
+    void waitForConsumer(Id id, QObject *consumer);
+
+    void cancelWaitForConsumer(Id id);
+
+private:
+    struct Entry
+    {
+        Id id = 0;
+        Role role = Role::Leading;
+        qint64 position = 0;
+        bool waitingForConsumer = false;
+        QObject *context = nullptr;
+        std::function<void()> notify;
+    };
+
+    Entry *findEntry(Id id);
+    const Entry *findEntry(Id id) const;
+
+    static void notifyRenderer(const Entry &entry);
+
+    mutable QMutex m_mutex;
+    std::vector<Entry> m_entries;
+};
+
+} // namespace QFFmpeg
+
+QT_END_NAMESPACE
+
+#endif // QFFMPEGFREERUNNINGCLOCK_P_H
@@ -41,6 +41,11 @@ PlaybackEngineObject::Id PlaybackEngineObject::id() const
     return m_id;
 }
 
+void PlaybackEngineObject::setStatistics(std::shared_ptr<PlaybackStatistics> statistics)
+{
+    m_statistics = std::move(statistics);
+}
+
 void PlaybackEngineObject::setPaused(bool isPaused)
 {
     if (m_paused.testAndSetRelease(!isPaused, isPaused))
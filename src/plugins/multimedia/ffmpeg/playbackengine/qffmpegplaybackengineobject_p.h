@@ -15,9 +15,11 @@
 //
 
 #include "playbackengine/qffmpegplaybackenginedefs_p.h"
+#include "playbackengine/qffmpegplaybackstatistics_p.h"
 #include "qthread.h"
 #include "qatomic.h"
 #include <chrono>
+#include <memory>
 
 QT_BEGIN_NAMESPACE
 
@@ -47,6 +49,9 @@ public:
 
     Id id() const;
 
+    // Must be set before the object starts working on its thread
+    void setStatistics(std::shared_ptr<PlaybackStatistics> statistics);
+
 signals:
     void atEnd();
 
@@ -67,6 +72,8 @@ protected:
 
     virtual void doNextStep() { }
 
+    PlaybackStatistics *statistics() const { return m_statistics.get(); }
+
 private slots:
     void onTimeout();
 
@@ -77,6 +84,7 @@ private:
     QAtomicInteger<bool> m_atEnd = false;
     QAtomicInteger<bool> m_deleting = false;
     const Id m_id;
+    std::shared_ptr<PlaybackStatistics> m_statistics;
 };
 } // namespace QFFmpeg
 
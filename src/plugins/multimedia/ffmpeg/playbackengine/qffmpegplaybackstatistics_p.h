@@ -0,0 +1,47 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+#ifndef QFFMPEGPLAYBACKSTATISTICS_P_H
+#define QFFMPEGPLAYBACKSTATISTICS_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API. It exists purely as an
+// implementation detail. This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtMultimedia/private/qplatformmediaplayer_p.h>
+#include <QtCore/qatomic.h>
+
+#include <array>
+
+QT_BEGIN_NAMESPACE
+
+namespace QFFmpeg {
+
+/*!
+    Counters of the playback pipeline, shared by the playback engine objects.
+
+    Each counter is written by a single object on its thread and read by
+    PlaybackEngine::statistics on demand. The writes are relaxed atomic stores,
+    so the counters cost next to nothing while nobody reads them.
+ */
+struct PlaybackStatistics
+{
+    QAtomicInteger<qint64> bufferedDuration = 0;
+    QAtomicInteger<qint64> bufferedBytes = 0;
+    std::array<QAtomicInt, QPlatformMediaPlayer::NTrackTypes> decoderQueueLengths = {};
+    QAtomicInteger<qint64> renderedVideoFrames = 0;
+    QAtomicInteger<qint64> videoRenderLateness = 0;
+    QAtomicInteger<qint64> audioUnderruns = 0;
+};
+
+} // namespace QFFmpeg
+
+QT_END_NAMESPACE
+
+#endif // QFFMPEGPLAYBACKSTATISTICS_P_H
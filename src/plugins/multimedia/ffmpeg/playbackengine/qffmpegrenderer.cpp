@@ -4,8 +4,16 @@
 #include "playbackengine/qffmpegrenderer_p.h"
 #include <qloggingcategory.h>
 
+#include <qtmultimedia_ffmpeg_tracepoints_p.h>
+
 QT_BEGIN_NAMESPACE
 
+Q_TRACE_POINT(qtmultimedia_ffmpeg, QFFmpegRenderer_doNextStep_entry, quint64 id,
+              quint64 frameSourceId, qint64 framePtsUs);
+Q_TRACE_POINT(qtmultimedia_ffmpeg, QFFmpegRenderer_doNextStep_exit);
+Q_TRACE_POINT(qtmultimedia_ffmpeg, QFFmpegRenderer_frameRendered, quint64 id,
+              quint64 frameSourceId, qint64 framePtsUs, qint64 latenessUs);
+
 namespace QFFmpeg {
 
 Q_STATIC_LOGGING_CATEGORY(qLcRenderer, "qt.multimedia.ffmpeg.renderer");
@@ -18,6 +26,23 @@ Renderer::Renderer(const TimeController &tc, const std::chrono::microseconds &se
 {
 }
 
+Renderer::~Renderer()
+{
+    if (m_freeRunningClock)
+        m_freeRunningClock->removeRenderer(id());
+}
+
+void Renderer::setFreeRunningClock(std::shared_ptr<FreeRunningClock> clock,
+                                   FreeRunningClock::Role role)
+{
+    Q_ASSERT(!m_freeRunningClock);
+    Q_ASSERT(m_frames.empty());
+
+    m_freeRunningClock = std::move(clock);
+    m_freeRunningClock->addRenderer(id(), role, m_lastFrameEnd, this,
+                                    [this]() { scheduleNextStep(); });
+}
+
 void Renderer::syncSoft(TimePoint tp, qint64 trackTime)
 {
     QMetaObject::invokeMethod(this, [this, tp, trackTime]() {
@@ -98,8 +123,10 @@ void Renderer::render(Frame frame)
 
     m_frames.enqueue(frame);
 
-    if (m_frames.size() == 1)
+    if (m_frames.size() == 1) {
+        updateFreeRunningPosition();
         scheduleNextStep();
+    }
 }
 
 void Renderer::onPauseChanged()
@@ -110,7 +137,13 @@ void Renderer::onPauseChanged()
 
 bool Renderer::canDoNextStep() const
 {
-    return !m_frames.empty() && (m_isStepForced || PlaybackEngineObject::canDoNextStep());
+    if (m_frames.empty() || !(m_isStepForced || PlaybackEngineObject::canDoNextStep()))
+        return false;
+
+    if (!m_freeRunningClock || m_isStepForced || !m_frames.front().isValid())
+        return true;
+
+    return m_freeRunningClock->canRender(id(), m_frames.front().absolutePts());
 }
 
 float Renderer::playbackRate() const
@@ -122,7 +155,7 @@ std::chrono::milliseconds Renderer::timerInterval() const
 {
     using namespace std::chrono_literals;
 
-    if (m_frames.empty())
+    if (m_frames.empty() || m_freeRunningClock)
         return 0ms;
 
     auto calculateInterval = [](const TimePoint &nextTime) {
@@ -158,6 +191,9 @@ void Renderer::doNextStep()
 {
     auto frame = m_frames.front();
 
+    Q_TRACE_SCOPE(QFFmpegRenderer_doNextStep, id(), frame.isValid() ? frame.sourceId() : 0,
+                  frame.isValid() ? frame.startTime() : -1);
+
     if (setForceStepDone()) {
         // if (frame.isValid() && frame.pts() > m_forceStepMaxPos) {
         //    scheduleNextStep(false);
@@ -184,7 +220,18 @@ void Renderer::doNextStep()
                 emit loopChanged(id(), frame.loopOffset().loopStartTimeUs, m_loopIndex);
             }
 
+            // the lateness is relative to the frame's presentation time, the free-running
+            // playback doesn't follow it
+            if (Q_TRACE_ENABLED(QFFmpegRenderer_frameRendered))
+                Q_TRACE(QFFmpegRenderer_frameRendered, id(), frame.sourceId(), frame.startTime(),
+                        qint64(frameDelay(frame, Clock::now()).count()));
+
             emit frameProcessed(frame);
+
+            if (m_freeRunningClock) {
+                if (QObject *consumer = frameConsumer())
+                    m_freeRunningClock->waitForConsumer(id(), consumer);
+            }
         } else {
             m_lastPosition.storeRelease(std::max(m_lastFrameEnd, lastPosition()));
         }
@@ -194,9 +241,33 @@ void Renderer::doNextStep()
 
     setAtEnd(result.done && !frame.isValid());
 
+    updateFreeRunningPosition();
+
     scheduleNextStep(false);
 }
 
+void Renderer::onFrameConsumerChanged()
+{
+    // the previous consumer might never process the pending call
+    if (m_freeRunningClock)
+        m_freeRunningClock->cancelWaitForConsumer(id());
+}
+
+void Renderer::updateFreeRunningPosition()
+{
+    if (!m_freeRunningClock)
+        return;
+
+    qint64 position = m_lastFrameEnd;
+    if (isAtEnd())
+        position = FreeRunningClock::EndPosition;
+    else if (!m_frames.empty())
+        position = m_frames.front().isValid() ? m_frames.front().absolutePts()
+                                              : FreeRunningClock::EndPosition;
+
+    m_freeRunningClock->setPendingPosition(id(), position);
+}
+
 std::chrono::microseconds Renderer::frameDelay(const Frame &frame, TimePoint timePoint) const
 {
     return std::chrono::duration_cast<std::chrono::microseconds>(
@@ -16,12 +16,14 @@
 
 #include "qffmpegplaybackengineobject_p.h"
 #include "qffmpegtimecontroller_p.h"
+#include "qffmpegfreerunningclock_p.h"
 #include "qffmpegframe_p.h"
 
 #include <QtCore/qpointer.h>
 #include <QtCore/qqueue.h>
 
 #include <chrono>
+#include <memory>
 
 QT_BEGIN_NAMESPACE
 
@@ -35,6 +37,12 @@ public:
     using Clock = TimeController::Clock;
     Renderer(const TimeController &tc, const std::chrono::microseconds &seekPosTimeOffset = {});
 
+    ~Renderer() override;
+
+    // Makes the renderer free-running: frames are rendered as soon as the clock allows it,
+    // regardless of the wall clock. Must be set before the renderer gets frames.
+    void setFreeRunningClock(std::shared_ptr<FreeRunningClock> clock, FreeRunningClock::Role role);
+
     void syncSoft(TimePoint tp, qint64 trackPos);
 
     qint64 seekPosition() const;
@@ -74,6 +82,12 @@ protected:
 
     virtual void onPlaybackRateChanged() { }
 
+    // The object receiving the rendered frames; while free-running, the next frame is
+    // rendered after the thread of the consumer has processed the previous one.
+    virtual QObject *frameConsumer() const { return nullptr; }
+
+    bool isFreeRunning() const { return m_freeRunningClock != nullptr; }
+
     struct RenderingResult
     {
         bool done = true;
@@ -94,10 +108,12 @@ protected:
     {
         const auto connectionType =
                 thread()->isCurrentThread() ? Qt::AutoConnection : Qt::BlockingQueuedConnection;
-        auto doer = [desired, changeHandler, &actual]() {
+        auto doer = [this, desired, changeHandler, &actual]() {
             const auto prev = std::exchange(actual, desired);
-            if (prev != desired)
+            if (prev != desired) {
                 changeHandler(prev);
+                onFrameConsumerChanged();
+            }
         };
         QMetaObject::invokeMethod(this, doer, connectionType);
     }
@@ -105,6 +121,10 @@ protected:
 private:
     void doNextStep() override;
 
+    void onFrameConsumerChanged();
+
+    void updateFreeRunningPosition();
+
 private:
     TimeController m_timeController;
     qint64 m_lastFrameEnd = 0;
@@ -116,6 +136,8 @@ private:
 
     QAtomicInteger<bool> m_isStepForced = false;
     std::optional<TimePoint> m_explicitNextFrameTime;
+
+    std::shared_ptr<FreeRunningClock> m_freeRunningClock;
 };
 
 } // namespace QFFmpeg
@@ -5,10 +5,21 @@
 #include "playbackengine/qffmpegmediadataholder_p.h"
 #include <qloggingcategory.h>
 
+#include <qtmultimedia_ffmpeg_tracepoints_p.h>
+
 QT_BEGIN_NAMESPACE
 
 Q_STATIC_LOGGING_CATEGORY(qLcStreamDecoder, "qt.multimedia.ffmpeg.streamdecoder");
 
+Q_TRACE_POINT(qtmultimedia_ffmpeg, QFFmpegStreamDecoder_decode_entry, quint64 id,
+              quint64 packetSourceId, qint64 packetPtsUs);
+Q_TRACE_POINT(qtmultimedia_ffmpeg, QFFmpegStreamDecoder_decode_exit);
+Q_TRACE_POINT(qtmultimedia_ffmpeg, QFFmpegStreamDecoder_receive_entry, quint64 id);
+Q_TRACE_POINT(qtmultimedia_ffmpeg, QFFmpegStreamDecoder_receive_exit);
+Q_TRACE_POINT(qtmultimedia_ffmpeg, QFFmpegStreamDecoder_frameDecoded, quint64 id, qint64 ptsUs,
+              int pendingFrames);
+Q_TRACE_POINT(qtmultimedia_ffmpeg, QFFmpegStreamDecoder_frameDropped, quint64 id, qint64 ptsUs);
+
 namespace QFFmpeg {
 
 StreamDecoder::StreamDecoder(const CodecContext &codecContext, qint64 absSeekPos)
@@ -101,6 +112,7 @@ void StreamDecoder::onFrameProcessed(Frame frame)
 
     --m_pendingFramesCount;
     Q_ASSERT(m_pendingFramesCount >= 0);
+    updateQueueStatistics();
 
     scheduleNextStep();
 }
@@ -115,11 +127,17 @@ bool StreamDecoder::canDoNextStep() const
 
 void StreamDecoder::onFrameFound(Frame frame)
 {
-    if (frame.isValid() && frame.absoluteEnd() < m_absSeekPos)
+    if (frame.isValid() && frame.absoluteEnd() < m_absSeekPos) {
+        Q_TRACE(QFFmpegStreamDecoder_frameDropped, id(), frame.startTime());
         return;
+    }
 
     Q_ASSERT(m_pendingFramesCount >= 0);
     ++m_pendingFramesCount;
+    updateQueueStatistics();
+
+    if (frame.isValid())
+        Q_TRACE(QFFmpegStreamDecoder_frameDecoded, id(), frame.startTime(), m_pendingFramesCount);
     emit requestHandleFrame(frame);
 }
 
@@ -144,13 +162,26 @@ void StreamDecoder::decodeMedia(Packet packet)
         receiveAVFrames(!packet.isValid());
 }
 
+void StreamDecoder::updateQueueStatistics()
+{
+    if (PlaybackStatistics *stats = statistics())
+        stats->decoderQueueLengths[m_trackType].storeRelaxed(m_pendingFramesCount);
+}
+
 int StreamDecoder::sendAVPacket(Packet packet)
 {
+    Q_TRACE_SCOPE(QFFmpegStreamDecoder_decode, id(), packet.isValid() ? packet.sourceId() : 0,
+                  packet.isValid() ? traceTimeStampUs(packet.avPacket()->pts,
+                                                      m_codecContext.stream()->time_base)
+                                   : -1);
+
     return avcodec_send_packet(m_codecContext.context(), packet.isValid() ? packet.avPacket() : nullptr);
 }
 
 void StreamDecoder::receiveAVFrames(bool flushPacket)
 {
+    Q_TRACE_SCOPE(QFFmpegStreamDecoder_receive, id());
+
     while (true) {
         auto avFrame = makeAVFrame();
 
@@ -70,6 +70,8 @@ private:
 
     void receiveAVFrames(bool flushPacket = false);
 
+    void updateQueueStatistics();
+
 private:
     CodecContext m_codecContext;
     qint64 m_absSeekPos = 0;
@@ -43,6 +43,11 @@ Renderer::RenderingResult SubtitleRenderer::renderInternal(Frame frame)
     return {};
 }
 
+QObject *SubtitleRenderer::frameConsumer() const
+{
+    return m_sink;
+}
+
 } // namespace QFFmpeg
 
 QT_END_NAMESPACE
@@ -64,7 +64,8 @@ VideoRenderer::RenderingResult VideoRenderer::renderInternal(Frame frame)
 #endif
 
     const auto pixelAspectRatio = codecContext->pixelAspectRatio(frame.avFrame());
-    auto buffer = std::make_unique<QFFmpegVideoBuffer>(frame.takeAVFrame(), pixelAspectRatio);
+    auto buffer = std::make_unique<QFFmpegVideoBuffer>(frame.takeAVFrame(), pixelAspectRatio,
+                                                       codecContext->swFrameConverter());
     QVideoFrameFormat format(buffer->size(), buffer->pixelFormat());
     format.setColorSpace(buffer->colorSpace());
     format.setColorTransfer(buffer->colorTransfer());
@@ -77,9 +78,21 @@ VideoRenderer::RenderingResult VideoRenderer::renderInternal(Frame frame)
     videoFrame.setEndTime(frame.endTime());
     m_sink->setVideoFrame(videoFrame);
 
+    if (PlaybackStatistics *stats = statistics()) {
+        stats->renderedVideoFrames.fetchAndAddRelaxed(1);
+        // the free-running playback doesn't follow the presentation times
+        if (!isFreeRunning())
+            stats->videoRenderLateness.storeRelaxed(frameDelay(frame).count());
+    }
+
     return {};
 }
 
+QObject *VideoRenderer::frameConsumer() const
+{
+    return m_sink;
+}
+
 } // namespace QFFmpeg
 
 QT_END_NAMESPACE
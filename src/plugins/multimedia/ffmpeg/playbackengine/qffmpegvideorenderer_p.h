@@ -36,6 +36,8 @@ public:
 protected:
     RenderingResult renderInternal(Frame frame) override;
 
+    QObject *frameConsumer() const override;
+
 private:
     QPointer<QVideoSink> m_sink;
     VideoTransformation m_transform;
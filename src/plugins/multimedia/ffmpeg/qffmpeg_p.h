@@ -57,6 +57,12 @@ inline std::optional<qint64> timeStampUs(qint64 ts, AVRational base)
     return mul(1'000'000 * ts, base);
 }
 
+// Returns -1 if the timestamp is not set; for the trace points
+inline qint64 traceTimeStampUs(qint64 ts, AVRational base)
+{
+    return ts == AV_NOPTS_VALUE ? -1 : timeStampUs(ts, base).value_or(-1);
+}
+
 inline std::optional<float> toFloat(AVRational r)
 {
     return r.den != 0 ? float(r.num) / float(r.den) : std::optional<float>{};
@@ -154,6 +160,10 @@ using AVCodecContextUPtr =
 using AVBufferUPtr =
         std::unique_ptr<AVBufferRef, AVDeleter<decltype(&av_buffer_unref), &av_buffer_unref>>;
 
+using AVBufferPoolUPtr =
+        std::unique_ptr<AVBufferPool,
+                        AVDeleter<decltype(&av_buffer_pool_uninit), &av_buffer_pool_uninit>>;
+
 using AVHWFramesConstraintsUPtr = std::unique_ptr<
         AVHWFramesConstraints,
         AVDeleter<decltype(&av_hwframe_constraints_free), &av_hwframe_constraints_free>>;
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
 #include "qffmpegaudiodecoder_p.h"
 #include "qffmpegresampler_p.h"
+#include "qffmpegsynchronousaudiodecoder_p.h"
 #include "qaudiobuffer.h"
 
 #include "qffmpegplaybackengine_p.h"
@@ -168,6 +169,7 @@ void QFFmpegAudioDecoder::start()
 void QFFmpegAudioDecoder::stop()
 {
     qCDebug(qLcAudioDecoder) << ">>>>> stop";
+    m_synchronousDecoder.reset();
     if (m_decoder) {
         m_decoder.reset();
         done();
@@ -176,11 +178,14 @@ void QFFmpegAudioDecoder::stop()
 
 QAudioFormat QFFmpegAudioDecoder::audioFormat() const
 {
-    return m_audioFormat;
+    // in synchronous mode, report the actual format of the data returned by readSynchronous
+    return m_synchronousDecoder ? m_synchronousDecoder->outputFormat() : m_audioFormat;
 }
 
 void QFFmpegAudioDecoder::setAudioFormat(const QAudioFormat &format)
 {
+    m_synchronousDecoder.reset();
+
     if (std::exchange(m_audioFormat, format) != format)
         formatChanged(m_audioFormat);
 }
@@ -197,6 +202,61 @@ QAudioBuffer QFFmpegAudioDecoder::read()
     return buffer;
 }
 
+qint64 QFFmpegAudioDecoder::position() const
+{
+    // synchronous mode doesn't emit signals, the position is taken from the decoder
+    return m_synchronousDecoder ? m_synchronousDecoder->position() / 1000
+                                : QPlatformAudioDecoder::position();
+}
+
+qint64 QFFmpegAudioDecoder::duration() const
+{
+    return m_synchronousDecoder ? m_synchronousDecoder->duration() / 1000
+                                : QPlatformAudioDecoder::duration();
+}
+
+bool QFFmpegAudioDecoder::startSynchronous(qint64 from, qint64 to)
+{
+    qCDebug(qLcAudioDecoder) << "start synchronous" << from << to;
+    stop();
+
+    QFFmpeg::SynchronousAudioDecoder::Maybe decoder =
+            QFFmpeg::SynchronousAudioDecoder::create(m_url, m_sourceDevice, m_audioFormat);
+    if (!decoder) {
+        auto [code, description] = decoder.error();
+        errorSignal(code, description);
+        return false;
+    }
+
+    // audioFormat(), position() and duration() report the state of the synchronous decoder
+    m_synchronousDecoder = std::move(decoder.value());
+
+    if (!m_synchronousDecoder->setRange(from * 1000, to < 0 ? -1 : to * 1000)) {
+        error(QAudioDecoder::ResourceError, m_synchronousDecoder->errorString());
+        m_synchronousDecoder.reset();
+        return false;
+    }
+
+    return true;
+}
+
+qint64 QFFmpegAudioDecoder::readSynchronous(QSpan<std::byte> data)
+{
+    if (!m_synchronousDecoder)
+        return -1;
+
+    const qint64 bytesRead = m_synchronousDecoder->read(data);
+    if (bytesRead < 0)
+        error(QAudioDecoder::ResourceError, m_synchronousDecoder->errorString());
+
+    return bytesRead;
+}
+
+bool QFFmpegAudioDecoder::seekSynchronous(qint64 position)
+{
+    return m_synchronousDecoder && m_synchronousDecoder->seek(position * 1000);
+}
+
 void QFFmpegAudioDecoder::newAudioBuffer(const QAudioBuffer &b)
 {
     Q_ASSERT(b.isValid());
@@ -23,6 +23,7 @@ QT_BEGIN_NAMESPACE
 
 namespace QFFmpeg {
 class AudioDecoder;
+class SynchronousAudioDecoder;
 } // namespace QFFmpeg
 
 class QFFmpegAudioDecoder : public QPlatformAudioDecoder
@@ -47,6 +48,13 @@ public:
 
     QAudioBuffer read() override;
 
+    qint64 position() const override;
+    qint64 duration() const override;
+
+    bool startSynchronous(qint64 from, qint64 to) override;
+    qint64 readSynchronous(QSpan<std::byte> data) override;
+    bool seekSynchronous(qint64 position) override;
+
 public Q_SLOTS:
     void newAudioBuffer(const QAudioBuffer &b);
     void done();
@@ -58,6 +66,7 @@ private:
     QUrl m_url;
     QIODevice *m_sourceDevice = nullptr;
     std::unique_ptr<AudioDecoder> m_decoder;
+    std::unique_ptr<QFFmpeg::SynchronousAudioDecoder> m_synchronousDecoder;
     QAudioFormat m_audioFormat;
 
     QAudioBuffer m_audioBuffer;
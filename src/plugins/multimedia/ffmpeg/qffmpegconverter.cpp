@@ -3,12 +3,16 @@
 
 #include "qffmpegconverter_p.h"
 #include "qffmpeg_p.h"
+#include "qffmpegslicedscaler_p.h"
 #include <QtMultimedia/qvideoframeformat.h>
 #include <QtMultimedia/qvideoframe.h>
 #include <QtCore/qloggingcategory.h>
 #include <private/qvideotexturehelper_p.h>
 
+#include <algorithm>
+
 extern "C" {
+#include <libavutil/pixdesc.h>
 #include <libswscale/swscale.h>
 }
 
@@ -148,13 +152,7 @@ using PixelFormat = QVideoFrameFormat::PixelFormat;
 
 // clang-format off
 
-QFFmpeg::SwsContextUPtr createConverter(const QSize &srcSize, PixelFormat srcPixFmt,
-                               const QSize &dstSize, PixelFormat dstPixFmt)
-{
-    return QFFmpeg::createSwsContext(srcSize, toAVPixelFormat(srcPixFmt), dstSize, toAVPixelFormat(dstPixFmt), SWS_BILINEAR);
-}
-
-bool setColorSpaceDetails(SwsContext *context,
+bool setColorSpaceDetails(QFFmpeg::SlicedScaler &scaler,
                           const QVideoFrameFormat &srcFormat,
                           const QVideoFrameFormat &dstFormat)
 {
@@ -164,104 +162,239 @@ bool setColorSpaceDetails(SwsContext *context,
     constexpr int brightness = 0;
     constexpr int contrast = 0;
     constexpr int saturation = 0;
-    const int status = sws_setColorspaceDetails(context,
+    return scaler.setColorspaceDetails(
         sws_getCoefficients(src.colorSpace), src.colorRange,
         sws_getCoefficients(dst.colorSpace), dst.colorRange,
         brightness, contrast, saturation);
+}
 
-    return status == 0;
+// clang-format on
+
+// The size of a pixel in the plane, in bytes. Packed 4:2:2 formats interleave the chroma of
+// two pixels, so the smallest step of the plane components is the one of a pixel.
+int pixelStep(const AVPixFmtDescriptor *desc, int plane)
+{
+    int step = 0;
+    for (int i = 0; i < desc->nb_components; ++i) {
+        if (desc->comp[i].plane == plane && (step == 0 || desc->comp[i].step < step))
+            step = desc->comp[i].step;
+    }
+    return step;
 }
 
-bool convert(SwsContext *context, QVideoFrame &src, int srcHeight, QVideoFrame &dst)
+// Moves the planes to the top-left corner of the source rectangle,
+// which must be aligned to the chroma subsampling of the format
+bool cropSwsData(SwsFrameData &data, AVPixelFormat format, const QPoint &origin)
 {
-    if (!src.map(QVideoFrame::ReadOnly))
+    if (origin.isNull())
+        return true;
+
+    constexpr auto unsupportedFlags =
+            AV_PIX_FMT_FLAG_PAL | AV_PIX_FMT_FLAG_BITSTREAM | AV_PIX_FMT_FLAG_HWACCEL;
+    const AVPixFmtDescriptor *desc = av_pix_fmt_desc_get(format);
+    if (!desc || (desc->flags & unsupportedFlags))
         return false;
 
-    QScopeGuard unmapSrc{[&] {
-        src.unmap();
-    }};
+    for (int plane = 0; plane < SwsFrameData::arraySize; ++plane) {
+        if (!data.bits[plane])
+            continue;
 
-    if (!dst.map(QVideoFrame::WriteOnly))
-        return false;
+        // Planes 1 and 2 are chroma ones, see av_image_fill_pointers
+        const bool isChroma = plane == 1 || plane == 2;
+        const int x = isChroma ? origin.x() >> desc->log2_chroma_w : origin.x();
+        const int y = isChroma ? origin.y() >> desc->log2_chroma_h : origin.y();
+        data.bits[plane] +=
+                qsizetype(y) * data.stride[plane] + qsizetype(x) * pixelStep(desc, plane);
+    }
 
-    QScopeGuard unmapDst{[&] {
-        dst.unmap();
-    }};
+    return true;
+}
 
-    const SwsFrameData srcData = getSwsData(src);
-    const SwsFrameData dstData = getSwsData(dst);
+// The alignment of sizes and positions imposed by the chroma subsampling of the format
+QSize chromaAlignment(PixelFormat format)
+{
+    const auto *desc = QVideoTextureHelper::textureDescription(format);
 
-    constexpr int firstSrcSliceRow = 0;
-    const int scaledHeight = sws_scale(context,
-        srcData.bits.data(), srcData.stride.data(),
-        firstSrcSliceRow, srcHeight,
-        dstData.bits.data(), dstData.stride.data());
+    QSize alignment(1, 1);
+    for (int i = 0; i < desc->nplanes; ++i) {
+        // TODO: Assumes that max subsampling is 2
+        if (desc->sizeScale[i].x != 1)
+            alignment.setWidth(2);
 
-    if (scaledHeight != srcHeight)
-        return false;
+        if (desc->sizeScale[i].y != 1)
+            alignment.setHeight(2);
+    }
 
-    return true;
+    return alignment;
 }
 
 // Ensure even size if using planar format with chroma subsampling
 QSize adjustSize(const QSize& size, PixelFormat srcFmt, PixelFormat dstFmt)
 {
-    const auto* srcDesc = QVideoTextureHelper::textureDescription(srcFmt);
-    const auto* dstDesc = QVideoTextureHelper::textureDescription(dstFmt);
-
     QSize output = size;
-    for (const auto desc : { srcDesc, dstDesc }) {
-        for (int i = 0; i < desc->nplanes; ++i) {
-            // TODO: Assumes that max subsampling is 2
-            if (desc->sizeScale[i].x != 1)
-                output.setWidth(output.width() & ~1); // Make even
-
-            if (desc->sizeScale[i].y != 1)
-                output.setHeight(output.height() & ~1); // Make even
-        }
+    for (const auto fmt : { srcFmt, dstFmt }) {
+        const QSize alignment = chromaAlignment(fmt);
+        output.setWidth(output.width() & ~(alignment.width() - 1));
+        output.setHeight(output.height() & ~(alignment.height() - 1));
     }
 
     return output;
 }
 
+// Clips the source rectangle to the frame, and moves its origin to the chroma sample it
+// belongs to; an odd origin in subsampled planes can't be addressed by the plane pointers.
+QRect sourceRectFor(const QRect &requestedRect, const QVideoFrame &src)
+{
+    const QRect frameRect(QPoint(), src.size());
+    if (requestedRect.isNull())
+        return frameRect;
+
+    const QRect rect = requestedRect & frameRect;
+    if (rect.isEmpty())
+        return {};
+
+    const QSize alignment = chromaAlignment(src.pixelFormat());
+    const QPoint origin(rect.x() & ~(alignment.width() - 1), rect.y() & ~(alignment.height() - 1));
+    return QRect(origin, rect.bottomRight());
+}
+
 } // namespace
 
-// Converts a video frame to the dstFormat video frame format.
-QVideoFrame convertFrame(QVideoFrame &src, const QVideoFrameFormat &dstFormat)
+namespace QFFmpeg {
+
+VideoFrameConverter::VideoFrameConverter(const QVideoFrameFormat &targetFormat)
+    : m_targetFormat(targetFormat)
+{
+}
+
+VideoFrameConverter::~VideoFrameConverter() = default;
+
+void VideoFrameConverter::setMaxSliceCount(int count)
+{
+    m_maxSliceCount = std::max(count, 1);
+}
+
+QVideoFrame VideoFrameConverter::convert(QVideoFrame &src)
 {
-    if (src.size() != dstFormat.frameSize()) {
-        qCCritical(lc) << "Resizing is not supported";
+    QVideoFrame dst{ m_targetFormat };
+    if (!convert(src, dst))
         return {};
+
+    return dst;
+}
+
+bool VideoFrameConverter::convert(QVideoFrame &src, QVideoFrame &dst)
+{
+    if (dst.pixelFormat() != m_targetFormat.pixelFormat()
+        || dst.size() != m_targetFormat.frameSize()) {
+        qCCritical(lc) << "The destination frame doesn't match the target format";
+        return false;
     }
 
-    // Adjust size to even width/height if we have chroma subsampling
-    const QSize size = adjustSize(src.size(), src.pixelFormat(), dstFormat.pixelFormat());
-    if (size != src.size())
+    const QRect srcRect = sourceRectFor(m_sourceRect, src);
+    if (srcRect.isEmpty()) {
+        qCCritical(lc) << "The source rectangle" << m_sourceRect << "is outside of the frame";
+        return false;
+    }
+
+    // Adjust sizes to even width/height if we have chroma subsampling
+    const QSize srcSize = adjustSize(srcRect.size(), src.pixelFormat(), dst.pixelFormat());
+    const QSize dstSize = adjustSize(dst.size(), src.pixelFormat(), dst.pixelFormat());
+    if (srcSize != srcRect.size() || dstSize != dst.size())
         qCWarning(lc) << "Input truncated to even width/height";
 
-    const QFFmpeg::SwsContextUPtr conv = createConverter(
-        size, src.pixelFormat(), size, dstFormat.pixelFormat());
+    if (srcSize.isEmpty() || dstSize.isEmpty()) {
+        qCCritical(lc) << "Nothing to convert after truncating the frames";
+        return false;
+    }
 
-    if (!conv) {
-        qCCritical(lc) << "Failed to create SW converter";
-        return {};
+    const QVideoFrameFormat srcFormat = src.surfaceFormat();
+    SlicedScaler *scaler = scalerFor({ srcFormat.pixelFormat(), srcFormat.colorSpace(),
+                                       srcFormat.colorRange(), srcSize,
+                                       m_targetFormat.pixelFormat(), m_targetFormat.colorSpace(),
+                                       m_targetFormat.colorRange(), dstSize, m_maxSliceCount });
+    if (!scaler)
+        return false;
+
+    if (!src.map(QVideoFrame::ReadOnly)) {
+        qCCritical(lc) << "Failed to map the source frame";
+        return false;
     }
 
-    if (!setColorSpaceDetails(conv.get(), src.surfaceFormat(), dstFormat)) {
-        qCCritical(lc) << "Failed to set color space details";
-        return {};
+    QScopeGuard unmapSrc{ [&] {
+        src.unmap();
+    } };
+
+    if (!dst.map(QVideoFrame::WriteOnly)) {
+        qCCritical(lc) << "Failed to map the destination frame";
+        return false;
     }
 
-    QVideoFrame dst{ dstFormat };
+    QScopeGuard unmapDst{ [&] {
+        dst.unmap();
+    } };
 
-    if (!convert(conv.get(), src, size.height(), dst)) {
+    SwsFrameData srcData = getSwsData(src);
+    const SwsFrameData dstData = getSwsData(dst);
+
+    if (!cropSwsData(srcData, scaler->sourceFormat(), srcRect.topLeft())) {
+        qCCritical(lc) << "Cropping is not supported for" << src.pixelFormat();
+        return false;
+    }
+
+    const int scaledHeight = scaler->scale(srcData.bits.data(), srcData.stride.data(),
+                                           dstData.bits.data(), dstData.stride.data());
+    if (scaledHeight != dstSize.height()) {
         qCCritical(lc) << "Frame conversion failed";
-        return {};
+        return false;
     }
 
-    return dst;
+    return true;
 }
 
-// clang-format on
+SlicedScaler *VideoFrameConverter::scalerFor(const ScalerKey &key)
+{
+    // The converters of live sources usually see a single format; a few entries cover
+    // the sources changing their formats back and forth.
+    constexpr size_t MaxCachedScalers = 4;
+
+    auto found = std::find_if(m_scalers.begin(), m_scalers.end(),
+                              [&](const CachedScaler &cached) { return cached.key == key; });
+    if (found != m_scalers.end()) {
+        std::rotate(m_scalers.begin(), found, std::next(found));
+        return m_scalers.front().scaler.get();
+    }
+
+    auto scaler = std::make_unique<SlicedScaler>(
+            key.srcSize, toAVPixelFormat(key.srcPixelFormat), key.dstSize,
+            toAVPixelFormat(key.dstPixelFormat), SWS_BILINEAR, key.maxSliceCount);
+
+    if (!scaler->isValid()) {
+        qCCritical(lc) << "Failed to create SW converter";
+        return nullptr;
+    }
+
+    QVideoFrameFormat srcFormat(key.srcSize, key.srcPixelFormat);
+    srcFormat.setColorSpace(key.srcColorSpace);
+    srcFormat.setColorRange(key.srcColorRange);
+    if (!setColorSpaceDetails(*scaler, srcFormat, m_targetFormat)) {
+        qCCritical(lc) << "Failed to set color space details";
+        return nullptr;
+    }
+
+    if (m_scalers.size() == MaxCachedScalers)
+        m_scalers.pop_back();
+
+    m_scalers.insert(m_scalers.begin(), { key, std::move(scaler) });
+    return m_scalers.front().scaler.get();
+}
+
+} // namespace QFFmpeg
+
+// Converts a video frame to the dstFormat video frame format.
+QVideoFrame convertFrame(QVideoFrame &src, const QVideoFrameFormat &dstFormat)
+{
+    return QFFmpeg::VideoFrameConverter(dstFormat).convert(src);
+}
 
 QT_END_NAMESPACE
@@ -16,13 +16,92 @@
 //
 
 #include <QtCore/qtconfigmacros.h>
+#include <QtCore/qrect.h>
+#include <QtMultimedia/qvideoframeformat.h>
 #include <private/qtmultimediaglobal_p.h>
 
+#include <memory>
+#include <vector>
+
 QT_BEGIN_NAMESPACE
 
-class QVideoFrameFormat;
 class QVideoFrame;
 
+namespace QFFmpeg {
+
+class SlicedScaler;
+
+// Converts video frames to the target format and size, cropping and scaling them if needed.
+// The scalers are cached by source and target formats and sizes, so converting a stream of
+// frames doesn't recreate them for every frame. The class is not thread-safe.
+class VideoFrameConverter
+{
+public:
+    explicit VideoFrameConverter(const QVideoFrameFormat &targetFormat = {});
+    ~VideoFrameConverter();
+
+    void setTargetFormat(const QVideoFrameFormat &format) { m_targetFormat = format; }
+    const QVideoFrameFormat &targetFormat() const { return m_targetFormat; }
+
+    // The region of the source frames to convert; a null rectangle selects the whole frames.
+    // The region is clipped to the frames, and aligned to their chroma subsampling.
+    void setSourceRect(const QRect &rect) { m_sourceRect = rect; }
+    QRect sourceRect() const { return m_sourceRect; }
+
+    // The maximum number of threads converting a frame, see SlicedScaler; 1 by default.
+    void setMaxSliceCount(int count);
+    int maxSliceCount() const { return m_maxSliceCount; }
+
+    // Converts src into a new frame of the target format
+    QVideoFrame convert(QVideoFrame &src);
+
+    // Converts src into dst, which allows reusing the destination frames.
+    // dst must have the pixel format and the size of the target format.
+    bool convert(QVideoFrame &src, QVideoFrame &dst);
+
+private:
+    struct ScalerKey
+    {
+        QVideoFrameFormat::PixelFormat srcPixelFormat;
+        QVideoFrameFormat::ColorSpace srcColorSpace;
+        QVideoFrameFormat::ColorRange srcColorRange;
+        QSize srcSize;
+        QVideoFrameFormat::PixelFormat dstPixelFormat;
+        QVideoFrameFormat::ColorSpace dstColorSpace;
+        QVideoFrameFormat::ColorRange dstColorRange;
+        QSize dstSize;
+        int maxSliceCount;
+
+        friend bool operator==(const ScalerKey &lhs, const ScalerKey &rhs) noexcept
+        {
+            return lhs.srcPixelFormat == rhs.srcPixelFormat
+                    && lhs.srcColorSpace == rhs.srcColorSpace
+                    && lhs.srcColorRange == rhs.srcColorRange && lhs.srcSize == rhs.srcSize
+                    && lhs.dstPixelFormat == rhs.dstPixelFormat
+                    && lhs.dstColorSpace == rhs.dstColorSpace
+                    && lhs.dstColorRange == rhs.dstColorRange && lhs.dstSize == rhs.dstSize
+                    && lhs.maxSliceCount == rhs.maxSliceCount;
+        }
+    };
+
+    struct CachedScaler
+    {
+        ScalerKey key;
+        std::unique_ptr<SlicedScaler> scaler;
+    };
+
+    SlicedScaler *scalerFor(const ScalerKey &key);
+
+    QVideoFrameFormat m_targetFormat;
+    QRect m_sourceRect;
+    int m_maxSliceCount = 1;
+
+    // the most recently used scaler first
+    std::vector<CachedScaler> m_scalers;
+};
+
+} // namespace QFFmpeg
+
 QVideoFrame convertFrame(QVideoFrame &src, const QVideoFrameFormat &dstFormat);
 
 QT_END_NAMESPACE
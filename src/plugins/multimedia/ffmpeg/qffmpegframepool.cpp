@@ -0,0 +1,126 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qffmpegframepool_p.h"
+
+#include <QtCore/qloggingcategory.h>
+
+extern "C" {
+#include <libavutil/imgutils.h>
+#include <libavutil/samplefmt.h>
+}
+
+QT_BEGIN_NAMESPACE
+
+Q_STATIC_LOGGING_CATEGORY(qLcFFmpegFramePool, "qt.multimedia.ffmpeg.framepool");
+
+namespace QFFmpeg {
+
+bool AVFramePool::reset(AVPixelFormat format, const QSize &size)
+{
+    if (m_pool && format == m_format && size == m_size)
+        return true;
+
+    m_pool.reset();
+    m_format = format;
+    m_size = size;
+
+    const int bufferSize =
+            av_image_get_buffer_size(format, size.width(), size.height(), Alignment);
+    if (bufferSize <= 0) {
+        qCWarning(qLcFFmpegFramePool) << "Cannot create frame pool for format" << format
+                                      << "and size" << size << "; error:" << err2str(bufferSize);
+        return false;
+    }
+
+    m_pool.reset(av_buffer_pool_init(bufferSize, nullptr));
+    return m_pool != nullptr;
+}
+
+AVFrameUPtr AVFramePool::get()
+{
+    if (!m_pool)
+        return nullptr;
+
+    AVFrameUPtr frame = makeAVFrame();
+    if (!frame)
+        return nullptr;
+
+    frame->buf[0] = av_buffer_pool_get(m_pool.get());
+    if (!frame->buf[0])
+        return nullptr;
+
+    frame->format = m_format;
+    frame->width = m_size.width();
+    frame->height = m_size.height();
+
+    const int filledSize =
+            av_image_fill_arrays(frame->data, frame->linesize, frame->buf[0]->data, m_format,
+                                 m_size.width(), m_size.height(), Alignment);
+    if (filledSize < 0) {
+        qCWarning(qLcFFmpegFramePool) << "Cannot fill frame arrays:" << err2str(filledSize);
+        return nullptr;
+    }
+
+    return frame;
+}
+
+bool AVAudioFramePool::reset(AVSampleFormat format, int channelCount, int samplesCount)
+{
+    if (m_pool && format == m_format && channelCount == m_channelCount
+        && samplesCount == m_samplesCount)
+        return true;
+
+    m_pool.reset();
+    m_format = format;
+    m_channelCount = channelCount;
+    m_samplesCount = samplesCount;
+
+    const int planesCount = av_sample_fmt_is_planar(format) ? channelCount : 1;
+    if (planesCount > AV_NUM_DATA_POINTERS)
+        return false;
+
+    const int bufferSize =
+            av_samples_get_buffer_size(nullptr, channelCount, samplesCount, format, 0);
+    if (bufferSize <= 0) {
+        qCWarning(qLcFFmpegFramePool) << "Cannot create audio frame pool for format" << format
+                                      << "; error:" << err2str(bufferSize);
+        return false;
+    }
+
+    m_pool.reset(av_buffer_pool_init(bufferSize, nullptr));
+    return m_pool != nullptr;
+}
+
+AVFrameUPtr AVAudioFramePool::get()
+{
+    if (!m_pool)
+        return nullptr;
+
+    AVFrameUPtr frame = makeAVFrame();
+    if (!frame)
+        return nullptr;
+
+    frame->buf[0] = av_buffer_pool_get(m_pool.get());
+    if (!frame->buf[0])
+        return nullptr;
+
+    frame->format = m_format;
+    frame->nb_samples = m_samplesCount;
+
+    const int filledSize =
+            av_samples_fill_arrays(frame->data, frame->linesize, frame->buf[0]->data,
+                                   m_channelCount, m_samplesCount, m_format, 0);
+    if (filledSize < 0) {
+        qCWarning(qLcFFmpegFramePool) << "Cannot fill audio frame arrays:" << err2str(filledSize);
+        return nullptr;
+    }
+
+    frame->extended_data = frame->data;
+
+    return frame;
+}
+
+} // namespace QFFmpeg
+
+QT_END_NAMESPACE
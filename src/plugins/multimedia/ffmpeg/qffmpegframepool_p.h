@@ -0,0 +1,95 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+#ifndef QFFMPEGFRAMEPOOL_P_H
+#define QFFMPEGFRAMEPOOL_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API. It exists purely as an
+// implementation detail. This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include "qffmpeg_p.h"
+
+#include <QtCore/qsize.h>
+
+QT_BEGIN_NAMESPACE
+
+namespace QFFmpeg {
+
+/*!
+    Allocates software AVFrames of the same pixel format and size from an AVBufferPool.
+
+    Each frame keeps all its planes in a single pooled buffer, which returns to
+    the pool as soon as the last reference to the frame is released, e.g. after
+    the encoder has consumed the frame. The pool itself is released once it has
+    been reset or destroyed and all its buffers have been returned.
+ */
+class AVFramePool
+{
+public:
+    /*!
+        Sets up the pool for the specified format and size.
+        Does nothing if the pool has already been set up with the same parameters.
+        Returns false if the format is not supported.
+     */
+    bool reset(AVPixelFormat format, const QSize &size);
+
+    /*!
+        Returns a new frame with the buffers from the pool,
+        or nullptr if the pool has not been set up or is out of memory.
+     */
+    AVFrameUPtr get();
+
+    AVPixelFormat format() const { return m_format; }
+    QSize size() const { return m_size; }
+
+private:
+    // Planes and lines alignment, suitable for SIMD optimizations in swscale and encoders.
+    static constexpr int Alignment = 64;
+
+    AVBufferPoolUPtr m_pool;
+    AVPixelFormat m_format = AV_PIX_FMT_NONE;
+    QSize m_size;
+};
+
+/*!
+    Allocates audio AVFrames of the same sample format, channel count, and
+    number of samples from an AVBufferPool.
+
+    The channel layout and the sample rate are left to the caller.
+ */
+class AVAudioFramePool
+{
+public:
+    /*!
+        Sets up the pool for the specified parameters.
+        Does nothing if the pool has already been set up with the same parameters.
+        Returns false if the parameters are not supported, e.g. if the planes
+        don't fit into AVFrame::data.
+     */
+    bool reset(AVSampleFormat format, int channelCount, int samplesCount);
+
+    /*!
+        Returns a new frame with the buffers from the pool,
+        or nullptr if the pool has not been set up or is out of memory.
+     */
+    AVFrameUPtr get();
+
+private:
+    AVBufferPoolUPtr m_pool;
+    AVSampleFormat m_format = AV_SAMPLE_FMT_NONE;
+    int m_channelCount = 0;
+    int m_samplesCount = 0;
+};
+
+} // namespace QFFmpeg
+
+QT_END_NAMESPACE
+
+#endif // QFFMPEGFRAMEPOOL_P_H
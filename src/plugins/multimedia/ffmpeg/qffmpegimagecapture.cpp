@@ -7,27 +7,53 @@
 #include <private/qplatformimagecapture_p.h>
 #include <qvideoframeformat.h>
 #include <private/qmediastoragelocation_p.h>
-#include <qimagewriter.h>
 
 #include <QtCore/QDebug>
 #include <QtCore/QDir>
+#include <QtCore/qthread.h>
 #include <qstandardpaths.h>
 
 #include <qloggingcategory.h>
 
+#include <algorithm>
+
 QT_BEGIN_NAMESPACE
 
 using namespace Qt::StringLiterals;
 
-// Probably, might be increased. To be investigated and tested on Android implementation
-static constexpr int MaxPendingImagesCount = 1;
+// The number of requests waiting for a frame or being encoded, which bounds the bursts of
+// captures. Probably, might be increased on Android; to be investigated and tested.
+#ifdef Q_OS_ANDROID
+static constexpr int DefaultMaxPendingImagesCount = 1;
+#else
+static constexpr int DefaultMaxPendingImagesCount = 4;
+#endif
 
 Q_STATIC_LOGGING_CATEGORY(qLcImageCapture, "qt.multimedia.imageCapture")
 
+static int maxPendingImagesCount()
+{
+    bool ok = false;
+    const int count = qEnvironmentVariableIntValue("QT_FFMPEG_IMAGE_CAPTURE_QUEUE_DEPTH", &ok);
+    return ok && count > 0 ? count : DefaultMaxPendingImagesCount;
+}
+
 QFFmpegImageCapture::QFFmpegImageCapture(QImageCapture *parent)
-  : QPlatformImageCapture(parent)
+    : QPlatformImageCapture(parent), m_maxPendingImagesCount(maxPendingImagesCount())
 {
     qRegisterMetaType<QVideoFrame>();
+
+    m_encoderPool.setMaxThreadCount(
+            std::min(m_maxPendingImagesCount, std::max(QThread::idealThreadCount(), 1)));
+
+    connect(&m_encoderPool, &QFFmpeg::ImageEncoderPool::imageCaptured, this,
+            &QPlatformImageCapture::imageCaptured);
+    connect(&m_encoderPool, &QFFmpeg::ImageEncoderPool::imageSaved, this,
+            &QPlatformImageCapture::imageSaved);
+    connect(&m_encoderPool, &QFFmpeg::ImageEncoderPool::error, this,
+            &QPlatformImageCapture::error);
+    connect(&m_encoderPool, &QFFmpeg::ImageEncoderPool::requestFinished, this,
+            &QFFmpegImageCapture::updateReadyForCapture);
 }
 
 QFFmpegImageCapture::~QFFmpegImageCapture() = default;
@@ -94,7 +120,7 @@ int QFFmpegImageCapture::doCapture(const QString &fileName)
         qCDebug(qLcImageCapture) << "error 2";
         return -1;
     }
-    if (m_pendingImages.size() >= MaxPendingImagesCount) {
+    if (pendingImagesCount() >= m_maxPendingImagesCount) {
         //emit error in the next event loop,
         //so application can associate it with returned request id.
         QMetaObject::invokeMethod(this, "error", Qt::QueuedConnection,
@@ -124,6 +150,7 @@ void QFFmpegImageCapture::setCaptureSession(QPlatformMediaCaptureSession *sessio
         m_session->disconnect(this);
         m_lastId = 0;
         m_pendingImages.clear();
+        m_encoderPool.clear();
     }
 
     m_session = captureSession;
@@ -137,8 +164,8 @@ void QFFmpegImageCapture::setCaptureSession(QPlatformMediaCaptureSession *sessio
 
 void QFFmpegImageCapture::updateReadyForCapture()
 {
-    const bool ready = m_session && m_pendingImages.size() < MaxPendingImagesCount && m_videoSource
-            && m_videoSource->isActive();
+    const bool ready = m_session && pendingImagesCount() < m_maxPendingImagesCount
+            && m_videoSource && m_videoSource->isActive();
 
     qCDebug(qLcImageCapture) << "updateReadyForCapture" << ready;
 
@@ -159,58 +186,10 @@ void QFFmpegImageCapture::newVideoFrame(const QVideoFrame &frame)
     // ### Add metadata from the AVFrame
     emit imageMetadataAvailable(pending.id, pending.metaData);
     emit imageAvailable(pending.id, frame);
-    QImage image = frame.toImage();
-    if (m_settings.resolution().isValid() && m_settings.resolution() != image.size())
-        image = image.scaled(m_settings.resolution());
-
-    emit imageCaptured(pending.id, image);
-    if (!pending.filename.isEmpty()) {
-        const char *fmt = nullptr;
-        switch (m_settings.format()) {
-        case QImageCapture::UnspecifiedFormat:
-        case QImageCapture::JPEG:
-            fmt = "jpeg";
-            break;
-        case QImageCapture::PNG:
-            fmt = "png";
-            break;
-        case QImageCapture::WebP:
-            fmt = "webp";
-            break;
-        case QImageCapture::Tiff:
-            fmt = "tiff";
-            break;
-        }
-        int quality = -1;
-        switch (m_settings.quality()) {
-        case QImageCapture::VeryLowQuality:
-            quality = 25;
-            break;
-        case QImageCapture::LowQuality:
-            quality = 50;
-            break;
-        case QImageCapture::NormalQuality:
-            break;
-        case QImageCapture::HighQuality:
-            quality = 75;
-            break;
-        case QImageCapture::VeryHighQuality:
-            quality = 99;
-            break;
-        }
-
-        QImageWriter writer(pending.filename, fmt);
-        writer.setQuality(quality);
-
-        if (writer.write(image)) {
-            emit imageSaved(pending.id, pending.filename);
-        } else {
-            QImageCapture::Error err = QImageCapture::ResourceError;
-            if (writer.error() == QImageWriter::UnsupportedFormatError)
-                err = QImageCapture::FormatError;
-            emit error(pending.id, err, writer.errorString());
-        }
-    }
+
+    // the preview and the file are reported by the encoder pool, in the order of the requests
+    m_encoderPool.encode(
+            { pending.id, frame, pending.filename, m_settings, isPreviewRequested() });
 
     updateReadyForCapture();
 }
@@ -221,6 +200,11 @@ void QFFmpegImageCapture::setupVideoSourceConnections()
             &QFFmpegImageCapture::newVideoFrame);
 }
 
+int QFFmpegImageCapture::pendingImagesCount() const
+{
+    return int(m_pendingImages.size()) + m_encoderPool.pendingCount();
+}
+
 QPlatformVideoSource *QFFmpegImageCapture::videoSource() const
 {
     return m_videoSource;
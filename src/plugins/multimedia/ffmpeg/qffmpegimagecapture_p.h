@@ -18,6 +18,7 @@
 
 #include <private/qplatformimagecapture_p.h>
 #include "qffmpegmediacapturesession_p.h"
+#include "qffmpegimageencoderpool_p.h"
 
 #include <QtCore/qpointer.h>
 #include <qqueue.h>
@@ -45,6 +46,7 @@ protected:
     virtual void setupVideoSourceConnections();
     QPlatformVideoSource *videoSource() const;
     void updateReadyForCapture();
+    int pendingImagesCount() const;
 
 protected Q_SLOTS:
     void newVideoFrame(const QVideoFrame &frame);
@@ -62,7 +64,11 @@ private:
         QMediaMetaData metaData;
     };
 
+    // the requests waiting for a frame
     QQueue<PendingImage> m_pendingImages;
+    // the requests being encoded
+    QFFmpeg::ImageEncoderPool m_encoderPool;
+    const int m_maxPendingImagesCount;
     bool m_isReadyForCapture = false;
 };
 
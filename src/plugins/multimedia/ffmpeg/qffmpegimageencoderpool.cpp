@@ -0,0 +1,326 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qffmpegimageencoderpool_p.h"
+#include "qffmpeg_p.h"
+#include "qffmpegcodecstorage_p.h"
+#include "qffmpegconverter_p.h"
+
+#include <QtCore/qfile.h>
+#include <QtCore/qloggingcategory.h>
+#include <QtCore/qscopeguard.h>
+#include <QtGui/qimagewriter.h>
+#include <QtMultimedia/private/qmultimediautils_p.h>
+
+#include <algorithm>
+
+QT_BEGIN_NAMESPACE
+
+Q_STATIC_LOGGING_CATEGORY(qLcImageEncoderPool, "qt.multimedia.ffmpeg.imageencoderpool");
+
+namespace QFFmpeg {
+
+namespace {
+
+bool isJpeg(QImageCapture::FileFormat format)
+{
+    return format == QImageCapture::UnspecifiedFormat || format == QImageCapture::JPEG;
+}
+
+bool isYuvFormat(QVideoFrameFormat::PixelFormat format)
+{
+    switch (format) {
+    case QVideoFrameFormat::Format_YUV420P:
+    case QVideoFrameFormat::Format_YUV420P10:
+    case QVideoFrameFormat::Format_YUV422P:
+    case QVideoFrameFormat::Format_YV12:
+    case QVideoFrameFormat::Format_UYVY:
+    case QVideoFrameFormat::Format_YUYV:
+    case QVideoFrameFormat::Format_NV12:
+    case QVideoFrameFormat::Format_NV21:
+    case QVideoFrameFormat::Format_P010:
+    case QVideoFrameFormat::Format_P016:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// The qscale of the mjpeg encoder, from 2 (best) to 31 (worst),
+// roughly matching the qualities used with QImageWriter
+int mjpegQScale(QImageCapture::Quality quality)
+{
+    switch (quality) {
+    case QImageCapture::VeryLowQuality:
+        return 20;
+    case QImageCapture::LowQuality:
+        return 10;
+    case QImageCapture::NormalQuality:
+        return 5;
+    case QImageCapture::HighQuality:
+        return 4;
+    case QImageCapture::VeryHighQuality:
+        return 2;
+    }
+    return 5;
+}
+
+int imageWriterQuality(QImageCapture::Quality quality)
+{
+    switch (quality) {
+    case QImageCapture::VeryLowQuality:
+        return 25;
+    case QImageCapture::LowQuality:
+        return 50;
+    case QImageCapture::NormalQuality:
+        return -1;
+    case QImageCapture::HighQuality:
+        return 75;
+    case QImageCapture::VeryHighQuality:
+        return 99;
+    }
+    return -1;
+}
+
+const char *imageWriterFormat(QImageCapture::FileFormat format)
+{
+    switch (format) {
+    case QImageCapture::UnspecifiedFormat:
+    case QImageCapture::JPEG:
+        return "jpeg";
+    case QImageCapture::PNG:
+        return "png";
+    case QImageCapture::WebP:
+        return "webp";
+    case QImageCapture::Tiff:
+        return "tiff";
+    }
+    return nullptr;
+}
+
+std::optional<std::pair<Codec, AVPixelFormat>> findMjpegEncoder()
+{
+    // Newer FFmpeg versions prefer the regular pixel format with the full color range
+    for (const AVPixelFormat format : { AV_PIX_FMT_YUV420P, AV_PIX_FMT_YUVJ420P }) {
+        if (auto codec = findAVEncoder(AV_CODEC_ID_MJPEG, format))
+            return std::pair{ *codec, format };
+    }
+    return {};
+}
+
+// Encodes the frame into a JPEG file without converting it to RGB. The frame is only converted
+// if it's not full range BT.601 YUV 4:2:0 of the requested size, which is what the JPEG file
+// is tagged with. Returns false if the encoder can't handle the frame, so that the caller
+// can fall back to QImageWriter.
+bool encodeMjpeg(QVideoFrame &frame, const QString &fileName, const QImageEncoderSettings &settings,
+                 QImageCapture::Error &error, QString &errorString)
+{
+    // the rotated and mirrored frames are saved as they are presented, via QImage
+    if (!isYuvFormat(frame.pixelFormat())
+        || qNormalizedFrameTransformation(frame) != VideoTransformation{})
+        return false;
+
+    static const auto encoder = findMjpegEncoder();
+    if (!encoder)
+        return false;
+
+    const auto &[codec, avPixelFormat] = *encoder;
+
+    QSize size = settings.resolution().isValid() ? settings.resolution() : frame.size();
+    // 4:2:0 subsampling
+    size = QSize(size.width() & ~1, size.height() & ~1);
+    if (size.isEmpty())
+        return false;
+
+    QVideoFrameFormat targetFormat(size, QVideoFrameFormat::Format_YUV420P);
+    targetFormat.setColorSpace(QVideoFrameFormat::ColorSpace_BT601);
+    targetFormat.setColorRange(QVideoFrameFormat::ColorRange_Full);
+
+    const QVideoFrameFormat frameFormat = frame.surfaceFormat();
+    // swscale takes the undefined color space as BT.601
+    const bool isBt601 = frameFormat.colorSpace() == QVideoFrameFormat::ColorSpace_BT601
+            || frameFormat.colorSpace() == QVideoFrameFormat::ColorSpace_Undefined;
+    QVideoFrame yuvFrame = frame;
+    if (frameFormat.pixelFormat() != targetFormat.pixelFormat() || frame.size() != size
+        || frameFormat.colorRange() != QVideoFrameFormat::ColorRange_Full || !isBt601) {
+        yuvFrame = VideoFrameConverter(targetFormat).convert(frame);
+        if (!yuvFrame.isValid())
+            return false;
+    }
+
+    AVCodecContextUPtr context(avcodec_alloc_context3(codec.get()));
+    if (!context) {
+        qCWarning(qLcImageEncoderPool) << "Cannot allocate the mjpeg encoder context";
+        return false;
+    }
+
+    context->width = size.width();
+    context->height = size.height();
+    context->pix_fmt = avPixelFormat;
+    context->color_range = AVCOL_RANGE_JPEG;
+    context->colorspace = AVCOL_SPC_BT470BG;
+    context->time_base = { 1, 1 };
+    context->flags |= AV_CODEC_FLAG_QSCALE;
+    context->global_quality = FF_QP2LAMBDA * mjpegQScale(settings.quality());
+
+    int res = avcodec_open2(context.get(), codec.get(), nullptr);
+    if (res < 0) {
+        qCWarning(qLcImageEncoderPool) << "Cannot open the mjpeg encoder:" << err2str(res);
+        return false;
+    }
+
+    if (!yuvFrame.map(QVideoFrame::ReadOnly))
+        return false;
+
+    auto unmap = qScopeGuard([&] {
+        yuvFrame.unmap();
+    });
+
+    AVFrameUPtr avFrame = makeAVFrame();
+    avFrame->format = avPixelFormat;
+    avFrame->width = size.width();
+    avFrame->height = size.height();
+    avFrame->color_range = AVCOL_RANGE_JPEG;
+    avFrame->quality = context->global_quality;
+    avFrame->pts = 0;
+    for (int i = 0; i < 3; ++i) {
+        avFrame->data[i] = const_cast<uint8_t *>(yuvFrame.bits(i));
+        avFrame->linesize[i] = yuvFrame.bytesPerLine(i);
+    }
+
+    AVPacketUPtr packet(av_packet_alloc());
+    res = avcodec_send_frame(context.get(), avFrame.get());
+    if (res >= 0)
+        res = avcodec_send_frame(context.get(), nullptr);
+    if (res >= 0)
+        res = avcodec_receive_packet(context.get(), packet.get());
+
+    if (res < 0) {
+        qCWarning(qLcImageEncoderPool) << "Cannot encode the image:" << err2str(res);
+        return false;
+    }
+
+    QFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly)
+        || file.write(reinterpret_cast<const char *>(packet->data), packet->size) != packet->size) {
+        error = QImageCapture::ResourceError;
+        errorString = file.errorString();
+    }
+
+    return true;
+}
+
+} // namespace
+
+ImageEncoderPool::ImageEncoderPool(QObject *parent) : QObject(parent)
+{
+    m_threadPool.setObjectName(QStringLiteral("ImageEncoderPool"));
+}
+
+ImageEncoderPool::~ImageEncoderPool()
+{
+    m_threadPool.waitForDone();
+}
+
+void ImageEncoderPool::setMaxThreadCount(int count)
+{
+    m_threadPool.setMaxThreadCount(count);
+}
+
+void ImageEncoderPool::encode(Request request)
+{
+    const quint64 sequenceNumber = m_nextSequenceNumber++;
+    m_pending.push_back({ sequenceNumber, request.id, request.fileName, std::nullopt });
+
+    m_threadPool.start([this, sequenceNumber, request = std::move(request)]() mutable {
+        Result result = encodeRequest(request);
+        // the results are dropped if the pool is destroyed in the meantime
+        QMetaObject::invokeMethod(this, [this, sequenceNumber, result = std::move(result)] {
+            onRequestEncoded(sequenceNumber, std::move(result));
+        });
+    });
+}
+
+void ImageEncoderPool::clear()
+{
+    m_pending.clear();
+}
+
+ImageEncoderPool::Result ImageEncoderPool::encodeRequest(Request &request)
+{
+    Result result;
+    QVideoFrame &frame = request.frame;
+    const QImageEncoderSettings &settings = request.settings;
+
+    // the conversion to RGB is only done once, if the preview or QImageWriter needs it
+    QImage image;
+    auto toImage = [&] {
+        if (image.isNull()) {
+            image = frame.toImage();
+            if (settings.resolution().isValid() && settings.resolution() != image.size())
+                image = image.scaled(settings.resolution());
+        }
+        return image;
+    };
+
+    if (request.preview)
+        result.preview = toImage();
+
+    if (request.fileName.isEmpty())
+        return result;
+
+    if (isJpeg(settings.format())
+        && encodeMjpeg(frame, request.fileName, settings, result.error, result.errorString))
+        return result;
+
+    QImageWriter writer(request.fileName, imageWriterFormat(settings.format()));
+    writer.setQuality(imageWriterQuality(settings.quality()));
+
+    if (!writer.write(toImage())) {
+        result.error = writer.error() == QImageWriter::UnsupportedFormatError
+                ? QImageCapture::FormatError
+                : QImageCapture::ResourceError;
+        result.errorString = writer.errorString();
+    }
+
+    return result;
+}
+
+void ImageEncoderPool::onRequestEncoded(quint64 sequenceNumber, Result result)
+{
+    auto found = std::find_if(m_pending.begin(), m_pending.end(), [&](const PendingRequest &r) {
+        return r.sequenceNumber == sequenceNumber;
+    });
+
+    if (found == m_pending.end())
+        return; // cleared
+
+    found->result = std::move(result);
+    reportFinishedRequests();
+}
+
+void ImageEncoderPool::reportFinishedRequests()
+{
+    while (!m_pending.empty() && m_pending.front().result) {
+        const PendingRequest request = std::move(m_pending.front());
+        m_pending.pop_front();
+
+        const Result &result = *request.result;
+        qCDebug(qLcImageEncoderPool) << "Image" << request.id << "encoded";
+
+        emit imageCaptured(request.id, result.preview);
+        if (!request.fileName.isEmpty()) {
+            if (result.error == QImageCapture::NoError)
+                emit imageSaved(request.id, request.fileName);
+            else
+                emit error(request.id, result.error, result.errorString);
+        }
+        emit requestFinished(request.id);
+    }
+}
+
+} // namespace QFFmpeg
+
+QT_END_NAMESPACE
+
+#include "moc_qffmpegimageencoderpool_p.cpp"
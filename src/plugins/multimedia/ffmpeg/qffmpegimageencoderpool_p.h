@@ -0,0 +1,108 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QFFMPEGIMAGEENCODERPOOL_P_H
+#define QFFMPEGIMAGEENCODERPOOL_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API. It exists purely as an
+// implementation detail. This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/qobject.h>
+#include <QtCore/qthreadpool.h>
+#include <QtGui/qimage.h>
+#include <QtMultimedia/qimagecapture.h>
+#include <QtMultimedia/qvideoframe.h>
+#include <QtMultimedia/private/qplatformimagecapture_p.h>
+
+#include <deque>
+#include <optional>
+
+QT_BEGIN_NAMESPACE
+
+namespace QFFmpeg {
+
+// Encodes captured frames on a pool of worker threads, so that saving an image doesn't block
+// the thread of the image capture and a burst of captures is encoded concurrently.
+//
+// JPEG files are encoded from the YUV frames with the FFmpeg mjpeg encoder; the other formats,
+// and the frames that the encoder can't take, are saved with QImageWriter.
+// The results are reported on the thread of the pool in the order of the requests,
+// whichever request finishes first.
+class ImageEncoderPool : public QObject
+{
+    Q_OBJECT
+public:
+    struct Request
+    {
+        int id = -1;
+        QVideoFrame frame;
+        // the image is only converted to a QImage, not saved, if the file name is empty
+        QString fileName;
+        QImageEncoderSettings settings;
+        // the preview is only built if somebody receives it
+        bool preview = true;
+    };
+
+    explicit ImageEncoderPool(QObject *parent = nullptr);
+    // waits for the running requests, whose results are dropped
+    ~ImageEncoderPool() override;
+
+    void setMaxThreadCount(int count);
+    int maxThreadCount() const { return m_threadPool.maxThreadCount(); }
+
+    void encode(Request request);
+
+    // the requests that haven't been reported yet
+    int pendingCount() const { return int(m_pending.size()); }
+
+    // drops the results of the pending requests
+    void clear();
+
+Q_SIGNALS:
+    // emitted for each request in this order: imageCaptured, then imageSaved or error
+    // if the request has a file name, and finally requestFinished.
+    // The preview is null if the request doesn't ask for it.
+    void imageCaptured(int id, const QImage &preview);
+    void imageSaved(int id, const QString &fileName);
+    void error(int id, int error, const QString &errorString);
+    void requestFinished(int id);
+
+private:
+    struct Result
+    {
+        QImage preview;
+        QImageCapture::Error error = QImageCapture::NoError;
+        QString errorString;
+    };
+
+    struct PendingRequest
+    {
+        quint64 sequenceNumber;
+        int id;
+        QString fileName;
+        std::optional<Result> result;
+    };
+
+    static Result encodeRequest(Request &request);
+    void onRequestEncoded(quint64 sequenceNumber, Result result);
+    void reportFinishedRequests();
+
+    QThreadPool m_threadPool;
+    quint64 m_nextSequenceNumber = 0;
+    // in the order of the requests
+    std::deque<PendingRequest> m_pending;
+};
+
+} // namespace QFFmpeg
+
+QT_END_NAMESPACE
+
+#endif // QFFMPEGIMAGEENCODERPOOL_P_H
@@ -9,6 +9,7 @@
 #include "private/qplatformaudiobufferinput_p.h"
 #include "private/qplatformvideoframeinput_p.h"
 #include "private/qplatformcamera_p.h"
+#include "private/qplatformvideosink_p.h"
 
 #include "qffmpegimagecapture_p.h"
 #include "qffmpegmediarecorder_p.h"
@@ -223,6 +224,13 @@ void QFFmpegMediaCaptureSession::setVideoPreview(QVideoSink *sink)
     if (std::exchange(m_videoSink, sink) == sink)
         return;
 
+    disconnect(m_frameCallbackConnection);
+    if (QPlatformVideoSink *platformSink = sink ? sink->platformVideoSink() : nullptr) {
+        m_frameCallbackConnection =
+                connect(platformSink, &QPlatformVideoSink::frameCallbackChanged, this,
+                        &QFFmpegMediaCaptureSession::updateVideoFrameConnection);
+    }
+
     updateVideoFrameConnection();
 }
 
@@ -255,14 +263,27 @@ void QFFmpegMediaCaptureSession::updateVideoFrameConnection()
 {
     disconnect(m_videoFrameConnection);
 
-    if (m_primaryActiveVideoSource && m_videoSink) {
-        // deliver frames directly to video sink;
-        // AutoConnection type might be a pessimization due to an extra queuing
-        // TODO: investigate and integrate direct connection
-        m_videoFrameConnection =
-                connect(m_primaryActiveVideoSource, &QPlatformVideoSource::newVideoFrame,
-                        m_videoSink, &QVideoSink::setVideoFrame);
+    if (!m_primaryActiveVideoSource || !m_videoSink)
+        return;
+
+    QPlatformVideoSink *platformSink = m_videoSink->platformVideoSink();
+    if (platformSink && platformSink->hasFrameCallback()) {
+        // deliver frames to the frame callback on the source thread; the callback state,
+        // unlike the sink, can be accessed there while the sink is being destroyed
+        m_videoFrameConnection = connect(
+                m_primaryActiveVideoSource, &QPlatformVideoSource::newVideoFrame, this,
+                [state = platformSink->frameCallbackState()](const QVideoFrame &frame) {
+                    state->deliver(frame);
+                },
+                Qt::DirectConnection);
+        return;
     }
+
+    // queue frames to the thread of the video sink;
+    // AutoConnection type might be a pessimization due to an extra queuing
+    m_videoFrameConnection = connect(m_primaryActiveVideoSource,
+                                     &QPlatformVideoSource::newVideoFrame, m_videoSink,
+                                     &QVideoSink::setVideoFrame);
 }
 
 void QFFmpegMediaCaptureSession::updatePrimaryActiveVideoSource()
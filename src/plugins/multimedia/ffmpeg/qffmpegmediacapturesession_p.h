@@ -105,6 +105,7 @@ private:
     qsizetype m_audioBufferSize = 0;
 
     QMetaObject::Connection m_videoFrameConnection;
+    QMetaObject::Connection m_frameCallbackConnection;
 };
 
 QT_END_NAMESPACE
@@ -13,6 +13,7 @@
 #include "qffmpegaudioinput_p.h"
 #include "qffmpegaudiodecoder_p.h"
 #include "qffmpegresampler_p.h"
+#include "qffmpegvideothumbnailextractor_p.h"
 #include "qgrabwindowsurfacecapture_p.h"
 #include "qffmpegconverter_p.h"
 
@@ -70,6 +71,7 @@ extern "C" {
 #endif
 
 #include <QtCore/qloggingcategory.h>
+#include <QtCore/qthread.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -316,6 +318,12 @@ QMaybe<QPlatformVideoSink *> QFFmpegMediaIntegration::createVideoSink(QVideoSink
     return new QFFmpegVideoSink(sink);
 }
 
+QMaybe<std::unique_ptr<QPlatformVideoThumbnailExtractor>>
+QFFmpegMediaIntegration::createVideoThumbnailExtractor()
+{
+    return { std::make_unique<QFFmpegVideoThumbnailExtractor>() };
+}
+
 QMaybe<QPlatformAudioInput *> QFFmpegMediaIntegration::createAudioInput(QAudioInput *input)
 {
     return new QFFmpegAudioInput(input);
@@ -324,7 +332,26 @@ QMaybe<QPlatformAudioInput *> QFFmpegMediaIntegration::createAudioInput(QAudioIn
 QVideoFrame QFFmpegMediaIntegration::convertVideoFrame(QVideoFrame &srcFrame,
                                                        const QVideoFrameFormat &destFormat)
 {
-    return convertFrame(srcFrame, destFormat);
+    std::unique_ptr<QFFmpeg::VideoFrameConverter> converter;
+    {
+        QMutexLocker locker(&m_frameConvertersMutex);
+        if (!m_frameConverters.empty()) {
+            converter = std::move(m_frameConverters.back());
+            m_frameConverters.pop_back();
+        }
+    }
+
+    if (!converter)
+        converter = std::make_unique<QFFmpeg::VideoFrameConverter>();
+
+    converter->setTargetFormat(destFormat);
+    QVideoFrame result = converter->convert(srcFrame);
+
+    // a burst of concurrent conversions doesn't keep more converters than threads using them
+    QMutexLocker locker(&m_frameConvertersMutex);
+    if (m_frameConverters.size() < size_t(std::max(QThread::idealThreadCount(), 1)))
+        m_frameConverters.push_back(std::move(converter));
+    return result;
 }
 
 QPlatformMediaFormatInfo *QFFmpegMediaIntegration::createFormatInfo()
@@ -16,6 +16,12 @@
 //
 
 #include <private/qplatformmediaintegration_p.h>
+#include "qffmpegconverter_p.h"
+
+#include <QtCore/qmutex.h>
+
+#include <memory>
+#include <vector>
 
 QT_BEGIN_NAMESPACE
 
@@ -40,6 +46,9 @@ public:
 
     QMaybe<QPlatformVideoSink *> createVideoSink(QVideoSink *sink) override;
 
+    QMaybe<std::unique_ptr<QPlatformVideoThumbnailExtractor>>
+    createVideoThumbnailExtractor() override;
+
     QMaybe<QPlatformAudioInput *> createAudioInput(QAudioInput *input) override;
 //    QPlatformAudioOutput *createAudioOutput(QAudioOutput *) override;
 
@@ -52,6 +61,13 @@ protected:
     QPlatformVideoDevices *createVideoDevices() override;
 
     QPlatformCapturableWindows *createCapturableWindows() override;
+
+private:
+    // Idle converters, keeping their cached scalers between the conversions;
+    // each conversion takes one, so concurrent conversions don't wait for each other.
+    // At most QThread::idealThreadCount() converters are kept.
+    QMutex m_frameConvertersMutex;
+    std::vector<std::unique_ptr<QFFmpeg::VideoFrameConverter>> m_frameConverters;
 };
 
 QT_END_NAMESPACE
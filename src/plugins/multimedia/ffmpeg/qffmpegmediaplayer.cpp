@@ -254,6 +254,7 @@ void QFFmpegMediaPlayer::setMediaAsync(QFFmpeg::MediaDataHolder::Maybe mediaData
     m_playbackEngine->setLoops(loops());
     m_playbackEngine->setPlaybackRate(m_playbackRate);
     m_playbackEngine->setPitchCompensation(m_pitchCompensation);
+    m_playbackEngine->setFreeRunning(m_freeRunning);
 
     durationChanged(duration());
     tracksChanged();
@@ -429,6 +430,24 @@ QFFmpegMediaPlayer::pitchCompensationAvailability() const
     return PitchCompensationAvailability::PitchCompensationAvailable;
 }
 
+bool QFFmpegMediaPlayer::setFreeRunning(bool enabled)
+{
+    m_freeRunning = enabled;
+    if (m_playbackEngine)
+        m_playbackEngine->setFreeRunning(enabled);
+    return true;
+}
+
+bool QFFmpegMediaPlayer::isFreeRunning() const
+{
+    return m_freeRunning;
+}
+
+QPlaybackStatistics QFFmpegMediaPlayer::statistics() const
+{
+    return m_playbackEngine ? m_playbackEngine->statistics() : QPlaybackStatistics{};
+}
+
 QT_END_NAMESPACE
 
 #include "moc_qffmpegmediaplayer_p.cpp"
@@ -78,6 +78,11 @@ public:
     void setPitchCompensation(bool enabled) override;
     bool pitchCompensation() const override;
 
+    bool setFreeRunning(bool enabled) override;
+    bool isFreeRunning() const override;
+
+    QPlaybackStatistics statistics() const override;
+
 private:
     void runPlayback();
     void handleIncorrectMedia(QMediaPlayer::MediaStatus status);
@@ -116,6 +121,7 @@ private:
                                                          // network connection attempt
 
     bool m_pitchCompensation = true;
+    bool m_freeRunning = false;
 };
 
 QT_END_NAMESPACE
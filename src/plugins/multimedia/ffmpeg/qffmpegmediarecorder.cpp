@@ -88,6 +88,8 @@ void QFFmpegMediaRecorder::record(QMediaEncoderSettings &settings)
 
     connect(m_recordingEngine.get(), &QFFmpeg::RecordingEngine::durationChanged, this,
             &QFFmpegMediaRecorder::newDuration);
+    connect(m_recordingEngine.get(), &QFFmpeg::RecordingEngine::encoderLoadChanged, this,
+            &QFFmpegMediaRecorder::newEncoderLoad);
     connect(m_recordingEngine.get(), &QFFmpeg::RecordingEngine::finalizationDone, this,
             &QFFmpegMediaRecorder::finalizationDone);
     connect(m_recordingEngine.get(), &QFFmpeg::RecordingEngine::sessionError, this,
@@ -105,6 +107,7 @@ void QFFmpegMediaRecorder::record(QMediaEncoderSettings &settings)
             handleStreamInitializationError);
 
     durationChanged(0);
+    encoderLoadChanged(0., 0);
     actualLocationChanged(QUrl::fromLocalFile(actualLocation));
 
     qCDebug(qLcMediaEncoder) << "Starting recording engine";
@@ -149,6 +152,11 @@ void QFFmpegMediaRecorder::stop()
     m_recordingEngine.reset();
 }
 
+QRecordingStatistics QFFmpegMediaRecorder::statistics() const
+{
+    return m_recordingEngine ? m_recordingEngine->statistics() : QRecordingStatistics{};
+}
+
 void QFFmpegMediaRecorder::finalizationDone()
 {
     stateChanged(QMediaRecorder::StoppedState);
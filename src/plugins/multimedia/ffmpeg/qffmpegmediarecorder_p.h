@@ -50,8 +50,14 @@ public:
 
     void updateAutoStop() override;
 
+    QRecordingStatistics statistics() const override;
+
 private Q_SLOTS:
     void newDuration(qint64 d) { durationChanged(d); }
+    void newEncoderLoad(qreal load, qint64 droppedVideoFrames)
+    {
+        encoderLoadChanged(load, droppedVideoFrames);
+    }
     void finalizationDone();
     void handleSessionError(QMediaRecorder::Error code, const QString &description);
 
@@ -14,6 +14,8 @@
 #include "playbackengine/qffmpegvideorenderer_p.h"
 #include "playbackengine/qffmpegaudiorenderer_p.h"
 
+#include <QtMultimedia/private/qplaybackstatistics_p.h>
+
 #include <qloggingcategory.h>
 
 QT_BEGIN_NAMESPACE
@@ -180,6 +182,8 @@ void PlaybackEngine::registerObject(PlaybackEngineObject &object)
 {
     connect(&object, &PlaybackEngineObject::error, this, &PlaybackEngine::errorOccured);
 
+    object.setStatistics(m_statistics);
+
     auto threadName = objectThreadName(object);
     auto &thread = m_threads[threadName];
     if (!thread) {
@@ -201,7 +205,7 @@ PlaybackEngine::createRenderer(QPlatformMediaPlayer::TrackType trackType)
                        m_timeController, m_videoSink, m_media.transformation())
                            : RendererPtr{ {}, {} };
     case QPlatformMediaPlayer::AudioStream:
-        return m_audioOutput || m_audioBufferOutput
+        return (m_audioOutput && !isFreeRunning()) || m_audioBufferOutput
                 ? createPlaybackEngineObject<AudioRenderer>(
                           m_timeController, m_audioOutput, m_audioBufferOutput, m_pitchCompensation)
                 : RendererPtr{ {}, {} };
@@ -337,6 +341,15 @@ void PlaybackEngine::createStreamAndRenderer(QPlatformMediaPlayer::TrackType tra
         if (!renderer)
             return;
 
+        if (m_freeRunningClock) {
+            // subtitles follow the audio and the video, but mustn't hold them back
+            // while waiting for sparse subtitle packets
+            const auto role = trackType == QPlatformMediaPlayer::SubtitleStream
+                    ? FreeRunningClock::Role::Following
+                    : FreeRunningClock::Role::Leading;
+            renderer->setFreeRunningClock(m_freeRunningClock, role);
+        }
+
         connect(renderer.get(), &Renderer::synchronized, this,
                 &PlaybackEngine::onRendererSynchronized);
 
@@ -562,6 +575,48 @@ void PlaybackEngine::setPitchCompensation(bool enabled)
         renderer->setPitchCompensation(enabled);
 }
 
+void PlaybackEngine::setFreeRunning(bool enabled)
+{
+    if (isFreeRunning() == enabled)
+        return;
+
+    qCDebug(qLcPlaybackEngine) << "Set free-running playback:" << enabled;
+
+    m_freeRunningClock = enabled ? std::make_shared<FreeRunningClock>() : nullptr;
+
+    // the renderers get the clock on creation
+    forceUpdate();
+}
+
+QPlaybackStatistics PlaybackEngine::statistics() const
+{
+    auto result = std::make_unique<QPlaybackStatisticsPrivate>();
+
+    // the counters of objects that have been deleted, e.g. on seeking, are outdated
+    if (m_demuxer) {
+        result->bufferedDuration = m_statistics->bufferedDuration.loadRelaxed();
+        result->bufferedBytes = m_statistics->bufferedBytes.loadRelaxed();
+    }
+
+    auto decoderQueue = [this](QPlatformMediaPlayer::TrackType trackType, int &length,
+                               int &capacity) {
+        if (!m_streams[trackType])
+            return;
+        length = m_statistics->decoderQueueLengths[trackType].loadRelaxed();
+        capacity = StreamDecoder::maxQueueSize(trackType);
+    };
+    decoderQueue(QPlatformMediaPlayer::VideoStream, result->videoDecoderQueueLength,
+                 result->videoDecoderQueueCapacity);
+    decoderQueue(QPlatformMediaPlayer::AudioStream, result->audioDecoderQueueLength,
+                 result->audioDecoderQueueCapacity);
+
+    result->renderedVideoFrames = m_statistics->renderedVideoFrames.loadRelaxed();
+    result->videoRenderLateness = m_statistics->videoRenderLateness.loadRelaxed();
+    result->audioUnderruns = m_statistics->audioUnderruns.loadRelaxed();
+
+    return result.release()->create();
+}
+
 void PlaybackEngine::setActiveTrack(QPlatformMediaPlayer::TrackType trackType, int streamNumber)
 {
     if (!m_media.setActiveTrack(trackType, streamNumber))
@@ -47,9 +47,13 @@
 
 #include "playbackengine/qffmpegplaybackenginedefs_p.h"
 #include "playbackengine/qffmpegtimecontroller_p.h"
+#include "playbackengine/qffmpegfreerunningclock_p.h"
 #include "playbackengine/qffmpegmediadataholder_p.h"
 #include "playbackengine/qffmpegcodeccontext_p.h"
 #include "playbackengine/qffmpegplaybackutils_p.h"
+#include "playbackengine/qffmpegplaybackstatistics_p.h"
+
+#include <QtMultimedia/qplaybackstatistics.h>
 
 #include <QtCore/qpointer.h>
 
@@ -121,6 +125,15 @@ public:
 
     void setPitchCompensation(bool enabled);
 
+    // Renders the frames as soon as the outputs took the previous ones instead of pacing
+    // them against the wall clock, keeping audio and video in lock-step.
+    // Audio devices aren't used; the audio is only delivered to QAudioBufferOutput.
+    void setFreeRunning(bool enabled);
+
+    bool isFreeRunning() const { return m_freeRunningClock != nullptr; }
+
+    QPlaybackStatistics statistics() const;
+
 signals:
     void endOfStream();
     void errorOccured(int, const QString &);
@@ -224,6 +237,11 @@ private:
     LoopOffset m_currentLoopOffset;
 
     bool m_pitchCompensation = true;
+
+    std::shared_ptr<FreeRunningClock> m_freeRunningClock;
+
+    // The objects outlive the engine until their threads delete them
+    std::shared_ptr<PlaybackStatistics> m_statistics = std::make_shared<PlaybackStatistics>();
 };
 
 template<typename T, typename... Args>
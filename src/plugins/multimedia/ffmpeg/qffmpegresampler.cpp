@@ -66,25 +66,87 @@ QAudioBuffer QFFmpegResampler::resample(const AVFrame *frame)
     return resample(const_cast<const uint8_t **>(frame->extended_data), frame->nb_samples);
 }
 
+int QFFmpegResampler::resample(const AVFrame *frame, QSpan<std::byte> output)
+{
+    return convert(const_cast<const uint8_t **>(frame->extended_data), frame->nb_samples, output);
+}
+
+int QFFmpegResampler::resample(QSpan<const std::byte> input, QSpan<std::byte> output)
+{
+    if (!m_inputFormat.isValid())
+        return 0;
+
+    const auto *data = reinterpret_cast<const uint8_t *>(input.data());
+    return convert(&data, m_inputFormat.framesForBytes(static_cast<qint32>(input.size())), output);
+}
+
 QAudioBuffer QFFmpegResampler::resample(const uint8_t **inputData, int inputSamplesCount)
 {
     const int maxOutSamples = adjustMaxOutSamples(inputSamplesCount);
 
-    QByteArray samples(m_outputFormat.bytesForFrames(maxOutSamples), Qt::Uninitialized);
-    auto *out = reinterpret_cast<uint8_t *>(samples.data());
-    const int outSamples =
-            swr_convert(m_resampler.get(), &out, maxOutSamples, inputData, inputSamplesCount);
+    qsizetype poolIndex = -1;
+    QByteArray samples = takePooledBuffer(m_outputFormat.bytesForFrames(maxOutSamples), poolIndex);
+
+    const qint64 startTime = m_outputFormat.durationForFrames(m_samplesProcessed) + m_startTime;
+    const int outSamples = convert(inputData, inputSamplesCount,
+                                   QSpan{ reinterpret_cast<std::byte *>(samples.data()),
+                                          samples.size() });
 
     samples.resize(m_outputFormat.bytesForFrames(outSamples));
 
-    const qint64 startTime = m_outputFormat.durationForFrames(m_samplesProcessed) + m_startTime;
+    if (poolIndex >= 0)
+        m_bufferPool[poolIndex] = samples;
+
+    return QAudioBuffer(samples, m_outputFormat, startTime);
+}
+
+int QFFmpegResampler::convert(const uint8_t **inputData, int inputSamplesCount,
+                              QSpan<std::byte> output)
+{
+    const int maxOutSamples = std::min(adjustMaxOutSamples(inputSamplesCount),
+                                       m_outputFormat.framesForBytes(qint32(output.size())));
+
+    auto *out = reinterpret_cast<uint8_t *>(output.data());
+    const int outSamples =
+            swr_convert(m_resampler.get(), &out, maxOutSamples, inputData, inputSamplesCount);
+    if (outSamples < 0) {
+        qCWarning(qLcResampler) << "swr_convert fail:" << outSamples;
+        return 0;
+    }
+
     m_samplesProcessed += outSamples;
 
     qCDebug(qLcResamplerTrace).nospace()
-            << "Created output buffer. Time stamp: " << startTime
-            << "us. Samples in: " << inputSamplesCount
+            << "Resampled. Samples in: " << inputSamplesCount
             << ", Samples out: " << outSamples << ", Max samples: " << maxOutSamples;
-    return QAudioBuffer(samples, m_outputFormat, startTime);
+    return outSamples;
+}
+
+QByteArray QFFmpegResampler::takePooledBuffer(qsizetype size, qsizetype &poolIndex)
+{
+    // A pooled buffer is free if no QAudioBuffer refers to it anymore;
+    // prefer the ones that don't need to grow.
+    poolIndex = -1;
+    for (qsizetype i = 0; i < BufferPoolSize; ++i) {
+        const QByteArray &buffer = m_bufferPool[i];
+        if (!buffer.isNull() && !buffer.isDetached())
+            continue;
+
+        if (poolIndex < 0 || buffer.capacity() > m_bufferPool[poolIndex].capacity())
+            poolIndex = i;
+
+        if (buffer.capacity() >= size)
+            break;
+    }
+
+    // all the pooled buffers are in use
+    if (poolIndex < 0)
+        return QByteArray(size, Qt::Uninitialized);
+
+    // take it out of the pool, so that writing to it doesn't detach
+    QByteArray buffer = std::exchange(m_bufferPool[poolIndex], {});
+    buffer.resize(size);
+    return buffer;
 }
 
 int QFFmpegResampler::adjustMaxOutSamples(int inputSamplesCount)
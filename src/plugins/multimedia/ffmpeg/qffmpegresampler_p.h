@@ -18,6 +18,10 @@
 #include "qffmpeg_p.h"
 #include "private/qplatformaudioresampler_p.h"
 
+#include <QtCore/qspan.h>
+
+#include <array>
+
 QT_BEGIN_NAMESPACE
 
 namespace QFFmpeg
@@ -39,6 +43,18 @@ public:
 
     QAudioBuffer resample(const AVFrame *frame);
 
+    // Resample into a buffer provided by the caller, without allocating.
+    // The output should fit maxOutputFrames() frames, otherwise the remaining
+    // samples are kept by the resampler until the next call.
+    // Return the number of frames written to the output.
+    int resample(const AVFrame *frame, QSpan<std::byte> output);
+    int resample(QSpan<const std::byte> input, QSpan<std::byte> output);
+    // Writes the samples delayed by the resampler at the end of the input
+    int flush(QSpan<std::byte> output) { return convert(nullptr, 0, output); }
+
+    int maxOutputFrames(int inputFrames) { return adjustMaxOutSamples(inputFrames); }
+    const QAudioFormat &outputFormat() const { return m_outputFormat; }
+
     qint64 samplesProcessed() const { return m_samplesProcessed; }
     void setSampleCompensation(qint32 delta, quint32 distance);
     qint32 activeSampleCompensationDelta() const;
@@ -47,8 +63,15 @@ private:
     int adjustMaxOutSamples(int inputSamplesCount);
 
     QAudioBuffer resample(const uint8_t **inputData, int inputSamplesCount);
+    int convert(const uint8_t **inputData, int inputSamplesCount, QSpan<std::byte> output);
+
+    QByteArray takePooledBuffer(qsizetype size, qsizetype &poolIndex);
 
 private:
+    // The data of the returned QAudioBuffers is recycled once the buffers are released
+    static constexpr qsizetype BufferPoolSize = 4;
+
+
     QAudioFormat m_inputFormat;
     QAudioFormat m_outputFormat;
     qint64 m_startTime = 0;
@@ -56,6 +79,7 @@ private:
     qint64 m_samplesProcessed = 0;
     qint64 m_endCompensationSample = std::numeric_limits<qint64>::min();
     qint32 m_sampleCompensationDelta = 0;
+    std::array<QByteArray, BufferPoolSize> m_bufferPool;
 };
 
 QT_END_NAMESPACE
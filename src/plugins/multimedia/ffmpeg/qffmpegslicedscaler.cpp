@@ -0,0 +1,217 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qffmpegslicedscaler_p.h"
+
+#include <QtCore/qloggingcategory.h>
+#include <QtCore/qthreadpool.h>
+
+extern "C" {
+#include <libavutil/imgutils.h>
+#include <libavutil/pixdesc.h>
+}
+
+QT_BEGIN_NAMESPACE
+
+Q_STATIC_LOGGING_CATEGORY(qLcFFmpegSlicedScaler, "qt.multimedia.ffmpeg.slicedscaler");
+
+namespace QFFmpeg {
+
+namespace {
+
+// Slicing small images doesn't pay off the synchronization costs
+constexpr int MinSliceHeight = 128;
+constexpr int MaxSliceCount = 16;
+
+// Slice borders must not split chroma rows, nor shift the rows of the 8x8 dither matrices
+constexpr int SliceAlignment = 16;
+
+// The rows above and below a slice that cover the vertical chroma filters of swscale
+constexpr int SliceMargin = 16;
+
+bool canSlice(const AVPixFmtDescriptor *desc)
+{
+    constexpr auto unsupportedFlags =
+            AV_PIX_FMT_FLAG_PAL | AV_PIX_FMT_FLAG_BITSTREAM | AV_PIX_FMT_FLAG_HWACCEL;
+    return desc && !(desc->flags & unsupportedFlags);
+}
+
+int sliceCountFor(const QSize &srcSize, const AVPixFmtDescriptor *srcDesc, const QSize &dstSize,
+                  const AVPixFmtDescriptor *dstDesc, int maxSliceCount)
+{
+    if (srcSize.height() != dstSize.height() || !canSlice(srcDesc) || !canSlice(dstDesc))
+        return 1;
+
+    return qBound(1, std::min(maxSliceCount, srcSize.height() / MinSliceHeight), MaxSliceCount);
+}
+
+int planeVerticalShift(const AVPixFmtDescriptor *desc, int plane)
+{
+    // Planes 1 and 2 are chroma ones, see av_image_fill_pointers
+    return desc && (plane == 1 || plane == 2) ? desc->log2_chroma_h : 0;
+}
+
+} // namespace
+
+SlicedScaler::SlicedScaler(const QSize &srcSize, AVPixelFormat srcFormat, const QSize &dstSize,
+                           AVPixelFormat dstFormat, int conversionType, int maxSliceCount)
+    : m_srcSize(srcSize), m_dstSize(dstSize), m_srcFormat(srcFormat), m_dstFormat(dstFormat)
+{
+    const AVPixFmtDescriptor *srcDesc = av_pix_fmt_desc_get(srcFormat);
+    const AVPixFmtDescriptor *dstDesc = av_pix_fmt_desc_get(dstFormat);
+
+    const int sliceCount = sliceCountFor(srcSize, srcDesc, dstSize, dstDesc, maxSliceCount);
+
+    if (sliceCount == 1) {
+        auto context = createSwsContext(srcSize, srcFormat, dstSize, dstFormat, conversionType);
+        if (context)
+            m_slices.push_back({ 0, srcSize.height(), 0, std::move(context) });
+        m_sliceResults.resize(m_slices.size());
+        return;
+    }
+
+    // Without vertical scaling, the vertical filters only read the rows of the neighboring
+    // slices if the chroma subsampling changes. The slices convert these rows as well then,
+    // into a frame of their own, and only their own rows are copied to the output, so that
+    // the output matches the one of a single SwsContext.
+    const int margin = srcDesc->log2_chroma_h != dstDesc->log2_chroma_h ? SliceMargin : 0;
+    const int height = srcSize.height();
+
+    int y = 0;
+    for (int i = 0; i < sliceCount; ++i) {
+        const int nextY = i + 1 == sliceCount
+                ? height
+                : (height * (i + 1) / sliceCount) & ~(SliceAlignment - 1);
+        const int contextY = std::max(0, y - margin);
+        const int contextHeight = std::min(height, nextY + margin) - contextY;
+
+        auto context = createSwsContext({ srcSize.width(), contextHeight }, srcFormat,
+                                        { dstSize.width(), contextHeight }, dstFormat,
+                                        conversionType);
+
+        AVFrameUPtr output;
+        if (context && margin) {
+            output = makeAVFrame();
+            output->format = dstFormat;
+            output->width = dstSize.width();
+            output->height = contextHeight;
+            if (av_frame_get_buffer(output.get(), 0) < 0)
+                context.reset();
+        }
+
+        if (!context) {
+            m_slices.clear();
+            return;
+        }
+
+        m_slices.push_back({ y, nextY - y, contextY, std::move(context), std::move(output) });
+        y = nextY;
+    }
+
+    m_sliceResults.resize(m_slices.size());
+
+    m_threadPool = std::make_unique<QThreadPool>();
+    m_threadPool->setObjectName(QStringLiteral("SlicedScaler"));
+    // the calling thread processes the first slice
+    m_threadPool->setMaxThreadCount(sliceCount - 1);
+
+    qCDebug(qLcFFmpegSlicedScaler) << "Created sliced scaler" << srcFormat << srcSize << "->"
+                                   << dstFormat << dstSize << "with" << sliceCount << "slices";
+}
+
+SlicedScaler::~SlicedScaler() = default;
+
+bool SlicedScaler::setColorspaceDetails(const int srcTable[4], int srcRange, const int dstTable[4],
+                                        int dstRange, int brightness, int contrast, int saturation)
+{
+    if (m_slices.empty())
+        return false;
+
+    for (const Slice &slice : m_slices) {
+        if (sws_setColorspaceDetails(slice.context.get(), srcTable, srcRange, dstTable, dstRange,
+                                     brightness, contrast, saturation)
+            != 0)
+            return false;
+    }
+
+    return true;
+}
+
+int SlicedScaler::scale(const uint8_t *const srcData[], const int srcLinesize[],
+                        uint8_t *const dstData[], const int dstLinesize[])
+{
+    if (m_slices.empty())
+        return AVERROR(EINVAL);
+
+    if (m_slices.size() == 1)
+        return scaleSlice(m_slices.front(), srcData, srcLinesize, dstData, dstLinesize);
+
+    Q_ASSERT(m_threadPool);
+
+    for (size_t i = 1; i < m_slices.size(); ++i)
+        m_threadPool->start([&, i]() {
+            m_sliceResults[i] =
+                    scaleSlice(m_slices[i], srcData, srcLinesize, dstData, dstLinesize);
+        });
+
+    m_sliceResults[0] = scaleSlice(m_slices[0], srcData, srcLinesize, dstData, dstLinesize);
+
+    m_threadPool->waitForDone();
+
+    int scaledHeight = 0;
+    for (int result : m_sliceResults) {
+        if (result < 0)
+            return result;
+        scaledHeight += result;
+    }
+
+    return scaledHeight;
+}
+
+int SlicedScaler::scaleSlice(const Slice &slice, const uint8_t *const srcData[],
+                             const int srcLinesize[], uint8_t *const dstData[],
+                             const int dstLinesize[]) const
+{
+    const AVPixFmtDescriptor *srcDesc = av_pix_fmt_desc_get(m_srcFormat);
+    const AVPixFmtDescriptor *dstDesc = av_pix_fmt_desc_get(m_dstFormat);
+
+    const uint8_t *src[AV_NUM_DATA_POINTERS] = {};
+    uint8_t *dst[AV_NUM_DATA_POINTERS] = {};
+
+    for (int plane = 0; plane < 4; ++plane) {
+        if (srcData[plane])
+            src[plane] = srcData[plane]
+                    + qsizetype(slice.contextY >> planeVerticalShift(srcDesc, plane))
+                            * srcLinesize[plane];
+        if (dstData[plane])
+            dst[plane] = dstData[plane]
+                    + qsizetype(slice.y >> planeVerticalShift(dstDesc, plane)) * dstLinesize[plane];
+    }
+
+    if (!slice.output)
+        return sws_scale(slice.context.get(), src, srcLinesize, 0, slice.height, dst, dstLinesize);
+
+    const AVFrame &output = *slice.output;
+    const int result = sws_scale(slice.context.get(), src, srcLinesize, 0, output.height,
+                                 output.data, output.linesize);
+    if (result < 0)
+        return result;
+
+    // copy the rows of the slice, without the margins
+    for (int plane = 0; plane < av_pix_fmt_count_planes(m_dstFormat); ++plane) {
+        const int shift = planeVerticalShift(dstDesc, plane);
+        const int firstRow = (slice.y - slice.contextY) >> shift;
+        const int rowCount = AV_CEIL_RSHIFT(slice.y + slice.height, shift) - (slice.y >> shift);
+        const int bytesPerLine = av_image_get_linesize(m_dstFormat, m_dstSize.width(), plane);
+
+        av_image_copy_plane(dst[plane], dstLinesize[plane],
+                            output.data[plane] + qsizetype(firstRow) * output.linesize[plane],
+                            output.linesize[plane], bytesPerLine, rowCount);
+    }
+
+    return slice.height;
+}
+
+} // namespace QFFmpeg
+
+QT_END_NAMESPACE
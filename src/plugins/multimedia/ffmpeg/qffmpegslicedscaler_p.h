@@ -0,0 +1,110 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+#ifndef QFFMPEGSLICEDSCALER_P_H
+#define QFFMPEGSLICEDSCALER_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API. It exists purely as an
+// implementation detail. This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include "qffmpeg_p.h"
+
+#include <QtCore/qsize.h>
+#include <QtCore/qthread.h>
+
+#include <memory>
+#include <vector>
+
+QT_BEGIN_NAMESPACE
+
+class QThreadPool;
+
+namespace QFFmpeg {
+
+/*!
+    Converts software images with several SwsContexts working in parallel,
+    each of them processing its own range of rows.
+
+    The image is only sliced if the conversion keeps the image height and
+    the image is high enough; vertical scaling filters would produce seams
+    at the slice borders. Otherwise, a single SwsContext converts the whole
+    image on the calling thread.
+
+    If the vertical chroma subsampling changes, the slices also convert a few
+    rows of their neighbors for the vertical chroma filters, and discard them.
+    The output is the same as the one of a single SwsContext.
+ */
+class SlicedScaler
+{
+public:
+    SlicedScaler(const QSize &srcSize, AVPixelFormat srcFormat, const QSize &dstSize,
+                 AVPixelFormat dstFormat, int conversionType,
+                 int maxSliceCount = QThread::idealThreadCount());
+    ~SlicedScaler();
+
+    bool isValid() const { return !m_slices.empty(); }
+
+    int sliceCount() const { return static_cast<int>(m_slices.size()); }
+
+    QSize sourceSize() const { return m_srcSize; }
+    QSize targetSize() const { return m_dstSize; }
+    AVPixelFormat sourceFormat() const { return m_srcFormat; }
+    AVPixelFormat targetFormat() const { return m_dstFormat; }
+
+    /*!
+        Applies sws_setColorspaceDetails to all the slices.
+        Returns false if any of them doesn't support the details.
+     */
+    bool setColorspaceDetails(const int srcTable[4], int srcRange, const int dstTable[4],
+                              int dstRange, int brightness, int contrast, int saturation);
+
+    /*!
+        Converts the whole image. Blocks until all the slices are processed.
+        Returns the height of the output image, or a negative value on failure.
+     */
+    int scale(const uint8_t *const srcData[], const int srcLinesize[], uint8_t *const dstData[],
+              const int dstLinesize[]);
+
+    int scale(const AVFrame &src, AVFrame &dst)
+    {
+        return scale(src.data, src.linesize, dst.data, dst.linesize);
+    }
+
+private:
+    struct Slice
+    {
+        int y = 0;
+        int height = 0;
+        int contextY = 0; // the first row converted by the context, including the margin
+        SwsContextUPtr context;
+        AVFrameUPtr output; // the rows converted with the margins, if any
+    };
+
+    int scaleSlice(const Slice &slice, const uint8_t *const srcData[], const int srcLinesize[],
+                   uint8_t *const dstData[], const int dstLinesize[]) const;
+
+private:
+    const QSize m_srcSize;
+    const QSize m_dstSize;
+    const AVPixelFormat m_srcFormat;
+    const AVPixelFormat m_dstFormat;
+
+    std::vector<Slice> m_slices;
+    std::vector<int> m_sliceResults;
+    std::unique_ptr<QThreadPool> m_threadPool;
+};
+
+using SlicedScalerUPtr = std::unique_ptr<SlicedScaler>;
+
+} // namespace QFFmpeg
+
+QT_END_NAMESPACE
+
+#endif // QFFMPEGSLICEDSCALER_P_H
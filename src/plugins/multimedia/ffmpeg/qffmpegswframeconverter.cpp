@@ -0,0 +1,55 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qffmpegswframeconverter_p.h"
+#include "qffmpegslicedscaler_p.h"
+
+#include <QtCore/qloggingcategory.h>
+
+QT_BEGIN_NAMESPACE
+
+Q_STATIC_LOGGING_CATEGORY(qLcFFmpegSwFrameConverter, "qt.multimedia.ffmpeg.swframeconverter");
+
+namespace QFFmpeg {
+
+SwFrameConverter::SwFrameConverter() = default;
+
+SwFrameConverter::~SwFrameConverter() = default;
+
+AVFrameUPtr SwFrameConverter::convert(const AVFrame &frame, AVPixelFormat dstFormat,
+                                      const QSize &dstSize)
+{
+    const auto srcFormat = AVPixelFormat(frame.format);
+    const QSize srcSize(frame.width, frame.height);
+
+    QMutexLocker locker(&m_mutex);
+
+    if (!m_scaler || m_scaler->sourceFormat() != srcFormat || m_scaler->sourceSize() != srcSize
+        || m_scaler->targetFormat() != dstFormat || m_scaler->targetSize() != dstSize) {
+        qCDebug(qLcFFmpegSwFrameConverter) << "Creating scaler" << srcFormat << srcSize << "->"
+                                           << dstFormat << dstSize;
+        m_scaler = std::make_unique<SlicedScaler>(srcSize, srcFormat, dstSize, dstFormat,
+                                                  SWS_BICUBIC);
+    }
+
+    if (!m_scaler->isValid() || !m_framePool.reset(dstFormat, dstSize))
+        return nullptr;
+
+    AVFrameUPtr result = m_framePool.get();
+    if (!result)
+        return nullptr;
+
+    const int status = m_scaler->scale(frame, *result);
+    if (status < 0) {
+        qCWarning(qLcFFmpegSwFrameConverter) << "Cannot convert frame:" << err2str(status);
+        return nullptr;
+    }
+
+    // keep the timestamps, the color properties and the side data
+    av_frame_copy_props(result.get(), &frame);
+    return result;
+}
+
+} // namespace QFFmpeg
+
+QT_END_NAMESPACE
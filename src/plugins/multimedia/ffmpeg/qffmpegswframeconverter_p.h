@@ -0,0 +1,61 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+#ifndef QFFMPEGSWFRAMECONVERTER_P_H
+#define QFFMPEGSWFRAMECONVERTER_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API. It exists purely as an
+// implementation detail. This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include "qffmpeg_p.h"
+#include "qffmpegframepool_p.h"
+
+#include <QtCore/qmutex.h>
+#include <QtCore/qsize.h>
+
+#include <memory>
+
+QT_BEGIN_NAMESPACE
+
+namespace QFFmpeg {
+
+class SlicedScaler;
+
+/*!
+    Converts software frames whose pixel format or size cannot be used as is.
+
+    The scaler is kept as long as the source and target formats and sizes don't change,
+    and the converted frames are allocated from a pool. A converter is meant to be shared
+    by the frames of a codec context; the conversions are serialized, as frames can be
+    mapped from any thread.
+ */
+class SwFrameConverter
+{
+public:
+    SwFrameConverter();
+    ~SwFrameConverter();
+
+    /*!
+        Returns the converted frame, with the properties of the source frame,
+        or nullptr on failure.
+     */
+    AVFrameUPtr convert(const AVFrame &frame, AVPixelFormat dstFormat, const QSize &dstSize);
+
+private:
+    QMutex m_mutex;
+    std::unique_ptr<SlicedScaler> m_scaler;
+    AVFramePool m_framePool;
+};
+
+} // namespace QFFmpeg
+
+QT_END_NAMESPACE
+
+#endif // QFFMPEGSWFRAMECONVERTER_P_H
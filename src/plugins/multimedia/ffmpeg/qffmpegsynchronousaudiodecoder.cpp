@@ -0,0 +1,271 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+#include "qffmpegsynchronousaudiodecoder_p.h"
+#include "qffmpegresampler_p.h"
+
+#include <QtCore/qloggingcategory.h>
+#include <QtMultimedia/qmediaplayer.h>
+
+QT_BEGIN_NAMESPACE
+
+Q_STATIC_LOGGING_CATEGORY(qLcSynchronousAudioDecoder,
+                          "qt.multimedia.ffmpeg.synchronousaudiodecoder")
+
+namespace QFFmpeg {
+
+namespace {
+
+qint64 mediaStartTime(const AVFormatContext *context)
+{
+    // AV_TIME_BASE units are microseconds
+    return context->start_time != AV_NOPTS_VALUE ? context->start_time : 0;
+}
+
+} // namespace
+
+SynchronousAudioDecoder::Maybe SynchronousAudioDecoder::create(const QUrl &url, QIODevice *device,
+                                                               const QAudioFormat &outputFormat)
+{
+    MediaDataHolder::Maybe media = MediaDataHolder::create(url, device, nullptr);
+    if (!media)
+        return media.error();
+
+    QSharedPointer<MediaDataHolder> holder = media.value();
+    const int streamIndex = holder->currentStreamIndex(QPlatformMediaPlayer::AudioStream);
+    if (streamIndex < 0)
+        return MediaDataHolder::ContextError{
+            QMediaPlayer::FormatError, QLatin1String("The media doesn't contain an audio stream")
+        };
+
+    AVFormatContext *context = holder->avContext();
+    QMaybe<CodecContext> codecContext =
+            CodecContext::create(context->streams[streamIndex], context);
+    if (!codecContext)
+        return MediaDataHolder::ContextError{ QMediaPlayer::FormatError, codecContext.error() };
+
+    return std::unique_ptr<SynchronousAudioDecoder>(
+            new SynchronousAudioDecoder(std::move(holder), codecContext.value(), outputFormat));
+}
+
+SynchronousAudioDecoder::SynchronousAudioDecoder(QSharedPointer<MediaDataHolder> media,
+                                                 CodecContext codecContext,
+                                                 const QAudioFormat &outputFormat)
+    : m_media(std::move(media)),
+      m_codecContext(std::move(codecContext)),
+      m_packet(av_packet_alloc()),
+      m_frame(makeAVFrame())
+{
+    m_resampler = std::make_unique<QFFmpegResampler>(&m_codecContext, outputFormat);
+    m_outputFormat = m_resampler->outputFormat();
+}
+
+SynchronousAudioDecoder::~SynchronousAudioDecoder() = default;
+
+qint64 SynchronousAudioDecoder::position() const
+{
+    if (!m_basePosition)
+        return m_skipUntil;
+
+    const qsizetype pendingBytes = m_pending.size() - m_pendingOffset;
+    const qint64 decodedEnd =
+            *m_basePosition + m_outputFormat.durationForFrames(m_framesSinceBase);
+    return std::max(decodedEnd - m_outputFormat.durationForBytes(pendingBytes), m_skipUntil);
+}
+
+bool SynchronousAudioDecoder::setRange(qint64 start, qint64 end)
+{
+    m_rangeStart = std::max<qint64>(start, 0);
+    m_rangeEnd = end >= 0 ? std::max(end, m_rangeStart) : -1;
+    return seek(m_rangeStart);
+}
+
+bool SynchronousAudioDecoder::seek(qint64 position)
+{
+    position = std::max(position, m_rangeStart);
+    if (m_rangeEnd >= 0)
+        position = std::min(position, m_rangeEnd);
+
+    AVFormatContext *context = m_media->avContext();
+
+    // Without seeking, the data before the position is decoded and skipped,
+    // which is only possible if nothing has been decoded yet.
+    const bool canSkip = !m_hasDecoded;
+    const bool needsSeek = !canSkip || position > 0;
+
+    if (needsSeek) {
+        if (!m_media->isSeekable() && !canSkip) {
+            setError(QLatin1String("The media is not seekable"), 0);
+            return false;
+        }
+
+        if (m_media->isSeekable()) {
+            const qint64 seekPos = position + mediaStartTime(context);
+            const int err = av_seek_frame(context, -1, seekPos, AVSEEK_FLAG_BACKWARD);
+            if (err < 0) {
+                if (!canSkip) {
+                    setError(QLatin1String("Failed to seek"), err);
+                    return false;
+                }
+                qCDebug(qLcSynchronousAudioDecoder)
+                        << "Failed to seek, decoding from the start:" << err2str(err);
+            }
+            avcodec_flush_buffers(m_codecContext.context());
+        }
+
+        // drop the samples buffered by the resampler
+        m_resampler = std::make_unique<QFFmpegResampler>(&m_codecContext, m_outputFormat);
+    }
+
+    m_pending.resize(0);
+    m_pendingOffset = 0;
+    m_skipUntil = position;
+    m_basePosition.reset();
+    m_framesSinceBase = 0;
+    m_inputDone = false;
+    m_atEnd = m_rangeEnd >= 0 && position >= m_rangeEnd;
+
+    return true;
+}
+
+qint64 SynchronousAudioDecoder::read(QSpan<std::byte> output)
+{
+    if (!m_errorString.isEmpty())
+        return -1;
+
+    const qsizetype bytesPerFrame = m_outputFormat.bytesPerFrame();
+    output = output.first(output.size() - output.size() % bytesPerFrame);
+
+    qsizetype bytesWritten = 0;
+    while (bytesWritten < output.size()) {
+        if (m_pendingOffset == m_pending.size()) {
+            if (!decodeNextFrame())
+                break;
+            continue;
+        }
+
+        const qsizetype bytesToCopy =
+                std::min(m_pending.size() - m_pendingOffset, output.size() - bytesWritten);
+        memcpy(output.data() + bytesWritten, m_pending.constData() + m_pendingOffset, bytesToCopy);
+        m_pendingOffset += bytesToCopy;
+        bytesWritten += bytesToCopy;
+    }
+
+    if (bytesWritten == 0 && !m_errorString.isEmpty())
+        return -1;
+
+    return bytesWritten;
+}
+
+bool SynchronousAudioDecoder::decodeNextFrame()
+{
+    m_pending.resize(0);
+    m_pendingOffset = 0;
+
+    while (!m_atEnd && m_pendingOffset == m_pending.size()) {
+        if (!receiveFrame())
+            return false;
+    }
+
+    return m_pendingOffset < m_pending.size();
+}
+
+bool SynchronousAudioDecoder::receiveFrame()
+{
+    AVCodecContext *codec = m_codecContext.context();
+
+    const int ret = avcodec_receive_frame(codec, m_frame.get());
+    if (ret == 0) {
+        m_hasDecoded = true;
+        resampleFrame(m_frame.get());
+        av_frame_unref(m_frame.get());
+        return true;
+    }
+
+    if (ret == AVERROR_EOF) {
+        // flush the samples buffered by the resampler
+        resampleFrame(nullptr);
+        m_atEnd = true;
+        return true;
+    }
+
+    if (ret != AVERROR(EAGAIN)) {
+        setError(QLatin1String("Failed to decode audio"), ret);
+        return false;
+    }
+
+    // the codec needs more input
+    const int readResult = av_read_frame(m_media->avContext(), m_packet.get());
+    if (readResult < 0) {
+        if (readResult != AVERROR_EOF)
+            qCWarning(qLcSynchronousAudioDecoder)
+                    << "Failed to read packet:" << err2str(readResult);
+
+        if (!std::exchange(m_inputDone, true))
+            avcodec_send_packet(codec, nullptr); // drain the codec
+        return true;
+    }
+
+    if (m_packet->stream_index == int(m_codecContext.streamIndex())) {
+        const int sendResult = avcodec_send_packet(codec, m_packet.get());
+        if (sendResult < 0 && sendResult != AVERROR(EAGAIN))
+            qCDebug(qLcSynchronousAudioDecoder) << "Dropped packet:" << err2str(sendResult);
+    }
+
+    av_packet_unref(m_packet.get());
+    return true;
+}
+
+void SynchronousAudioDecoder::resampleFrame(const AVFrame *frame)
+{
+    if (frame && !m_basePosition) {
+        m_basePosition = frame->best_effort_timestamp != AV_NOPTS_VALUE
+                ? m_codecContext.toUs(frame->best_effort_timestamp)
+                        - mediaStartTime(m_media->avContext())
+                : 0;
+    }
+
+    if (!m_basePosition)
+        return; // nothing decoded since the last seek
+
+    const int inputFrames = frame ? frame->nb_samples : 0;
+    m_pending.resize(m_outputFormat.bytesForFrames(m_resampler->maxOutputFrames(inputFrames)));
+
+    const QSpan<std::byte> pending{ reinterpret_cast<std::byte *>(m_pending.data()),
+                                    m_pending.size() };
+    const int outputFrames =
+            frame ? m_resampler->resample(frame, pending) : m_resampler->flush(pending);
+
+    const qint64 chunkStart =
+            *m_basePosition + m_outputFormat.durationForFrames(m_framesSinceBase);
+    m_framesSinceBase += outputFrames;
+
+    // trim the chunk to [m_skipUntil, m_rangeEnd)
+    qint64 firstFrame = 0;
+    if (chunkStart < m_skipUntil)
+        firstFrame = std::min<qint64>(m_outputFormat.framesForDuration(m_skipUntil - chunkStart),
+                                      outputFrames);
+
+    qint64 lastFrame = outputFrames;
+    if (m_rangeEnd >= 0) {
+        const qint64 framesToEnd = m_rangeEnd > chunkStart
+                ? m_outputFormat.framesForDuration(m_rangeEnd - chunkStart)
+                : 0;
+        if (framesToEnd <= outputFrames) {
+            lastFrame = framesToEnd;
+            m_atEnd = true;
+        }
+    }
+
+    m_pendingOffset = m_outputFormat.bytesForFrames(int(firstFrame));
+    m_pending.resize(m_outputFormat.bytesForFrames(int(std::max(firstFrame, lastFrame))));
+}
+
+void SynchronousAudioDecoder::setError(const QString &description, int avError)
+{
+    m_errorString = avError ? description + QLatin1String(": ") + err2str(avError) : description;
+    qCWarning(qLcSynchronousAudioDecoder) << m_errorString;
+}
+
+} // namespace QFFmpeg
+
+QT_END_NAMESPACE
@@ -0,0 +1,121 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+#ifndef QFFMPEGSYNCHRONOUSAUDIODECODER_P_H
+#define QFFMPEGSYNCHRONOUSAUDIODECODER_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API. It exists purely as an
+// implementation detail. This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include "qffmpeg_p.h"
+#include "playbackengine/qffmpegcodeccontext_p.h"
+#include "playbackengine/qffmpegmediadataholder_p.h"
+
+#include <QtCore/qspan.h>
+#include <QtMultimedia/qaudioformat.h>
+
+#include <memory>
+#include <optional>
+
+QT_BEGIN_NAMESPACE
+
+class QFFmpegResampler;
+
+namespace QFFmpeg {
+
+/*!
+    Decodes the default audio stream of a media synchronously, straight from the
+    demuxer via the codec into the resampler, without the playback engine.
+
+    It doesn't require an event loop and can be used from any thread, one instance
+    per thread. All the times are in microseconds, relative to the start of the media.
+ */
+class SynchronousAudioDecoder
+{
+public:
+    using Maybe = QMaybe<std::unique_ptr<SynchronousAudioDecoder>, MediaDataHolder::ContextError>;
+
+    /*!
+        Opens the media from \a url or \a device. The decoded data is converted
+        to \a outputFormat, or kept in the native format if \a outputFormat is invalid.
+     */
+    static Maybe create(const QUrl &url, QIODevice *device, const QAudioFormat &outputFormat);
+
+    ~SynchronousAudioDecoder();
+
+    const QAudioFormat &outputFormat() const { return m_outputFormat; }
+    qint64 duration() const { return m_media->duration(); }
+
+    /*!
+        Returns the time of the next frame returned by read().
+     */
+    qint64 position() const;
+
+    /*!
+        Limits decoding to [\a start, \a end), and seeks to \a start.
+        A negative \a end means the end of the stream.
+     */
+    bool setRange(qint64 start, qint64 end);
+
+    /*!
+        Seeks to \a position, clamped to the range. The first frame returned
+        by read() is the one at \a position, not the preceding key frame.
+     */
+    bool seek(qint64 position);
+
+    /*!
+        Fills \a output with whole frames of decoded data.
+        Returns the number of bytes written, 0 at the end of the range, or -1 on error.
+     */
+    qint64 read(QSpan<std::byte> output);
+
+    const QString &errorString() const { return m_errorString; }
+
+private:
+    SynchronousAudioDecoder(QSharedPointer<MediaDataHolder> media, CodecContext codecContext,
+                            const QAudioFormat &outputFormat);
+
+    // Decodes and resamples the next frame into m_pending; returns false at the end or on error
+    bool decodeNextFrame();
+    bool receiveFrame();
+    void resampleFrame(const AVFrame *frame);
+    void setError(const QString &description, int avError);
+
+    QSharedPointer<MediaDataHolder> m_media;
+    CodecContext m_codecContext;
+    QAudioFormat m_outputFormat;
+    std::unique_ptr<QFFmpegResampler> m_resampler;
+
+    AVPacketUPtr m_packet;
+    AVFrameUPtr m_frame;
+
+    // resampled data that hasn't been returned by read() yet
+    QByteArray m_pending;
+    qsizetype m_pendingOffset = 0;
+
+    qint64 m_rangeStart = 0;
+    qint64 m_rangeEnd = -1;
+    qint64 m_skipUntil = 0;
+
+    // time of the first frame after the last seek, and frames resampled since then
+    std::optional<qint64> m_basePosition;
+    qint64 m_framesSinceBase = 0;
+
+    bool m_inputDone = false;
+    bool m_atEnd = false;
+    bool m_hasDecoded = false;
+    QString m_errorString;
+};
+
+} // namespace QFFmpeg
+
+QT_END_NAMESPACE
+
+#endif // QFFMPEGSYNCHRONOUSAUDIODECODER_P_H
@@ -16,6 +16,7 @@
 
 #include <private/qtmultimediaglobal_p.h>
 
+#include <qatomic.h>
 #include <qmutex.h>
 #include <qwaitcondition.h>
 #include <qthread.h>
@@ -42,6 +43,12 @@ public:
         void operator()(ConsumerThread *thread) const { thread->stopAndDelete(); }
     };
 
+    /*!
+        Returns the number of work items waiting to be processed, as last
+        reported by setQueueLength. Thread-safe.
+     */
+    int queueLength() const { return m_queueLength.loadRelaxed(); }
+
 protected:
     /*!
         Stops the thread and deletes this object
@@ -85,12 +92,19 @@ protected:
      */
     QMutexLocker<QMutex> lockLoopData() const;
 
+    /*!
+        Reports the number of work items waiting to be processed;
+        supposed to be invoked under lockLoopData.
+     */
+    void setQueueLength(size_t length) { m_queueLength.storeRelaxed(int(length)); }
+
 private:
     void run() final;
 
     mutable QMutex m_loopDataMutex;
     QWaitCondition m_condition;
     bool m_exit = false;
+    QAtomicInt m_queueLength = 0;
 };
 
 template <typename T>
@@ -5,6 +5,7 @@
 #include "private/qvideotexturehelper_p.h"
 #include "private/qmultimediautils_p.h"
 #include "qffmpeghwaccel_p.h"
+#include "qffmpegswframeconverter_p.h"
 #include "qloggingcategory.h"
 #include <QtCore/qthread.h>
 
@@ -27,9 +28,30 @@ static bool isFrameFlipped(const AVFrame& frame) {
     return false;
 }
 
-QFFmpegVideoBuffer::QFFmpegVideoBuffer(AVFrameUPtr frame, AVRational pixelAspectRatio)
+static float maxNitsOf(const AVFrame &frame)
+{
+    float maxNits = -1;
+    for (int i = 0; i < frame.nb_side_data; ++i) {
+        AVFrameSideData *sd = frame.side_data[i];
+        // TODO: Longer term we might want to also support HDR10+ dynamic metadata
+        if (sd->type == AV_FRAME_DATA_MASTERING_DISPLAY_METADATA) {
+            auto *data = reinterpret_cast<AVMasteringDisplayMetadata *>(sd->data);
+            auto maybeLum = QFFmpeg::mul(qreal(10'000.), data->max_luminance);
+            if (maybeLum)
+                maxNits = float(maybeLum.value());
+        }
+    }
+    return maxNits;
+}
+
+QFFmpegVideoBuffer::QFFmpegVideoBuffer(AVFrameUPtr frame, AVRational pixelAspectRatio,
+                                       std::shared_ptr<SwFrameConverter> swFrameConverter)
     : QHwVideoBuffer(QVideoFrame::NoHandle),
-      m_frame(frame.get()),
+      m_colorSpace(fromAvColorSpace(frame->colorspace)),
+      m_colorTransfer(fromAvColorTransfer(frame->color_trc)),
+      m_colorRange(fromAvColorRange(frame->color_range)),
+      m_maxNits(maxNitsOf(*frame)),
+      m_swFrameConverter(std::move(swFrameConverter)),
       m_size(qCalculateFrameSize({ frame->width, frame->height },
                                  { pixelAspectRatio.num, pixelAspectRatio.den }))
 {
@@ -42,12 +64,13 @@ QFFmpegVideoBuffer::QFFmpegVideoBuffer(AVFrameUPtr frame, AVRational pixelAspect
     m_swFrame = std::move(frame);
     m_pixelFormat = toQtPixelFormat(AVPixelFormat(m_swFrame->format));
 
-    convertSWFrame();
+    // the conversion, if needed, is deferred to map(): frames that are dropped before being
+    // presented don't pay for it
 }
 
 QFFmpegVideoBuffer::~QFFmpegVideoBuffer() = default;
 
-void QFFmpegVideoBuffer::convertSWFrame()
+bool QFFmpegVideoBuffer::convertSWFrame()
 {
     Q_ASSERT(m_swFrame);
 
@@ -59,21 +82,17 @@ void QFFmpegVideoBuffer::convertSWFrame()
         || m_size != actualSize) {
         Q_ASSERT(toQtPixelFormat(targetAVPixelFormat) == m_pixelFormat);
         // convert the format into something we can handle
-        SwsContextUPtr scaleContext = createSwsContext(actualSize, actualAVPixelFormat, m_size,
-                                                       targetAVPixelFormat, SWS_BICUBIC);
-
-        auto newFrame = makeAVFrame();
-        newFrame->width = m_size.width();
-        newFrame->height = m_size.height();
-        newFrame->format = targetAVPixelFormat;
-        av_frame_get_buffer(newFrame.get(), 0);
-
-        sws_scale(scaleContext.get(), m_swFrame->data, m_swFrame->linesize, 0, m_swFrame->height,
-                  newFrame->data, newFrame->linesize);
-        if (m_frame == m_swFrame.get())
-            m_frame = newFrame.get();
+        if (!m_swFrameConverter)
+            m_swFrameConverter = std::make_shared<SwFrameConverter>();
+
+        auto newFrame = m_swFrameConverter->convert(*m_swFrame, targetAVPixelFormat, m_size);
+        if (!newFrame)
+            return false;
+
         m_swFrame = std::move(newFrame);
     }
+
+    return true;
 }
 
 void QFFmpegVideoBuffer::initTextureConverter(QRhi &rhi)
@@ -123,33 +142,22 @@ QRhi *QFFmpegVideoBuffer::rhi() const
 
 QVideoFrameFormat::ColorSpace QFFmpegVideoBuffer::colorSpace() const
 {
-    return fromAvColorSpace(m_frame->colorspace);
+    return m_colorSpace;
 }
 
 QVideoFrameFormat::ColorTransfer QFFmpegVideoBuffer::colorTransfer() const
 {
-    return fromAvColorTransfer(m_frame->color_trc);
+    return m_colorTransfer;
 }
 
 QVideoFrameFormat::ColorRange QFFmpegVideoBuffer::colorRange() const
 {
-    return fromAvColorRange(m_frame->color_range);
+    return m_colorRange;
 }
 
-float QFFmpegVideoBuffer::maxNits()
+float QFFmpegVideoBuffer::maxNits() const
 {
-    float maxNits = -1;
-    for (int i = 0; i < m_frame->nb_side_data; ++i) {
-        AVFrameSideData *sd = m_frame->side_data[i];
-        // TODO: Longer term we might want to also support HDR10+ dynamic metadata
-        if (sd->type == AV_FRAME_DATA_MASTERING_DISPLAY_METADATA) {
-            auto *data = reinterpret_cast<AVMasteringDisplayMetadata *>(sd->data);
-            auto maybeLum = QFFmpeg::mul(qreal(10'000.), data->max_luminance);
-            if (maybeLum)
-                maxNits = float(maybeLum.value());
-        }
-    }
-    return maxNits;
+    return m_maxNits;
 }
 
 QAbstractVideoBuffer::MapData QFFmpegVideoBuffer::map(QVideoFrame::MapMode mode)
@@ -163,7 +171,12 @@ QAbstractVideoBuffer::MapData QFFmpegVideoBuffer::map(QVideoFrame::MapMode mode)
             qWarning() << "Error transferring the data to system memory:" << ret;
             return {};
         }
-        convertSWFrame();
+    }
+
+    // does nothing if the frame has already been converted
+    if (!convertSWFrame()) {
+        qWarning() << "Cannot convert the frame to" << m_pixelFormat;
+        return {};
     }
 
     m_mode = mode;
@@ -21,14 +21,23 @@
 #include "qffmpeg_p.h"
 #include "qffmpeghwaccel_p.h"
 
+#include <memory>
+
 QT_BEGIN_NAMESPACE
 
+namespace QFFmpeg {
+class SwFrameConverter;
+}
+
 class QFFmpegVideoBuffer : public QHwVideoBuffer
 {
 public:
     using AVFrameUPtr = QFFmpeg::AVFrameUPtr;
 
-    QFFmpegVideoBuffer(AVFrameUPtr frame, AVRational pixelAspectRatio = { 1, 1 });
+    // Software frames that need a conversion are converted when mapped for the first time,
+    // with the converter shared by the frames of the codec context, if any.
+    QFFmpegVideoBuffer(AVFrameUPtr frame, AVRational pixelAspectRatio = { 1, 1 },
+                       std::shared_ptr<QFFmpeg::SwFrameConverter> swFrameConverter = {});
     ~QFFmpegVideoBuffer() override;
 
     MapData map(QVideoFrame::MapMode mode) override;
@@ -42,7 +51,9 @@ public:
     static QVideoFrameFormat::PixelFormat toQtPixelFormat(AVPixelFormat avPixelFormat, bool *needsConversion = nullptr);
     static AVPixelFormat toAVPixelFormat(QVideoFrameFormat::PixelFormat pixelFormat);
 
-    void convertSWFrame();
+    // Converts the software frame into m_pixelFormat and m_size, if it has another
+    // format, size or layout. Returns false on failure.
+    bool convertSWFrame();
 
     AVFrame *getHWFrame() const { return m_hwFrame.get(); }
 
@@ -54,7 +65,7 @@ public:
     QVideoFrameFormat::ColorTransfer colorTransfer() const;
     QVideoFrameFormat::ColorRange colorRange() const;
 
-    float maxNits();
+    float maxNits() const;
 
 private:
     // The result texture converter must be accessed from the rhi's thread
@@ -64,9 +75,14 @@ private:
 
 private:
     QVideoFrameFormat::PixelFormat m_pixelFormat;
-    AVFrame *m_frame = nullptr;
+    // taken from the decoded frame, since the conversion in map() replaces m_swFrame
+    QVideoFrameFormat::ColorSpace m_colorSpace;
+    QVideoFrameFormat::ColorTransfer m_colorTransfer;
+    QVideoFrameFormat::ColorRange m_colorRange;
+    float m_maxNits;
     AVFrameUPtr m_hwFrame;
     AVFrameUPtr m_swFrame;
+    std::shared_ptr<QFFmpeg::SwFrameConverter> m_swFrameConverter;
     QSize m_size;
     QVideoFrame::MapMode m_mode = QVideoFrame::NotMapped;
 };
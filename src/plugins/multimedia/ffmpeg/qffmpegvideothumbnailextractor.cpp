@@ -0,0 +1,369 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qffmpegvideothumbnailextractor_p.h"
+#include "qffmpeg_p.h"
+#include "qffmpegconverter_p.h"
+#include "qffmpegvideobuffer_p.h"
+#include "playbackengine/qffmpegcodeccontext_p.h"
+#include "playbackengine/qffmpegmediadataholder_p.h"
+
+#include <QtCore/qloggingcategory.h>
+#include <QtGui/qtransform.h>
+#include <QtMultimedia/private/qvideoframe_p.h>
+#include <QtMultimedia/private/qvideoframeconverter_p.h>
+
+#include <algorithm>
+#include <numeric>
+#include <optional>
+
+QT_BEGIN_NAMESPACE
+
+Q_STATIC_LOGGING_CATEGORY(qLcVideoThumbnailExtractor,
+                          "qt.multimedia.ffmpeg.videothumbnailextractor");
+
+namespace QFFmpeg {
+
+namespace {
+
+using Settings = QVideoThumbnailExtractor::Settings;
+using Result = QVideoThumbnailExtractor::Result;
+using Thumbnail = QVideoThumbnailExtractor::Thumbnail;
+
+class FunctionCancelToken : public ICancelToken
+{
+public:
+    explicit FunctionCancelToken(const std::function<bool()> &isCancelled)
+        : m_isCancelled(isCancelled)
+    {
+    }
+
+    bool isCancelled() const override { return m_isCancelled && m_isCancelled(); }
+
+private:
+    std::function<bool()> m_isCancelled;
+};
+
+QList<qint64> thumbnailPositions(const Settings &settings, qint64 duration)
+{
+    if (!settings.positions.isEmpty())
+        return settings.positions;
+
+    if (duration <= 0 || settings.count <= 1)
+        return QList<qint64>(std::max(settings.count, 0), duration > 0 ? duration / 2 : 0);
+
+    // the middles of equal segments, which avoids the black frames at the start and the end
+    QList<qint64> positions;
+    positions.reserve(settings.count);
+    for (int i = 0; i < settings.count; ++i)
+        positions.append(duration * (2 * i + 1) / (2 * settings.count));
+
+    return positions;
+}
+
+class ThumbnailDecoder
+{
+public:
+    ThumbnailDecoder(QSharedPointer<MediaDataHolder> media, CodecContext codecContext,
+                     const Settings &settings, const ICancelToken &cancelToken)
+        : m_media(std::move(media)),
+          m_codecContext(std::move(codecContext)),
+          m_cancelToken(cancelToken),
+          m_packet(av_packet_alloc()),
+          m_transformation(m_media->transformation()),
+          m_size(settings.size),
+          m_keyFramesOnly(settings.keyFramesOnly)
+    {
+        AVFormatContext *context = m_media->avContext();
+        AVStream *stream = m_codecContext.stream();
+
+        // the demuxer doesn't need to parse the packets of the other streams
+        for (unsigned i = 0; i < context->nb_streams; ++i) {
+            if (context->streams[i] != stream)
+                context->streams[i]->discard = AVDISCARD_ALL;
+        }
+
+        if (m_keyFramesOnly)
+            m_codecContext.context()->skip_frame = AVDISCARD_NONKEY;
+
+        m_startTime = stream->start_time != AV_NOPTS_VALUE ? stream->start_time : 0;
+
+        m_converter.setTargetFormat(QVideoFrameFormat(
+                {}, QVideoFrameFormat::pixelFormatFromImageFormat(QImage::Format_RGB32)));
+    }
+
+    std::optional<Thumbnail> thumbnailAt(qint64 position);
+
+    const QString &errorString() const { return m_errorString; }
+
+private:
+    void seek(qint64 timestamp);
+    AVFrameUPtr frameAt(qint64 timestamp);
+    AVFrameUPtr receiveFrame();
+    QImage toImage(AVFrameUPtr frame);
+    QSize thumbnailSize(QSize frameSize) const;
+
+    QSharedPointer<MediaDataHolder> m_media;
+    CodecContext m_codecContext;
+    const ICancelToken &m_cancelToken;
+    AVPacketUPtr m_packet;
+    VideoFrameConverter m_converter;
+
+    const VideoTransformation m_transformation;
+    const QSize m_size;
+    const bool m_keyFramesOnly;
+    qint64 m_startTime = 0;
+
+    // the first frame past the previous thumbnail, if the media hasn't been seeked since then
+    AVFrameUPtr m_lookahead;
+    bool m_seeked = false;
+    bool m_inputDone = false;
+
+    // with keyFramesOnly, neighbouring positions often share the key frame
+    std::optional<Thumbnail> m_lastThumbnail;
+
+    QString m_errorString;
+};
+
+std::optional<Thumbnail> ThumbnailDecoder::thumbnailAt(qint64 position)
+{
+    const AVStream *stream = m_codecContext.stream();
+    const qint64 timestamp =
+            av_rescale_q(position, { 1, AV_TIME_BASE }, stream->time_base) + m_startTime;
+
+    seek(timestamp);
+
+    AVFrameUPtr frame = frameAt(timestamp);
+    if (!frame)
+        return {};
+
+    const qint64 pts = frame->best_effort_timestamp != AV_NOPTS_VALUE
+            ? frame->best_effort_timestamp
+            : frame->pts;
+    const qint64 framePosition = pts != AV_NOPTS_VALUE ? m_codecContext.toUs(pts - m_startTime)
+                                                       : position;
+
+    if (m_lastThumbnail && m_lastThumbnail->position == framePosition)
+        return Thumbnail{ position, framePosition, m_lastThumbnail->image };
+
+    QImage image = toImage(std::move(frame));
+    if (image.isNull()) {
+        m_errorString = QLatin1String("Failed to convert the video frame");
+        return {};
+    }
+
+    m_lastThumbnail = Thumbnail{ position, framePosition, std::move(image) };
+    return m_lastThumbnail;
+}
+
+void ThumbnailDecoder::seek(qint64 timestamp)
+{
+    if (!m_media->isSeekable())
+        return; // the positions are processed in ascending order, so we just decode forward
+
+    AVFormatContext *context = m_media->avContext();
+    const int err = av_seek_frame(context, m_codecContext.streamIndex(), timestamp,
+                                  AVSEEK_FLAG_BACKWARD);
+    if (err < 0) {
+        qCDebug(qLcVideoThumbnailExtractor) << "Failed to seek, decoding forward:" << err2str(err);
+        return;
+    }
+
+    avcodec_flush_buffers(m_codecContext.context());
+    m_lookahead.reset();
+    m_seeked = true;
+    m_inputDone = false;
+}
+
+AVFrameUPtr ThumbnailDecoder::frameAt(qint64 timestamp)
+{
+    // the last frame at or before the timestamp
+    AVFrameUPtr best;
+
+    while (true) {
+        AVFrameUPtr frame = m_lookahead ? std::move(m_lookahead) : receiveFrame();
+        if (!frame)
+            return best;
+
+        // after seeking, the first decoded frame is the key frame at or before the timestamp
+        if (std::exchange(m_seeked, false) && m_keyFramesOnly)
+            return frame;
+
+        const qint64 pts = frame->best_effort_timestamp;
+        if (pts != AV_NOPTS_VALUE && pts > timestamp) {
+            if (!best)
+                return frame;
+
+            m_lookahead = std::move(frame);
+            return best;
+        }
+
+        best = std::move(frame);
+        if (pts == timestamp)
+            return best;
+    }
+}
+
+AVFrameUPtr ThumbnailDecoder::receiveFrame()
+{
+    AVCodecContext *codec = m_codecContext.context();
+    AVFrameUPtr frame = makeAVFrame();
+
+    while (!m_cancelToken.isCancelled()) {
+        int ret = avcodec_receive_frame(codec, frame.get());
+        if (ret == 0)
+            return frame;
+
+        if (ret == AVERROR_EOF)
+            return {};
+
+        if (ret != AVERROR(EAGAIN)) {
+            m_errorString = QLatin1String("Failed to decode the video: ") + err2str(ret);
+            return {};
+        }
+
+        // the codec needs more input
+        ret = av_read_frame(m_media->avContext(), m_packet.get());
+        if (ret < 0) {
+            if (ret != AVERROR_EOF)
+                qCWarning(qLcVideoThumbnailExtractor) << "Failed to read a packet:" << err2str(ret);
+
+            if (std::exchange(m_inputDone, true))
+                return {};
+
+            // drain the codec
+            avcodec_send_packet(codec, nullptr);
+            continue;
+        }
+
+        if (m_packet->stream_index == int(m_codecContext.streamIndex())) {
+            ret = avcodec_send_packet(codec, m_packet.get());
+            // corrupted packets are skipped, like in playback
+            if (ret < 0 && ret != AVERROR(EAGAIN))
+                qCDebug(qLcVideoThumbnailExtractor) << "Failed to send a packet:" << err2str(ret);
+        }
+
+        av_packet_unref(m_packet.get());
+    }
+
+    return {};
+}
+
+QImage ThumbnailDecoder::toImage(AVFrameUPtr frame)
+{
+    const AVRational pixelAspectRatio = m_codecContext.pixelAspectRatio(frame.get());
+    const QSize displaySize = qCalculateFrameSize(
+            { frame->width, frame->height }, { pixelAspectRatio.num, pixelAspectRatio.den });
+
+    // the pixel aspect ratio is applied by the scaling into the thumbnail size
+    auto buffer = std::make_unique<QFFmpegVideoBuffer>(std::move(frame), AVRational{ 1, 1 },
+                                                       m_codecContext.swFrameConverter());
+    QVideoFrameFormat format(buffer->size(), buffer->pixelFormat());
+    format.setColorSpace(buffer->colorSpace());
+    format.setColorTransfer(buffer->colorTransfer());
+    format.setColorRange(buffer->colorRange());
+    QVideoFrame videoFrame = QVideoFramePrivate::createFrame(std::move(buffer), format);
+
+    QVideoFrameFormat targetFormat = m_converter.targetFormat();
+    targetFormat.setFrameSize(thumbnailSize(displaySize));
+    m_converter.setTargetFormat(targetFormat);
+
+    QVideoFrame rgbFrame = m_converter.convert(videoFrame);
+    if (!rgbFrame.isValid())
+        return {};
+
+    // the image references the mapped frame; the thumbnails are small, so only the rotated
+    // ones are copied
+    QImage image = videoFramePlaneAsImage(rgbFrame, 0, QImage::Format_RGB32, rgbFrame.size());
+
+    QTransform transform;
+    if (m_transformation.rotation != QtVideo::Rotation::None)
+        transform.rotate(qreal(m_transformation.rotation));
+    if (m_transformation.mirrorredHorizontallyAfterRotation)
+        transform.scale(-1., 1);
+    if (!transform.isIdentity())
+        image = image.transformed(transform);
+
+    return image;
+}
+
+QSize ThumbnailDecoder::thumbnailSize(QSize frameSize) const
+{
+    // the requested size applies to the presented, rotated, thumbnails
+    QSize size = qRotatedFrameSize(frameSize, m_transformation.rotation);
+    if (m_size.isValid() && (size.width() > m_size.width() || size.height() > m_size.height()))
+        size = size.scaled(m_size, Qt::KeepAspectRatio).expandedTo({ 1, 1 });
+
+    return qRotatedFrameSize(size, m_transformation.rotation);
+}
+
+} // namespace
+
+} // namespace QFFmpeg
+
+using namespace QFFmpeg;
+
+QVideoThumbnailExtractor::Result
+QFFmpegVideoThumbnailExtractor::extract(const QUrl &url, QIODevice *device,
+                                        const QVideoThumbnailExtractor::Settings &settings,
+                                        const std::function<bool()> &isCancelled)
+{
+    Result result;
+
+    auto setError = [&](QMediaPlayer::Error error, const QString &description) {
+        result.thumbnails.clear();
+        result.error = error;
+        result.errorString = description;
+        return result;
+    };
+
+    auto cancelToken = std::make_shared<FunctionCancelToken>(isCancelled);
+    MediaDataHolder::Maybe media = MediaDataHolder::create(url, device, cancelToken);
+    if (!media)
+        return setError(QMediaPlayer::Error(media.error().code), media.error().description);
+
+    QSharedPointer<MediaDataHolder> holder = media.value();
+    const int streamIndex = holder->currentStreamIndex(QPlatformMediaPlayer::VideoStream);
+    if (streamIndex < 0) {
+        return setError(QMediaPlayer::FormatError,
+                        QLatin1String("The media doesn't contain a video stream"));
+    }
+
+    AVFormatContext *context = holder->avContext();
+    QMaybe<CodecContext> codecContext =
+            CodecContext::create(context->streams[streamIndex], context);
+    if (!codecContext)
+        return setError(QMediaPlayer::FormatError, codecContext.error());
+
+    const QList<qint64> positions = thumbnailPositions(settings, holder->duration());
+
+    // decode in ascending order, so that the media is only read forward
+    QList<qsizetype> order(positions.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](qsizetype lhs, qsizetype rhs) {
+        return positions[lhs] < positions[rhs];
+    });
+
+    ThumbnailDecoder decoder(std::move(holder), codecContext.value(), settings, *cancelToken);
+
+    result.thumbnails.resize(positions.size());
+    for (const qsizetype index : order) {
+        if (cancelToken->isCancelled())
+            return setError(QMediaPlayer::ResourceError, QLatin1String("Cancelled"));
+
+        std::optional<Thumbnail> thumbnail = decoder.thumbnailAt(positions[index]);
+        if (!thumbnail) {
+            const QString &errorString = decoder.errorString();
+            return setError(QMediaPlayer::FormatError,
+                            errorString.isEmpty() ? QLatin1String("No video frame at %1 us")
+                                                            .arg(positions[index])
+                                                  : errorString);
+        }
+
+        result.thumbnails[index] = std::move(*thumbnail);
+    }
+
+    return result;
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,40 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QFFMPEGVIDEOTHUMBNAILEXTRACTOR_P_H
+#define QFFMPEGVIDEOTHUMBNAILEXTRACTOR_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API. It exists purely as an
+// implementation detail. This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtMultimedia/private/qplatformvideothumbnailextractor_p.h>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    Extracts thumbnails straight from the demuxer via the codec, without the playback engine.
+
+    The extractor seeks to the key frame at or before each position, and decodes from there
+    only as many frames as needed; with keyFramesOnly, the codec skips the other frames and
+    only the key frame is decoded. The frames are scaled to the thumbnail size while they
+    are converted to RGB.
+ */
+class QFFmpegVideoThumbnailExtractor : public QPlatformVideoThumbnailExtractor
+{
+public:
+    QVideoThumbnailExtractor::Result extract(const QUrl &url, QIODevice *device,
+                                             const QVideoThumbnailExtractor::Settings &settings,
+                                             const std::function<bool()> &isCancelled) override;
+};
+
+QT_END_NAMESPACE
+
+#endif // QFFMPEGVIDEOTHUMBNAILEXTRACTOR_P_H
@@ -116,6 +116,7 @@ void AudioEncoder::addBuffer(const QAudioBuffer &buffer)
 
         m_audioBufferQueue.push(buffer);
         m_queueDuration += bufferDuration;
+        setQueueLength(m_audioBufferQueue.size());
     }
 
     dataReady();
@@ -126,6 +127,7 @@ QAudioBuffer AudioEncoder::takeBuffer()
     auto locker = lockLoopData();
     QAudioBuffer result = dequeueIfPossible(m_audioBufferQueue);
     m_queueDuration -= std::chrono::microseconds(result.duration());
+    setQueueLength(m_audioBufferQueue.size());
     return result;
 }
 
@@ -297,9 +299,30 @@ void AudioEncoder::ensurePendingFrame(int availableSamplesCount)
     if (m_avFrame)
         return;
 
-    m_avFrame = makeAVFrame();
+#if QT_FFMPEG_HAS_AV_CHANNEL_LAYOUT
+    const int channelsCount = m_codecContext->ch_layout.nb_channels;
+#else
+    const int channelsCount = m_codecContext->channels;
+#endif
+
+    const bool isFixedFrameSize =
+            !(m_codecContext->codec->capabilities & AV_CODEC_CAP_VARIABLE_FRAME_SIZE)
+            && m_codecContext->frame_size;
+
+    // Fixed size frames are taken from the pool, and return to it once the codec
+    // has consumed them, so that steady-state encoding doesn't allocate sample buffers.
+    if (isFixedFrameSize
+        && m_avFramePool.reset(m_codecContext->sample_fmt, channelsCount,
+                               m_codecContext->frame_size))
+        m_avFrame = m_avFramePool.get();
+
+    if (!m_avFrame) {
+        m_avFrame = makeAVFrame();
+        m_avFrame->format = m_codecContext->sample_fmt;
+        m_avFrame->nb_samples =
+                isFixedFrameSize ? m_codecContext->frame_size : availableSamplesCount;
+    }
 
-    m_avFrame->format = m_codecContext->sample_fmt;
 #if QT_FFMPEG_HAS_AV_CHANNEL_LAYOUT
     m_avFrame->ch_layout = m_codecContext->ch_layout;
 #else
@@ -308,11 +331,7 @@ void AudioEncoder::ensurePendingFrame(int availableSamplesCount)
 #endif
     m_avFrame->sample_rate = m_codecContext->sample_rate;
 
-    const bool isFixedFrameSize =
-            !(m_codecContext->codec->capabilities & AV_CODEC_CAP_VARIABLE_FRAME_SIZE)
-            && m_codecContext->frame_size;
-    m_avFrame->nb_samples = isFixedFrameSize ? m_codecContext->frame_size : availableSamplesCount;
-    if (m_avFrame->nb_samples)
+    if (!m_avFrame->buf[0] && m_avFrame->nb_samples)
         av_frame_get_buffer(m_avFrame.get(), 0);
 
     const auto &timeBase = m_stream->time_base;
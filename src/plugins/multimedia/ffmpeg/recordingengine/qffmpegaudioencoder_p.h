@@ -16,6 +16,7 @@
 
 #include "qffmpeg_p.h"
 #include "qffmpegencoderthread_p.h"
+#include "qffmpegframepool_p.h"
 #include "private/qplatformmediarecorder_p.h"
 #include <qaudiobuffer.h>
 #include <queue>
@@ -73,6 +74,7 @@ private:
     QMediaEncoderSettings m_settings;
 
     AVFrameUPtr m_avFrame;
+    AVAudioFramePool m_avFramePool;
     int m_avFrameSamplesOffset = 0;
     std::vector<uint8_t *> m_avFramePlanesData;
 };
@@ -0,0 +1,124 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qffmpegencoderloadcontroller_p.h"
+
+#include <QtCore/qloggingcategory.h>
+
+#include <algorithm>
+
+QT_BEGIN_NAMESPACE
+
+Q_STATIC_LOGGING_CATEGORY(qLcEncoderLoadController, "qt.multimedia.ffmpeg.encoderloadcontroller");
+
+namespace QFFmpeg {
+
+namespace {
+
+constexpr qreal SmoothingFactor = 0.125;
+
+void smooth(qreal &average, qint64 value)
+{
+    if (qFuzzyIsNull(average))
+        average = value;
+    else
+        average += (value - average) * SmoothingFactor;
+}
+
+} // namespace
+
+EncoderLoadController::EncoderLoadController(size_t maxQueueSize)
+    : m_maxQueueSize(maxQueueSize), m_highWatermark(std::max<size_t>(maxQueueSize / 2, 1))
+{
+    Q_ASSERT(maxQueueSize > 0);
+}
+
+void EncoderLoadController::setEnabled(bool enabled)
+{
+    m_enabled = enabled;
+    if (!enabled)
+        setDegradationLevel(0);
+}
+
+bool EncoderLoadController::acceptFrame(size_t queueSize)
+{
+    if (queueSize >= m_maxQueueSize) {
+        ++m_droppedFrames;
+
+        // The queue might stay full for a while after stepping down, so give the
+        // encoder a chance to drain it before stepping down once again.
+        if (m_enabled && m_framesSinceLevelChange >= static_cast<int>(m_maxQueueSize))
+            setDegradationLevel(m_degradationLevel + 1);
+
+        return false;
+    }
+
+    ++m_sourceFrameCounter;
+
+    if (m_degradationLevel > 0 && m_sourceFrameCounter % (m_degradationLevel + 1) != 0) {
+        ++m_droppedFrames;
+        return false;
+    }
+
+    return true;
+}
+
+void EncoderLoadController::frameEncoded(qint64 encodingTimeUs, qint64 frameDurationUs,
+                                         size_t queueSize)
+{
+    smooth(m_avgEncodingTimeUs, encodingTimeUs);
+    if (frameDurationUs > 0)
+        smooth(m_avgFrameDurationUs, frameDurationUs);
+
+    ++m_framesSinceLevelChange;
+
+    if (!m_enabled)
+        return;
+
+    if (queueSize >= m_highWatermark || loadOnLevel(m_degradationLevel) > 1.) {
+        m_healthyFrameCount = 0;
+        if (m_framesSinceLevelChange >= static_cast<int>(m_maxQueueSize))
+            setDegradationLevel(m_degradationLevel + 1);
+        return;
+    }
+
+    const bool canRecover = m_degradationLevel > 0 && queueSize <= 1
+            && loadOnLevel(m_degradationLevel - 1) < RecoveryLoadThreshold;
+
+    if (!canRecover)
+        m_healthyFrameCount = 0;
+    else if (++m_healthyFrameCount >= RecoveryFrameCount)
+        setDegradationLevel(m_degradationLevel - 1);
+}
+
+EncoderLoadController::Statistics EncoderLoadController::statistics() const
+{
+    return { loadOnLevel(0), m_droppedFrames, m_degradationLevel };
+}
+
+qreal EncoderLoadController::loadOnLevel(int level) const
+{
+    if (m_avgFrameDurationUs <= 0.)
+        return 0.;
+
+    return m_avgEncodingTimeUs / (m_avgFrameDurationUs * (level + 1));
+}
+
+void EncoderLoadController::setDegradationLevel(int level)
+{
+    level = qBound(0, level, MaxDegradationLevel);
+    if (level == m_degradationLevel)
+        return;
+
+    qCDebug(qLcEncoderLoadController)
+            << "Changing degradation level" << m_degradationLevel << "->" << level
+            << "; load:" << loadOnLevel(0) << "dropped frames:" << m_droppedFrames;
+
+    m_degradationLevel = level;
+    m_framesSinceLevelChange = 0;
+    m_healthyFrameCount = 0;
+}
+
+} // namespace QFFmpeg
+
+QT_END_NAMESPACE
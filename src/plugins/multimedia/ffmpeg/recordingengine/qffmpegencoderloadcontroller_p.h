@@ -0,0 +1,95 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+#ifndef QFFMPEGENCODERLOADCONTROLLER_P_H
+#define QFFMPEGENCODERLOADCONTROLLER_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API. It exists purely as an
+// implementation detail. This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/qglobal.h>
+
+QT_BEGIN_NAMESPACE
+
+namespace QFFmpeg {
+
+/*!
+    Watches how well a video encoder keeps up with a live video source,
+    and decimates the source frame rate while the encoder falls behind.
+
+    Degradation is applied in levels: on level N, only every (N + 1)th
+    source frame is encoded. The controller steps one level down if the
+    frame queue reaches the high watermark or if the smoothed encoding time
+    exceeds the time budget of the current level. It steps one level up
+    after the encoder has stayed comfortably within the budget of the
+    upper level for RecoveryFrameCount encoded frames.
+
+    The controller is not thread-safe; the owner is supposed to guard it
+    with the same mutex as the frame queue.
+ */
+class EncoderLoadController
+{
+public:
+    struct Statistics
+    {
+        // Smoothed encoding time divided by the source frame interval;
+        // values above 1 mean that the encoder can't keep up with the source frame rate.
+        qreal load = 0.;
+        qint64 droppedFrames = 0;
+        int degradationLevel = 0;
+    };
+
+    static constexpr int MaxDegradationLevel = 3;
+    static constexpr int RecoveryFrameCount = 30;
+    static constexpr qreal RecoveryLoadThreshold = 0.75;
+
+    explicit EncoderLoadController(size_t maxQueueSize);
+
+    void setEnabled(bool enabled);
+    bool isEnabled() const { return m_enabled; }
+
+    /*!
+        Called upon each new source frame with the current queue size.
+        Returns false if the frame has to be dropped.
+     */
+    bool acceptFrame(size_t queueSize);
+
+    /*!
+        Called after a frame has been encoded.
+     */
+    void frameEncoded(qint64 encodingTimeUs, qint64 frameDurationUs, size_t queueSize);
+
+    Statistics statistics() const;
+
+private:
+    qreal loadOnLevel(int level) const;
+
+    void setDegradationLevel(int level);
+
+private:
+    const size_t m_maxQueueSize;
+    const size_t m_highWatermark;
+    bool m_enabled = false;
+
+    qreal m_avgEncodingTimeUs = 0.;
+    qreal m_avgFrameDurationUs = 0.;
+
+    int m_degradationLevel = 0;
+    int m_framesSinceLevelChange = 0;
+    int m_healthyFrameCount = 0;
+    quint64 m_sourceFrameCounter = 0;
+    qint64 m_droppedFrames = 0;
+};
+
+} // namespace QFFmpeg
+
+QT_END_NAMESPACE
+
+#endif // QFFMPEGENCODERLOADCONTROLLER_P_H
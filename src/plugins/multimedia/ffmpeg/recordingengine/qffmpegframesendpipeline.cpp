@@ -0,0 +1,128 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qffmpegframesendpipeline_p.h"
+
+QT_BEGIN_NAMESPACE
+
+namespace QFFmpeg {
+
+FrameSendPipeline::FrameSendPipeline(Delegate &delegate) : m_delegate(delegate)
+{
+    m_conversionThread.setObjectName(QStringLiteral("VideoFrameConverter"));
+    m_conversionThread.setMaxThreadCount(1);
+}
+
+FrameSendPipeline::~FrameSendPipeline()
+{
+    m_conversionThread.waitForDone();
+}
+
+int FrameSendPipeline::sendFrame(AVFrameUPtr inputFrame)
+{
+    if (inputFrame) {
+        // the caller has to resend the pending frames after an EAGAIN
+        Q_ASSERT(!m_pendingInputFrame);
+        m_pendingInputFrame = std::move(inputFrame);
+    } else {
+        m_flushPending = true;
+    }
+
+    return sendPendingFrames();
+}
+
+int FrameSendPipeline::sendPendingFrames()
+{
+    // The pipelined frame goes first. Besides, its conversion must be
+    // completed before the next conversion is prepared.
+    int previousFrameStatus = finishConversion();
+    if (previousFrameStatus == 0)
+        previousFrameStatus = sendConvertedFrame();
+
+    // on EAGAIN, the input frame stays pending until the packets are retrieved
+    if (previousFrameStatus == AVERROR(EAGAIN))
+        return previousFrameStatus;
+
+    // A failure of the previous frame has nothing to do with the input frame,
+    // so the input frame is passed on, and the failure is reported afterwards
+    if (m_pendingInputFrame) {
+        AVFrameUPtr inputFrame = std::move(m_pendingInputFrame);
+
+        if (!m_delegate.prepareConversion(*inputFrame))
+            return AVERROR(EINVAL);
+
+        if (m_delegate.canPipelineConversion()) {
+            startConversion(std::move(inputFrame));
+        } else {
+            QMaybe<AVFrameUPtr, int> resultFrame = m_delegate.convertFrame(std::move(inputFrame));
+            if (!resultFrame)
+                return resultFrame.error();
+
+            m_convertedFrame = std::move(resultFrame.value());
+            const int status = sendConvertedFrame();
+            if (status < 0)
+                return status; // on EAGAIN, the converted frame stays pending
+        }
+    }
+
+    if (m_flushPending) {
+        // the frame converted during this call has to reach the codec before the flush
+        int status = finishConversion();
+        if (status == 0)
+            status = sendConvertedFrame();
+        if (status < 0)
+            return status;
+
+        m_flushPending = false;
+        status = m_delegate.sendFrameToCodec(nullptr); // Flush
+        if (status < 0)
+            return status;
+    }
+
+    return previousFrameStatus;
+}
+
+void FrameSendPipeline::startConversion(AVFrameUPtr inputFrame)
+{
+    Q_ASSERT(!m_conversionInput);
+
+    m_conversionInput = std::move(inputFrame);
+    m_conversionThread.start([this]() {
+        QMaybe<AVFrameUPtr, int> resultFrame =
+                m_delegate.convertFrame(std::move(m_conversionInput));
+        if (resultFrame)
+            m_conversionOutput = std::move(resultFrame.value());
+        else
+            m_conversionStatus = resultFrame.error();
+    });
+}
+
+int FrameSendPipeline::finishConversion()
+{
+    m_conversionThread.waitForDone();
+
+    if (m_conversionOutput) {
+        Q_ASSERT(!m_convertedFrame);
+        m_convertedFrame = std::move(m_conversionOutput);
+    }
+
+    return std::exchange(m_conversionStatus, 0);
+}
+
+int FrameSendPipeline::sendConvertedFrame()
+{
+    if (!m_convertedFrame)
+        return 0;
+
+    const int status = m_delegate.sendFrameToCodec(m_convertedFrame.get());
+
+    // Keep the frame to resend it after the packets are retrieved
+    if (status != AVERROR(EAGAIN))
+        m_convertedFrame.reset();
+
+    return status;
+}
+
+} // namespace QFFmpeg
+
+QT_END_NAMESPACE
@@ -0,0 +1,91 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+#ifndef QFFMPEGFRAMESENDPIPELINE_P_H
+#define QFFMPEGFRAMESENDPIPELINE_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API. It exists purely as an
+// implementation detail. This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include "qffmpeg_p.h"
+#include "private/qmaybe_p.h"
+
+#include <QtCore/qthreadpool.h>
+
+QT_BEGIN_NAMESPACE
+
+namespace QFFmpeg {
+
+/*!
+    Sends frames to a codec, converting each of them before it's sent.
+
+    If the delegate allows it, the frame is converted on a worker thread while the codec
+    is encoding the previous one, and sent to the codec upon the next call. The frames
+    reach the codec in the order they are passed in, and the flush comes last.
+
+    If the codec returns AVERROR(EAGAIN), the frames that it hasn't accepted are kept;
+    the caller has to retrieve the packets and call sendPendingFrames() before sending
+    the next frame.
+ */
+class FrameSendPipeline
+{
+public:
+    class Delegate
+    {
+    public:
+        virtual ~Delegate() = default;
+
+        // Prepares the conversion of the frame, called once the previous conversion is
+        // finished. Returns false if the frame can't be converted.
+        virtual bool prepareConversion(const AVFrame &frame) = 0;
+
+        // Whether the prepared conversion can run on the worker thread
+        virtual bool canPipelineConversion() const = 0;
+
+        // Converts the frame, on the worker thread if the conversion is pipelined
+        virtual QMaybe<AVFrameUPtr, int> convertFrame(AVFrameUPtr frame) = 0;
+
+        // Sends the converted frame to the codec, or flushes the codec if the frame is null
+        virtual int sendFrameToCodec(AVFrame *frame) = 0;
+    };
+
+    explicit FrameSendPipeline(Delegate &delegate);
+    // waits for the running conversion
+    ~FrameSendPipeline();
+
+    /*!
+        Sends the frame, or flushes the pipeline and the codec if the frame is null.
+        The returned status refers to the frames sent to the codec during this call;
+        a failure of the previous frame doesn't drop the frame passed in.
+     */
+    int sendFrame(AVFrameUPtr inputFrame);
+    int sendPendingFrames();
+
+private:
+    void startConversion(AVFrameUPtr inputFrame);
+    int finishConversion();
+    int sendConvertedFrame();
+
+    Delegate &m_delegate;
+
+    AVFrameUPtr m_conversionInput;
+    AVFrameUPtr m_conversionOutput;
+    int m_conversionStatus = 0;
+    AVFrameUPtr m_convertedFrame; // converted, but not accepted by the codec yet
+    AVFrameUPtr m_pendingInputFrame; // held back while the codec doesn't accept frames
+    bool m_flushPending = false;
+    QThreadPool m_conversionThread;
+};
+
+} // namespace QFFmpeg
+
+QT_END_NAMESPACE
+
+#endif // QFFMPEGFRAMESENDPIPELINE_P_H
@@ -5,13 +5,20 @@
 #include "qffmpegrecordingengineutils_p.h"
 #include <QtCore/qloggingcategory.h>
 
+#include <qtmultimedia_ffmpeg_tracepoints_p.h>
+
 QT_BEGIN_NAMESPACE
 
+Q_TRACE_POINT(qtmultimedia_ffmpeg, QFFmpegMuxer_queue, quint64 muxer, int size);
+Q_TRACE_POINT(qtmultimedia_ffmpeg, QFFmpegMuxer_processOne_entry, quint64 muxer, int streamIndex,
+              qint64 ptsUs, int size);
+Q_TRACE_POINT(qtmultimedia_ffmpeg, QFFmpegMuxer_processOne_exit);
+
 namespace QFFmpeg {
 
 Q_STATIC_LOGGING_CATEGORY(qLcFFmpegMuxer, "qt.multimedia.ffmpeg.muxer");
 
-Muxer::Muxer(RecordingEngine *encoder) : m_encoder(encoder)
+Muxer::Muxer(RecordingEngine *encoder) : m_encoder(encoder), m_traceId(nextTraceId())
 {
     setObjectName(QLatin1String("Muxer"));
 }
@@ -21,6 +28,8 @@ void Muxer::addPacket(AVPacketUPtr packet)
     {
         QMutexLocker locker = lockLoopData();
         m_packetQueue.push(std::move(packet));
+        setQueueLength(m_packetQueue.size());
+        Q_TRACE(QFFmpegMuxer_queue, m_traceId, int(m_packetQueue.size()));
     }
 
     //    qCDebug(qLcFFmpegEncoder) << "Muxer::addPacket" << packet->pts << packet->stream_index;
@@ -30,7 +39,9 @@ void Muxer::addPacket(AVPacketUPtr packet)
 AVPacketUPtr Muxer::takePacket()
 {
     QMutexLocker locker = lockLoopData();
-    return dequeueIfPossible(m_packetQueue);
+    AVPacketUPtr result = dequeueIfPossible(m_packetQueue);
+    setQueueLength(m_packetQueue.size());
+    return result;
 }
 
 bool Muxer::init()
@@ -56,8 +67,18 @@ void Muxer::processOne()
     //   qCDebug(qLcFFmpegEncoder) << "writing packet to file" << packet->pts << packet->duration <<
     //   packet->stream_index;
 
+    AVFormatContext *formatContext = m_encoder->avFormatContext();
+    // the pts matches the one of the frame in the encoder's trace point
+    Q_TRACE_SCOPE(QFFmpegMuxer_processOne, m_traceId, packet->stream_index,
+                  traceTimeStampUs(packet->pts,
+                                   formatContext->streams[packet->stream_index]->time_base),
+                  packet->size);
+
+    m_writtenPackets.fetchAndAddRelaxed(1);
+    m_writtenBytes.fetchAndAddRelaxed(packet->size);
+
     // the function takes ownership for the packet
-    av_interleaved_write_frame(m_encoder->avFormatContext(), packet.release());
+    av_interleaved_write_frame(formatContext, packet.release());
 }
 
 } // namespace QFFmpeg
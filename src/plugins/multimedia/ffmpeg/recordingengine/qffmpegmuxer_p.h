@@ -31,6 +31,9 @@ public:
 
     void addPacket(AVPacketUPtr packet);
 
+    qint64 writtenPackets() const { return m_writtenPackets.loadRelaxed(); }
+    qint64 writtenBytes() const { return m_writtenBytes.loadRelaxed(); }
+
 private:
     AVPacketUPtr takePacket();
 
@@ -42,7 +45,11 @@ private:
 private:
     std::queue<AVPacketUPtr> m_packetQueue;
 
+    QAtomicInteger<qint64> m_writtenPackets = 0;
+    QAtomicInteger<qint64> m_writtenBytes = 0;
+
     RecordingEngine *m_encoder;
+    const quint64 m_traceId;
 };
 
 } // namespace QFFmpeg
@@ -10,6 +10,7 @@
 #include "private/qplatformaudiobufferinput_p.h"
 #include "private/qplatformvideosource_p.h"
 #include "private/qplatformvideoframeinput_p.h"
+#include "private/qrecordingstatistics_p.h"
 
 #include "qdebug.h"
 #include "qffmpegvideoencoder_p.h"
@@ -127,6 +128,10 @@ void RecordingEngine::addVideoSource(QPlatformVideoSource *source, const QVideoF
     if (m_autoStop)
         videoEncoder->setAutoStop(true);
 
+    // QVideoFrameInput respects canPushFrame, so frames sent by the user are never decimated.
+    // Live sources, e.g. cameras and screen captures, don't wait for the encoder.
+    videoEncoder->setLoadControlEnabled(!qobject_cast<QPlatformVideoFrameInput *>(source));
+
     connect(videoEncoder, &EncoderThread::endOfSourceStream, this,
             &RecordingEngine::handleSourceEndOfStream);
 
@@ -254,6 +259,53 @@ void RecordingEngine::newTimeStamp(qint64 time)
     }
 }
 
+void RecordingEngine::updateVideoEncoderLoad(const VideoEncoder *encoder,
+                                             const EncoderLoadController::Statistics &statistics)
+{
+    qreal load = 0.;
+    qint64 droppedFrames = 0;
+
+    {
+        QMutexLocker locker(&m_encoderLoadMutex);
+
+        auto found = std::find_if(m_videoEncoderLoads.begin(), m_videoEncoderLoads.end(),
+                                  [encoder](const auto &entry) { return entry.first == encoder; });
+        if (found != m_videoEncoderLoads.end())
+            found->second = statistics;
+        else
+            m_videoEncoderLoads.emplace_back(encoder, statistics);
+
+        for (const auto &[_, encoderStatistics] : m_videoEncoderLoads) {
+            load = std::max(load, encoderStatistics.load);
+            droppedFrames += encoderStatistics.droppedFrames;
+        }
+    }
+
+    emit encoderLoadChanged(load, droppedFrames);
+}
+
+QRecordingStatistics RecordingEngine::statistics() const
+{
+    auto result = std::make_unique<QRecordingStatisticsPrivate>();
+
+    for (const auto &encoder : m_videoEncoders) {
+        result->videoEncoderQueueLength =
+                std::max(result->videoEncoderQueueLength, encoder->queueLength());
+        result->videoEncoderQueueCapacity =
+                std::max(result->videoEncoderQueueCapacity, int(encoder->maxQueueSize()));
+    }
+
+    for (const auto &encoder : m_audioEncoders)
+        result->audioEncoderQueueLength =
+                std::max(result->audioEncoderQueueLength, encoder->queueLength());
+
+    result->muxerQueueLength = m_muxer->queueLength();
+    result->muxedPackets = m_muxer->writtenPackets();
+    result->muxedBytes = m_muxer->writtenBytes();
+
+    return result.release()->create();
+}
+
 bool RecordingEngine::isEndOfSourceStreams() const
 {
     return allOfEncoders(&EncoderThread::isEndOfSourceStream);
@@ -16,9 +16,11 @@
 
 #include "qffmpegthread_p.h"
 #include "qffmpegencodingformatcontext_p.h"
+#include "qffmpegencoderloadcontroller_p.h"
 
 #include <private/qplatformmediarecorder_p.h>
 #include <qmediarecorder.h>
+#include <qrecordingstatistics.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -69,6 +71,18 @@ public:
 
     bool isEndOfSourceStreams() const;
 
+    /** Accumulates load statistics of the video encoders and
+     *  emits encoderLoadChanged with the maximum load and the total number of dropped frames.
+     *  Thread-safe; invoked on the encoder threads.
+     */
+    void updateVideoEncoderLoad(const VideoEncoder *encoder,
+                                const EncoderLoadController::Statistics &statistics);
+
+    /** Takes a snapshot of the queue lengths and the muxer counters.
+     *  Must be invoked on the engine's thread before finalize.
+     */
+    QRecordingStatistics statistics() const;
+
 public Q_SLOTS:
     void newTimeStamp(qint64 time);
 
@@ -78,6 +92,7 @@ Q_SIGNALS:
     void streamInitializationError(QMediaRecorder::Error code, const QString &description);
     void finalizationDone();
     void autoStopped();
+    void encoderLoadChanged(qreal load, qint64 droppedVideoFrames);
 
 private:
     // Normal states transition, Stop is called upon Encoding,
@@ -143,6 +158,10 @@ private:
     QMutex m_timeMutex;
     qint64 m_timeRecorded = 0;
 
+    QMutex m_encoderLoadMutex;
+    std::vector<std::pair<const VideoEncoder *, EncoderLoadController::Statistics>>
+            m_videoEncoderLoads;
+
     bool m_autoStop = false;
     size_t m_initializedEncodersCount = 0;
     State m_state = State::None;
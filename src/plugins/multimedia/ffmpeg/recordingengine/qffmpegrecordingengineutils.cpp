@@ -10,6 +10,8 @@ QT_BEGIN_NAMESPACE
 
 namespace QFFmpeg {
 
+static QAtomicInteger<quint64> TraceId = 0;
+
 template <typename F>
 static void doWithMediaFrameInput(QObject *source, F &&f)
 {
@@ -58,6 +60,11 @@ void disconnectEncoderFromSource(EncoderThread *encoder)
     setEncoderInterface(source, nullptr);
 }
 
+quint64 nextTraceId()
+{
+    return TraceId.fetchAndAddRelaxed(1);
+}
+
 } // namespace QFFmpeg
 
 QT_END_NAMESPACE
@@ -74,6 +74,9 @@ void connectEncoderToSource(Encoder *encoder, Source *source)
 
 void disconnectEncoderFromSource(EncoderThread *encoder);
 
+// Returns sequential IDs identifying the objects of the recording engine in the trace points
+quint64 nextTraceId();
+
 } // namespace QFFmpeg
 
 QT_END_NAMESPACE
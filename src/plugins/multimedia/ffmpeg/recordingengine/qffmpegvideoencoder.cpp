@@ -73,24 +73,32 @@ void VideoEncoder::addFrame(const QVideoFrame &frame)
 
         // Drop frames if encoder can not keep up with the video source data rate;
         // canPushFrame might be used instead
-        const bool queueFull = m_videoFrameQueue.size() >= m_maxQueueSize;
-
-        if (queueFull) {
-            qCDebug(qLcFFmpegVideoEncoder) << "RecordingEngine frame queue full. Frame lost.";
+        if (!m_loadController.acceptFrame(m_videoFrameQueue.size())) {
+            qCDebug(qLcFFmpegVideoEncoder)
+                    << "RecordingEngine frame queue is full or decimated. Frame lost.";
             return;
         }
 
         m_videoFrameQueue.push({ frame, m_shouldAdjustTimeBaseForNextFrame });
         m_shouldAdjustTimeBaseForNextFrame = false;
+        setQueueLength(m_videoFrameQueue.size());
     }
 
     dataReady();
 }
 
+void VideoEncoder::setLoadControlEnabled(bool enabled)
+{
+    auto guard = lockLoopData();
+    m_loadController.setEnabled(enabled);
+}
+
 VideoEncoder::FrameInfo VideoEncoder::takeFrame()
 {
     auto guard = lockLoopData();
-    return dequeueIfPossible(m_videoFrameQueue);
+    FrameInfo result = dequeueIfPossible(m_videoFrameQueue);
+    setQueueLength(m_videoFrameQueue.size());
+    return result;
 }
 
 void VideoEncoder::retrievePackets()
@@ -147,6 +155,9 @@ void VideoEncoder::processOne()
 {
     Q_ASSERT(m_frameEncoder);
 
+    QElapsedTimer encodingTimer;
+    encodingTimer.start();
+
     retrievePackets();
 
     FrameInfo frameInfo = takeFrame();
@@ -220,10 +231,41 @@ void VideoEncoder::processOne()
     qCDebug(qLcFFmpegVideoEncoder)
             << ">>> sending frame" << avFrame->pts << time << m_lastFrameTime;
     int ret = m_frameEncoder->sendFrame(std::move(avFrame));
+    // the codec is full: drain its packets and resend the frames that it has kept
+    while (ret == AVERROR(EAGAIN)) {
+        retrievePackets();
+        ret = m_frameEncoder->sendPendingFrames();
+    }
+
     if (ret < 0) {
         qCDebug(qLcFFmpegVideoEncoder) << "error sending frame" << ret << err2str(ret);
         emit m_recordingEngine.sessionError(QMediaRecorder::ResourceError, err2str(ret));
     }
+
+    updateLoadStatistics(encodingTimer.nsecsElapsed() / 1000, endTime - startTime);
+}
+
+void VideoEncoder::updateLoadStatistics(qint64 encodingTimeUs, qint64 frameDurationUs)
+{
+    // Report not more often than every LoadReportIntervalMs unless the degradation level changes
+    constexpr qint64 LoadReportIntervalMs = 500;
+
+    EncoderLoadController::Statistics statistics;
+    {
+        auto guard = lockLoopData();
+        m_loadController.frameEncoded(encodingTimeUs, frameDurationUs, m_videoFrameQueue.size());
+        statistics = m_loadController.statistics();
+    }
+
+    const bool levelChanged =
+            statistics.degradationLevel != m_reportedLoadStatistics.degradationLevel;
+    if (!levelChanged && m_loadReportTimer.isValid()
+        && m_loadReportTimer.elapsed() < LoadReportIntervalMs)
+        return;
+
+    m_loadReportTimer.start();
+    m_reportedLoadStatistics = statistics;
+    m_recordingEngine.updateVideoEncoderLoad(this, statistics);
 }
 
 bool VideoEncoder::checkIfCanPushFrame() const
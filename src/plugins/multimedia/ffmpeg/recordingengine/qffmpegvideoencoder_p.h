@@ -15,9 +15,11 @@
 //
 
 #include "qffmpegencoderthread_p.h"
+#include "qffmpegencoderloadcontroller_p.h"
 #include "qffmpeg_p.h"
 #include "qffmpegvideoframeencoder_p.h"
 #include <qvideoframe.h>
+#include <qelapsedtimer.h>
 #include <queue>
 
 QT_BEGIN_NAMESPACE
@@ -37,6 +39,14 @@ public:
 
     void addFrame(const QVideoFrame &frame);
 
+    /*!
+        Enables frame rate decimation if the encoder falls behind the source.
+        Should be enabled only for live sources, which don't respect canPushFrame.
+     */
+    void setLoadControlEnabled(bool enabled);
+
+    size_t maxQueueSize() const { return m_maxQueueSize; }
+
 protected:
     bool checkIfCanPushFrame() const override;
 
@@ -57,11 +67,16 @@ private:
 
     std::pair<qint64, qint64> frameTimeStamps(const QVideoFrame &frame) const;
 
+    void updateLoadStatistics(qint64 encodingTimeUs, qint64 frameDurationUs);
+
 private:
     QMediaEncoderSettings m_settings;
     VideoFrameEncoder::SourceParams m_sourceParams;
     std::queue<FrameInfo> m_videoFrameQueue;
     const size_t m_maxQueueSize = 10; // Arbitrarily chosen to limit memory usage (332 MB @ 4K)
+    EncoderLoadController m_loadController{ m_maxQueueSize };
+    EncoderLoadController::Statistics m_reportedLoadStatistics;
+    QElapsedTimer m_loadReportTimer;
 
     VideoFrameEncoderUPtr m_frameEncoder;
     qint64 m_baseTime = 0;
@@ -6,9 +6,12 @@
 #include "qffmpegencoderoptions_p.h"
 #include "qffmpegvideoencoderutils_p.h"
 #include "qffmpegcodecstorage_p.h"
+#include "qffmpegrecordingengineutils_p.h"
 #include <qloggingcategory.h>
 #include <QtMultimedia/private/qmaybe_p.h>
 
+#include <qtmultimedia_ffmpeg_tracepoints_p.h>
+
 extern "C" {
 #include "libavutil/display.h"
 #include "libavutil/pixdesc.h"
@@ -18,6 +21,10 @@ QT_BEGIN_NAMESPACE
 
 Q_STATIC_LOGGING_CATEGORY(qLcVideoFrameEncoder, "qt.multimedia.ffmpeg.videoencoder");
 
+Q_TRACE_POINT(qtmultimedia_ffmpeg, QFFmpegVideoFrameEncoder_sendFrame_entry, quint64 encoder,
+              int streamIndex, qint64 ptsUs);
+Q_TRACE_POINT(qtmultimedia_ffmpeg, QFFmpegVideoFrameEncoder_sendFrame_exit);
+
 namespace QFFmpeg {
 
 namespace {
@@ -128,7 +135,8 @@ VideoFrameEncoder::VideoFrameEncoder(AVStream *stream, const Codec &codec, HWAcc
       m_accel(std::move(hwAccel)),
       m_sourceSize(sourceParams.size),
       m_sourceFormat(sourceParams.format),
-      m_sourceSWFormat(sourceParams.swFormat)
+      m_sourceSWFormat(sourceParams.swFormat),
+      m_traceId(nextTraceId())
 {
 }
 
@@ -371,27 +379,24 @@ struct FrameConverter
         return 0;
     }
 
-    void convert(SwsContext *scaleContext, AVPixelFormat format, const QSize &size)
+    int convert(SlicedScaler &scaler, AVFramePool &framePool)
     {
-        AVFrameUPtr scaledFrame = makeAVFrame();
-
-        scaledFrame->format = format;
-        scaledFrame->width = size.width();
-        scaledFrame->height = size.height();
-
-        av_frame_get_buffer(scaledFrame.get(), 0);
-
-        const AVFrame *srcFrame = currentFrame();
+        AVFrameUPtr scaledFrame = framePool.get();
+        if (!scaledFrame)
+            return AVERROR(ENOMEM);
 
-        const auto scaledHeight =
-                sws_scale(scaleContext, srcFrame->data, srcFrame->linesize, 0, srcFrame->height,
-                          scaledFrame->data, scaledFrame->linesize);
+        const auto scaledHeight = scaler.scale(*currentFrame(), *scaledFrame);
+        if (scaledHeight < 0) {
+            qCDebug(qLcVideoFrameEncoder) << "Error scaling frame" << err2str(scaledHeight);
+            return scaledHeight;
+        }
 
         if (scaledHeight != scaledFrame->height)
             qCWarning(qLcVideoFrameEncoder)
                     << "Scaled height" << scaledHeight << "!=" << scaledFrame->height;
 
         setFrame(std::move(scaledFrame));
+        return 0;
     }
 
     int uploadToHw(HWAccel *accel)
@@ -459,17 +464,34 @@ private:
 
 int VideoFrameEncoder::sendFrame(AVFrameUPtr inputFrame)
 {
+    // The pts is in the stream time base, like the one of the packets that the muxer writes;
+    // -1 for the flush
+    Q_TRACE_SCOPE(QFFmpegVideoFrameEncoder_sendFrame, m_traceId, m_stream->id,
+                  inputFrame ? traceTimeStampUs(inputFrame->pts, m_stream->time_base) : -1);
+
     if (!m_codecContext) {
         qWarning() << "codec context is not initialized!";
         return AVERROR(EINVAL);
     }
 
-    if (!inputFrame)
-        return avcodec_send_frame(m_codecContext.get(), nullptr); // Flush
+    return m_sendPipeline.sendFrame(std::move(inputFrame));
+}
 
-    if (!updateSourceFormatAndSize(inputFrame.get()))
+int VideoFrameEncoder::sendPendingFrames()
+{
+    if (!m_codecContext)
         return AVERROR(EINVAL);
 
+    return m_sendPipeline.sendPendingFrames();
+}
+
+bool VideoFrameEncoder::prepareConversion(const AVFrame &frame)
+{
+    return updateSourceFormatAndSize(&frame);
+}
+
+QMaybe<AVFrameUPtr, int> VideoFrameEncoder::convertFrame(AVFrameUPtr inputFrame)
+{
     FrameConverter converter{ std::move(inputFrame) };
 
     if (m_downloadFromHW) {
@@ -478,8 +500,11 @@ int VideoFrameEncoder::sendFrame(AVFrameUPtr inputFrame)
             return status;
     }
 
-    if (m_scaleContext)
-        converter.convert(m_scaleContext.get(), m_targetSWFormat, m_targetSize);
+    if (m_scaler) {
+        const int status = converter.convert(*m_scaler, m_scaledFramePool);
+        if (status != 0)
+            return status;
+    }
 
     if (m_uploadToHW) {
         const int status = converter.uploadToHw(m_accel.get());
@@ -487,16 +512,25 @@ int VideoFrameEncoder::sendFrame(AVFrameUPtr inputFrame)
             return status;
     }
 
-    const QMaybe<AVFrameUPtr, int> resultFrame = converter.takeResultFrame();
-    if (!resultFrame)
-        return resultFrame.error();
+    return converter.takeResultFrame();
+}
 
-    AVRational timeBase{};
-    int64_t pts{};
-    getAVFrameTime(*resultFrame.value(), pts, timeBase);
-    qCDebug(qLcVideoFrameEncoder) << "sending frame" << pts << "*" << timeBase;
+bool VideoFrameEncoder::canPipelineConversion() const
+{
+    // Hardware transfers stay on the encoder thread
+    return m_scaler && !m_downloadFromHW && !m_uploadToHW;
+}
 
-    return avcodec_send_frame(m_codecContext.get(), resultFrame.value().get());
+int VideoFrameEncoder::sendFrameToCodec(AVFrame *frame)
+{
+    if (frame) {
+        AVRational timeBase{};
+        int64_t pts{};
+        getAVFrameTime(*frame, pts, timeBase);
+        qCDebug(qLcVideoFrameEncoder) << "sending frame" << pts << "*" << timeBase;
+    }
+
+    return avcodec_send_frame(m_codecContext.get(), frame);
 }
 
 qint64 VideoFrameEncoder::estimateDuration(const AVPacket &packet, bool isFirstPacket)
@@ -623,7 +657,7 @@ void VideoFrameEncoder::updateConversions()
     const bool needToScale = m_sourceSize != m_targetSize;
     const bool zeroCopy = m_sourceFormat == m_targetFormat && !needToScale;
 
-    m_scaleContext.reset();
+    m_scaler.reset();
 
     if (zeroCopy) {
         m_downloadFromHW = false;
@@ -644,8 +678,12 @@ void VideoFrameEncoder::updateConversions()
 
         const int conversionType = getScaleConversionType(m_sourceSize, m_targetSize);
 
-        m_scaleContext = createSwsContext(m_sourceSize, m_sourceSWFormat, m_targetSize,
-                                          m_targetSWFormat, conversionType);
+        m_scaler = std::make_unique<SlicedScaler>(m_sourceSize, m_sourceSWFormat, m_targetSize,
+                                                  m_targetSWFormat, conversionType);
+        if (!m_scaler->isValid())
+            m_scaler.reset();
+
+        m_scaledFramePool.reset(m_targetSWFormat, m_targetSize);
     }
 
     qCDebug(qLcVideoFrameEncoder) << "VideoFrameEncoder conversions initialized:"
@@ -655,7 +693,7 @@ void VideoFrameEncoder::updateConversions()
                                   << (isHwPixelFormat(m_targetFormat) ? "(hw)" : "(sw)")
                                   << "sourceSWFormat:" << m_sourceSWFormat
                                   << "targetSWFormat:" << m_targetSWFormat
-                                  << "scaleContext:" << m_scaleContext.get();
+                                  << "scaleSlices:" << (m_scaler ? m_scaler->sliceCount() : 0);
 }
 
 } // namespace QFFmpeg
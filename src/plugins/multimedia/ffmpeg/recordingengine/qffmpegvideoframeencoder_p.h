@@ -15,8 +15,12 @@
 //
 
 #include "qffmpeghwaccel_p.h"
+#include "qffmpegframepool_p.h"
+#include "qffmpegframesendpipeline_p.h"
+#include "qffmpegslicedscaler_p.h"
 #include "private/qplatformmediarecorder_p.h"
 #include "private/qmultimediautils_p.h"
+#include "private/qmaybe_p.h"
 
 #include <unordered_set>
 
@@ -29,7 +33,7 @@ namespace QFFmpeg {
 class VideoFrameEncoder;
 using VideoFrameEncoderUPtr = std::unique_ptr<VideoFrameEncoder>;
 
-class VideoFrameEncoder
+class VideoFrameEncoder : private FrameSendPipeline::Delegate
 {
 public:
     struct SourceParams
@@ -58,7 +62,17 @@ public:
 
     const AVRational &getTimeBase() const;
 
+    /*!
+        Sends the frame to the codec. Software conversions are pipelined, so the frame
+        is converted asynchronously and sent to the codec upon the next call;
+        the returned status refers to the frames sent to the codec during this call.
+        A null frame flushes the pipeline and the codec.
+
+        If the codec returns AVERROR(EAGAIN), the frames that it hasn't accepted are kept;
+        retrieve the packets and call sendPendingFrames() before sending the next frame.
+     */
     int sendFrame(AVFrameUPtr inputFrame);
+    int sendPendingFrames();
     AVPacketUPtr retrievePacket();
 
 private:
@@ -72,6 +86,12 @@ private:
 
     void updateConversions();
 
+    // FrameSendPipeline::Delegate
+    bool prepareConversion(const AVFrame &frame) override;
+    bool canPipelineConversion() const override;
+    QMaybe<AVFrameUPtr, int> convertFrame(AVFrameUPtr inputFrame) override;
+    int sendFrameToCodec(AVFrame *frame) override;
+
     struct CreationResult
     {
         VideoFrameEncoderUPtr encoder;
@@ -108,7 +128,8 @@ private:
 
     qint64 m_lastPacketTime = AV_NOPTS_VALUE;
     AVCodecContextUPtr m_codecContext;
-    SwsContextUPtr m_scaleContext;
+    SlicedScalerUPtr m_scaler;
+    AVFramePool m_scaledFramePool;
     AVPixelFormat m_sourceFormat = AV_PIX_FMT_NONE;
     AVPixelFormat m_sourceSWFormat = AV_PIX_FMT_NONE;
     AVPixelFormat m_targetFormat = AV_PIX_FMT_NONE;
@@ -120,6 +141,12 @@ private:
 
     int64_t m_prevPacketDts = AV_NOPTS_VALUE;
     int64_t m_packetDtsOffset = 0;
+
+    // The next frame is converted on the thread of the pipeline while the codec is
+    // encoding the previous one. Declared after the conversions, so that it's
+    // destroyed, waiting for the running conversion, before them.
+    FrameSendPipeline m_sendPipeline{ *this };
+    const quint64 m_traceId;
 };
 } // namespace QFFmpeg
 
@@ -18,6 +18,7 @@
 #include <qgstreamerformatinfo_p.h>
 
 #include <QtMultimedia/qaudiodevice.h>
+#include <QtMultimedia/private/qplaybackstatistics_p.h>
 #include <QtCore/qdebug.h>
 #include <QtCore/qiodevice.h>
 #include <QtCore/qloggingcategory.h>
@@ -782,6 +783,49 @@ bool QGstreamerMediaPlayer::pitchCompensation() const
     return true;
 }
 
+QPlaybackStatistics QGstreamerMediaPlayer::statistics() const
+{
+    if (!hasMedia() || isCustomSource())
+        return {};
+
+    auto result = std::make_unique<QPlaybackStatisticsPrivate>();
+
+    // The queues of playbin answer the buffering query in the time format
+    // if the demuxer knows the positions of the packets
+    QGstQueryHandle query{
+        gst_query_new_buffering(GST_FORMAT_TIME),
+        QGstQueryHandle::HasRef,
+    };
+    if (gst_element_query(m_playbin.element(), query.get())) {
+        GstFormat format = GST_FORMAT_UNDEFINED;
+        gint64 stop = -1;
+        gst_query_parse_buffering_range(query.get(), &format, nullptr, &stop, nullptr);
+
+        const GstClockTime position = gst_play_get_position(m_gstPlay.get());
+        if (format == GST_FORMAT_TIME && stop >= 0 && GST_CLOCK_TIME_IS_VALID(position)
+            && GstClockTime(stop) > position)
+            result->bufferedDuration = (GstClockTime(stop) - position) / GST_USECOND;
+    }
+
+    // GstBaseSink counts the rendered buffers in its "stats" property
+    QGstreamerVideoSink *videoSink = gstVideoOutput->gstreamerVideoSink();
+    QGstElement renderingSink = videoSink ? videoSink->renderingSink() : QGstElement{};
+    if (renderingSink && GST_IS_BASE_SINK(renderingSink.element())) {
+        GstStructure *stats = nullptr;
+        g_object_get(renderingSink.object(), "stats", &stats, nullptr);
+        QUniqueGstStructureHandle statsHandle{ stats };
+
+        guint64 rendered = 0;
+        if (stats && gst_structure_get_uint64(stats, "rendered", &rendered))
+            result->renderedVideoFrames = qint64(rendered);
+    }
+
+    if (videoSink)
+        result->droppedVideoFrames = qint64(videoSink->droppedFrameCount());
+
+    return result.release()->create();
+}
+
 QPlatformMediaPlayer::PitchCompensationAvailability
 QGstreamerMediaPlayer::pitchCompensationAvailability() const
 {
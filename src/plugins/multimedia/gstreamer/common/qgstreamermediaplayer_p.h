@@ -88,6 +88,8 @@ public:
     PitchCompensationAvailability pitchCompensationAvailability() const override;
     bool pitchCompensation() const override;
 
+    QPlaybackStatistics statistics() const override;
+
 private:
     QGstreamerMediaPlayer(QGstreamerVideoOutput *videoOutput, QMediaPlayer *parent);
 
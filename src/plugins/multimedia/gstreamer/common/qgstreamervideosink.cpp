@@ -41,6 +41,9 @@ QGstreamerVideoSink::QGstreamerVideoSink(QVideoSink *parent)
       },
       m_sinkBin{
           QGstBin::create("videoSinkBin"),
+      },
+      m_latestFrameOnly{
+          qEnvironmentVariableIntValue("QT_GSTREAMER_LATEST_VIDEO_FRAME_ONLY") > 0,
       }
 {
     // This is a hack for some iMX and NVidia platforms. These require the use of a special video
@@ -150,6 +153,12 @@ void QGstreamerVideoSink::setActive(bool isActive)
         m_gstQtSink.setActive(isActive);
 }
 
+quint64 QGstreamerVideoSink::droppedFrameCount() const
+{
+    return m_droppedFrameCountOfOldSinks
+            + (m_gstQtSink ? m_gstQtSink.droppedBufferCount() : 0);
+}
+
 void QGstreamerVideoSink::setAsync(bool isAsync)
 {
     m_sinkIsAsync = isAsync;
@@ -166,6 +175,7 @@ void QGstreamerVideoSink::setRhi(QRhi *rhi)
     updateGstContexts();
     if (m_gstQtSink) {
         QGstVideoRendererSinkElement oldSink = std::move(m_gstQtSink);
+        m_droppedFrameCountOfOldSinks += oldSink.droppedBufferCount();
 
         // force creation of a new sink with proper caps.
         createQtSink();
@@ -181,6 +191,7 @@ void QGstreamerVideoSink::createQtSink()
     if (!m_sinkIsAsync)
         m_gstQtSink.set("async", false);
     m_gstQtSink.setActive(m_isActive);
+    m_gstQtSink.setLatestFrameOnly(m_latestFrameOnly);
 }
 
 void QGstreamerVideoSink::updateSinkElement(QGstVideoRendererSinkElement newSink)
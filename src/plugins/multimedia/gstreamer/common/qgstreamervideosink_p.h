@@ -36,6 +36,9 @@ public:
 
     QGstElement gstSink();
 
+    // The element rendering the frames inside of gstSink(), null until gstSink() is called
+    QGstElement renderingSink() const { return m_gstVideoSink; }
+
     GstContext *gstGlDisplayContext() const { return m_gstGlDisplayContext.get(); }
     GstContext *gstGlLocalContext() const { return m_gstGlLocalContext.get(); }
     Qt::HANDLE eglDisplay() const { return m_eglDisplay; }
@@ -44,6 +47,9 @@ public:
     void setActive(bool);
     void setAsync(bool);
 
+    // The frames replaced in the latest-frame-only mode, see QT_GSTREAMER_LATEST_VIDEO_FRAME_ONLY
+    quint64 droppedFrameCount() const;
+
 Q_SIGNALS:
     void aboutToBeDestroyed();
 
@@ -63,6 +69,9 @@ private:
     QRhi *m_rhi = nullptr;
     bool m_isActive = true;
     bool m_sinkIsAsync = true;
+    // Only present the newest frame, replacing the frames the GUI thread hasn't picked up yet
+    const bool m_latestFrameOnly = false;
+    quint64 m_droppedFrameCountOfOldSinks = 0;
 
     Qt::HANDLE m_eglDisplay = nullptr;
     QFunctionPointer m_eglImageTargetTexture2D = nullptr;
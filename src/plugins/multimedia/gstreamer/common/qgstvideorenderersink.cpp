@@ -21,6 +21,7 @@
 
 #include <gst/video/video.h>
 #include <gst/video/gstvideometa.h>
+#include <gst/video/gstvideopool.h>
 
 
 #if QT_CONFIG(gstreamer_gl)
@@ -39,7 +40,8 @@ Q_STATIC_LOGGING_CATEGORY(qLcGstVideoRenderer, "qt.multimedia.gstvideorenderer")
 QT_BEGIN_NAMESPACE
 
 QGstVideoRenderer::QGstVideoRenderer(QGstreamerVideoSink *sink)
-    : m_sink(sink), m_surfaceCaps(createSurfaceCaps(sink))
+    : m_sink(sink),
+      m_surfaceCaps(createSurfaceCaps(sink))
 {
     QObject::connect(
             sink, &QGstreamerVideoSink::aboutToBeDestroyed, this,
@@ -117,8 +119,8 @@ QT_WARNING_DISABLE_GCC("-Wswitch") // case value not in enumerated type ‘QEven
 
     switch (event->type()) {
     case renderFramesEvent: {
-        // LATER: we currently show every frame. however it may be reasonable to drop frames
-        // here if the queue contains more than one frame
+        // By default, we show every frame. In the latest-only mode, the queue
+        // contains at most one frame, see render().
         while (std::optional<RenderBufferState> nextState = m_bufferQueue.dequeue())
             handleNewBuffer(std::move(*nextState));
         return;
@@ -189,13 +191,61 @@ void QGstVideoRenderer::unlock()
     qCDebug(qLcGstVideoRenderer) << "QGstVideoRenderer::unlock";
 }
 
-bool QGstVideoRenderer::proposeAllocation(GstQuery *)
+bool QGstVideoRenderer::proposeAllocation(GstQuery *query)
 {
     qCDebug(qLcGstVideoRenderer) << "QGstVideoRenderer::proposeAllocation";
+
+    GstCaps *rawCaps = nullptr;
+    gboolean needPool = false;
+    gst_query_parse_allocation(query, &rawCaps, &needPool);
+    if (!rawCaps)
+        return false;
+
+    // We map frames via gst_video_frame_map, which respects the strides and offsets of
+    // GstVideoMeta, so upstream is free to pad or crop the buffers.
+    gst_query_add_allocation_meta(query, GST_VIDEO_META_API_TYPE, nullptr);
+    gst_query_add_allocation_meta(query, GST_VIDEO_CROP_META_API_TYPE, nullptr);
+
+    const QGstCaps caps(rawCaps, QGstCaps::NeedsRef);
+
+    // GL textures and dmabufs are allocated by the upstream element
+    if (caps.memoryFormat() != QGstCaps::CpuMemory)
+        return true;
+
+    const auto formatAndVideoInfo = caps.formatAndVideoInfo();
+    if (!formatAndVideoInfo)
+        return false;
+
+    const GstVideoInfo &info = formatAndVideoInfo->second;
+    const guint size = GST_VIDEO_INFO_SIZE(&info);
+
+    // The buffer being rendered, the one pending in the queue and the one being
+    // decoded. Buffers return to the pool once the last QVideoFrame referring to
+    // them is destroyed, so the pool grows on demand if frames are retained longer.
+    constexpr guint minBuffers = 3;
+
+    if (needPool) {
+        GstBufferPool *pool = gst_video_buffer_pool_new();
+        GstStructure *config = gst_buffer_pool_get_config(pool);
+        gst_buffer_pool_config_set_params(config, rawCaps, size, minBuffers, 0);
+        gst_buffer_pool_config_add_option(config, GST_BUFFER_POOL_OPTION_VIDEO_META);
+
+        if (!gst_buffer_pool_set_config(pool, config)) {
+            qCWarning(qLcGstVideoRenderer) << "Failed to configure the video buffer pool";
+            gst_object_unref(pool);
+            return false;
+        }
+
+        gst_query_add_allocation_pool(query, pool, size, minBuffers, 0);
+        gst_object_unref(pool);
+    } else {
+        gst_query_add_allocation_pool(query, nullptr, size, minBuffers, 0);
+    }
+
     return true;
 }
 
-GstFlowReturn QGstVideoRenderer::render(GstBuffer *buffer)
+GstFlowReturn QGstVideoRenderer::render(GstBaseSink *sink, GstBuffer *buffer)
 {
     qCDebug(qLcGstVideoRenderer) << "QGstVideoRenderer::render";
 
@@ -225,14 +275,99 @@ GstFlowReturn QGstVideoRenderer::render(GstBuffer *buffer)
 
     qCDebug(qLcGstVideoRenderer) << "    sending video frame";
 
-    qsizetype sizeOfQueue = m_bufferQueue.enqueue(std::move(state));
-    if (sizeOfQueue == 1)
-        // we only need to wake up, if we don't have a pending frame
-        QCoreApplication::postEvent(this, new QEvent(renderFramesEvent));
+    ++m_renderedBufferCount;
+
+    if (deliverBufferDirectly(state))
+        return GST_FLOW_OK;
+
+    if (m_latestFrameOnly.load(std::memory_order_relaxed)) {
+        const qsizetype droppedCount = m_bufferQueue.replaceAll(std::move(state));
+        if (droppedCount > 0)
+            reportDroppedBuffers(sink, droppedCount);
+        else
+            QCoreApplication::postEvent(this, new QEvent(renderFramesEvent));
+    } else {
+        qsizetype sizeOfQueue = m_bufferQueue.enqueue(std::move(state));
+        if (sizeOfQueue == 1)
+            // we only need to wake up, if we don't have a pending frame
+            QCoreApplication::postEvent(this, new QEvent(renderFramesEvent));
+    }
+
+    m_pendingBufferPts = GST_BUFFER_PTS(buffer);
+    m_pendingBufferDuration = GST_BUFFER_DURATION(buffer);
+    m_pendingBufferQueueTime = gst_util_get_timestamp();
 
     return GST_FLOW_OK;
 }
 
+void QGstVideoRenderer::reportDroppedBuffers(GstBaseSink *sink, qsizetype droppedCount)
+{
+    const quint64 totalDroppedCount =
+            m_droppedBufferCount.fetch_add(droppedCount, std::memory_order_relaxed) + droppedCount;
+
+    qCDebug(qLcGstVideoRenderer) << "    dropped" << droppedCount
+                                 << "video frame(s) not picked up in time; total:"
+                                 << totalDroppedCount;
+
+    if (!GST_CLOCK_TIME_IS_VALID(m_pendingBufferPts)
+        || !GST_CLOCK_TIME_IS_VALID(m_pendingBufferQueueTime))
+        return;
+
+    // While the qt thread is stalled, every buffer replaces the previous one. The drops are
+    // reported at most once per interval, the QoS message carries the accumulated totals.
+    const GstClockTime now = gst_util_get_timestamp();
+    if (!m_qosReportThrottle.isReportDue(now))
+        return;
+
+    // The dropped buffer is late by the time it has been waiting for the qt thread.
+    // Decoders skip decoding of the frames until timestamp + 2 * lateness.
+    const GstClockTimeDiff lateness = GST_CLOCK_DIFF(m_pendingBufferQueueTime, now);
+    const GstClockTime runningTime =
+            gst_segment_to_running_time(&sink->segment, GST_FORMAT_TIME, m_pendingBufferPts);
+    if (!GST_CLOCK_TIME_IS_VALID(runningTime))
+        return;
+
+    m_qosReportThrottle.setReported(now);
+
+    double proportion = 1.;
+    if (GST_CLOCK_TIME_IS_VALID(m_pendingBufferDuration) && m_pendingBufferDuration > 0)
+        proportion = std::max(1., double(lateness + m_pendingBufferDuration)
+                                          / double(m_pendingBufferDuration));
+
+    gst_pad_push_event(GST_BASE_SINK_PAD(sink),
+                       gst_event_new_qos(GST_QOS_TYPE_OVERFLOW, proportion, lateness, runningTime));
+
+    GstMessage *message = gst_message_new_qos(GST_OBJECT_CAST(sink), /*live=*/FALSE, runningTime,
+                                              gst_segment_to_stream_time(&sink->segment,
+                                                                         GST_FORMAT_TIME,
+                                                                         m_pendingBufferPts),
+                                              m_pendingBufferPts, m_pendingBufferDuration);
+    gst_message_set_qos_values(message, lateness, proportion, /*quality=*/1000000);
+    gst_message_set_qos_stats(message, GST_FORMAT_BUFFERS, m_renderedBufferCount - totalDroppedCount,
+                              totalDroppedCount);
+    gst_element_post_message(GST_ELEMENT_CAST(sink), message);
+}
+
+bool QGstVideoRenderer::deliverBufferDirectly(const RenderBufferState &state)
+{
+    // GL textures and dmabufs have to be handed over to the qt thread
+    if (state.memoryFormat != QGstCaps::CpuMemory || !m_isActive)
+        return false;
+
+    // holding the lock keeps the sink alive while the frame callback is running
+    QMutexLocker locker(&m_sinkMutex);
+    if (!m_sink || !m_sink->hasFrameCallback())
+        return false;
+
+    auto videoBuffer = std::make_unique<QGstVideoBuffer>(state.buffer, m_videoInfo, m_sink,
+                                                         state.format, state.memoryFormat);
+    QVideoFrame frame = QVideoFramePrivate::createFrame(std::move(videoBuffer), state.format);
+    QGstUtils::setFrameTimeStampsFromBuffer(&frame, state.buffer.get());
+
+    qCDebug(qLcGstVideoRenderer) << "    delivering video frame directly";
+    return m_sink->deliverVideoFrameDirectly(frame);
+}
+
 bool QGstVideoRenderer::query(GstQuery *query)
 {
 #if QT_CONFIG(gstreamer_gl)
@@ -292,6 +427,11 @@ void QGstVideoRenderer::setActive(bool isActive)
         updateCurrentVideoFrame({});
 }
 
+void QGstVideoRenderer::setLatestFrameOnly(bool latestFrameOnly)
+{
+    m_latestFrameOnly.store(latestFrameOnly, std::memory_order_relaxed);
+}
+
 void QGstVideoRenderer::updateCurrentVideoFrame(QVideoFrame frame)
 {
     m_currentVideoFrame = std::move(frame);
@@ -503,7 +643,7 @@ gboolean QGstVideoRendererSink::unlock(GstBaseSink *base)
 GstFlowReturn QGstVideoRendererSink::show_frame(GstVideoSink *base, GstBuffer *buffer)
 {
     VO_SINK(base);
-    return sink->renderer->render(buffer);
+    return sink->renderer->render(GST_BASE_SINK_CAST(base), buffer);
 }
 
 gboolean QGstVideoRendererSink::query(GstBaseSink *base, GstQuery *query)
@@ -536,6 +676,16 @@ void QGstVideoRendererSinkElement::setActive(bool isActive)
     qGstVideoRendererSink()->renderer->setActive(isActive);
 }
 
+void QGstVideoRendererSinkElement::setLatestFrameOnly(bool latestFrameOnly)
+{
+    qGstVideoRendererSink()->renderer->setLatestFrameOnly(latestFrameOnly);
+}
+
+quint64 QGstVideoRendererSinkElement::droppedBufferCount() const
+{
+    return qGstVideoRendererSink()->renderer->droppedBufferCount();
+}
+
 QGstVideoRendererSink *QGstVideoRendererSinkElement::qGstVideoRendererSink() const
 {
     return reinterpret_cast<QGstVideoRendererSink *>(element());
@@ -25,6 +25,8 @@
 #include <QtCore/qqueue.h>
 #include <QtCore/qwaitcondition.h>
 
+#include <atomic>
+
 #include <gst/video/gstvideosink.h>
 #include <gst/video/video.h>
 
@@ -46,6 +48,16 @@ public:
         return queue.size();
     }
 
+    // Replaces all the queued values with the given one; returns the number of replaced values
+    qsizetype replaceAll(T value)
+    {
+        QMutexLocker locker(&mutex);
+        const qsizetype replacedCount = queue.size();
+        queue.clear();
+        queue.append(std::move(value));
+        return replacedCount;
+    }
+
     std::optional<T> dequeue()
     {
         QMutexLocker locker(&mutex);
@@ -66,6 +78,24 @@ private:
     QList<T> queue;
 };
 
+// Limits the QoS reports about dropped buffers to one per interval
+class QQosReportThrottle
+{
+public:
+    explicit QQosReportThrottle(GstClockTime interval) : m_interval(interval) { }
+
+    bool isReportDue(GstClockTime now) const
+    {
+        return !GST_CLOCK_TIME_IS_VALID(m_lastReportTime) || now - m_lastReportTime >= m_interval;
+    }
+
+    void setReported(GstClockTime now) { m_lastReportTime = now; }
+
+private:
+    const GstClockTime m_interval;
+    GstClockTime m_lastReportTime = GST_CLOCK_TIME_NONE;
+};
+
 } // namespace QGstUtils
 
 class QGstVideoRenderer : public QObject
@@ -85,6 +115,7 @@ class QGstVideoRenderer : public QObject
 
     static constexpr QEvent::Type renderFramesEvent = static_cast<QEvent::Type>(QEvent::User + 100);
     static constexpr QEvent::Type stopEvent = static_cast<QEvent::Type>(QEvent::User + 101);
+    static constexpr GstClockTime qosReportInterval = 100 * GST_MSECOND;
 
 public:
     explicit QGstVideoRenderer(QGstreamerVideoSink *);
@@ -96,15 +127,24 @@ public:
     void stop();
     void unlock();
     bool proposeAllocation(GstQuery *);
-    GstFlowReturn render(GstBuffer *);
+    GstFlowReturn render(GstBaseSink *, GstBuffer *);
     bool query(GstQuery *);
     void gstEvent(GstEvent *);
 
     void setActive(bool);
 
+    // In the latest-only mode, buffers not picked up by the qt thread yet are replaced
+    // by the newer ones, and upstream elements are notified about dropped buffers via QoS events,
+    // at most once per qosReportInterval.
+    void setLatestFrameOnly(bool);
+    quint64 droppedBufferCount() const { return m_droppedBufferCount.load(std::memory_order_relaxed); }
+
 private:
     void updateCurrentVideoFrame(QVideoFrame);
 
+    void reportDroppedBuffers(GstBaseSink *, qsizetype droppedCount);
+    bool deliverBufferDirectly(const RenderBufferState &);
+
     void notify();
     static QGstCaps createSurfaceCaps(QGstreamerVideoSink *);
 
@@ -125,14 +165,21 @@ private:
     QVideoFrameFormat m_format;
     GstVideoInfo m_videoInfo{};
     QGstCaps::MemoryFormat m_memoryFormat = QGstCaps::CpuMemory;
+    GstClockTime m_pendingBufferPts = GST_CLOCK_TIME_NONE;
+    GstClockTime m_pendingBufferDuration = GST_CLOCK_TIME_NONE;
+    GstClockTime m_pendingBufferQueueTime = GST_CLOCK_TIME_NONE;
+    QGstUtils::QQosReportThrottle m_qosReportThrottle{ qosReportInterval };
+    quint64 m_renderedBufferCount = 0;
 
     // --- only accessed from qt thread
     QVideoFrame m_currentPipelineFrame;
     QVideoFrame m_currentVideoFrame;
-    bool m_isActive{ false };
 
+    std::atomic_bool m_isActive{ false };
     QGstUtils::QConcurrentQueue<RenderBufferState> m_bufferQueue;
     bool m_flushing{ false };
+    std::atomic_bool m_latestFrameOnly{ false };
+    std::atomic<quint64> m_droppedBufferCount{ 0 };
 };
 
 class QGstVideoRendererSinkElement;
@@ -193,6 +240,8 @@ public:
     QGstVideoRendererSinkElement &operator=(QGstVideoRendererSinkElement &&) noexcept = default;
 
     void setActive(bool);
+    void setLatestFrameOnly(bool);
+    quint64 droppedBufferCount() const;
 
     QGstVideoRendererSink *qGstVideoRendererSink() const;
 };
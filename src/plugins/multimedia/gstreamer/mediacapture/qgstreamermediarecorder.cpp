@@ -10,6 +10,7 @@
 
 #include <QtMultimedia/private/qmediastoragelocation_p.h>
 #include <QtMultimedia/private/qplatformcamera_p.h>
+#include <QtMultimedia/private/qrecordingstatistics_p.h>
 #include <QtMultimedia/qaudiodevice.h>
 
 #include <QtCore/qdebug.h>
@@ -305,6 +306,8 @@ void QGstreamerMediaRecorder::record(QMediaEncoderSettings &settings)
             videoPauseControl.installOn(videoSink);
     }
 
+    m_fileSink = gstFileSink;
+
     QGstreamerMediaCaptureSession::RecorderElements recorder{
         std::move(gstEncodebin),
         std::move(gstFileSink),
@@ -361,6 +364,7 @@ void QGstreamerMediaRecorder::finalize()
     qCDebug(qLcMediaRecorder) << "finalize";
 
     m_session->finalizeRecorder();
+    m_fileSink = {};
     m_finalizing = false;
     stateChanged(QMediaRecorder::StoppedState);
 }
@@ -372,6 +376,21 @@ void QGstreamerMediaRecorder::setMetaData(const QMediaMetaData &metaData)
     m_metaData = metaData;
 }
 
+QRecordingStatistics QGstreamerMediaRecorder::statistics() const
+{
+    if (!m_fileSink)
+        return {};
+
+    auto result = std::make_unique<QRecordingStatisticsPrivate>();
+
+    // filesink answers the position query with the number of bytes written
+    gint64 bytes = 0;
+    if (gst_element_query_position(m_fileSink.element(), GST_FORMAT_BYTES, &bytes))
+        result->muxedBytes = bytes;
+
+    return result.release()->create();
+}
+
 QMediaMetaData QGstreamerMediaRecorder::metaData() const
 {
     return m_metaData;
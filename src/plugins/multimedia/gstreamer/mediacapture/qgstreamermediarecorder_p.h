@@ -45,6 +45,8 @@ public:
     void setMetaData(const QMediaMetaData &) override;
     QMediaMetaData metaData() const override;
 
+    QRecordingStatistics statistics() const override;
+
     void setCaptureSession(QPlatformMediaCaptureSession *session);
 
     void processBusMessage(const QGstreamerMessage &message);
@@ -73,6 +75,7 @@ private:
     QGstreamerMediaCaptureSession *m_session = nullptr;
     QMediaMetaData m_metaData;
     QTimer signalDurationChangedTimer;
+    QGstElement m_fileSink;
 
     bool m_finalizing = false;
 };
@@ -3,6 +3,8 @@
 #include "qambisonicdecoder_p.h"
 
 #include "qambisonicdecoderdata_p.h"
+#include <QtMultimedia/private/qaudiohelpers_p.h>
+#include <algorithm>
 #include <cmath>
 #include <qdebug.h>
 
@@ -265,11 +267,27 @@ void QAmbisonicDecoder::processBuffer(const float *input[], short *output, int n
 }
 
 void QAmbisonicDecoder::processBufferWithReverb(const float *input[], const float *reverb[2], short *output, int nSamples)
+{
+    // decode blocks of frames to float, and convert each block with saturation
+    constexpr int blockFrames = 64;
+    float block[blockFrames * 32]; // we can't support more than 32 channels from our API
+    for (int offset = 0; offset < nSamples; offset += blockFrames) {
+        const int frames = std::min(blockFrames, nSamples - offset);
+        decodeFrames(input, reverb, offset, frames, block);
+        QAudioHelperInternal::convertSamples(QSpan<const float>{ block, frames * outputChannels },
+                                             QSpan<qint16>{ output, frames * outputChannels });
+        output += frames * outputChannels;
+    }
+}
+
+void QAmbisonicDecoder::decodeFrames(const float *input[], const float *reverb[2], int offset,
+                                     int frames, float *output)
 {
     if (simpleDecoderFactors) {
-        for (int i = 0; i < nSamples; ++i) {
-            float o[4] = {};
+        for (int i = offset; i < offset + frames; ++i) {
+            float *o = output;
             for (int k = 0; k < outputChannels; ++k) {
+                o[k] = 0.f;
                 for (int j = 0; j < 4; ++j)
                     o[k] += simpleDecoderFactors[k*4 + j]*input[j][i];
             }
@@ -278,22 +296,19 @@ void QAmbisonicDecoder::processBufferWithReverb(const float *input[], const floa
                     o[k] += reverb[0][i]*reverbFactors[2*k] + reverb[1][i]*reverbFactors[2*k+1];
                 }
             }
-
-            for (int k = 0; k < outputChannels; ++k)
-                output[k] = static_cast<short>(o[k]*32768.);
             output += outputChannels;
         }
         return;
     }
 
-    //    qDebug() << "XXX" << inputChannels << outputChannels;
     const float *matrix_hi = decoderData->hf[level - 1];
     const float *matrix_lo = decoderData->lf[level - 1];
-    for (int i = 0; i < nSamples; ++i) {
+    for (int i = offset; i < offset + frames; ++i) {
         QAmbisonicDecoderFilter::Output buf[maxAmbisonicChannels];
         for (int j = 0; j < inputChannels; ++j)
             buf[j] = filters[j].next(input[j][i]);
-        float o[32] = {}; // we can't support more than 32 channels from our API
+        float *o = output;
+        std::fill_n(o, outputChannels, 0.f);
         for (int j = 0; j < inputChannels; ++j) {
             for (int k = 0; k < outputChannels; ++k)
                 o[k] += matrix_lo[k*inputChannels + j]*buf[j].lf + matrix_hi[k*inputChannels + j]*buf[j].hf;
@@ -303,11 +318,8 @@ void QAmbisonicDecoder::processBufferWithReverb(const float *input[], const floa
                 o[k] += reverb[0][i]*reverbFactors[2*k] + reverb[1][i]*reverbFactors[2*k+1];
             }
         }
-        for (int k = 0; k < outputChannels; ++k)
-            output[k] = static_cast<short>(o[k]*32768.);
         output += outputChannels;
     }
-
 }
 
 QT_END_NAMESPACE
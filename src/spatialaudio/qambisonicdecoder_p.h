@@ -53,6 +53,10 @@ public:
     static constexpr int maxAmbisonicChannels = 16;
     static constexpr int maxAmbisonicLevel = 3;
 private:
+    // decodes frames [offset, offset + frames) of the input into interleaved floats
+    void decodeFrames(const float *input[], const float *reverb[2], int offset, int frames,
+                      float *output);
+
     QAudioFormat::ChannelConfig channelConfig;
     AmbisonicLevel level = AmbisonicLevel1;
     int inputChannels = 0;
@@ -5,6 +5,7 @@
 #include <QDebug>
 #include "qaudiodecoder.h"
 
+#include <private/qaudiobatchdecoder_p.h>
 #include <private/mediafileselector_p.h>
 #include <private/mediabackendutils_p.h>
 
@@ -57,6 +58,9 @@ private slots:
     void invalidSource();
     void deviceTest();
     void play_emitsFormatError_whenMediaHasNoAudioTrack();
+    void startSynchronous_readsWholeFile_withoutEventLoop();
+    void seek_inSynchronousMode_readsFromRequestedPosition();
+    void batchDecoder_decodesAllSources_inSubmissionOrder();
 
 private:
     QUrl testFileUrl(const QString filePath);
@@ -962,6 +966,120 @@ void tst_QAudioDecoderBackend::play_emitsFormatError_whenMediaHasNoAudioTrack()
     QCOMPARE_EQ(decoder.error(), QAudioDecoder::Error::FormatError);
 }
 
+void tst_QAudioDecoderBackend::startSynchronous_readsWholeFile_withoutEventLoop()
+{
+    CHECK_SELECTED_URL(m_wavFile);
+
+    QAudioDecoder decoder;
+    decoder.setSource(*m_wavFile);
+
+    QSignalSpy formatSpy(&decoder, &QAudioDecoder::formatChanged);
+    QSignalSpy positionSpy(&decoder, &QAudioDecoder::positionChanged);
+    QSignalSpy durationSpy(&decoder, &QAudioDecoder::durationChanged);
+
+    if (!decoder.startSynchronous()) {
+        QCOMPARE(decoder.error(), QAudioDecoder::NotSupportedError);
+        QSKIP("Synchronous decoding is not supported by the backend");
+    }
+
+    QCOMPARE(decoder.position(), 0);
+    QCOMPARE_GT(decoder.duration(), 0);
+
+    // Test file is 44.1K 16bit mono, 44094 samples
+    const QAudioFormat format = decoder.audioFormat();
+    QCOMPARE(format.channelCount(), 1);
+    QCOMPARE(format.sampleRate(), testFileSampleRate);
+    QCOMPARE(format.sampleFormat(), QAudioFormat::Int16);
+
+    std::array<std::byte, 4000> data;
+    qint64 byteCount = 0;
+    qint64 bytesRead = 0;
+    while ((bytesRead = decoder.readInto(data)) > 0)
+        byteCount += bytesRead;
+
+    QCOMPARE(bytesRead, 0);
+    QCOMPARE(byteCount, testFileSampleCount * 2);
+    QCOMPARE(decoder.readInto(data), 0);
+    QCOMPARE(decoder.error(), QAudioDecoder::NoError);
+    QCOMPARE(decoder.position(), format.durationForFrames(testFileSampleCount) / 1000);
+
+    // the state is only reported by the accessors
+    QVERIFY(formatSpy.isEmpty());
+    QVERIFY(positionSpy.isEmpty());
+    QVERIFY(durationSpy.isEmpty());
+}
+
+void tst_QAudioDecoderBackend::seek_inSynchronousMode_readsFromRequestedPosition()
+{
+    CHECK_SELECTED_URL(m_wavFile);
+
+    QAudioDecoder decoder;
+    decoder.setSource(*m_wavFile);
+    if (!decoder.startSynchronous(100, 600))
+        QSKIP("Synchronous decoding is not supported by the backend");
+
+    const QAudioFormat format = decoder.audioFormat();
+    std::vector<std::byte> data(format.bytesForDuration(1'000'000));
+
+    // the range boundaries are rounded to whole frames
+    auto checkDuration = [&](qint64 bytes, qint64 durationUs) {
+        QCOMPARE_LE(qAbs(bytes - format.bytesForDuration(durationUs)), format.bytesPerFrame());
+    };
+
+    // the range is 500 ms long
+    checkDuration(decoder.readInto(data), 500'000);
+    QCOMPARE(decoder.readInto(data), 0);
+
+    QVERIFY(decoder.seek(400));
+    QCOMPARE(decoder.position(), 400);
+    checkDuration(decoder.readInto(data), 200'000);
+}
+
+void tst_QAudioDecoderBackend::batchDecoder_decodesAllSources_inSubmissionOrder()
+{
+    CHECK_SELECTED_URL(m_wavFile);
+
+    {
+        QAudioDecoder decoder;
+        decoder.setSource(*m_wavFile);
+        if (!decoder.startSynchronous())
+            QSKIP("Synchronous decoding is not supported by the backend");
+    }
+
+    const QList<QUrl> sources{ *m_wavFile, QUrl::fromLocalFile(TEST_INVALID_SOURCE), *m_wavFile,
+                               *m_wavFile, *m_wavFile, *m_wavFile };
+
+    QAudioBatchDecoder batchDecoder;
+    batchDecoder.setMaxConcurrency(3);
+    batchDecoder.setDeliveryOrder(QAudioBatchDecoder::DeliveryOrder::Submission);
+    // smaller than a single decoded file: the workers have to wait for the consumer
+    batchDecoder.setMaxPendingBytes(1024);
+
+    QSignalSpy finishedSpy(&batchDecoder, &QAudioBatchDecoder::finished);
+    batchDecoder.start(sources);
+    QVERIFY(batchDecoder.isRunning());
+
+    for (qsizetype i = 0; i < sources.size(); ++i) {
+        std::optional<QAudioBatchDecoder::Result> result =
+                batchDecoder.waitForResult(QDeadlineTimer(std::chrono::seconds(10)));
+        QVERIFY(result);
+        QCOMPARE(result->index, i);
+        QCOMPARE(result->source, sources[i]);
+
+        if (i == 1) {
+            QCOMPARE_NE(result->error, QAudioDecoder::NoError);
+            QVERIFY(!result->buffer.isValid());
+        } else {
+            QCOMPARE(result->error, QAudioDecoder::NoError);
+            QCOMPARE(result->buffer.sampleCount(), testFileSampleCount);
+        }
+    }
+
+    QVERIFY(!batchDecoder.isRunning());
+    QVERIFY(!batchDecoder.waitForResult(QDeadlineTimer(0)));
+    QTRY_COMPARE(finishedSpy.size(), 1);
+}
+
 QTEST_MAIN(tst_QAudioDecoderBackend)
 
 #include "tst_qaudiodecoderbackend.moc"
@@ -17,6 +17,8 @@
 
 #include <private/qmockiodevice_p.h>
 
+#include <atomic>
+
 #define AUDIO_BUFFER 192000
 
 using AudioSinkInitializer = bool (*)(QAudioSink &);
@@ -83,6 +85,10 @@ private slots:
     void volume_data();
     void volume();
 
+    void callback();
+    void callback_doesNotStart_whenSampleTypeMismatchesFormat();
+    void callback_isInvokedOnAudioThread_withBuffersWithinBufferSize();
+
     void stop_stopsAudioSink_whenInvokedUponFirstStateChange_data();
     void stop_stopsAudioSink_whenInvokedUponFirstStateChange();
 
@@ -1075,6 +1081,92 @@ void tst_QAudioSink::volume()
     QTRY_VERIFY(qRound(audioSink.volume() * 10.0f) == expectedInt);
 }
 
+void tst_QAudioSink::callback()
+{
+    const QAudioFormat format = testFormats.at(0);
+    QCOMPARE(format.sampleFormat(), QAudioFormat::Int16);
+
+    QAudioSink audioSink(audioDevice, format, this);
+
+    std::atomic_int callbackCount = 0;
+    std::atomic<qsizetype> samplesRequested = 0;
+    audioSink.start([&](QSpan<qint16> buffer) {
+        std::fill(buffer.begin(), buffer.end(), qint16(0));
+        samplesRequested += buffer.size();
+        ++callbackCount;
+    });
+
+    if (audioSink.state() == QtAudio::StoppedState && audioSink.error() == QtAudio::NoError)
+        QSKIP("The audio backend doesn't support the callback mode");
+
+    QCOMPARE(audioSink.error(), QtAudio::NoError);
+    QCOMPARE(audioSink.state(), QtAudio::ActiveState);
+
+    QTRY_VERIFY(callbackCount > 2);
+    QCOMPARE(samplesRequested.load() % format.channelCount(), qsizetype(0));
+    QTRY_VERIFY(audioSink.processedUSecs() > 0);
+
+    audioSink.stop();
+    QCOMPARE(audioSink.state(), QtAudio::StoppedState);
+
+    // the callback isn't invoked anymore after stop() has returned
+    const int callbackCountAfterStop = callbackCount;
+    QTest::qWait(50);
+    QCOMPARE(callbackCount.load(), callbackCountAfterStop);
+}
+
+void tst_QAudioSink::callback_doesNotStart_whenSampleTypeMismatchesFormat()
+{
+    const QAudioFormat format = testFormats.at(0);
+    QCOMPARE(format.sampleFormat(), QAudioFormat::Int16);
+
+    QAudioSink audioSink(audioDevice, format, this);
+
+    QTest::ignoreMessage(QtWarningMsg,
+                         QRegularExpression("the sample type of the callback doesn't match"));
+    audioSink.start([](QSpan<float>) {
+        QFAIL("The callback must not be invoked");
+    });
+
+    QCOMPARE(audioSink.state(), QtAudio::StoppedState);
+}
+
+void tst_QAudioSink::callback_isInvokedOnAudioThread_withBuffersWithinBufferSize()
+{
+    const QAudioFormat format = testFormats.at(0);
+    QCOMPARE(format.sampleFormat(), QAudioFormat::Int16);
+
+    QAudioSink audioSink(audioDevice, format, this);
+    audioSink.setBufferSize(format.bytesForDuration(20'000));
+
+    std::atomic_int callbackCount = 0;
+    std::atomic_bool calledOnOwnerThread = false;
+    std::atomic<qsizetype> maxBufferSize = 0;
+    audioSink.start([&](QSpan<qint16> buffer) {
+        std::fill(buffer.begin(), buffer.end(), qint16(0));
+        if (QThread::currentThread() == thread())
+            calledOnOwnerThread = true;
+        maxBufferSize = std::max(maxBufferSize.load(), buffer.size_bytes());
+        ++callbackCount;
+    });
+
+    if (audioSink.state() == QtAudio::StoppedState && audioSink.error() == QtAudio::NoError)
+        QSKIP("The audio backend doesn't support the callback mode");
+
+    QCOMPARE(audioSink.state(), QtAudio::ActiveState);
+
+    // the callback keeps being invoked while the owner thread is blocked
+    QThread::msleep(200);
+    QCOMPARE_GT(callbackCount.load(), 2);
+
+    QTRY_VERIFY(callbackCount > 10);
+    const qsizetype bufferSize = audioSink.bufferSize();
+    audioSink.stop();
+
+    QVERIFY(!calledOnOwnerThread);
+    QCOMPARE_LE(maxBufferSize.load(), bufferSize);
+}
+
 void tst_QAudioSink::stop_stopsAudioSink_whenInvokedUponFirstStateChange_data()
 {
     QTest::addColumn<AudioSinkInitializer>("initializer");
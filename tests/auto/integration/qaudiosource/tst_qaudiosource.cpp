@@ -17,6 +17,8 @@
 #include <private/mediabackendutils_p.h>
 #include <private/qmockiodevice_p.h>
 
+#include <atomic>
+
 #define RANGE_ERR 0.5
 
 template<typename T> inline bool qTolerantCompare(T value, T expected)
@@ -65,6 +67,9 @@ private slots:
 
     void stop_finishesPushMode_whenInvokedUponReadyReadSignal();
 
+    void callback();
+    void callback_doesNotStart_whenSampleTypeMismatchesFormat();
+
     void stop_stopsAudioSource_whenInvokedUponFirstStateChange_data();
     void stop_stopsAudioSource_whenInvokedUponFirstStateChange();
 
@@ -915,6 +920,54 @@ void tst_QAudioSource::stop_finishesPushMode_whenInvokedUponReadyReadSignal()
              "didn't transitions to StoppedState after close()");
 }
 
+void tst_QAudioSource::callback()
+{
+    const QAudioFormat format = testFormats.at(0);
+    QCOMPARE(format.sampleFormat(), QAudioFormat::Int16);
+
+    QAudioSource audioSource(audioDevice, format, this);
+
+    std::atomic_int callbackCount = 0;
+    std::atomic<qsizetype> samplesCaptured = 0;
+    audioSource.start([&](QSpan<const qint16> buffer) {
+        samplesCaptured += buffer.size();
+        ++callbackCount;
+    });
+
+    if (audioSource.state() == QtAudio::StoppedState && audioSource.error() == QtAudio::NoError)
+        QSKIP("The audio backend doesn't support the callback mode");
+
+    QCOMPARE(audioSource.error(), QtAudio::NoError);
+    QCOMPARE(audioSource.state(), QtAudio::ActiveState);
+
+    QTRY_VERIFY(callbackCount > 2);
+    QCOMPARE(samplesCaptured.load() % format.channelCount(), qsizetype(0));
+
+    audioSource.stop();
+    QCOMPARE(audioSource.state(), QtAudio::StoppedState);
+
+    // the callback isn't invoked anymore after stop() has returned
+    const int callbackCountAfterStop = callbackCount;
+    QTest::qWait(50);
+    QCOMPARE(callbackCount.load(), callbackCountAfterStop);
+}
+
+void tst_QAudioSource::callback_doesNotStart_whenSampleTypeMismatchesFormat()
+{
+    const QAudioFormat format = testFormats.at(0);
+    QCOMPARE(format.sampleFormat(), QAudioFormat::Int16);
+
+    QAudioSource audioSource(audioDevice, format, this);
+
+    QTest::ignoreMessage(QtWarningMsg,
+                         QRegularExpression("the sample type of the callback doesn't match"));
+    audioSource.start([](QSpan<const float>) {
+        QFAIL("The callback must not be invoked");
+    });
+
+    QCOMPARE(audioSource.state(), QtAudio::StoppedState);
+}
+
 void tst_QAudioSource::stop_stopsAudioSource_whenInvokedUponFirstStateChange_data()
 {
     QTest::addColumn<AudioSourceInitializer>("initializer");
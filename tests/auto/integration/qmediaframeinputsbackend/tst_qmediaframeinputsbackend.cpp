@@ -9,8 +9,11 @@
 #include <qsignalspy.h>
 #include <qmediarecorder.h>
 #include <qmediaplayer.h>
+#include <qimagecapture.h>
+#include <qvideosink.h>
 #include <private/capturesessionfixture_p.h>
 #include <private/qplatformmediaintegration_p.h>
+#include <private/qplatformvideoframeinput_p.h>
 #include <private/qplatformaudioresampler_p.h>
 #include <private/mediainfo_p.h>
 #include <private/testvideosink_p.h>
@@ -18,6 +21,9 @@
 #include <private/audiogenerationutils_p.h>
 #include <private/qcolorutil_p.h>
 
+#include <atomic>
+#include <memory>
+
 QT_BEGIN_NAMESPACE
 
 namespace {
@@ -144,6 +150,60 @@ AudioComparisonResult compareAudioData(QAudioBuffer actual, QAudioBuffer expecte
     return compareAudioData(toFloatSpan(actual), toFloatSpan(expected), format.channelCount());
 }
 
+// Creates a frame of red, green, blue and yellow quadrants, like ImagePattern::ColoredSquares,
+// in the given color space and range
+QVideoFrame createColoredSquaresFrame(QSize size, QVideoFrameFormat::PixelFormat pixelFormat,
+                                      QVideoFrameFormat::ColorSpace colorSpace,
+                                      QVideoFrameFormat::ColorRange colorRange)
+{
+    constexpr std::array<QRgb, 4> colors = { 0xFFFF0000, 0xFF00FF00, 0xFF0000FF, 0xFFFFFF00 };
+
+    QImage image(size, QImage::Format_ARGB32);
+    for (int y = 0; y < size.height(); ++y) {
+        for (int x = 0; x < size.width(); ++x) {
+            const int colorIndex = (x < size.width() / 2 ? 0 : 1) + (y < size.height() / 2 ? 0 : 2);
+            image.setPixel(x, y, colors[colorIndex]);
+        }
+    }
+
+    QVideoFrameFormat format(size, pixelFormat);
+    format.setColorSpace(colorSpace);
+    format.setColorRange(colorRange);
+    return QPlatformMediaIntegration::instance()->convertVideoFrame(QVideoFrame(image), format);
+}
+
+// Emits the frames from a thread of its own, like the cameras of the FFmpeg backend do
+class VideoSourceThread
+{
+public:
+    explicit VideoSourceThread(QVideoFrameInput &input)
+        : m_thread(QThread::create([this, source = input.platformVideoFrameInput()] {
+              const QVideoFrameFormat format({ 16, 8 }, QVideoFrameFormat::Format_RGBA8888);
+              while (!m_stop) {
+                  emit source->newVideoFrame(QVideoFrame(format));
+                  ++m_sentFrames;
+                  QThread::sleep(1ms);
+              }
+          }))
+    {
+        m_thread->start();
+    }
+
+    ~VideoSourceThread()
+    {
+        m_stop = true;
+        m_thread->wait();
+    }
+
+    QThread *thread() const { return m_thread.get(); }
+    int sentFrames() const { return m_sentFrames; }
+
+private:
+    std::atomic_bool m_stop = false;
+    std::atomic_int m_sentFrames = 0;
+    std::unique_ptr<QThread> m_thread;
+};
+
 } // namespace
 
 void tst_QMediaFrameInputsBackend::initTestCase()
@@ -454,6 +514,192 @@ void tst_QMediaFrameInputsBackend::
     QCOMPARE_EQ(f.readyToSendVideoFrame.size(), expectedSignalCount);
 }
 
+void tst_QMediaFrameInputsBackend::
+        imageCaptureSavesImagesInRequestOrder_whenVideoFrameInputSendsFrames_data()
+{
+    QTest::addColumn<QVideoFrameFormat::PixelFormat>("pixelFormat");
+    QTest::addColumn<QVideoFrameFormat::ColorSpace>("colorSpace");
+    QTest::addColumn<QVideoFrameFormat::ColorRange>("colorRange");
+    QTest::addColumn<QSize>("resolution");
+
+    // saved as it is
+    QTest::addRow("YUV420P, BT.601, full range")
+            << QVideoFrameFormat::Format_YUV420P << QVideoFrameFormat::ColorSpace_BT601
+            << QVideoFrameFormat::ColorRange_Full << QSize();
+    // converted to BT.601 full range YUV 4:2:0
+    QTest::addRow("YUV420P, BT.709, video range")
+            << QVideoFrameFormat::Format_YUV420P << QVideoFrameFormat::ColorSpace_BT709
+            << QVideoFrameFormat::ColorRange_Video << QSize();
+    QTest::addRow("NV12, BT.709, full range")
+            << QVideoFrameFormat::Format_NV12 << QVideoFrameFormat::ColorSpace_BT709
+            << QVideoFrameFormat::ColorRange_Full << QSize();
+    QTest::addRow("YUV420P, BT.601, full range, scaled")
+            << QVideoFrameFormat::Format_YUV420P << QVideoFrameFormat::ColorSpace_BT601
+            << QVideoFrameFormat::ColorRange_Full << QSize(80, 60);
+    // saved with QImageWriter
+    QTest::addRow("BGRA8888")
+            << QVideoFrameFormat::Format_BGRA8888 << QVideoFrameFormat::ColorSpace_Undefined
+            << QVideoFrameFormat::ColorRange_Unknown << QSize();
+}
+
+void tst_QMediaFrameInputsBackend::
+        imageCaptureSavesImagesInRequestOrder_whenVideoFrameInputSendsFrames()
+{
+    QSKIP_IF_NOT_FFMPEG("Image capture from QVideoFrameInput is only tested with FFmpeg");
+
+    QFETCH(const QVideoFrameFormat::PixelFormat, pixelFormat);
+    QFETCH(const QVideoFrameFormat::ColorSpace, colorSpace);
+    QFETCH(const QVideoFrameFormat::ColorRange, colorRange);
+    QFETCH(const QSize, resolution);
+
+    QTemporaryDir tempDir;
+    QVERIFY(tempDir.isValid());
+
+    const QSize frameSize(160, 120);
+    const QSize expectedSize = resolution.isValid() ? resolution : frameSize;
+    const QVideoFrame frame =
+            createColoredSquaresFrame(frameSize, pixelFormat, colorSpace, colorRange);
+    QVERIFY(frame.isValid());
+
+    QMediaCaptureSession session;
+    QVideoFrameInput videoInput;
+    // the frame input only sends frames if they have a destination
+    QVideoSink videoSink;
+    QImageCapture imageCapture;
+    imageCapture.setFileFormat(QImageCapture::JPEG);
+    imageCapture.setResolution(resolution);
+    session.setVideoFrameInput(&videoInput);
+    session.setVideoSink(&videoSink);
+    session.setImageCapture(&imageCapture);
+
+    // the spy receives imageCaptured, so the previews are built
+    QSignalSpy capturedSpy(&imageCapture, &QImageCapture::imageCaptured);
+    QSignalSpy savedSpy(&imageCapture, &QImageCapture::imageSaved);
+    QSignalSpy errorSpy(&imageCapture, &QImageCapture::errorOccurred);
+
+    constexpr int shotCount = 3;
+    QList<int> requestedIds;
+    QStringList fileNames;
+    for (int i = 0; i < shotCount; ++i) {
+        QTRY_VERIFY(imageCapture.isReadyForCapture());
+
+        fileNames.push_back(tempDir.filePath(QStringLiteral("image%1.jpg").arg(i)));
+        const int id = imageCapture.captureToFile(fileNames.back());
+        QCOMPARE_GE(id, 0);
+        requestedIds.push_back(id);
+
+        QVERIFY(videoInput.sendVideoFrame(frame));
+    }
+
+    QTRY_COMPARE(savedSpy.size() + errorSpy.size(), shotCount);
+    if (!errorSpy.isEmpty())
+        QFAIL(qPrintable(errorSpy.front().at(2).toString()));
+    QCOMPARE(capturedSpy.size(), shotCount);
+
+    for (int i = 0; i < shotCount; ++i) {
+        QCOMPARE(capturedSpy.at(i).at(0).toInt(), requestedIds[i]);
+        QCOMPARE(capturedSpy.at(i).at(1).value<QImage>().size(), expectedSize);
+
+        QCOMPARE(savedSpy.at(i).at(0).toInt(), requestedIds[i]);
+        QCOMPARE(savedSpy.at(i).at(1).toString(), fileNames[i]);
+
+        const QImage image(fileNames[i]);
+        QVERIFY(!image.isNull());
+        QCOMPARE(image.size(), expectedSize);
+
+        const std::array<QColor, 4> colors = MediaInfo::sampleQuadrants(image);
+        QVERIFY(fuzzyCompare(colors[0], Qt::red));
+        QVERIFY(fuzzyCompare(colors[1], Qt::green));
+        QVERIFY(fuzzyCompare(colors[2], Qt::blue));
+        QVERIFY(fuzzyCompare(colors[3], Qt::yellow));
+    }
+}
+
+void tst_QMediaFrameInputsBackend::
+        videoSinkFrameCallback_isInvokedOnSourceThread_whenFrameCallbackIsSet()
+{
+    QSKIP_IF_NOT_FFMPEG("The direct frame delivery is only tested with FFmpeg");
+
+    QMediaCaptureSession session;
+    QVideoFrameInput videoInput;
+    QVideoSink videoSink;
+    session.setVideoFrameInput(&videoInput);
+    session.setVideoSink(&videoSink);
+
+    QSignalSpy frameChangedSpy(&videoSink, &QVideoSink::videoFrameChanged);
+    std::atomic<QThread *> callbackThread = nullptr;
+    std::atomic_int callCount = 0;
+    videoSink.setFrameCallback([&](const QVideoFrame &) {
+        callbackThread = QThread::currentThread();
+        ++callCount;
+    });
+
+    VideoSourceThread source(videoInput);
+    QTRY_VERIFY(callCount > 2);
+
+    QCOMPARE(callbackThread.load(), source.thread());
+    QVERIFY(videoSink.videoFrame().isValid());
+    QCOMPARE(frameChangedSpy.size(), 0);
+}
+
+void tst_QMediaFrameInputsBackend::videoSinkEmitsVideoFrameChanged_whenFrameCallbackIsCleared()
+{
+    QSKIP_IF_NOT_FFMPEG("The direct frame delivery is only tested with FFmpeg");
+
+    QMediaCaptureSession session;
+    QVideoFrameInput videoInput;
+    QVideoSink videoSink;
+    session.setVideoFrameInput(&videoInput);
+    session.setVideoSink(&videoSink);
+
+    std::atomic_int callCount = 0;
+    videoSink.setFrameCallback([&](const QVideoFrame &) { ++callCount; });
+
+    VideoSourceThread source(videoInput);
+    QTRY_VERIFY(callCount > 0);
+
+    QThread *signalThread = nullptr;
+    connect(&videoSink, &QVideoSink::videoFrameChanged, this,
+            [&] { signalThread = QThread::currentThread(); }, Qt::DirectConnection);
+
+    videoSink.setFrameCallback({});
+    const int callsAfterClearing = callCount;
+
+    // the frames are queued to the thread of the sink again
+    QTRY_COMPARE(signalThread, QThread::currentThread());
+    QCOMPARE(callCount, callsAfterClearing);
+}
+
+void tst_QMediaFrameInputsBackend::videoSinkCanBeDestroyed_whileSourceThreadDeliversFrames()
+{
+    QSKIP_IF_NOT_FFMPEG("The direct frame delivery is only tested with FFmpeg");
+
+    QMediaCaptureSession session;
+    QVideoFrameInput videoInput;
+    auto videoSink = std::make_unique<QVideoSink>();
+    session.setVideoFrameInput(&videoInput);
+    session.setVideoSink(videoSink.get());
+
+    std::atomic_int callCount = 0;
+    videoSink->setFrameCallback([&](const QVideoFrame &) {
+        ++callCount;
+        // keeps the callback running while the sink is destroyed
+        QThread::sleep(2ms);
+    });
+
+    VideoSourceThread source(videoInput);
+    QTRY_VERIFY(callCount > 0);
+
+    videoSink.reset();
+    QCOMPARE(session.videoSink(), nullptr);
+
+    // the source keeps sending frames, which don't reach the callback anymore
+    const int callsAfterDestruction = callCount;
+    const int sentFrames = source.sentFrames();
+    QTRY_VERIFY(source.sentFrames() > sentFrames + 2);
+    QCOMPARE(callCount, callsAfterDestruction);
+}
+
 QT_END_NAMESPACE
 
 QT_USE_NAMESPACE
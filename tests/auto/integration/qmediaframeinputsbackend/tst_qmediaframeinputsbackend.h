@@ -36,6 +36,13 @@ private slots:
     void readyToSendAudioBuffer_isEmittedRepeatedly_whenPullModeIsEnabled();
     void readyToSendAudioBufferAndVideoFrame_isEmittedRepeatedly_whenPullModeIsEnabled();
 
+    void imageCaptureSavesImagesInRequestOrder_whenVideoFrameInputSendsFrames_data();
+    void imageCaptureSavesImagesInRequestOrder_whenVideoFrameInputSendsFrames();
+
+    void videoSinkFrameCallback_isInvokedOnSourceThread_whenFrameCallbackIsSet();
+    void videoSinkEmitsVideoFrameChanged_whenFrameCallbackIsCleared();
+    void videoSinkCanBeDestroyed_whileSourceThreadDeliversFrames();
+
 };
 
 QT_END_NAMESPACE
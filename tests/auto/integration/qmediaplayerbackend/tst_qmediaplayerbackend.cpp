@@ -35,10 +35,13 @@
 #include <private/mediafileselector_p.h>
 #include <private/mediabackendutils_p.h>
 #include <private/qsequentialfileadaptor_p.h>
+#include <private/qvideothumbnailextractor_p.h>
+#include <private/qvideotexturehelper_p.h>
 #include <QtMultimedia/private/qtmultimedia-config_p.h>
 #include "private/qquickvideooutput_p.h"
 
 #include <array>
+#include <map>
 
 // NOLINTBEGIN(readability-convert-member-functions-to-static)
 
@@ -121,6 +124,7 @@ private slots:
 
     void setSourceAndPlay_setCorrectVideoSize_whenVideoHasNonStandardPixelAspectRatio_data();
     void setSourceAndPlay_setCorrectVideoSize_whenVideoHasNonStandardPixelAspectRatio();
+    void map_convertsSoftwareFrameOnce_whenVideoHasNonStandardPixelAspectRatio();
 
     void pause_doesNotChangePlayerState_whenInvalidFileLoaded();
     void pause_doesNothing_whenMediaIsNotLoaded();
@@ -237,6 +241,11 @@ private slots:
     void play_finishes_whenPlayingFileWithPacketsAfterStreamEnd_data();
     void play_finishes_whenPlayingFileWithPacketsAfterStreamEnd();
 
+    void statistics_reportsPipelineState_whenPlayingVideo();
+
+    void videoThumbnailExtractor_extractsThumbnailsOfAllSources_data();
+    void videoThumbnailExtractor_extractsThumbnailsOfAllSources();
+
     void makeStressTestCases();
     void stressTest_setupAndTeardown();
     void stressTest_setupAndTeardown_data();
@@ -1159,6 +1168,69 @@ void tst_QMediaPlayerBackend::
              1);
 }
 
+void tst_QMediaPlayerBackend::
+        map_convertsSoftwareFrameOnce_whenVideoHasNonStandardPixelAspectRatio()
+{
+    // The FFmpeg backend defers the scaling of the frames to their first mapping
+    QSKIP_IF_NOT_FFMPEG("This test is only for FFmpeg backend");
+    CHECK_SELECTED_URL(m_192x108_PAR_3_2_Video);
+
+    const QSize expectedVideoSize(192 * 3 / 2, 108);
+
+    m_fixture->player.setSource(*m_192x108_PAR_3_2_Video);
+    m_fixture->player.play();
+
+    QVideoFrame frame = m_fixture->surface.waitForFrame();
+    QVERIFY(frame.isValid());
+
+    const QVideoFrameFormat format = frame.surfaceFormat();
+    const auto *description = QVideoTextureHelper::textureDescription(format.pixelFormat());
+    QVERIFY(description);
+
+    QVERIFY(frame.map(QVideoFrame::ReadOnly));
+
+    QCOMPARE(frame.size(), expectedVideoSize);
+    QCOMPARE(frame.pixelFormat(), format.pixelFormat());
+    QCOMPARE(frame.planeCount(), description->nplanes);
+    QCOMPARE_GE(frame.bytesPerLine(0), expectedVideoSize.width() * description->strideFactor);
+    for (int plane = 0; plane < frame.planeCount(); ++plane) {
+        QVERIFY(frame.bits(plane));
+        QCOMPARE_GE(frame.mappedBytes(plane),
+                    frame.bytesPerLine(plane)
+                            * description->heightForPlane(expectedVideoSize.height(), plane));
+    }
+
+    uchar *convertedBits = frame.bits(0);
+    const int convertedBytesPerLine = frame.bytesPerLine(0);
+    frame.unmap();
+
+    // the converted frame is kept for the next mappings
+    QVERIFY(frame.map(QVideoFrame::ReadOnly));
+    QCOMPARE(frame.bits(0), convertedBits);
+    QCOMPARE(frame.bytesPerLine(0), convertedBytesPerLine);
+    frame.unmap();
+
+    // the color data comes from the decoded frame, not from the converted one
+    QCOMPARE(frame.surfaceFormat().colorSpace(), format.colorSpace());
+    QCOMPARE(frame.surfaceFormat().colorTransfer(), format.colorTransfer());
+    QCOMPARE(frame.surfaceFormat().colorRange(), format.colorRange());
+
+#ifdef Q_OS_ANDROID
+    QSKIP("frame.toImage will return null image because of QTBUG-108446");
+#endif
+
+    const QImage image = frame.toImage();
+    QCOMPARE(image.size(), expectedVideoSize);
+
+    const std::vector<QRgb> colors = { 0xFFFFFF, 0xFF0000, 0xFF00, 0xFF, 0x0 };
+    const auto pixelsOffset = 4;
+    const auto halfSize = expectedVideoSize / 2;
+
+    QCOMPARE(findSimilarColorIndex(colors, image.pixel(halfSize.width() - pixelsOffset, 0)), 0);
+    QCOMPARE(findSimilarColorIndex(colors, image.pixel(halfSize.width() + pixelsOffset, 0)), 1);
+    QCOMPARE(findSimilarColorIndex(colors, image.pixel(0, halfSize.height() + pixelsOffset)), 1);
+}
+
 void tst_QMediaPlayerBackend::pause_doesNotChangePlayerState_whenInvalidFileLoaded()
 {
     m_fixture->player.setSource({ "Some not existing media" });
@@ -4567,6 +4639,117 @@ void tst_QMediaPlayerBackend::play_finishes_whenPlayingFileWithPacketsAfterStrea
     QCOMPARE(loopIterations(m_fixture->positionChanged).size(), unsigned(loops));
 }
 
+void tst_QMediaPlayerBackend::statistics_reportsPipelineState_whenPlayingVideo()
+{
+    CHECK_SELECTED_URL(m_localVideoFile3ColorsWithSound);
+
+    QVERIFY(m_fixture->player.statistics().isNull());
+
+    m_fixture->player.setSource(*m_localVideoFile3ColorsWithSound);
+    m_fixture->player.play();
+
+    QTRY_VERIFY(!m_fixture->player.statistics().isNull());
+    QTRY_COMPARE_GT(m_fixture->player.statistics().renderedVideoFrames(), 0);
+
+    if (isGStreamerPlatform())
+        return; // gstreamer doesn't report the queues of the decoders
+
+    QTRY_COMPARE_GT(m_fixture->player.statistics().bufferedDuration(), 0);
+    QTRY_COMPARE_GT(m_fixture->player.statistics().bufferedBytes(), 0);
+
+    QTRY_COMPARE_GT(m_fixture->player.statistics().videoDecoderQueueCapacity(), 0);
+    QTRY_COMPARE_GT(m_fixture->player.statistics().audioDecoderQueueCapacity(), 0);
+
+    const QPlaybackStatistics statistics = m_fixture->player.statistics();
+    QCOMPARE_LE(statistics.videoDecoderQueueLength(), statistics.videoDecoderQueueCapacity());
+    QCOMPARE_LE(statistics.audioDecoderQueueLength(), statistics.audioDecoderQueueCapacity());
+
+    m_fixture->player.stop();
+    m_fixture->player.setSource({});
+    QVERIFY(m_fixture->player.statistics().isNull());
+}
+
+void tst_QMediaPlayerBackend::videoThumbnailExtractor_extractsThumbnailsOfAllSources_data()
+{
+    QTest::addColumn<bool>("keyFramesOnly");
+
+    QTest::addRow("key frames only") << true;
+    QTest::addRow("exact frames") << false;
+}
+
+void tst_QMediaPlayerBackend::videoThumbnailExtractor_extractsThumbnailsOfAllSources()
+{
+    using namespace std::chrono_literals;
+
+    QSKIP_IF_NOT_FFMPEG();
+    CHECK_SELECTED_URL(m_localVideoFile3ColorsWithSound);
+    CHECK_SELECTED_URL(m_192x108_PAR_3_2_Video);
+
+    QFETCH(bool, keyFramesOnly);
+
+    // Arrange
+    QVideoThumbnailExtractor::Settings settings;
+    settings.count = 3;
+    settings.size = QSize(144, 144);
+    settings.keyFramesOnly = keyFramesOnly;
+
+    QVideoThumbnailExtractor extractor;
+    extractor.setMaxConcurrency(2);
+    extractor.setSettings(settings);
+
+    const QList<QUrl> sources{ *m_localVideoFile3ColorsWithSound,
+                               QUrl("Some not existing media"), *m_192x108_PAR_3_2_Video };
+
+    QSignalSpy finishedSpy(&extractor, &QVideoThumbnailExtractor::finished);
+
+    // Act
+    extractor.start(sources);
+
+    std::map<qsizetype, QVideoThumbnailExtractor::Result> results;
+    for (qsizetype i = 0; i < sources.size(); ++i) {
+        std::optional<QVideoThumbnailExtractor::Result> result =
+                extractor.waitForResult(QDeadlineTimer(10s));
+        QVERIFY(result);
+        QCOMPARE(result->source, sources[result->index]);
+        results.emplace(result->index, std::move(*result));
+    }
+
+    // Assert
+    QVERIFY(!extractor.isRunning());
+    QTRY_COMPARE(finishedSpy.size(), 1);
+
+    // one color per second
+    const QVideoThumbnailExtractor::Result &colors = results[0];
+    QCOMPARE(colors.error, QMediaPlayer::NoError);
+    QCOMPARE(colors.thumbnails.size(), 3);
+    for (qsizetype i = 0; i < colors.thumbnails.size(); ++i) {
+        const QVideoThumbnailExtractor::Thumbnail &thumbnail = colors.thumbnails[i];
+        QCOMPARE_GT(thumbnail.requestedPosition, i * 1'000'000);
+        QCOMPARE_LT(thumbnail.requestedPosition, (i + 1) * 1'000'000);
+        QCOMPARE_LE(thumbnail.position, thumbnail.requestedPosition);
+        QVERIFY(!thumbnail.image.isNull());
+        QCOMPARE_LE(thumbnail.image.width(), 144);
+        QCOMPARE_LE(thumbnail.image.height(), 144);
+
+        if (!keyFramesOnly) {
+            QCOMPARE_GT(thumbnail.position, thumbnail.requestedPosition - 100'000);
+            QCOMPARE(findSimilarColorIndex(m_video3Colors, thumbnail.image.pixel(1, 1)),
+                     std::ptrdiff_t(i));
+        }
+    }
+
+    const QVideoThumbnailExtractor::Result &invalid = results[1];
+    QCOMPARE_NE(invalid.error, QMediaPlayer::NoError);
+    QVERIFY(invalid.thumbnails.isEmpty());
+
+    // 192x108 with the pixel aspect ratio 3:2 is presented as 288x108
+    const QVideoThumbnailExtractor::Result &par = results[2];
+    QCOMPARE(par.error, QMediaPlayer::NoError);
+    QCOMPARE(par.thumbnails.size(), 3);
+    for (const QVideoThumbnailExtractor::Thumbnail &thumbnail : par.thumbnails)
+        QCOMPARE(thumbnail.image.size(), QSize(144, 54));
+}
+
 void tst_QMediaPlayerBackend::makeStressTestCases()
 {
     QTest::addColumn<MaybeUrl>("media");
@@ -121,6 +121,8 @@ private slots:
 
     void record_reflectsAudioEncoderSetting();
 
+    void statistics_reportsPipelineState_whenRecording();
+
 private:
     QTemporaryDir m_tempDir;
 };
@@ -753,4 +755,29 @@ void tst_QMediaRecorderBackend::record_reflectsAudioEncoderSetting()
 
 QTEST_MAIN(tst_QMediaRecorderBackend)
 
+void tst_QMediaRecorderBackend::statistics_reportsPipelineState_whenRecording()
+{
+    QSKIP_IF_NOT_FFMPEG();
+
+    // Arrange
+    CaptureSessionFixture f{ StreamType::AudioAndVideo };
+    QVERIFY(f.m_recorder.statistics().isNull());
+
+    // Act
+    f.start(RunMode::Pull, AutoStop::No);
+    QTRY_COMPARE(f.m_recorder.recorderState(), QMediaRecorder::RecordingState);
+
+    // Assert
+    QTRY_COMPARE_GT(f.m_recorder.statistics().muxedPackets(), 0);
+    QTRY_COMPARE_GT(f.m_recorder.statistics().muxedBytes(), 0);
+
+    const QRecordingStatistics statistics = f.m_recorder.statistics();
+    QCOMPARE_GT(statistics.videoEncoderQueueCapacity(), 0);
+    QCOMPARE_LE(statistics.videoEncoderQueueLength(), statistics.videoEncoderQueueCapacity());
+
+    f.m_recorder.stop();
+    QVERIFY(f.waitForRecorderStopped(60s));
+    QVERIFY(f.m_recorder.statistics().isNull());
+}
+
 #include "tst_qmediarecorderbackend.moc"
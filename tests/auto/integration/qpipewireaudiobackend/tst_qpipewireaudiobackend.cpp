@@ -0,0 +1,256 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QtTest/QtTest>
+#include <QtCore/qbuffer.h>
+#include <QtCore/qprocess.h>
+#include <QtMultimedia/qaudiosink.h>
+#include <QtMultimedia/qaudiosource.h>
+#include <QtMultimedia/qmediadevices.h>
+#include <QtMultimedia/private/qplatformaudiodevices_p.h>
+#include <QtMultimedia/private/qplatformmediaintegration_p.h>
+
+#include <atomic>
+
+using namespace Qt::Literals;
+
+namespace {
+
+constexpr auto nullSinkName = "qt-test-null-sink"_L1;
+constexpr auto nullSourceName = "qt-test-null-source"_L1;
+
+QAudioFormat testFormat()
+{
+    QAudioFormat format;
+    format.setSampleRate(48000);
+    format.setChannelCount(2);
+    format.setSampleFormat(QAudioFormat::Int16);
+    return format;
+}
+
+QAudioDevice findDevice(const QList<QAudioDevice> &devices, QLatin1StringView nodeName)
+{
+    auto found = std::find_if(devices.begin(), devices.end(), [&](const QAudioDevice &device) {
+        return device.id() == nodeName;
+    });
+    return found != devices.end() ? *found : QAudioDevice{};
+}
+
+} // namespace
+
+// Runs the PipeWire sink and source against null nodes of a local PipeWire daemon, so that
+// the tests neither depend on the sound hardware nor make noise.
+class tst_QPipeWireAudioBackend : public QObject
+{
+    Q_OBJECT
+
+public:
+    static void initMain() { qputenv("QT_AUDIO_BACKEND", "pipewire"); }
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+
+    void sink_pushMode_consumesWrittenData();
+    void sink_pullMode_playsDeviceToEnd();
+    void sink_callbackMode_invokesCallbackOffTheOwnerThread();
+    void sink_callbackMode_setsOpenError_whenFormatIsInvalid();
+
+    void source_pullMode_providesCapturedData();
+    void source_callbackMode_invokesCallbackOffTheOwnerThread();
+
+private:
+    std::optional<int> createNullNode(QLatin1StringView nodeName, QLatin1StringView mediaClass);
+
+    QList<int> m_nodeIds;
+    QAudioDevice m_sinkDevice;
+    QAudioDevice m_sourceDevice;
+};
+
+void tst_QPipeWireAudioBackend::initTestCase()
+{
+    const QPlatformAudioDevices *audioDevices =
+            QPlatformMediaIntegration::instance()->audioDevices();
+    if (audioDevices->backendName() != "PipeWire"_L1)
+        QSKIP("The PipeWire audio backend is not available");
+
+    for (auto [nodeName, mediaClass] : { std::pair{ nullSinkName, "Audio/Sink"_L1 },
+                                         std::pair{ nullSourceName, "Audio/Source/Virtual"_L1 } }) {
+        const std::optional<int> nodeId = createNullNode(nodeName, mediaClass);
+        if (!nodeId)
+            QSKIP("Cannot create the null nodes with pw-cli");
+        m_nodeIds.append(*nodeId);
+    }
+
+    QTRY_VERIFY(!findDevice(QMediaDevices::audioOutputs(), nullSinkName).isNull());
+    QTRY_VERIFY(!findDevice(QMediaDevices::audioInputs(), nullSourceName).isNull());
+
+    m_sinkDevice = findDevice(QMediaDevices::audioOutputs(), nullSinkName);
+    m_sourceDevice = findDevice(QMediaDevices::audioInputs(), nullSourceName);
+}
+
+void tst_QPipeWireAudioBackend::cleanupTestCase()
+{
+    for (int nodeId : std::as_const(m_nodeIds))
+        QProcess::execute(u"pw-cli"_s, { u"destroy"_s, QString::number(nodeId) });
+}
+
+std::optional<int> tst_QPipeWireAudioBackend::createNullNode(QLatin1StringView nodeName,
+                                                             QLatin1StringView mediaClass)
+{
+    const QString properties = u"{ factory.name=support.null-audio-sink node.name=%1 "
+                               u"media.class=%2 object.linger=true audio.position=[ FL FR ] }"_s
+                                       .arg(nodeName, mediaClass);
+
+    QProcess process;
+    process.start(u"pw-cli"_s, { u"create-node"_s, u"adapter"_s, properties });
+    if (!process.waitForFinished() || process.exitCode() != 0)
+        return std::nullopt;
+
+    const QRegularExpressionMatch match =
+            QRegularExpression(u"id:?\\s*(\\d+)"_s).match(QString::fromUtf8(process.readAll()));
+    if (!match.hasMatch())
+        return std::nullopt;
+
+    return match.captured(1).toInt();
+}
+
+void tst_QPipeWireAudioBackend::sink_pushMode_consumesWrittenData()
+{
+    const QAudioFormat format = testFormat();
+    QAudioSink sink(m_sinkDevice, format);
+
+    QIODevice *device = sink.start();
+    QVERIFY(device);
+    QCOMPARE(sink.error(), QtAudio::NoError);
+
+    const QByteArray silence(format.bytesForDuration(10'000), '\0');
+    QElapsedTimer timer;
+    timer.start();
+    while (timer.elapsed() < 300) {
+        if (sink.bytesFree() >= silence.size())
+            QCOMPARE(device->write(silence), silence.size());
+        QTest::qWait(5);
+    }
+
+    QCOMPARE(sink.error(), QtAudio::NoError);
+    QCOMPARE_GT(sink.processedUSecs(), 100'000);
+
+    sink.stop();
+    QCOMPARE(sink.state(), QtAudio::StoppedState);
+}
+
+void tst_QPipeWireAudioBackend::sink_pullMode_playsDeviceToEnd()
+{
+    const QAudioFormat format = testFormat();
+    QAudioSink sink(m_sinkDevice, format);
+
+    QByteArray data(format.bytesForDuration(200'000), '\0');
+    QBuffer buffer(&data);
+    QVERIFY(buffer.open(QIODevice::ReadOnly));
+
+    sink.start(&buffer);
+    QCOMPARE(sink.state(), QtAudio::ActiveState);
+
+    // the sink enters the idle state without an error once the device has been consumed
+    QTRY_COMPARE(sink.state(), QtAudio::IdleState);
+    QCOMPARE(sink.error(), QtAudio::NoError);
+    QVERIFY(buffer.atEnd());
+    QTRY_COMPARE_GE(sink.processedUSecs(), 150'000);
+
+    sink.stop();
+}
+
+void tst_QPipeWireAudioBackend::sink_callbackMode_invokesCallbackOffTheOwnerThread()
+{
+    QAudioSink sink(m_sinkDevice, testFormat());
+
+    std::atomic_int callbackCount = 0;
+    std::atomic_bool calledOnOwnerThread = false;
+    sink.start([&](QSpan<qint16> buffer) {
+        std::fill(buffer.begin(), buffer.end(), qint16(0));
+        if (QThread::currentThread() == thread())
+            calledOnOwnerThread = true;
+        ++callbackCount;
+    });
+
+    QCOMPARE(sink.state(), QtAudio::ActiveState);
+    QCOMPARE(sink.error(), QtAudio::NoError);
+
+    // the graph keeps invoking the callback while the owner thread is blocked
+    QThread::msleep(200);
+    QCOMPARE_GT(callbackCount.load(), 2);
+
+    sink.stop();
+    QVERIFY(!calledOnOwnerThread);
+
+    const int callbackCountAfterStop = callbackCount;
+    QTest::qWait(50);
+    QCOMPARE(callbackCount.load(), callbackCountAfterStop);
+}
+
+void tst_QPipeWireAudioBackend::sink_callbackMode_setsOpenError_whenFormatIsInvalid()
+{
+    QAudioFormat format = testFormat();
+    format.setSampleRate(0);
+    QAudioSink sink(m_sinkDevice, format);
+
+    QTest::failOnWarning(QRegularExpression(u"callback mode is not supported"_s));
+    sink.start([](QSpan<qint16>) {
+        QFAIL("The callback must not be invoked");
+    });
+
+    QCOMPARE(sink.state(), QtAudio::StoppedState);
+    QCOMPARE(sink.error(), QtAudio::OpenError);
+}
+
+void tst_QPipeWireAudioBackend::source_pullMode_providesCapturedData()
+{
+    const QAudioFormat format = testFormat();
+    QAudioSource source(m_sourceDevice, format);
+
+    QIODevice *device = source.start();
+    QVERIFY(device);
+    QCOMPARE(source.error(), QtAudio::NoError);
+
+    qint64 bytesRead = 0;
+    QElapsedTimer timer;
+    timer.start();
+    while (bytesRead < format.bytesForDuration(100'000) && timer.elapsed() < 5000) {
+        bytesRead += device->readAll().size();
+        QTest::qWait(10);
+    }
+
+    QCOMPARE_GE(bytesRead, format.bytesForDuration(100'000));
+    QCOMPARE_EQ(bytesRead % format.bytesPerFrame(), 0);
+    QCOMPARE_GT(source.processedUSecs(), 0);
+
+    source.stop();
+    QCOMPARE(source.state(), QtAudio::StoppedState);
+}
+
+void tst_QPipeWireAudioBackend::source_callbackMode_invokesCallbackOffTheOwnerThread()
+{
+    QAudioSource source(m_sourceDevice, testFormat());
+
+    std::atomic_int callbackCount = 0;
+    std::atomic_bool calledOnOwnerThread = false;
+    source.start([&](QSpan<const qint16>) {
+        if (QThread::currentThread() == thread())
+            calledOnOwnerThread = true;
+        ++callbackCount;
+    });
+
+    QCOMPARE(source.state(), QtAudio::ActiveState);
+    QCOMPARE(source.error(), QtAudio::NoError);
+
+    QThread::msleep(200);
+    QCOMPARE_GT(callbackCount.load(), 2);
+
+    source.stop();
+    QVERIFY(!calledOnOwnerThread);
+}
+
+QTEST_GUILESS_MAIN(tst_QPipeWireAudioBackend)
+
+#include "tst_qpipewireaudiobackend.moc"
@@ -42,6 +42,7 @@ public:
     virtual QMediaMetaData metaData() const override { return m_metaData; }
 
     using QPlatformMediaRecorder::updateError;
+    using QPlatformMediaRecorder::encoderLoadChanged;
 
 public:
 
@@ -11,7 +11,13 @@
 #include <QtQGstreamerMediaPluginImpl/private/qgst_debug_p.h>
 #include <QtQGstreamerMediaPluginImpl/private/qgst_discoverer_p.h>
 #include <QtQGstreamerMediaPluginImpl/private/qgstpipeline_p.h>
+#include <QtQGstreamerMediaPluginImpl/private/qgstreamermessage_p.h>
 #include <QtQGstreamerMediaPluginImpl/private/qgstreamermetadata_p.h>
+#include <QtQGstreamerMediaPluginImpl/private/qgstreamervideosink_p.h>
+#include <QtQGstreamerMediaPluginImpl/private/qgstvideorenderersink_p.h>
+#include <QtMultimedia/qvideosink.h>
+#include <QtCore/qelapsedtimer.h>
+#include <QtCore/qscopeguard.h>
 
 #include <set>
 #include <variant>
@@ -591,6 +597,120 @@ void tst_GStreamer::QGstDiscoverer_filtersOutVideoStream_whenStreamIdIsNull()
     QVERIFY(!result->videoStreams[0].streamID.isNull());
 }
 
+void tst_GStreamer::QConcurrentQueue_replaceAll_replacesQueuedValues()
+{
+    QGstUtils::QConcurrentQueue<int> queue;
+
+    QCOMPARE(queue.replaceAll(1), qsizetype(0));
+    QCOMPARE(queue.enqueue(2), qsizetype(2));
+    QCOMPARE(queue.enqueue(3), qsizetype(3));
+
+    QCOMPARE(queue.replaceAll(4), qsizetype(3));
+
+    QCOMPARE(queue.dequeue(), std::optional<int>(4));
+    QVERIFY(!queue.dequeue());
+    QCOMPARE(queue.replaceAll(5), qsizetype(0));
+}
+
+void tst_GStreamer::QQosReportThrottle_reportsAtMostOncePerInterval()
+{
+    constexpr GstClockTime start = 5 * GST_SECOND;
+    QGstUtils::QQosReportThrottle throttle(100 * GST_MSECOND);
+
+    QVERIFY(throttle.isReportDue(start));
+    throttle.setReported(start);
+
+    QVERIFY(!throttle.isReportDue(start));
+    QVERIFY(!throttle.isReportDue(start + 99 * GST_MSECOND));
+    QVERIFY(throttle.isReportDue(start + 100 * GST_MSECOND));
+
+    // the interval starts with the last report, not with the last check
+    QVERIFY(throttle.isReportDue(start + 250 * GST_MSECOND));
+    throttle.setReported(start + 250 * GST_MSECOND);
+    QVERIFY(!throttle.isReportDue(start + 300 * GST_MSECOND));
+    QVERIFY(throttle.isReportDue(start + 350 * GST_MSECOND));
+}
+
+void tst_GStreamer::QGstreamerVideoSink_countsDroppedFramesAndThrottlesQos_whenLatestFrameOnly()
+{
+    // the mode is read when the sink is created
+    qputenv("QT_GSTREAMER_LATEST_VIDEO_FRAME_ONLY", "1");
+    auto unsetEnvironment =
+            qScopeGuard([] { qunsetenv("QT_GSTREAMER_LATEST_VIDEO_FRAME_ONLY"); });
+
+    QVideoSink videoSink;
+    QGstreamerVideoSink platformSink(&videoSink);
+
+    // 50 frames at 100 fps; the event loop doesn't run, so the qt thread picks up none of them
+    constexpr int frameCount = 50;
+    QGstPipeline pipeline = QGstPipeline::create("pipeline");
+    QGstElement source = QGstElement::createFromFactory("videotestsrc", "source");
+    QGstElement capsFilter = QGstElement::createFromFactory("capsfilter", "capsFilter");
+    QVERIFY(source);
+    QVERIFY(capsFilter);
+    source.set("num-buffers", frameCount);
+    QGstCaps caps{
+        gst_caps_from_string("video/x-raw,format=RGBA,width=64,height=64,framerate=100/1"),
+        QGstCaps::HasRef,
+    };
+    capsFilter.set("caps", caps);
+
+    QGstElement sink = platformSink.gstSink();
+    pipeline.add(source, capsFilter, sink);
+    qLinkGstElements(source, capsFilter, sink);
+
+    QGstBusHandle bus{
+        gst_pipeline_get_bus(pipeline.pipeline()),
+        QGstBusHandle::HasRef,
+    };
+
+    auto stopPipeline = qScopeGuard([&] {
+        pipeline.setStateSync(GST_STATE_NULL);
+        pipeline.stopAndRemoveElements(source, capsFilter, sink);
+    });
+
+    QElapsedTimer timer;
+    timer.start();
+    pipeline.setState(GST_STATE_PLAYING);
+
+    int qosMessageCount = 0;
+    guint64 reportedDroppedCount = 0;
+    for (;;) {
+        QGstreamerMessage message{
+            gst_bus_timed_pop(bus.get(), 10 * GST_SECOND),
+            QGstreamerMessage::HasRef,
+        };
+        QVERIFY2(message, "timeout waiting for the end of the stream");
+
+        const GstMessageType type = message.type();
+        QVERIFY(type != GST_MESSAGE_ERROR);
+        if (type == GST_MESSAGE_EOS)
+            break;
+
+        if (type == GST_MESSAGE_QOS) {
+            ++qosMessageCount;
+            GstFormat format{};
+            guint64 processed = 0;
+            gst_message_parse_qos_stats(message.message(), &format, &processed,
+                                        &reportedDroppedCount);
+            QCOMPARE(format, GST_FORMAT_BUFFERS);
+        }
+    }
+
+    const qint64 elapsedMs = timer.elapsed();
+
+    // all the frames but the pending one are dropped; the preroll frame may be counted twice
+    const quint64 droppedCount = platformSink.droppedFrameCount();
+    QCOMPARE_GE(droppedCount, quint64(frameCount - 1));
+    QCOMPARE_LE(droppedCount, quint64(frameCount));
+
+    // the drops are reported with the accumulated totals, at most once per 100 ms
+    QCOMPARE_GE(qosMessageCount, 1);
+    QCOMPARE_LE(qosMessageCount, elapsedMs / 100 + 1);
+    QCOMPARE_GT(reportedDroppedCount, 0u);
+    QCOMPARE_LE(reportedDroppedCount, droppedCount);
+}
+
 QTEST_GUILESS_MAIN(tst_GStreamer)
 
 #include "moc_tst_gstreamer_backend.cpp"
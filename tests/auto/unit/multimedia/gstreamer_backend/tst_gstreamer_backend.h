@@ -57,6 +57,10 @@ private slots:
     void QGstDiscoverer_discoverMedia_withRotation();
     void QGstDiscoverer_filtersOutVideoStream_whenStreamIdIsNull();
 
+    void QConcurrentQueue_replaceAll_replacesQueuedValues();
+    void QQosReportThrottle_reportsAtMostOncePerInterval();
+    void QGstreamerVideoSink_countsDroppedFramesAndThrottlesQos_whenLatestFrameOnly();
+
 private:
     QGstreamerIntegration integration;
 };
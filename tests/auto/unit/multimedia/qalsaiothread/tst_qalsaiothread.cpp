@@ -0,0 +1,325 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QtTest/QtTest>
+
+#include <QtMultimedia/private/qalsaiothread_p.h>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+// NOLINTBEGIN(readability-convert-member-functions-to-static)
+
+using namespace std::chrono_literals;
+
+namespace {
+
+struct PcmDeleter
+{
+    void operator()(snd_pcm_t *handle) const { snd_pcm_close(handle); }
+};
+
+using PcmHandle = std::unique_ptr<snd_pcm_t, PcmDeleter>;
+
+// The null device of alsa-lib accepts and produces silence as fast as it is serviced, so the
+// tests don't depend on the audio hardware of the machine.
+struct NullPcm
+{
+    PcmHandle handle;
+    snd_pcm_uframes_t bufferFrames = 0;
+    snd_pcm_uframes_t periodFrames = 0;
+};
+
+QAudioFormat testFormat()
+{
+    QAudioFormat format;
+    format.setSampleFormat(QAudioFormat::Int16);
+    format.setChannelCount(2);
+    format.setSampleRate(48000);
+    return format;
+}
+
+NullPcm openNullPcm(snd_pcm_stream_t stream, snd_pcm_access_t access)
+{
+    snd_pcm_t *handle = nullptr;
+    if (snd_pcm_open(&handle, "null", stream, 0) < 0)
+        return {};
+
+    NullPcm pcm{ PcmHandle(handle) };
+    // prepares the pcm
+    if (snd_pcm_set_params(handle, SND_PCM_FORMAT_S16_LE, access, 2, 48000, 1,
+                           /*latency=*/50000)
+                < 0
+        || snd_pcm_get_params(handle, &pcm.bufferFrames, &pcm.periodFrames) < 0) {
+        return {};
+    }
+    return pcm;
+}
+
+std::vector<std::byte> makeTestData(qsizetype size)
+{
+    std::vector<std::byte> data(size);
+    for (qsizetype i = 0; i < size; ++i)
+        data[i] = std::byte(i % 251);
+    return data;
+}
+
+} // namespace
+
+class tst_QAlsaIOThread : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void playback_handsRingBufferOverToDevice_data();
+    void playback_handsRingBufferOverToDevice();
+    void playback_raisesStarved_whenRingBufferRunsDry();
+    void playback_doesNotCountSilence_whenRingBufferRunsDry();
+    void playback_invokesCallbackOnIOThread();
+    void drain_handsQueuedAudioOverBeforeStopping();
+    void capture_handsCapturedDataOverToRingBuffer_data();
+    void capture_handsCapturedDataOverToRingBuffer();
+    void capture_invokesCallbackOnIOThread();
+    void stop_stopsThread_whenIdle();
+
+private:
+    void addAccessData();
+};
+
+void tst_QAlsaIOThread::addAccessData()
+{
+    QTest::addColumn<bool>("mmap");
+
+    QTest::newRow("mmap") << true;
+    QTest::newRow("read/write") << false;
+}
+
+void tst_QAlsaIOThread::playback_handsRingBufferOverToDevice_data()
+{
+    addAccessData();
+}
+
+void tst_QAlsaIOThread::playback_handsRingBufferOverToDevice()
+{
+    QFETCH(bool, mmap);
+    const snd_pcm_access_t access =
+            mmap ? SND_PCM_ACCESS_MMAP_INTERLEAVED : SND_PCM_ACCESS_RW_INTERLEAVED;
+
+    NullPcm pcm = openNullPcm(SND_PCM_STREAM_PLAYBACK, access);
+    if (!pcm.handle)
+        QSKIP("The null ALSA device is not available");
+
+    const QAudioFormat format = testFormat();
+    QAlsaIOThread thread(pcm.handle.get(), SND_PCM_STREAM_PLAYBACK, access, format,
+                         pcm.bufferFrames, 1000);
+
+    const std::vector<std::byte> data = makeTestData(thread.ringBuffer().size());
+    QCOMPARE(thread.ringBuffer().write(QSpan<const std::byte>{ data }), qsizetype(data.size()));
+
+    thread.start();
+    QVERIFY(thread.isRunning());
+
+    QTRY_COMPARE(thread.ringBuffer().used(), 0);
+    QTRY_COMPARE(thread.framesTransferred(), qint64(data.size()) / format.bytesPerFrame());
+
+    thread.stop();
+    QVERIFY(!thread.isRunning());
+    QCOMPARE_EQ(thread.takeEvents() & uint(QAlsaIOThread::Event::Fatal), 0u);
+}
+
+void tst_QAlsaIOThread::playback_raisesStarved_whenRingBufferRunsDry()
+{
+    NullPcm pcm = openNullPcm(SND_PCM_STREAM_PLAYBACK, SND_PCM_ACCESS_RW_INTERLEAVED);
+    if (!pcm.handle)
+        QSKIP("The null ALSA device is not available");
+
+    QAlsaIOThread thread(pcm.handle.get(), SND_PCM_STREAM_PLAYBACK,
+                         SND_PCM_ACCESS_RW_INTERLEAVED, testFormat(), pcm.bufferFrames, 1000);
+    thread.start();
+
+    // the thread keeps the device running with silence
+    QTRY_VERIFY(thread.takeEvents() & uint(QAlsaIOThread::Event::Starved));
+    QVERIFY(thread.isRunning());
+}
+
+void tst_QAlsaIOThread::playback_doesNotCountSilence_whenRingBufferRunsDry()
+{
+    NullPcm pcm = openNullPcm(SND_PCM_STREAM_PLAYBACK, SND_PCM_ACCESS_RW_INTERLEAVED);
+    if (!pcm.handle)
+        QSKIP("The null ALSA device is not available");
+
+    const QAudioFormat format = testFormat();
+    QAlsaIOThread thread(pcm.handle.get(), SND_PCM_STREAM_PLAYBACK,
+                         SND_PCM_ACCESS_RW_INTERLEAVED, format, pcm.bufferFrames, 1000);
+
+    // less than a period, so that the first transfer is padded with silence
+    const qsizetype audioFrames = qsizetype(pcm.periodFrames) / 2;
+    const std::vector<std::byte> data = makeTestData(audioFrames * format.bytesPerFrame());
+    thread.ringBuffer().write(QSpan<const std::byte>{ data });
+
+    thread.start();
+    QTRY_VERIFY(thread.takeEvents() & uint(QAlsaIOThread::Event::Starved));
+    QCOMPARE(thread.ringBuffer().used(), 0);
+    QCOMPARE(thread.framesTransferred(), qint64(audioFrames));
+
+    // the device keeps consuming silence, which doesn't advance the processed frames
+    QTRY_VERIFY(thread.takeEvents() & uint(QAlsaIOThread::Event::Starved));
+    QCOMPARE(thread.framesTransferred(), qint64(audioFrames));
+
+    thread.stop();
+    QCOMPARE(thread.framesTransferred(), qint64(audioFrames));
+}
+
+void tst_QAlsaIOThread::playback_invokesCallbackOnIOThread()
+{
+    NullPcm pcm = openNullPcm(SND_PCM_STREAM_PLAYBACK, SND_PCM_ACCESS_RW_INTERLEAVED);
+    if (!pcm.handle)
+        QSKIP("The null ALSA device is not available");
+
+    const QAudioFormat format = testFormat();
+    const qsizetype bufferBytes = qsizetype(pcm.bufferFrames) * format.bytesPerFrame();
+
+    std::atomic<QThread *> callbackThread = nullptr;
+    std::atomic_bool spanWithinBuffer = true;
+    std::atomic_int callCount = 0;
+
+    QAlsaIOThread thread(pcm.handle.get(), SND_PCM_STREAM_PLAYBACK,
+                         SND_PCM_ACCESS_RW_INTERLEAVED, format, pcm.bufferFrames, 1000);
+    thread.setAudioCallback([&](QSpan<std::byte> buffer) {
+        callbackThread = QThread::currentThread();
+        if (buffer.size() > bufferBytes || buffer.size() % format.bytesPerFrame() != 0)
+            spanWithinBuffer = false;
+        std::fill(buffer.begin(), buffer.end(), std::byte{ 0 });
+        ++callCount;
+    });
+    thread.start();
+
+    QTRY_VERIFY(callCount > 1);
+    thread.stop();
+
+    QVERIFY(callbackThread.load() != nullptr);
+    QCOMPARE_NE(callbackThread.load(), QThread::currentThread());
+    QVERIFY(spanWithinBuffer);
+    // the callback always fills the whole buffer
+    QCOMPARE_EQ(thread.takeEvents() & uint(QAlsaIOThread::Event::Starved), 0u);
+
+    const int callsAfterStop = callCount;
+    QTest::qWait(20ms);
+    QCOMPARE(callCount, callsAfterStop);
+}
+
+void tst_QAlsaIOThread::drain_handsQueuedAudioOverBeforeStopping()
+{
+    NullPcm pcm = openNullPcm(SND_PCM_STREAM_PLAYBACK, SND_PCM_ACCESS_RW_INTERLEAVED);
+    if (!pcm.handle)
+        QSKIP("The null ALSA device is not available");
+
+    const QAudioFormat format = testFormat();
+    QAlsaIOThread thread(pcm.handle.get(), SND_PCM_STREAM_PLAYBACK,
+                         SND_PCM_ACCESS_RW_INTERLEAVED, format, pcm.bufferFrames, 1000);
+
+    const std::vector<std::byte> data = makeTestData(thread.ringBuffer().size());
+    thread.ringBuffer().write(QSpan<const std::byte>{ data });
+
+    thread.start();
+    thread.drain();
+
+    QVERIFY(!thread.isRunning());
+    QCOMPARE(thread.ringBuffer().used(), 0);
+    QCOMPARE(thread.framesTransferred(), qint64(data.size()) / format.bytesPerFrame());
+}
+
+void tst_QAlsaIOThread::capture_handsCapturedDataOverToRingBuffer_data()
+{
+    addAccessData();
+}
+
+void tst_QAlsaIOThread::capture_handsCapturedDataOverToRingBuffer()
+{
+    QFETCH(bool, mmap);
+    const snd_pcm_access_t access =
+            mmap ? SND_PCM_ACCESS_MMAP_INTERLEAVED : SND_PCM_ACCESS_RW_INTERLEAVED;
+
+    NullPcm pcm = openNullPcm(SND_PCM_STREAM_CAPTURE, access);
+    if (!pcm.handle)
+        QSKIP("The null ALSA device is not available");
+
+    const QAudioFormat format = testFormat();
+    QAlsaIOThread thread(pcm.handle.get(), SND_PCM_STREAM_CAPTURE, access, format,
+                         pcm.bufferFrames, 1000);
+    // the thread starts the capture
+    thread.start();
+
+    QTRY_VERIFY(thread.ringBuffer().used() >= format.bytesPerFrame());
+    thread.stop();
+
+    // the ring buffer holds whole frames of the captured data
+    QCOMPARE(thread.ringBuffer().used() % format.bytesPerFrame(), 0);
+    qsizetype bytesRead = 0;
+    bool silent = true;
+    thread.ringBuffer().consumeAll([&](QSpan<const std::byte> region) {
+        silent &= std::all_of(region.begin(), region.end(),
+                              [](std::byte b) { return b == std::byte{ 0 }; });
+        bytesRead += region.size();
+    });
+    QCOMPARE_GT(bytesRead, 0);
+    // reading from the null device returns silence, its mmap area isn't initialized
+    if (!mmap)
+        QVERIFY(silent);
+    QCOMPARE(thread.ringBuffer().used(), 0);
+}
+
+void tst_QAlsaIOThread::capture_invokesCallbackOnIOThread()
+{
+    NullPcm pcm = openNullPcm(SND_PCM_STREAM_CAPTURE, SND_PCM_ACCESS_RW_INTERLEAVED);
+    if (!pcm.handle)
+        QSKIP("The null ALSA device is not available");
+
+    const QAudioFormat format = testFormat();
+
+    std::atomic<QThread *> callbackThread = nullptr;
+    std::atomic<qint64> bytesCaptured = 0;
+
+    QAlsaIOThread thread(pcm.handle.get(), SND_PCM_STREAM_CAPTURE,
+                         SND_PCM_ACCESS_RW_INTERLEAVED, format, pcm.bufferFrames, 1000);
+    thread.setCaptureCallback([&](QSpan<const std::byte> buffer) {
+        callbackThread = QThread::currentThread();
+        bytesCaptured += buffer.size();
+    });
+    thread.start();
+
+    QTRY_VERIFY(bytesCaptured > 0);
+    thread.stop();
+
+    QCOMPARE_NE(callbackThread.load(), QThread::currentThread());
+    // the captured data is handed over to the callback instead of the ring buffer
+    QCOMPARE(thread.ringBuffer().used(), 0);
+    QCOMPARE(bytesCaptured.load(), thread.framesTransferred() * format.bytesPerFrame());
+}
+
+void tst_QAlsaIOThread::stop_stopsThread_whenIdle()
+{
+    NullPcm pcm = openNullPcm(SND_PCM_STREAM_PLAYBACK, SND_PCM_ACCESS_RW_INTERLEAVED);
+    if (!pcm.handle)
+        QSKIP("The null ALSA device is not available");
+
+    QAlsaIOThread thread(pcm.handle.get(), SND_PCM_STREAM_PLAYBACK,
+                         SND_PCM_ACCESS_RW_INTERLEAVED, testFormat(), pcm.bufferFrames, 1000);
+    thread.start();
+    QVERIFY(thread.isRunning());
+
+    thread.stop();
+    QVERIFY(!thread.isRunning());
+
+    // can be restarted, like after QAudioSink::resume()
+    thread.start();
+    QVERIFY(thread.isRunning());
+}
+
+// NOLINTEND(readability-convert-member-functions-to-static)
+
+QTEST_GUILESS_MAIN(tst_QAlsaIOThread)
+
+#include "tst_qalsaiothread.moc"
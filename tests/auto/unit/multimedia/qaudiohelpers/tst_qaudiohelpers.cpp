@@ -7,6 +7,9 @@
 #include <QtMultimedia/private/qaudiohelpers_p.h>
 #include <QtMultimedia/private/qaudio_alignment_support_p.h>
 
+#include <numeric>
+#include <vector>
+
 class tst_QAudioHelpers : public QObject
 {
     Q_OBJECT
@@ -15,6 +18,27 @@ private slots:
     void applyVolume();
     void applyVolume_data();
 
+    void applyVolume_inPlace();
+    void applyVolume_inPlace_data() { applyVolume_data(); }
+
+    void convertSamples_int16ToFloat_roundTrips();
+    void convertSamples_floatToInt16_saturates();
+    void convertSamples_convertsBetweenSampleFormats_data();
+    void convertSamples_convertsBetweenSampleFormats();
+
+    void deinterleave_interleave_roundTrip_data();
+    void deinterleave_interleave_roundTrip();
+
+    void mixAccumulate_saturatesIntegerSamples();
+    void mixAccumulate_appliesGain_toFloatSamples();
+    void mixAccumulate_keepsFullPrecision_ofInt32Samples();
+    void mix_sumsAllSources();
+    void mix_keepsFullPrecision_ofInt32Samples();
+
+    void applyVolumeRamp_interpolatesGainOverFrames();
+    void applyVolumeRamp_keepsFullPrecision_ofInt32Samples();
+    void smoothedVolume_rampsOnlyAfterVolumeChange();
+
     void alignmentSupport();
 };
 
@@ -116,6 +140,24 @@ void tst_QAudioHelpers::applyVolume()
                         epsilon);
 }
 
+void tst_QAudioHelpers::applyVolume_inPlace()
+{
+    QFETCH(QAudioFormat::SampleFormat, sampleFormat);
+    QFETCH(float, value);
+    QFETCH(float, factor);
+    QFETCH(float, expectedResult);
+
+    QByteArray data = WordConverter::toBytes(value, sampleFormat);
+
+    QAudioFormat fmt;
+    fmt.setSampleFormat(sampleFormat);
+
+    QAudioHelperInternal::applyVolume(factor, fmt, as_writable_bytes(QSpan{ data }));
+
+    float epsilon = (sampleFormat != QAudioFormat::SampleFormat::UInt8) ? 0.001f : 0.05f;
+    QCOMPARE_FLOAT_NEAR(WordConverter::fromBytes(data, sampleFormat), expectedResult, epsilon);
+}
+
 void tst_QAudioHelpers::applyVolume_data()
 {
     using SampleFormat = QAudioFormat::SampleFormat;
@@ -153,6 +195,311 @@ void tst_QAudioHelpers::applyVolume_data()
     makeEntriesFor("uint8", SampleFormat::UInt8);
 }
 
+namespace {
+
+template <typename T>
+QSpan<const std::byte> constBytes(const std::vector<T> &v)
+{
+    return as_bytes(QSpan<const T>{ v });
+}
+
+template <typename T>
+QSpan<std::byte> writableBytes(std::vector<T> &v)
+{
+    return as_writable_bytes(QSpan<T>{ v });
+}
+
+QAudioFormat makeFormat(QAudioFormat::SampleFormat sampleFormat, int channelCount = 1)
+{
+    QAudioFormat format;
+    format.setSampleFormat(sampleFormat);
+    format.setChannelCount(channelCount);
+    format.setSampleRate(48000);
+    return format;
+}
+
+} // namespace
+
+void tst_QAudioHelpers::convertSamples_int16ToFloat_roundTrips()
+{
+    // odd size, to cover the scalar tail of the vectorized kernels
+    std::vector<qint16> source(1001);
+    std::iota(source.begin(), source.end(), qint16(-500));
+    source.front() = std::numeric_limits<qint16>::min();
+    source.back() = std::numeric_limits<qint16>::max();
+
+    std::vector<float> floats(source.size());
+    QAudioHelperInternal::convertSamples(QSpan<const qint16>{ source }, QSpan<float>{ floats });
+    QCOMPARE(floats.front(), -1.f);
+    QCOMPARE(floats[500], 0.f);
+
+    std::vector<qint16> result(source.size());
+    QAudioHelperInternal::convertSamples(QSpan<const float>{ floats }, QSpan<qint16>{ result });
+    QCOMPARE(result, source);
+}
+
+void tst_QAudioHelpers::convertSamples_floatToInt16_saturates()
+{
+    std::vector<float> source(19, 0.f);
+    for (size_t i = 0; i < source.size(); ++i)
+        source[i] = (i % 2) ? 4.f : -4.f;
+    source[0] = 0.5f;
+
+    std::vector<qint16> result(source.size());
+    QAudioHelperInternal::convertSamples(QSpan<const float>{ source }, QSpan<qint16>{ result });
+
+    QCOMPARE(result[0], qint16(16384));
+    for (size_t i = 1; i < result.size(); ++i) {
+        QCOMPARE(result[i], (i % 2) ? std::numeric_limits<qint16>::max()
+                                    : std::numeric_limits<qint16>::min());
+    }
+}
+
+void tst_QAudioHelpers::convertSamples_convertsBetweenSampleFormats_data()
+{
+    using SampleFormat = QAudioFormat::SampleFormat;
+
+    QTest::addColumn<SampleFormat>("sourceFormat");
+    QTest::addColumn<SampleFormat>("destinationFormat");
+
+    const std::pair<const char *, SampleFormat> formats[] = {
+        { "uint8", SampleFormat::UInt8 },
+        { "int16", SampleFormat::Int16 },
+        { "int32", SampleFormat::Int32 },
+        { "float", SampleFormat::Float },
+    };
+
+    for (const auto &[sourceName, sourceFormat] : formats) {
+        for (const auto &[destinationName, destinationFormat] : formats) {
+            QTest::addRow("%s => %s", sourceName, destinationName)
+                    << sourceFormat << destinationFormat;
+        }
+    }
+}
+
+void tst_QAudioHelpers::convertSamples_convertsBetweenSampleFormats()
+{
+    QFETCH(QAudioFormat::SampleFormat, sourceFormat);
+    QFETCH(QAudioFormat::SampleFormat, destinationFormat);
+
+    const QList<float> values = { 0.f, 0.5f, -0.5f, 0.25f, -1.f };
+
+    QByteArray source;
+    for (float value : values)
+        source += WordConverter::toBytes(value, sourceFormat);
+
+    const QAudioFormat destination = makeFormat(destinationFormat);
+    QByteArray result(destination.bytesPerSample() * values.size(), Qt::Uninitialized);
+    QAudioHelperInternal::convertSamples(as_bytes(QSpan{ source }), sourceFormat,
+                                         as_writable_bytes(QSpan{ result }), destinationFormat);
+
+    const bool hasUInt8 = sourceFormat == QAudioFormat::UInt8
+            || destinationFormat == QAudioFormat::UInt8;
+    const float epsilon = hasUInt8 ? 0.02f : 0.001f;
+    for (qsizetype i = 0; i < values.size(); ++i) {
+        const QByteArrayView sample = QByteArrayView{ result }.sliced(
+                i * destination.bytesPerSample(), destination.bytesPerSample());
+        QCOMPARE_FLOAT_NEAR(WordConverter::fromBytes(sample, destinationFormat), values[i],
+                            epsilon);
+    }
+}
+
+void tst_QAudioHelpers::deinterleave_interleave_roundTrip_data()
+{
+    QTest::addColumn<int>("channelCount");
+    QTest::addColumn<int>("frameCount");
+
+    // stereo has a vectorized path
+    for (int channelCount : { 1, 2, 3 }) {
+        for (int frameCount : { 0, 1, 7, 64 })
+            QTest::addRow("%d channels, %d frames", channelCount, frameCount)
+                    << channelCount << frameCount;
+    }
+}
+
+void tst_QAudioHelpers::deinterleave_interleave_roundTrip()
+{
+    QFETCH(int, channelCount);
+    QFETCH(int, frameCount);
+
+    std::vector<float> interleaved(frameCount * channelCount);
+    for (int frame = 0; frame < frameCount; ++frame) {
+        for (int channel = 0; channel < channelCount; ++channel)
+            interleaved[frame * channelCount + channel] = float(channel * 1000 + frame);
+    }
+
+    std::vector<std::vector<float>> planes(channelCount, std::vector<float>(frameCount));
+    std::vector<float *> planePointers;
+    for (auto &plane : planes)
+        planePointers.push_back(plane.data());
+
+    QAudioHelperInternal::deinterleave(interleaved, planePointers);
+    for (int channel = 0; channel < channelCount; ++channel) {
+        for (int frame = 0; frame < frameCount; ++frame)
+            QCOMPARE(planes[channel][frame], float(channel * 1000 + frame));
+    }
+
+    std::vector<float> result(interleaved.size(), -1.f);
+    const std::vector<const float *> constPlanePointers(planePointers.begin(),
+                                                        planePointers.end());
+    QAudioHelperInternal::interleave(constPlanePointers, result);
+    QCOMPARE(result, interleaved);
+}
+
+void tst_QAudioHelpers::mixAccumulate_saturatesIntegerSamples()
+{
+    const std::vector<qint16> source(21, 20000);
+    std::vector<qint16> destination(21, 20000);
+    destination[0] = -30000;
+
+    QAudioHelperInternal::mixAccumulate(makeFormat(QAudioFormat::Int16), constBytes(source),
+                                        writableBytes(destination));
+
+    QCOMPARE(destination[0], qint16(-10000));
+    for (size_t i = 1; i < destination.size(); ++i)
+        QCOMPARE(destination[i], std::numeric_limits<qint16>::max());
+}
+
+void tst_QAudioHelpers::mixAccumulate_appliesGain_toFloatSamples()
+{
+    const std::vector<float> source(13, 0.75f);
+    std::vector<float> destination(13, 0.5f);
+
+    QAudioHelperInternal::mixAccumulate(makeFormat(QAudioFormat::Float), constBytes(source),
+                                        writableBytes(destination), 2.f);
+
+    // float samples are not clamped
+    for (float sample : destination)
+        QCOMPARE(sample, 2.f);
+}
+
+void tst_QAudioHelpers::mixAccumulate_keepsFullPrecision_ofInt32Samples()
+{
+    // odd values below the 24 bits of precision of a float
+    const std::vector<qint32> source{ 1, 3, 0x7fff'ff01, -0x7fff'ff01, 0x3fff'ffff };
+    std::vector<qint32> destination{ 0x1000'0001, -5, 0x100, -0x100, 1 };
+
+    QAudioHelperInternal::mixAccumulate(makeFormat(QAudioFormat::Int32), constBytes(source),
+                                        writableBytes(destination));
+
+    const std::vector<qint32> expected{ 0x1000'0002, -2, std::numeric_limits<qint32>::max(),
+                                        std::numeric_limits<qint32>::min(), 0x4000'0000 };
+    QCOMPARE(destination, expected);
+
+    std::vector<qint32> halved{ 1, 1, 1, 1, 1 };
+    QAudioHelperInternal::mixAccumulate(makeFormat(QAudioFormat::Int32),
+                                        constBytes(std::vector<qint32>(5, 0x2000'0001)),
+                                        writableBytes(halved), 0.5f);
+    QCOMPARE(halved, std::vector<qint32>(5, 0x1000'0001));
+}
+
+void tst_QAudioHelpers::mix_sumsAllSources()
+{
+    // saturating once, after summing, keeps the result of opposite extremes exact
+    const std::vector<qint16> first(10, 30000);
+    const std::vector<qint16> second(10, 30000);
+    const std::vector<qint16> third(10, -30000);
+    std::vector<qint16> destination(10, 1234);
+
+    const QSpan<const std::byte> sources[] = { constBytes(first), constBytes(second),
+                                               constBytes(third) };
+    QAudioHelperInternal::mix(makeFormat(QAudioFormat::Int16), sources,
+                              writableBytes(destination));
+
+    for (qint16 sample : destination)
+        QCOMPARE(sample, qint16(30000));
+}
+
+void tst_QAudioHelpers::mix_keepsFullPrecision_ofInt32Samples()
+{
+    // the intermediate sum exceeds the int32 range, the result doesn't
+    const std::vector<qint32> first(600, 0x7fff'fff1);
+    const std::vector<qint32> second(600, 0x7fff'fff3);
+    const std::vector<qint32> third(600, -0x7fff'fff5);
+    std::vector<qint32> destination(600);
+
+    const QSpan<const std::byte> sources[] = { constBytes(first), constBytes(second),
+                                               constBytes(third) };
+    QAudioHelperInternal::mix(makeFormat(QAudioFormat::Int32), sources,
+                              writableBytes(destination));
+
+    for (qint32 sample : destination)
+        QCOMPARE(sample, 0x7fff'ffef);
+}
+
+void tst_QAudioHelpers::applyVolumeRamp_keepsFullPrecision_ofInt32Samples()
+{
+    const std::vector<qint32> source(4, 0x7fff'ffff);
+    std::vector<qint32> destination(source.size());
+
+    // a constant ramp at unity gain leaves the samples unchanged
+    QAudioHelperInternal::applyVolumeRamp(1.f, 1.f, makeFormat(QAudioFormat::Int32),
+                                          constBytes(source), writableBytes(destination));
+    QCOMPARE(destination, source);
+
+    const std::vector<qint32> odd(4, 0x0100'0003);
+    QAudioHelperInternal::applyVolumeRamp(0.5f, 0.5f, makeFormat(QAudioFormat::Int32),
+                                          constBytes(odd), writableBytes(destination));
+    // 0x0100'0003 / 2 = 0x80'0001.5, rounded to even
+    QCOMPARE(destination, std::vector<qint32>(4, 0x0080'0002));
+}
+
+void tst_QAudioHelpers::applyVolumeRamp_interpolatesGainOverFrames()
+{
+    constexpr int channelCount = 2;
+    constexpr int frameCount = 100;
+    const std::vector<float> source(frameCount * channelCount, 1.f);
+    std::vector<float> destination(source.size());
+
+    QAudioHelperInternal::applyVolumeRamp(0.f, 1.f, makeFormat(QAudioFormat::Float, channelCount),
+                                          constBytes(source), writableBytes(destination));
+
+    QCOMPARE(destination[0], 0.f);
+    QCOMPARE(destination[1], 0.f);
+    for (int frame = 1; frame < frameCount; ++frame) {
+        QCOMPARE(destination[frame * channelCount], destination[frame * channelCount + 1]);
+        QCOMPARE_GT(destination[frame * channelCount], destination[(frame - 1) * channelCount]);
+    }
+    QCOMPARE_FLOAT_NEAR(destination.back(), 0.99f, 0.0001f);
+}
+
+void tst_QAudioHelpers::smoothedVolume_rampsOnlyAfterVolumeChange()
+{
+    const QAudioFormat format = makeFormat(QAudioFormat::Float);
+    const qsizetype rampFrames =
+            format.framesForDuration(QAudioHelperInternal::SmoothedVolume::RampDurationUs);
+
+    QAudioHelperInternal::SmoothedVolume volume(1.f);
+    std::vector<float> buffer(rampFrames * 2, 1.f);
+
+    volume.apply(format, writableBytes(buffer));
+    QCOMPARE(buffer.front(), 1.f);
+    QCOMPARE(buffer.back(), 1.f);
+
+    volume.setVolume(0.5f);
+    QCOMPARE(volume.volume(), 0.5f);
+
+    std::fill(buffer.begin(), buffer.end(), 1.f);
+    volume.apply(format, writableBytes(buffer));
+    QCOMPARE(buffer.front(), 1.f);
+    QCOMPARE_GT(buffer[rampFrames - 1], 0.5f);
+    QCOMPARE_LT(buffer[rampFrames - 1], 0.51f);
+    QCOMPARE(buffer[rampFrames], 0.5f);
+    QCOMPARE(buffer.back(), 0.5f);
+
+    // constant afterwards
+    std::fill(buffer.begin(), buffer.end(), 1.f);
+    volume.apply(format, writableBytes(buffer));
+    QCOMPARE(buffer.front(), 0.5f);
+
+    // reset skips the ramp
+    volume.setVolume(0.f);
+    volume.reset();
+    std::fill(buffer.begin(), buffer.end(), 1.f);
+    volume.apply(format, writableBytes(buffer));
+    QCOMPARE(buffer.front(), 0.f);
+}
+
 void tst_QAudioHelpers::alignmentSupport()
 {
     using namespace QtMultimediaPrivate;
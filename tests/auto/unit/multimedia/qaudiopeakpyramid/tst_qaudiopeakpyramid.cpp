@@ -0,0 +1,227 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QtTest/QtTest>
+
+#include <QtMultimedia/private/qaudiopeakpyramid_p.h>
+
+#include <cmath>
+#include <vector>
+
+using Peak = QAudioPeakPyramid::Peak;
+
+class tst_QAudioPeakPyramid : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void reduceBlock_computesMinMaxRms_perChannel_data();
+    void reduceBlock_computesMinMaxRms_perChannel();
+
+    void builder_producesSameResult_forAnyChunking();
+    void finish_completesLevels_upToSinglePeak();
+    void peakForRange_combinesPeaksOfRange();
+    void peakForRange_usesFinerLevels_forIncompleteCoarseLevels();
+
+    void serialization_roundTrips();
+    void fromByteArray_rejectsCorruptedData();
+};
+
+namespace {
+
+// interleaved sawtooth, with a different amplitude per channel
+std::vector<float> makeSignal(qsizetype frames, int channels)
+{
+    std::vector<float> samples(frames * channels);
+    for (qsizetype frame = 0; frame < frames; ++frame) {
+        for (int channel = 0; channel < channels; ++channel) {
+            const float amplitude = 1.f / (channel + 1);
+            samples[frame * channels + channel] =
+                    amplitude * (float(frame % 100) / 50.f - 1.f);
+        }
+    }
+    return samples;
+}
+
+Peak referencePeak(const std::vector<float> &samples, int channels, int channel,
+                   qsizetype firstFrame, qsizetype frameCount)
+{
+    Peak result{ std::numeric_limits<float>::max(), std::numeric_limits<float>::lowest(), 0.f };
+    double sumOfSquares = 0;
+    for (qsizetype frame = firstFrame; frame < firstFrame + frameCount; ++frame) {
+        const float value = samples[frame * channels + channel];
+        result.min = std::min(result.min, value);
+        result.max = std::max(result.max, value);
+        sumOfSquares += double(value) * value;
+    }
+    result.rms = float(std::sqrt(sumOfSquares / frameCount));
+    return result;
+}
+
+void comparePeaks(const Peak &actual, const Peak &expected)
+{
+    QCOMPARE(actual.min, expected.min);
+    QCOMPARE(actual.max, expected.max);
+    QVERIFY2(qAbs(actual.rms - expected.rms) < 1e-4f,
+             qPrintable(QStringLiteral("%1 != %2").arg(actual.rms).arg(expected.rms)));
+}
+
+} // namespace
+
+void tst_QAudioPeakPyramid::reduceBlock_computesMinMaxRms_perChannel_data()
+{
+    QTest::addColumn<int>("channels");
+    QTest::addColumn<int>("frames");
+
+    // 1, 2 and 4 channels take the vectorized path, with and without scalar tails
+    for (int channels : { 1, 2, 3, 4, 6 }) {
+        for (int frames : { 1, 3, 256, 257 }) {
+            QTest::addRow("%d channels, %d frames", channels, frames) << channels << frames;
+        }
+    }
+}
+
+void tst_QAudioPeakPyramid::reduceBlock_computesMinMaxRms_perChannel()
+{
+    QFETCH(int, channels);
+    QFETCH(int, frames);
+
+    const std::vector<float> samples = makeSignal(frames, channels);
+    std::vector<Peak> peaks(channels);
+    QAudioPeakPyramidBuilder::reduceBlock(samples, channels, peaks);
+
+    for (int channel = 0; channel < channels; ++channel)
+        comparePeaks(peaks[channel], referencePeak(samples, channels, channel, 0, frames));
+}
+
+void tst_QAudioPeakPyramid::builder_producesSameResult_forAnyChunking()
+{
+    constexpr int channels = 2;
+    const std::vector<float> samples = makeSignal(10'000, channels);
+
+    QAudioPeakPyramidBuilder wholeBuilder(channels, 48000, 64);
+    wholeBuilder.addFrames(samples);
+    wholeBuilder.finish();
+
+    QAudioPeakPyramidBuilder chunkedBuilder(channels, 48000, 64);
+    for (qsizetype offset = 0; offset < qsizetype(samples.size()); offset += 37 * channels) {
+        const qsizetype size = std::min<qsizetype>(37 * channels, samples.size() - offset);
+        chunkedBuilder.addFrames(QSpan<const float>(samples).subspan(offset, size));
+    }
+    chunkedBuilder.finish();
+
+    const QAudioPeakPyramid &whole = wholeBuilder.pyramid();
+    const QAudioPeakPyramid &chunked = chunkedBuilder.pyramid();
+    QCOMPARE(chunked.frameCount(), 10'000);
+    QCOMPARE(chunked.levelCount(), whole.levelCount());
+    for (int level = 0; level < whole.levelCount(); ++level) {
+        QCOMPARE(chunked.peakCount(level), whole.peakCount(level));
+        for (qsizetype i = 0; i < whole.peakCount(level); ++i) {
+            for (int channel = 0; channel < channels; ++channel)
+                QCOMPARE(chunked.peak(level, i, channel), whole.peak(level, i, channel));
+        }
+    }
+}
+
+void tst_QAudioPeakPyramid::finish_completesLevels_upToSinglePeak()
+{
+    const std::vector<float> samples = makeSignal(1000, 1);
+
+    QAudioPeakPyramidBuilder builder(1, 48000, 10);
+    builder.addFrames(samples);
+    builder.finish();
+
+    // 100 -> 25 -> 7 -> 2 -> 1
+    const QAudioPeakPyramid &pyramid = builder.pyramid();
+    QCOMPARE(pyramid.levelCount(), 5);
+    QCOMPARE(pyramid.peakCount(0), 100);
+    QCOMPARE(pyramid.peakCount(1), 25);
+    QCOMPARE(pyramid.peakCount(2), 7);
+    QCOMPARE(pyramid.peakCount(3), 2);
+    QCOMPARE(pyramid.peakCount(4), 1);
+
+    comparePeaks(pyramid.peak(4, 0, 0), referencePeak(samples, 1, 0, 0, 1000));
+    // the last peak of level 2 covers the frames 960..999
+    comparePeaks(pyramid.peak(2, 6, 0), referencePeak(samples, 1, 0, 960, 40));
+}
+
+void tst_QAudioPeakPyramid::peakForRange_combinesPeaksOfRange()
+{
+    const std::vector<float> samples = makeSignal(4096, 1);
+
+    QAudioPeakPyramidBuilder builder(1, 48000, 16);
+    builder.addFrames(samples);
+    builder.finish();
+    const QAudioPeakPyramid &pyramid = builder.pyramid();
+
+    // ranges aligned to the blocks are exact
+    comparePeaks(pyramid.peakForRange(0, 4096, 0), referencePeak(samples, 1, 0, 0, 4096));
+    comparePeaks(pyramid.peakForRange(1024, 2048, 0), referencePeak(samples, 1, 0, 1024, 1024));
+    comparePeaks(pyramid.peakForRange(32, 48, 0), referencePeak(samples, 1, 0, 32, 16));
+
+    // clamped to the signal
+    comparePeaks(pyramid.peakForRange(-100, 10'000, 0), referencePeak(samples, 1, 0, 0, 4096));
+
+    const Peak empty = pyramid.peakForRange(100, 100, 0);
+    QCOMPARE(empty, Peak{});
+}
+
+void tst_QAudioPeakPyramid::peakForRange_usesFinerLevels_forIncompleteCoarseLevels()
+{
+    const std::vector<float> samples = makeSignal(1000, 1);
+
+    // not finished: level 2 covers the frames 0..959 only
+    QAudioPeakPyramidBuilder builder(1, 48000, 10);
+    builder.addFrames(samples);
+
+    const QAudioPeakPyramid &pyramid = builder.pyramid();
+    QCOMPARE(pyramid.frameCount(), 1000);
+    comparePeaks(pyramid.peakForRange(0, 1000, 0), referencePeak(samples, 1, 0, 0, 1000));
+    comparePeaks(pyramid.peakForRange(640, 1000, 0), referencePeak(samples, 1, 0, 640, 360));
+}
+
+void tst_QAudioPeakPyramid::serialization_roundTrips()
+{
+    const std::vector<float> samples = makeSignal(5000, 2);
+
+    QAudioPeakPyramidBuilder builder(2, 44100, 32);
+    builder.addFrames(samples);
+    builder.finish();
+    const QAudioPeakPyramid &pyramid = builder.pyramid();
+
+    const std::optional<QAudioPeakPyramid> restored =
+            QAudioPeakPyramid::fromByteArray(pyramid.toByteArray());
+    QVERIFY(restored);
+    QCOMPARE(restored->channelCount(), 2);
+    QCOMPARE(restored->sampleRate(), 44100);
+    QCOMPARE(restored->blockFrames(), 32);
+    QCOMPARE(restored->frameCount(), 5000);
+    QCOMPARE(restored->levelCount(), pyramid.levelCount());
+
+    for (int level = 0; level < pyramid.levelCount(); ++level) {
+        QCOMPARE(restored->peakCount(level), pyramid.peakCount(level));
+        for (qsizetype i = 0; i < pyramid.peakCount(level); ++i)
+            QCOMPARE(restored->peak(level, i, 1), pyramid.peak(level, i, 1));
+    }
+}
+
+void tst_QAudioPeakPyramid::fromByteArray_rejectsCorruptedData()
+{
+    const std::vector<float> samples = makeSignal(500, 1);
+
+    QAudioPeakPyramidBuilder builder(1, 44100, 32);
+    builder.addFrames(samples);
+    builder.finish();
+    const QByteArray data = builder.pyramid().toByteArray();
+
+    QVERIFY(!QAudioPeakPyramid::fromByteArray({}));
+    QVERIFY(!QAudioPeakPyramid::fromByteArray(data.first(data.size() - 1)));
+
+    QByteArray wrongMagic = data;
+    wrongMagic[0] = char(wrongMagic[0] ^ 0xff);
+    QVERIFY(!QAudioPeakPyramid::fromByteArray(wrongMagic));
+}
+
+QTEST_GUILESS_MAIN(tst_QAudioPeakPyramid)
+
+#include "tst_qaudiopeakpyramid.moc"
@@ -5,6 +5,7 @@
 
 #include <QtMultimedia/private/qaudioringbuffer_p.h>
 
+#include <array>
 #include <chrono>
 #include <random>
 #include <thread>
@@ -19,8 +20,15 @@ private slots:
     void capacityAPIs();
     void reset();
 
+    void acquireWriteRegion_doesNotWrapAroundTheEnd();
+    void totalCounters_countTransferredElements();
+
     void stressTest();
     void stressTest_data();
+
+    void mpsc_acquireProducer_claimsDistinctLanes();
+    void mpsc_consume_reportsOffsetsPerLane();
+    void mpsc_stressTest();
 };
 
 struct IotaValidator
@@ -75,6 +83,50 @@ void tst_QAudioRingBuffer::reset()
     QCOMPARE(elementsConsumed, 0);
 }
 
+void tst_QAudioRingBuffer::acquireWriteRegion_doesNotWrapAroundTheEnd()
+{
+    QtPrivate::QAudioRingBuffer<int> ringbuffer{ 64 };
+
+    std::vector<int> data(48);
+    QCOMPARE(ringbuffer.write(data), 48);
+    QCOMPARE(ringbuffer.consumeAll([](auto) {
+    }), 48);
+
+    // the region ends at the end of the buffer, the next one starts at its beginning
+    QSpan<int> region = ringbuffer.acquireWriteRegion(32);
+    QCOMPARE(region.size(), 16);
+    ringbuffer.releaseWriteRegion(region.size());
+
+    region = ringbuffer.acquireWriteRegion(16);
+    QCOMPARE(region.size(), 16);
+    ringbuffer.releaseWriteRegion(region.size());
+
+    QCOMPARE(ringbuffer.used(), 32);
+    QCOMPARE(ringbuffer.acquireReadRegion(64).size(), 16);
+}
+
+void tst_QAudioRingBuffer::totalCounters_countTransferredElements()
+{
+    QtPrivate::QAudioRingBuffer<int> ringbuffer{ 7 };
+
+    std::vector<int> data(5);
+    for (int i = 0; i < 100; ++i) {
+        QCOMPARE(ringbuffer.write(data), 5);
+        QCOMPARE(ringbuffer.consume(3, [](auto) {
+        }), 3);
+        QCOMPARE(ringbuffer.consumeAll([](auto) {
+        }), 2);
+    }
+
+    QCOMPARE(ringbuffer.totalWritten(), 500u);
+    QCOMPARE(ringbuffer.totalRead(), 500u);
+    QCOMPARE(ringbuffer.used(), 0);
+
+    ringbuffer.reset();
+    QCOMPARE(ringbuffer.totalWritten(), 0u);
+    QCOMPARE(ringbuffer.totalRead(), 0u);
+}
+
 void tst_QAudioRingBuffer::stressTest()
 {
     using namespace std::chrono_literals;
@@ -152,6 +204,123 @@ void tst_QAudioRingBuffer::stressTest_data()
     QTest::newRow("rate limit consumer") << false << true << 64;
 }
 
+void tst_QAudioRingBuffer::mpsc_acquireProducer_claimsDistinctLanes()
+{
+    QtPrivate::QAudioMpscRingBuffer<int> ringbuffer{ 2, 16 };
+    QCOMPARE(ringbuffer.laneCount(), 2);
+    QCOMPARE(ringbuffer.laneSize(), 16);
+
+    auto first = ringbuffer.acquireProducer();
+    auto second = ringbuffer.acquireProducer();
+    QVERIFY(first.isValid());
+    QVERIFY(second.isValid());
+    QCOMPARE(ringbuffer.producerCount(), 2);
+
+    QVERIFY(!ringbuffer.acquireProducer().isValid());
+
+    first.release();
+    QVERIFY(!first.isValid());
+    QCOMPARE(ringbuffer.producerCount(), 1);
+
+    auto third = ringbuffer.acquireProducer();
+    QVERIFY(third.isValid());
+
+    // moving transfers the lane
+    auto moved = std::move(third);
+    QVERIFY(moved.isValid());
+    QVERIFY(!third.isValid());
+    QCOMPARE(ringbuffer.producerCount(), 2);
+}
+
+void tst_QAudioRingBuffer::mpsc_consume_reportsOffsetsPerLane()
+{
+    QtPrivate::QAudioMpscRingBuffer<int> ringbuffer{ 3, 8 };
+
+    auto first = ringbuffer.acquireProducer();
+    auto second = ringbuffer.acquireProducer();
+    QCOMPARE(first.write({ 1, 2, 3 }), 3);
+    QCOMPARE(second.write({ 10, 20, 30, 40, 50, 60, 70, 80, 90 }), 8);
+
+    // accumulate the lanes, like a mixer
+    std::vector<int> mix(4, 0);
+    const qsizetype consumed = ringbuffer.consume(4, [&](int, qsizetype offset,
+                                                         QSpan<const int> region) {
+        for (qsizetype i = 0; i < region.size(); ++i)
+            mix[offset + i] += region[i];
+    });
+
+    QCOMPARE(consumed, 4);
+    QCOMPARE(mix, (std::vector<int>{ 11, 22, 33, 40 }));
+    QCOMPARE(ringbuffer.used(0), 0);
+    QCOMPARE(ringbuffer.used(1), 4);
+    QCOMPARE(ringbuffer.used(2), 0);
+}
+
+void tst_QAudioRingBuffer::mpsc_stressTest()
+{
+    static constexpr int producerCount = 4;
+    static constexpr int elementsPerProducer = 100'000;
+    static constexpr int producerStride = 1'000'000;
+
+    QtPrivate::QAudioMpscRingBuffer<int> ringbuffer{ producerCount, 64 };
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < producerCount; ++p) {
+        producers.emplace_back([&, p] {
+            auto producer = ringbuffer.acquireProducer();
+            QTEST_ASSERT(producer.isValid());
+
+            std::mt19937 rng(p);
+            int index = 0;
+            std::vector<int> writeBuffer;
+            while (index < elementsPerProducer) {
+                std::uniform_int_distribution<int> sizeDist(
+                        1, std::min(32, elementsPerProducer - index));
+                writeBuffer.clear();
+                std::generate_n(std::back_inserter(writeBuffer), sizeDist(rng), [&] {
+                    return p * producerStride + index++;
+                });
+
+                QSpan<const int> writeRegion = writeBuffer;
+                while (!writeRegion.isEmpty()) {
+                    const qsizetype written = producer.write(writeRegion);
+                    if (written == 0)
+                        std::this_thread::yield();
+                    writeRegion = writeRegion.subspan(written);
+                }
+            }
+        });
+    }
+
+    // each producer keeps its lane, so the elements of a lane come from a single producer
+    std::array<IotaValidator, producerCount> validators;
+    std::array<int, producerCount> producerOfLane;
+    producerOfLane.fill(-1);
+    qsizetype elementsConsumed = 0;
+
+    auto validate = [&](int lane, qsizetype, QSpan<const int> region) {
+        for (int value : region) {
+            const int producer = value / producerStride;
+            if (producerOfLane[lane] == -1)
+                producerOfLane[lane] = producer;
+            QCOMPARE(producerOfLane[lane], producer);
+            QVERIFY(validators[producer].consumeAndValidate(value % producerStride));
+        }
+        elementsConsumed += region.size();
+    };
+
+    while (elementsConsumed != producerCount * elementsPerProducer) {
+        if (ringbuffer.consume(48, validate) == 0)
+            std::this_thread::yield();
+    }
+
+    for (std::thread &producer : producers)
+        producer.join();
+
+    for (const IotaValidator &validator : validators)
+        QCOMPARE(validator.state, elementsPerProducer);
+}
+
 QTEST_APPLESS_MAIN(tst_QAudioRingBuffer);
 
 #include "tst_qaudioringbuffer.moc"
@@ -0,0 +1,306 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QtTest/QtTest>
+
+#include <QtMultimedia/qvideoframe.h>
+#include <QtMultimedia/qvideoframeformat.h>
+
+#include "qffmpegconverter_p.h"
+
+#include <array>
+#include <cstdlib>
+
+// NOLINTBEGIN(readability-convert-member-functions-to-static)
+
+QT_USE_NAMESPACE
+
+using namespace QFFmpeg;
+
+namespace {
+
+constexpr QRgb red = 0xFFFF0000;
+constexpr QRgb green = 0xFF00FF00;
+constexpr QRgb blue = 0xFF0000FF;
+constexpr QRgb white = 0xFFFFFFFF;
+
+QVideoFrameFormat rgbaFormat(QSize size)
+{
+    return QVideoFrameFormat(size, QVideoFrameFormat::Format_RGBA8888);
+}
+
+// Creates an RGBA frame of four quadrants:
+//
+// *-------*-------*
+// |  red  | green |
+// *-------*-------*
+// | blue  | white |
+// *-------*-------*
+QVideoFrame createQuadrantFrame(QSize size)
+{
+    QVideoFrame frame(rgbaFormat(size));
+    if (!frame.map(QVideoFrame::WriteOnly))
+        return {};
+
+    for (int y = 0; y < size.height(); ++y) {
+        uchar *line = frame.bits(0) + y * frame.bytesPerLine(0);
+        for (int x = 0; x < size.width(); ++x) {
+            const bool right = x >= size.width() / 2;
+            const bool bottom = y >= size.height() / 2;
+            const QRgb color = bottom ? (right ? white : blue) : (right ? green : red);
+            uchar *pixel = line + x * 4;
+            pixel[0] = qRed(color);
+            pixel[1] = qGreen(color);
+            pixel[2] = qBlue(color);
+            pixel[3] = qAlpha(color);
+        }
+    }
+
+    frame.unmap();
+    return frame;
+}
+
+QRgb pixelAt(QVideoFrame &frame, QPoint pos)
+{
+    if (!frame.map(QVideoFrame::ReadOnly))
+        return 0;
+
+    const uchar *pixel = frame.bits(0) + pos.y() * frame.bytesPerLine(0) + pos.x() * 4;
+    const QRgb color = qRgba(pixel[0], pixel[1], pixel[2], pixel[3]);
+    frame.unmap();
+    return color;
+}
+
+// Whether the color matches, allowing for the rounding of the yuv conversions
+bool isSimilarColor(QRgb actual, QRgb expected)
+{
+    constexpr int tolerance = 8;
+    return std::abs(qRed(actual) - qRed(expected)) <= tolerance
+            && std::abs(qGreen(actual) - qGreen(expected)) <= tolerance
+            && std::abs(qBlue(actual) - qBlue(expected)) <= tolerance;
+}
+
+// Checks the color in the middle of each quadrant, away from the interpolated borders
+void verifyQuadrants(QVideoFrame &frame, const std::array<QRgb, 4> &expected)
+{
+    const int w = frame.width();
+    const int h = frame.height();
+    const std::array<QPoint, 4> centers = { QPoint(w / 4, h / 4), QPoint(w * 3 / 4, h / 4),
+                                            QPoint(w / 4, h * 3 / 4),
+                                            QPoint(w * 3 / 4, h * 3 / 4) };
+
+    for (size_t i = 0; i < centers.size(); ++i) {
+        const QRgb actual = pixelAt(frame, centers[i]);
+        QVERIFY2(isSimilarColor(actual, expected[i]),
+                 qPrintable(QStringLiteral("quadrant %1: %2 != %3")
+                                    .arg(i)
+                                    .arg(actual, 8, 16)
+                                    .arg(expected[i], 8, 16)));
+    }
+}
+
+} // namespace
+
+class tst_QFFmpegConverter : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void convert_keepsContent_whenFormatAndSizeMatch();
+    void convert_scalesFrame_toTargetSize_data();
+    void convert_scalesFrame_toTargetSize();
+    void convert_convertsThroughYuv_data();
+    void convert_convertsThroughYuv();
+    void setSourceRect_cropsFrame_toRect();
+    void setSourceRect_cropsYuvFrame_whenOriginIsOdd();
+    void setSourceRect_clipsRect_toFrame();
+    void convert_fails_whenSourceRectIsOutsideOfFrame();
+    void convertIntoFrame_reusesDestinationFrame();
+    void convertIntoFrame_fails_whenDestinationDoesNotMatchTargetFormat();
+};
+
+void tst_QFFmpegConverter::convert_keepsContent_whenFormatAndSizeMatch()
+{
+    const QSize size(64, 48);
+    QVideoFrame src = createQuadrantFrame(size);
+
+    VideoFrameConverter converter(rgbaFormat(size));
+    QVideoFrame dst = converter.convert(src);
+
+    QVERIFY(dst.isValid());
+    QCOMPARE(dst.pixelFormat(), QVideoFrameFormat::Format_RGBA8888);
+    QCOMPARE(dst.size(), size);
+    QCOMPARE(pixelAt(dst, { 0, 0 }), red);
+    QCOMPARE(pixelAt(dst, { size.width() - 1, 0 }), green);
+    QCOMPARE(pixelAt(dst, { 0, size.height() - 1 }), blue);
+    QCOMPARE(pixelAt(dst, { size.width() - 1, size.height() - 1 }), white);
+}
+
+void tst_QFFmpegConverter::convert_scalesFrame_toTargetSize_data()
+{
+    QTest::addColumn<QSize>("targetSize");
+
+    QTest::newRow("downscaling") << QSize(32, 24);
+    QTest::newRow("upscaling") << QSize(128, 96);
+    QTest::newRow("changing aspect ratio") << QSize(96, 24);
+}
+
+void tst_QFFmpegConverter::convert_scalesFrame_toTargetSize()
+{
+    QFETCH(QSize, targetSize);
+
+    QVideoFrame src = createQuadrantFrame({ 64, 48 });
+
+    VideoFrameConverter converter(rgbaFormat(targetSize));
+    QVideoFrame dst = converter.convert(src);
+
+    QVERIFY(dst.isValid());
+    QCOMPARE(dst.size(), targetSize);
+    verifyQuadrants(dst, { red, green, blue, white });
+}
+
+void tst_QFFmpegConverter::convert_convertsThroughYuv_data()
+{
+    QTest::addColumn<QVideoFrameFormat::PixelFormat>("yuvFormat");
+
+    QTest::newRow("YUV420P") << QVideoFrameFormat::Format_YUV420P;
+    QTest::newRow("NV12") << QVideoFrameFormat::Format_NV12;
+    QTest::newRow("YUYV") << QVideoFrameFormat::Format_YUYV;
+}
+
+void tst_QFFmpegConverter::convert_convertsThroughYuv()
+{
+    QFETCH(QVideoFrameFormat::PixelFormat, yuvFormat);
+
+    const QSize size(64, 48);
+    QVideoFrame src = createQuadrantFrame(size);
+
+    VideoFrameConverter toYuv(QVideoFrameFormat(size, yuvFormat));
+    QVideoFrame yuvFrame = toYuv.convert(src);
+    QVERIFY(yuvFrame.isValid());
+    QCOMPARE(yuvFrame.pixelFormat(), yuvFormat);
+
+    VideoFrameConverter toRgba(rgbaFormat(size / 2));
+    QVideoFrame dst = toRgba.convert(yuvFrame);
+    QVERIFY(dst.isValid());
+    verifyQuadrants(dst, { red, green, blue, white });
+}
+
+void tst_QFFmpegConverter::setSourceRect_cropsFrame_toRect()
+{
+    const QSize size(64, 48);
+    QVideoFrame src = createQuadrantFrame(size);
+
+    VideoFrameConverter converter(rgbaFormat({ 16, 12 }));
+    converter.setSourceRect(QRect(QPoint(size.width() / 2, 0), size / 2));
+    QCOMPARE(converter.sourceRect(), QRect(QPoint(size.width() / 2, 0), size / 2));
+
+    QVideoFrame dst = converter.convert(src);
+    QVERIFY(dst.isValid());
+    QCOMPARE(dst.size(), QSize(16, 12));
+    // the whole frame comes from the green quadrant
+    verifyQuadrants(dst, { green, green, green, green });
+
+    converter.setSourceRect(QRect(QPoint(0, size.height() / 2), size / 2));
+    dst = converter.convert(src);
+    QVERIFY(dst.isValid());
+    verifyQuadrants(dst, { blue, blue, blue, blue });
+
+    // a null rectangle selects the whole frame again
+    converter.setSourceRect({});
+    dst = converter.convert(src);
+    QVERIFY(dst.isValid());
+    verifyQuadrants(dst, { red, green, blue, white });
+}
+
+void tst_QFFmpegConverter::setSourceRect_cropsYuvFrame_whenOriginIsOdd()
+{
+    const QSize size(64, 48);
+    QVideoFrame rgbaFrame = createQuadrantFrame(size);
+    QVideoFrame src =
+            VideoFrameConverter(QVideoFrameFormat(size, QVideoFrameFormat::Format_YUV420P))
+                    .convert(rgbaFrame);
+    QVERIFY(src.isValid());
+
+    // the odd origin is moved to the even one of its chroma sample, at the white quadrant
+    VideoFrameConverter converter(rgbaFormat({ 16, 12 }));
+    converter.setSourceRect(QRect(QPoint(33, 25), QPoint(63, 47)));
+
+    QVideoFrame dst = converter.convert(src);
+    QVERIFY(dst.isValid());
+    verifyQuadrants(dst, { white, white, white, white });
+    QVERIFY(isSimilarColor(pixelAt(dst, { 0, 0 }), white));
+}
+
+void tst_QFFmpegConverter::setSourceRect_clipsRect_toFrame()
+{
+    const QSize size(64, 48);
+    QVideoFrame src = createQuadrantFrame(size);
+
+    // only the red quadrant is within the frame
+    VideoFrameConverter converter(rgbaFormat({ 16, 12 }));
+    converter.setSourceRect(QRect(-32, -24, 64, 48));
+
+    QVideoFrame dst = converter.convert(src);
+    QVERIFY(dst.isValid());
+    verifyQuadrants(dst, { red, red, red, red });
+}
+
+void tst_QFFmpegConverter::convert_fails_whenSourceRectIsOutsideOfFrame()
+{
+    QVideoFrame src = createQuadrantFrame({ 64, 48 });
+
+    VideoFrameConverter converter(rgbaFormat({ 16, 12 }));
+    converter.setSourceRect(QRect(100, 100, 16, 16));
+
+    QTest::ignoreMessage(QtCriticalMsg, QRegularExpression("outside of the frame"));
+    QVERIFY(!converter.convert(src).isValid());
+}
+
+void tst_QFFmpegConverter::convertIntoFrame_reusesDestinationFrame()
+{
+    const QSize size(64, 48);
+    QVideoFrame src = createQuadrantFrame(size);
+
+    const QVideoFrameFormat targetFormat = rgbaFormat(size / 2);
+    VideoFrameConverter converter(targetFormat);
+
+    QVideoFrame dst(targetFormat);
+    QVERIFY(dst.map(QVideoFrame::ReadOnly));
+    uchar *dstBits = dst.bits(0);
+    dst.unmap();
+
+    QVERIFY(converter.convert(src, dst));
+    verifyQuadrants(dst, { red, green, blue, white });
+
+    // the following conversions overwrite the same frame
+    converter.setSourceRect(QRect(QPoint(size.width() / 2, size.height() / 2), size / 2));
+    QVERIFY(converter.convert(src, dst));
+    verifyQuadrants(dst, { white, white, white, white });
+
+    QVERIFY(dst.map(QVideoFrame::ReadOnly));
+    QCOMPARE(dst.bits(0), dstBits);
+    dst.unmap();
+}
+
+void tst_QFFmpegConverter::convertIntoFrame_fails_whenDestinationDoesNotMatchTargetFormat()
+{
+    const QSize size(64, 48);
+    QVideoFrame src = createQuadrantFrame(size);
+
+    VideoFrameConverter converter(rgbaFormat(size));
+
+    QVideoFrame wrongSize(rgbaFormat(size / 2));
+    QTest::ignoreMessage(QtCriticalMsg, QRegularExpression("doesn't match the target format"));
+    QVERIFY(!converter.convert(src, wrongSize));
+
+    QVideoFrame wrongFormat(QVideoFrameFormat(size, QVideoFrameFormat::Format_BGRA8888));
+    QTest::ignoreMessage(QtCriticalMsg, QRegularExpression("doesn't match the target format"));
+    QVERIFY(!converter.convert(src, wrongFormat));
+}
+
+// NOLINTEND(readability-convert-member-functions-to-static)
+
+QTEST_GUILESS_MAIN(tst_QFFmpegConverter)
+
+#include "tst_qffmpegconverter.moc"
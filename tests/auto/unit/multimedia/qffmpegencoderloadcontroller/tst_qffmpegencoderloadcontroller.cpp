@@ -0,0 +1,296 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QtTest/QtTest>
+
+#include "recordingengine/qffmpegencoderloadcontroller_p.h"
+
+// NOLINTBEGIN(readability-convert-member-functions-to-static)
+
+QT_USE_NAMESPACE
+
+using namespace QFFmpeg;
+
+namespace {
+
+constexpr size_t MaxQueueSize = 6;
+constexpr size_t HighWatermark = MaxQueueSize / 2;
+
+// 25 fps source
+constexpr qint64 FrameDurationUs = 40'000;
+constexpr qint64 FastEncodingTimeUs = 1'000;
+constexpr qint64 SlowEncodingTimeUs = 50'000;
+
+int degradationLevel(const EncoderLoadController &controller)
+{
+    return controller.statistics().degradationLevel;
+}
+
+void encodeFrames(EncoderLoadController &controller, int count, qint64 encodingTimeUs,
+                  size_t queueSize)
+{
+    for (int i = 0; i < count; ++i)
+        controller.frameEncoded(encodingTimeUs, FrameDurationUs, queueSize);
+}
+
+// Steps one level down by keeping the queue at the high watermark
+void stepDown(EncoderLoadController &controller)
+{
+    encodeFrames(controller, MaxQueueSize, FastEncodingTimeUs, HighWatermark);
+}
+
+} // namespace
+
+class tst_QFFmpegEncoderLoadController : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void acceptFrame_dropsFrame_whenQueueIsFull();
+    void frameEncoded_keepsLevel_whenControllerIsDisabled();
+    void frameEncoded_stepsDown_whenEncoderIsSlowerThanSource();
+    void frameEncoded_stepsDown_whenQueueReachesHighWatermark();
+    void frameEncoded_stepsDownAtMostOncePerQueueLength();
+    void frameEncoded_doesNotStepDownBelowMaxLevel();
+    void frameEncoded_stepsUp_afterRecoveryFrameCountOfHealthyFrames();
+    void frameEncoded_restartsRecovery_whenQueueGrows();
+    void frameEncoded_doesNotStepUp_whenUpperLevelWouldBeOverloaded();
+    void acceptFrame_decimatesSourceFrames_onDegradationLevel_data();
+    void acceptFrame_decimatesSourceFrames_onDegradationLevel();
+    void acceptFrame_stepsDown_whenQueueStaysFull();
+    void setEnabled_resetsLevel_whenDisabled();
+    void statistics_reportsLoadOfSourceFrameRate();
+};
+
+void tst_QFFmpegEncoderLoadController::acceptFrame_dropsFrame_whenQueueIsFull()
+{
+    EncoderLoadController controller(MaxQueueSize);
+
+    QVERIFY(controller.acceptFrame(MaxQueueSize - 1));
+    QVERIFY(!controller.acceptFrame(MaxQueueSize));
+    QVERIFY(!controller.acceptFrame(MaxQueueSize + 1));
+
+    QCOMPARE(controller.statistics().droppedFrames, qint64(2));
+    QCOMPARE(degradationLevel(controller), 0);
+}
+
+void tst_QFFmpegEncoderLoadController::frameEncoded_keepsLevel_whenControllerIsDisabled()
+{
+    EncoderLoadController controller(MaxQueueSize);
+
+    encodeFrames(controller, 100, SlowEncodingTimeUs, MaxQueueSize);
+
+    QCOMPARE(degradationLevel(controller), 0);
+    QCOMPARE_GT(controller.statistics().load, 1.);
+}
+
+void tst_QFFmpegEncoderLoadController::frameEncoded_stepsDown_whenEncoderIsSlowerThanSource()
+{
+    EncoderLoadController controller(MaxQueueSize);
+    controller.setEnabled(true);
+
+    // the level is only changed after a queue length of frames
+    encodeFrames(controller, MaxQueueSize - 1, SlowEncodingTimeUs, 0);
+    QCOMPARE(degradationLevel(controller), 0);
+
+    encodeFrames(controller, 1, SlowEncodingTimeUs, 0);
+    QCOMPARE(degradationLevel(controller), 1);
+
+    // 50 ms per frame fits into the budget of two 40 ms frames
+    encodeFrames(controller, 100, SlowEncodingTimeUs, 0);
+    QCOMPARE(degradationLevel(controller), 1);
+}
+
+void tst_QFFmpegEncoderLoadController::frameEncoded_stepsDown_whenQueueReachesHighWatermark()
+{
+    EncoderLoadController controller(MaxQueueSize);
+    controller.setEnabled(true);
+
+    encodeFrames(controller, MaxQueueSize, FastEncodingTimeUs, HighWatermark - 1);
+    QCOMPARE(degradationLevel(controller), 0);
+
+    stepDown(controller);
+    QCOMPARE(degradationLevel(controller), 1);
+}
+
+void tst_QFFmpegEncoderLoadController::frameEncoded_stepsDownAtMostOncePerQueueLength()
+{
+    EncoderLoadController controller(MaxQueueSize);
+    controller.setEnabled(true);
+
+    stepDown(controller);
+    QCOMPARE(degradationLevel(controller), 1);
+
+    // the encoder gets the chance to drain the queue on the new level
+    encodeFrames(controller, MaxQueueSize - 1, FastEncodingTimeUs, MaxQueueSize);
+    QCOMPARE(degradationLevel(controller), 1);
+
+    encodeFrames(controller, 1, FastEncodingTimeUs, MaxQueueSize);
+    QCOMPARE(degradationLevel(controller), 2);
+}
+
+void tst_QFFmpegEncoderLoadController::frameEncoded_doesNotStepDownBelowMaxLevel()
+{
+    EncoderLoadController controller(MaxQueueSize);
+    controller.setEnabled(true);
+
+    for (int i = 0; i < EncoderLoadController::MaxDegradationLevel + 2; ++i)
+        stepDown(controller);
+
+    QCOMPARE(degradationLevel(controller), EncoderLoadController::MaxDegradationLevel);
+}
+
+void tst_QFFmpegEncoderLoadController::frameEncoded_stepsUp_afterRecoveryFrameCountOfHealthyFrames()
+{
+    EncoderLoadController controller(MaxQueueSize);
+    controller.setEnabled(true);
+    stepDown(controller);
+    stepDown(controller);
+    QCOMPARE(degradationLevel(controller), 2);
+
+    encodeFrames(controller, EncoderLoadController::RecoveryFrameCount - 1, FastEncodingTimeUs,
+                 1);
+    QCOMPARE(degradationLevel(controller), 2);
+
+    encodeFrames(controller, 1, FastEncodingTimeUs, 1);
+    QCOMPARE(degradationLevel(controller), 1);
+
+    // one level per recovery period
+    encodeFrames(controller, EncoderLoadController::RecoveryFrameCount - 1, FastEncodingTimeUs,
+                 0);
+    QCOMPARE(degradationLevel(controller), 1);
+
+    encodeFrames(controller, 1, FastEncodingTimeUs, 0);
+    QCOMPARE(degradationLevel(controller), 0);
+}
+
+void tst_QFFmpegEncoderLoadController::frameEncoded_restartsRecovery_whenQueueGrows()
+{
+    EncoderLoadController controller(MaxQueueSize);
+    controller.setEnabled(true);
+    stepDown(controller);
+
+    encodeFrames(controller, EncoderLoadController::RecoveryFrameCount - 1, FastEncodingTimeUs,
+                 0);
+
+    // below the high watermark, so no step down, but not healthy either
+    encodeFrames(controller, 1, FastEncodingTimeUs, HighWatermark - 1);
+    QCOMPARE(degradationLevel(controller), 1);
+
+    encodeFrames(controller, EncoderLoadController::RecoveryFrameCount - 1, FastEncodingTimeUs,
+                 0);
+    QCOMPARE(degradationLevel(controller), 1);
+
+    encodeFrames(controller, 1, FastEncodingTimeUs, 0);
+    QCOMPARE(degradationLevel(controller), 0);
+}
+
+void tst_QFFmpegEncoderLoadController::frameEncoded_doesNotStepUp_whenUpperLevelWouldBeOverloaded()
+{
+    EncoderLoadController controller(MaxQueueSize);
+    controller.setEnabled(true);
+
+    // 32 ms per frame fits into the budget of level 1, but the load on level 0 would
+    // be 0.8, above the recovery threshold
+    constexpr qint64 encodingTimeUs = 32'000;
+    encodeFrames(controller, MaxQueueSize, encodingTimeUs, HighWatermark);
+    QCOMPARE(degradationLevel(controller), 1);
+
+    encodeFrames(controller, EncoderLoadController::RecoveryFrameCount * 10, encodingTimeUs, 0);
+
+    QCOMPARE(degradationLevel(controller), 1);
+}
+
+void tst_QFFmpegEncoderLoadController::acceptFrame_decimatesSourceFrames_onDegradationLevel_data()
+{
+    QTest::addColumn<int>("level");
+
+    QTest::newRow("level 1") << 1;
+    QTest::newRow("level 2") << 2;
+    QTest::newRow("level 3") << 3;
+}
+
+void tst_QFFmpegEncoderLoadController::acceptFrame_decimatesSourceFrames_onDegradationLevel()
+{
+    QFETCH(const int, level);
+
+    EncoderLoadController controller(MaxQueueSize);
+    controller.setEnabled(true);
+    for (int i = 0; i < level; ++i)
+        stepDown(controller);
+    QCOMPARE(degradationLevel(controller), level);
+
+    const int sourceFrameCount = 12 * (level + 1);
+    int acceptedCount = 0;
+    int lastAccepted = -1;
+    for (int i = 0; i < sourceFrameCount; ++i) {
+        if (!controller.acceptFrame(0))
+            continue;
+
+        // every (level + 1)th frame
+        if (lastAccepted >= 0)
+            QCOMPARE(i - lastAccepted, level + 1);
+        lastAccepted = i;
+        ++acceptedCount;
+    }
+
+    QCOMPARE(acceptedCount, sourceFrameCount / (level + 1));
+    QCOMPARE(controller.statistics().droppedFrames, qint64(sourceFrameCount - acceptedCount));
+}
+
+void tst_QFFmpegEncoderLoadController::acceptFrame_stepsDown_whenQueueStaysFull()
+{
+    EncoderLoadController controller(MaxQueueSize);
+    controller.setEnabled(true);
+
+    // not enough frames encoded since the start
+    QVERIFY(!controller.acceptFrame(MaxQueueSize));
+    QCOMPARE(degradationLevel(controller), 0);
+
+    encodeFrames(controller, MaxQueueSize, FastEncodingTimeUs, 0);
+    QVERIFY(!controller.acceptFrame(MaxQueueSize));
+    QCOMPARE(degradationLevel(controller), 1);
+
+    // the queue stays full for a while after stepping down
+    QVERIFY(!controller.acceptFrame(MaxQueueSize));
+    QCOMPARE(degradationLevel(controller), 1);
+
+    QCOMPARE(controller.statistics().droppedFrames, qint64(3));
+}
+
+void tst_QFFmpegEncoderLoadController::setEnabled_resetsLevel_whenDisabled()
+{
+    EncoderLoadController controller(MaxQueueSize);
+    controller.setEnabled(true);
+    stepDown(controller);
+    QCOMPARE(degradationLevel(controller), 1);
+
+    controller.setEnabled(false);
+
+    QVERIFY(!controller.isEnabled());
+    QCOMPARE(degradationLevel(controller), 0);
+    QVERIFY(controller.acceptFrame(0));
+    QVERIFY(controller.acceptFrame(0));
+}
+
+void tst_QFFmpegEncoderLoadController::statistics_reportsLoadOfSourceFrameRate()
+{
+    EncoderLoadController controller(MaxQueueSize);
+    QCOMPARE(controller.statistics().load, 0.);
+
+    // the first sample initializes the averages
+    controller.frameEncoded(FrameDurationUs / 2, FrameDurationUs, 0);
+    QCOMPARE(controller.statistics().load, 0.5);
+
+    // the load is relative to the source frame rate, regardless of the level
+    controller.setEnabled(true);
+    encodeFrames(controller, MaxQueueSize, FrameDurationUs / 2, HighWatermark);
+    QCOMPARE(degradationLevel(controller), 1);
+    QCOMPARE(controller.statistics().load, 0.5);
+}
+
+// NOLINTEND(readability-convert-member-functions-to-static)
+
+QTEST_GUILESS_MAIN(tst_QFFmpegEncoderLoadController)
+
+#include "tst_qffmpegencoderloadcontroller.moc"
@@ -0,0 +1,169 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QtTest/QtTest>
+
+#include "qffmpegframepool_p.h"
+
+#include <cstring>
+#include <vector>
+
+// NOLINTBEGIN(readability-convert-member-functions-to-static)
+
+QT_USE_NAMESPACE
+
+using namespace QFFmpeg;
+
+namespace {
+
+const uint8_t *bufferData(const AVFrameUPtr &frame)
+{
+    return frame && frame->buf[0] ? frame->buf[0]->data : nullptr;
+}
+
+} // namespace
+
+class tst_QFFmpegFramePool : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void get_returnsNull_whenPoolIsNotSetUp();
+    void get_returnsFrameOfPoolFormatAndSize();
+    void get_reusesBuffer_whenPreviousFrameIsReleased();
+    void get_returnsDistinctBuffers_whenFramesAreHeld();
+    void reset_keepsFrames_whenParametersChange();
+    void reset_fails_whenFormatIsNotSupported();
+    void audioGet_reusesBuffer_whenPreviousFrameIsReleased();
+};
+
+void tst_QFFmpegFramePool::get_returnsNull_whenPoolIsNotSetUp()
+{
+    AVFramePool pool;
+    QVERIFY(!pool.get());
+
+    AVAudioFramePool audioPool;
+    QVERIFY(!audioPool.get());
+}
+
+void tst_QFFmpegFramePool::get_returnsFrameOfPoolFormatAndSize()
+{
+    AVFramePool pool;
+    QVERIFY(pool.reset(AV_PIX_FMT_YUV420P, QSize(350, 200)));
+
+    const AVFrameUPtr frame = pool.get();
+
+    QVERIFY(frame);
+    QCOMPARE(AVPixelFormat(frame->format), AV_PIX_FMT_YUV420P);
+    QCOMPARE(frame->width, 350);
+    QCOMPARE(frame->height, 200);
+    for (int plane = 0; plane < 3; ++plane) {
+        QVERIFY(frame->data[plane]);
+        QCOMPARE(frame->linesize[plane] % 64, 0);
+        QVERIFY(reinterpret_cast<quintptr>(frame->data[plane]) % 64 == 0);
+    }
+}
+
+void tst_QFFmpegFramePool::get_reusesBuffer_whenPreviousFrameIsReleased()
+{
+    AVFramePool pool;
+    QVERIFY(pool.reset(AV_PIX_FMT_NV12, QSize(640, 480)));
+
+    AVFrameUPtr frame = pool.get();
+    QVERIFY(frame);
+    const uint8_t *data = bufferData(frame);
+
+    // a reference held by the encoder keeps the buffer out of the pool
+    AVFrameUPtr encoderRef = makeAVFrame();
+    QCOMPARE(av_frame_ref(encoderRef.get(), frame.get()), 0);
+    frame.reset();
+
+    AVFrameUPtr otherFrame = pool.get();
+    QVERIFY(otherFrame);
+    QCOMPARE_NE(bufferData(otherFrame), data);
+    otherFrame.reset();
+
+    // Act
+    encoderRef.reset();
+    const AVFrameUPtr reusedFrame = pool.get();
+
+    // Assert
+    QVERIFY(reusedFrame);
+    QCOMPARE(bufferData(reusedFrame), data);
+}
+
+void tst_QFFmpegFramePool::get_returnsDistinctBuffers_whenFramesAreHeld()
+{
+    AVFramePool pool;
+    QVERIFY(pool.reset(AV_PIX_FMT_RGBA, QSize(64, 64)));
+
+    std::vector<AVFrameUPtr> frames;
+    QSet<const uint8_t *> buffers;
+    for (int i = 0; i < 4; ++i) {
+        frames.push_back(pool.get());
+        QVERIFY(frames.back());
+        buffers.insert(bufferData(frames.back()));
+    }
+
+    QCOMPARE(buffers.size(), 4);
+}
+
+void tst_QFFmpegFramePool::reset_keepsFrames_whenParametersChange()
+{
+    AVFramePool pool;
+    QVERIFY(pool.reset(AV_PIX_FMT_RGBA, QSize(64, 64)));
+    const AVFrameUPtr oldFrame = pool.get();
+    QVERIFY(oldFrame);
+    std::memset(oldFrame->data[0], 0x5a, size_t(oldFrame->linesize[0]) * 64);
+
+    // same parameters keep the pool
+    QVERIFY(pool.reset(AV_PIX_FMT_RGBA, QSize(64, 64)));
+
+    QVERIFY(pool.reset(AV_PIX_FMT_YUV420P, QSize(32, 32)));
+    const AVFrameUPtr newFrame = pool.get();
+
+    QVERIFY(newFrame);
+    QCOMPARE(AVPixelFormat(newFrame->format), AV_PIX_FMT_YUV420P);
+    QCOMPARE(newFrame->width, 32);
+    QCOMPARE(pool.format(), AV_PIX_FMT_YUV420P);
+    QCOMPARE(pool.size(), QSize(32, 32));
+
+    // the frames of the released pool stay valid until they are released
+    QCOMPARE(oldFrame->data[0][oldFrame->linesize[0] * 63], uint8_t(0x5a));
+}
+
+void tst_QFFmpegFramePool::reset_fails_whenFormatIsNotSupported()
+{
+    AVFramePool pool;
+
+    QTest::ignoreMessage(QtWarningMsg, QRegularExpression("Cannot create frame pool"));
+    QVERIFY(!pool.reset(AV_PIX_FMT_NONE, QSize(64, 64)));
+    QVERIFY(!pool.get());
+}
+
+void tst_QFFmpegFramePool::audioGet_reusesBuffer_whenPreviousFrameIsReleased()
+{
+    AVAudioFramePool pool;
+    QVERIFY(pool.reset(AV_SAMPLE_FMT_FLTP, 2, 1024));
+
+    AVFrameUPtr frame = pool.get();
+    QVERIFY(frame);
+    QCOMPARE(frame->nb_samples, 1024);
+    QVERIFY(frame->data[0]);
+    QVERIFY(frame->data[1]);
+    const uint8_t *data = bufferData(frame);
+
+    const AVFrameUPtr otherFrame = pool.get();
+    QCOMPARE_NE(bufferData(otherFrame), data);
+
+    frame.reset();
+    const AVFrameUPtr reusedFrame = pool.get();
+
+    QCOMPARE(bufferData(reusedFrame), data);
+}
+
+// NOLINTEND(readability-convert-member-functions-to-static)
+
+QTEST_GUILESS_MAIN(tst_QFFmpegFramePool)
+
+#include "tst_qffmpegframepool.moc"
@@ -0,0 +1,232 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QtTest/QtTest>
+
+#include "recordingengine/qffmpegframesendpipeline_p.h"
+
+#include <vector>
+
+// NOLINTBEGIN(readability-convert-member-functions-to-static)
+
+QT_USE_NAMESPACE
+
+using namespace QFFmpeg;
+
+namespace {
+
+constexpr int64_t FlushPts = -1;
+
+AVFrameUPtr createFrame(int64_t pts)
+{
+    AVFrameUPtr frame = makeAVFrame();
+    frame->pts = pts;
+    return frame;
+}
+
+// Emulates a codec with a packet queue of limited capacity, which returns
+// EAGAIN until the packets are received, like the encoders on the encode2 API.
+class FakeCodecDelegate : public FrameSendPipeline::Delegate
+{
+public:
+    explicit FakeCodecDelegate(bool pipelined) : m_pipelined(pipelined) { }
+
+    bool prepareConversion(const AVFrame &frame) override
+    {
+        return frame.pts != failingPreparationPts;
+    }
+
+    bool canPipelineConversion() const override { return m_pipelined; }
+
+    QMaybe<AVFrameUPtr, int> convertFrame(AVFrameUPtr frame) override
+    {
+        conversionThreads.push_back(QThread::currentThread());
+        if (frame->pts == failingConversionPts)
+            return AVERROR(ENOMEM);
+
+        // the converted frame is a new one, like the one of the scaler
+        return createFrame(frame->pts);
+    }
+
+    int sendFrameToCodec(AVFrame *frame) override
+    {
+        if (queuedPacketCount == capacity) {
+            ++eagainCount;
+            return AVERROR(EAGAIN);
+        }
+
+        const int64_t pts = frame ? frame->pts : FlushPts;
+        if (pts == failingCodecPts)
+            return AVERROR(EINVAL);
+
+        ++queuedPacketCount;
+        sentPts.push_back(pts);
+        return 0;
+    }
+
+    void receivePackets() { queuedPacketCount = 0; }
+
+    int capacity = 2;
+    int64_t failingPreparationPts = -2;
+    int64_t failingConversionPts = -2;
+    int64_t failingCodecPts = -2;
+
+    std::vector<int64_t> sentPts;
+    std::vector<QThread *> conversionThreads;
+    int eagainCount = 0;
+
+private:
+    const bool m_pipelined;
+    int queuedPacketCount = 0;
+};
+
+// Sends the frame like the encoder thread: on EAGAIN, receives the packets and
+// resends the pending frames until the codec accepts them
+int encode(FrameSendPipeline &pipeline, FakeCodecDelegate &codec, AVFrameUPtr frame)
+{
+    int status = pipeline.sendFrame(std::move(frame));
+    while (status == AVERROR(EAGAIN)) {
+        codec.receivePackets();
+        status = pipeline.sendPendingFrames();
+    }
+    return status;
+}
+
+std::vector<int64_t> framesAndFlush(std::vector<int64_t> pts)
+{
+    pts.push_back(FlushPts);
+    return pts;
+}
+
+} // namespace
+
+class tst_QFFmpegFrameSendPipeline : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase_data();
+
+    void sendFrame_sendsFramesInOrderAndFlushLast_whenCodecReturnsEagain();
+    void sendFrame_convertsOnWorkerThread_onlyIfConversionCanBePipelined();
+    void sendFrame_sendsNextFrame_whenCodecRejectsPreviousFrame();
+    void sendFrame_sendsNextFrame_whenConversionOfPreviousFrameFails();
+    void sendFrame_returnsError_whenConversionCannotBePrepared();
+    void sendFrame_flushesCodec_whenNoFrameWasSent();
+};
+
+void tst_QFFmpegFrameSendPipeline::initTestCase_data()
+{
+    QTest::addColumn<bool>("pipelined");
+
+    QTest::newRow("pipelined") << true;
+    QTest::newRow("not pipelined") << false;
+}
+
+void tst_QFFmpegFrameSendPipeline::sendFrame_sendsFramesInOrderAndFlushLast_whenCodecReturnsEagain()
+{
+    QFETCH_GLOBAL(const bool, pipelined);
+
+    FakeCodecDelegate codec(pipelined);
+    FrameSendPipeline pipeline(codec);
+
+    for (int64_t pts = 0; pts < 10; ++pts)
+        QCOMPARE(encode(pipeline, codec, createFrame(pts)), 0);
+    QCOMPARE(encode(pipeline, codec, nullptr), 0);
+
+    QCOMPARE_GT(codec.eagainCount, 0);
+    QCOMPARE(codec.sentPts, framesAndFlush({ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 }));
+}
+
+void tst_QFFmpegFrameSendPipeline::sendFrame_convertsOnWorkerThread_onlyIfConversionCanBePipelined()
+{
+    QFETCH_GLOBAL(const bool, pipelined);
+
+    FakeCodecDelegate codec(pipelined);
+    FrameSendPipeline pipeline(codec);
+
+    for (int64_t pts = 0; pts < 3; ++pts)
+        QCOMPARE(encode(pipeline, codec, createFrame(pts)), 0);
+    QCOMPARE(encode(pipeline, codec, nullptr), 0);
+
+    QCOMPARE(codec.conversionThreads.size(), size_t(3));
+    for (QThread *thread : codec.conversionThreads)
+        QCOMPARE(thread != QThread::currentThread(), pipelined);
+}
+
+void tst_QFFmpegFrameSendPipeline::sendFrame_sendsNextFrame_whenCodecRejectsPreviousFrame()
+{
+    QFETCH_GLOBAL(const bool, pipelined);
+
+    FakeCodecDelegate codec(pipelined);
+    codec.failingCodecPts = 2;
+    FrameSendPipeline pipeline(codec);
+
+    std::vector<int> statuses;
+    for (int64_t pts = 0; pts < 5; ++pts)
+        statuses.push_back(encode(pipeline, codec, createFrame(pts)));
+    statuses.push_back(encode(pipeline, codec, nullptr));
+
+    // the pipelined frame reaches the codec upon the next call, which reports the failure
+    const int failingCall = pipelined ? 3 : 2;
+    for (int i = 0; i < int(statuses.size()); ++i)
+        QCOMPARE(statuses[i], i == failingCall ? AVERROR(EINVAL) : 0);
+
+    QCOMPARE(codec.sentPts, framesAndFlush({ 0, 1, 3, 4 }));
+}
+
+void tst_QFFmpegFrameSendPipeline::sendFrame_sendsNextFrame_whenConversionOfPreviousFrameFails()
+{
+    QFETCH_GLOBAL(const bool, pipelined);
+
+    FakeCodecDelegate codec(pipelined);
+    codec.failingConversionPts = 1;
+    FrameSendPipeline pipeline(codec);
+
+    int failureCount = 0;
+    for (int64_t pts = 0; pts < 4; ++pts) {
+        const int status = encode(pipeline, codec, createFrame(pts));
+        if (status != 0) {
+            QCOMPARE(status, AVERROR(ENOMEM));
+            ++failureCount;
+        }
+    }
+    QCOMPARE(encode(pipeline, codec, nullptr), 0);
+
+    QCOMPARE(failureCount, 1);
+    QCOMPARE(codec.sentPts, framesAndFlush({ 0, 2, 3 }));
+}
+
+void tst_QFFmpegFrameSendPipeline::sendFrame_returnsError_whenConversionCannotBePrepared()
+{
+    QFETCH_GLOBAL(const bool, pipelined);
+
+    FakeCodecDelegate codec(pipelined);
+    codec.failingPreparationPts = 1;
+    FrameSendPipeline pipeline(codec);
+
+    QCOMPARE(encode(pipeline, codec, createFrame(0)), 0);
+    QCOMPARE(encode(pipeline, codec, createFrame(1)), AVERROR(EINVAL));
+    QCOMPARE(encode(pipeline, codec, createFrame(2)), 0);
+    QCOMPARE(encode(pipeline, codec, nullptr), 0);
+
+    QCOMPARE(codec.sentPts, framesAndFlush({ 0, 2 }));
+}
+
+void tst_QFFmpegFrameSendPipeline::sendFrame_flushesCodec_whenNoFrameWasSent()
+{
+    QFETCH_GLOBAL(const bool, pipelined);
+
+    FakeCodecDelegate codec(pipelined);
+    FrameSendPipeline pipeline(codec);
+
+    QCOMPARE(encode(pipeline, codec, nullptr), 0);
+
+    QCOMPARE(codec.sentPts, framesAndFlush({}));
+}
+
+// NOLINTEND(readability-convert-member-functions-to-static)
+
+QTEST_GUILESS_MAIN(tst_QFFmpegFrameSendPipeline)
+
+#include "tst_qffmpegframesendpipeline.moc"
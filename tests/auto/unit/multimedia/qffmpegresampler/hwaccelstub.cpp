@@ -0,0 +1,27 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include "qffmpeghwaccel_p.h"
+
+QT_BEGIN_NAMESPACE
+
+namespace QFFmpeg {
+
+// The resampler doesn't use hardware devices; the codec storage only asks for them
+// when it looks codecs up.
+
+const std::vector<AVHWDeviceType> &HWAccel::encodingDeviceTypes()
+{
+    static const std::vector<AVHWDeviceType> result;
+    return result;
+}
+
+const std::vector<AVHWDeviceType> &HWAccel::decodingDeviceTypes()
+{
+    static const std::vector<AVHWDeviceType> result;
+    return result;
+}
+
+} // namespace QFFmpeg
+
+QT_END_NAMESPACE
@@ -0,0 +1,354 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QtTest/QtTest>
+
+#include "qffmpegresampler_p.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+// NOLINTBEGIN(readability-convert-member-functions-to-static)
+
+QT_USE_NAMESPACE
+
+using namespace QFFmpeg;
+
+namespace {
+
+// Written behind the output bounds to detect overruns
+constexpr std::byte GuardByte{ 0xA5 };
+constexpr qsizetype GuardSize = 256;
+
+QAudioFormat stereoFormat(QAudioFormat::SampleFormat sampleFormat, int sampleRate)
+{
+    QAudioFormat format;
+    format.setSampleFormat(sampleFormat);
+    format.setChannelCount(2);
+    format.setSampleRate(sampleRate);
+    return format;
+}
+
+// A sine-like ramp, so that the resampler filters produce non-trivial output
+std::vector<std::byte> makeInput(const QAudioFormat &format, int frames, int seed = 0)
+{
+    Q_ASSERT(format.sampleFormat() == QAudioFormat::Int16);
+
+    std::vector<qint16> samples(frames * format.channelCount());
+    for (size_t i = 0; i < samples.size(); ++i)
+        samples[i] = qint16((int(i) * 37 + seed * 1000) % 20000 - 10000);
+
+    std::vector<std::byte> bytes(samples.size() * sizeof(qint16));
+    std::memcpy(bytes.data(), samples.data(), bytes.size());
+    return bytes;
+}
+
+QSpan<const std::byte> asSpan(const std::vector<std::byte> &data)
+{
+    return { data.data(), qsizetype(data.size()) };
+}
+
+// An output of the given frame count followed by the guard bytes
+struct GuardedOutput
+{
+    GuardedOutput(const QAudioFormat &format, int frames)
+        : size(format.bytesForFrames(frames)), storage(size + GuardSize, GuardByte)
+    {
+    }
+
+    QSpan<std::byte> span() { return { storage.data(), size }; }
+
+    bool isGuardIntact() const
+    {
+        return std::all_of(storage.begin() + size, storage.end(),
+                           [](std::byte b) { return b == GuardByte; });
+    }
+
+    qsizetype size;
+    std::vector<std::byte> storage;
+};
+
+AVFrameUPtr makeS16Frame(const std::vector<std::byte> &data, const QAudioFormat &format)
+{
+    AVFrameUPtr frame = makeAVFrame();
+    frame->format = AV_SAMPLE_FMT_S16;
+    frame->sample_rate = format.sampleRate();
+    frame->nb_samples = format.framesForBytes(qint32(data.size()));
+    // interleaved data lives in the first plane
+    frame->data[0] = reinterpret_cast<uint8_t *>(const_cast<std::byte *>(data.data()));
+    frame->linesize[0] = int(data.size());
+    frame->extended_data = frame->data;
+    return frame;
+}
+
+} // namespace
+
+class tst_QFFmpegResampler : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void resampleSpan_copiesInput_whenFormatsMatch();
+    void resampleFrame_producesSameOutputAsSpanInput();
+    void resampleSpan_keepsRemainingFrames_whenOutputIsTooSmall();
+
+    void maxOutputFrames_boundsOutput_data();
+    void maxOutputFrames_boundsOutput();
+    void maxOutputFrames_boundsOutput_withSampleCompensation();
+
+    void resampleBuffer_reusesPooledBuffer_whenReleased();
+    void resampleBuffer_doesNotReusePooledBuffer_whileConsumerHoldsCopy();
+    void resampleBuffer_allocatesBuffer_whenAllPooledBuffersAreHeld();
+};
+
+void tst_QFFmpegResampler::resampleSpan_copiesInput_whenFormatsMatch()
+{
+    const QAudioFormat format = stereoFormat(QAudioFormat::Int16, 48000);
+    QFFmpegResampler resampler(format, format);
+
+    const std::vector<std::byte> input = makeInput(format, 480);
+    GuardedOutput output(format, resampler.maxOutputFrames(480));
+
+    const int frames = resampler.resample(asSpan(input), output.span());
+
+    QCOMPARE(frames, 480);
+    QVERIFY(std::equal(input.begin(), input.end(), output.storage.begin()));
+    QVERIFY(output.isGuardIntact());
+    QCOMPARE(resampler.samplesProcessed(), qint64(480));
+}
+
+void tst_QFFmpegResampler::resampleFrame_producesSameOutputAsSpanInput()
+{
+    const QAudioFormat inputFormat = stereoFormat(QAudioFormat::Int16, 48000);
+    const QAudioFormat outputFormat = stereoFormat(QAudioFormat::Float, 44100);
+    QFFmpegResampler spanResampler(inputFormat, outputFormat);
+    QFFmpegResampler frameResampler(inputFormat, outputFormat);
+
+    for (int chunk = 0; chunk < 4; ++chunk) {
+        const std::vector<std::byte> input = makeInput(inputFormat, 1024, chunk);
+        const AVFrameUPtr frame = makeS16Frame(input, inputFormat);
+
+        GuardedOutput spanOutput(outputFormat, spanResampler.maxOutputFrames(1024));
+        GuardedOutput frameOutput(outputFormat, frameResampler.maxOutputFrames(1024));
+
+        const int spanFrames = spanResampler.resample(asSpan(input), spanOutput.span());
+        const int frameFrames = frameResampler.resample(frame.get(), frameOutput.span());
+
+        QCOMPARE(frameFrames, spanFrames);
+        QVERIFY(std::equal(spanOutput.storage.begin(),
+                           spanOutput.storage.begin() + outputFormat.bytesForFrames(spanFrames),
+                           frameOutput.storage.begin()));
+        QVERIFY(frameOutput.isGuardIntact());
+    }
+}
+
+void tst_QFFmpegResampler::resampleSpan_keepsRemainingFrames_whenOutputIsTooSmall()
+{
+    const QAudioFormat inputFormat = stereoFormat(QAudioFormat::Int16, 44100);
+    const QAudioFormat outputFormat = stereoFormat(QAudioFormat::Int16, 48000);
+    const std::vector<std::byte> input = makeInput(inputFormat, 4410);
+
+    QFFmpegResampler referenceResampler(inputFormat, outputFormat);
+    GuardedOutput referenceOutput(outputFormat, referenceResampler.maxOutputFrames(4410));
+    const int referenceFrames =
+            referenceResampler.resample(asSpan(input), referenceOutput.span());
+    QCOMPARE_GT(referenceFrames, 0);
+
+    QFFmpegResampler resampler(inputFormat, outputFormat);
+    const int halfFrames = referenceFrames / 2;
+    GuardedOutput firstOutput(outputFormat, halfFrames);
+    QCOMPARE(resampler.resample(asSpan(input), firstOutput.span()), halfFrames);
+    QVERIFY(firstOutput.isGuardIntact());
+
+    // the next call writes the kept frames first
+    GuardedOutput secondOutput(outputFormat, resampler.maxOutputFrames(0));
+    const int secondFrames = resampler.resample(QSpan<const std::byte>{}, secondOutput.span());
+
+    QCOMPARE_GE(halfFrames + secondFrames, referenceFrames);
+    QVERIFY(std::equal(referenceOutput.storage.begin(),
+                       referenceOutput.storage.begin() + outputFormat.bytesForFrames(halfFrames),
+                       firstOutput.storage.begin()));
+    QVERIFY(std::equal(referenceOutput.storage.begin() + outputFormat.bytesForFrames(halfFrames),
+                       referenceOutput.storage.begin()
+                               + outputFormat.bytesForFrames(referenceFrames),
+                       secondOutput.storage.begin()));
+}
+
+void tst_QFFmpegResampler::maxOutputFrames_boundsOutput_data()
+{
+    QTest::addColumn<int>("inputRate");
+    QTest::addColumn<int>("outputRate");
+
+    QTest::newRow("same rate") << 48000 << 48000;
+    QTest::newRow("48000 -> 44100") << 48000 << 44100;
+    QTest::newRow("44100 -> 48000") << 44100 << 48000;
+    QTest::newRow("8000 -> 48000") << 8000 << 48000;
+    QTest::newRow("96000 -> 8000") << 96000 << 8000;
+}
+
+void tst_QFFmpegResampler::maxOutputFrames_boundsOutput()
+{
+    QFETCH(const int, inputRate);
+    QFETCH(const int, outputRate);
+
+    const QAudioFormat inputFormat = stereoFormat(QAudioFormat::Int16, inputRate);
+    const QAudioFormat outputFormat = stereoFormat(QAudioFormat::Float, outputRate);
+    QFFmpegResampler resampler(inputFormat, outputFormat);
+
+    // chunks of various sizes, as they come from decoders and audio devices
+    const int chunkSizes[] = { 1, 7, 441, 1024, 4096, 13, 1000, 2, 8192, 480 };
+    qint64 inputFrames = 0;
+    qint64 outputFrames = 0;
+
+    for (int i = 0; i < int(std::size(chunkSizes)); ++i) {
+        const int chunkSize = chunkSizes[i];
+        const std::vector<std::byte> input = makeInput(inputFormat, chunkSize, i);
+
+        const int maxFrames = resampler.maxOutputFrames(chunkSize);
+        GuardedOutput output(outputFormat, maxFrames);
+        const int frames = resampler.resample(asSpan(input), output.span());
+
+        QCOMPARE_GE(frames, 0);
+        QCOMPARE_LE(frames, maxFrames);
+        QVERIFY2(output.isGuardIntact(), "the resampler wrote past maxOutputFrames");
+
+        inputFrames += chunkSize;
+        outputFrames += frames;
+    }
+
+    // the flush writes the delayed frames, which maxOutputFrames(0) accounts for
+    const int maxFlushFrames = resampler.maxOutputFrames(0);
+    GuardedOutput flushOutput(outputFormat, maxFlushFrames);
+    const int flushedFrames = resampler.flush(flushOutput.span());
+    QCOMPARE_LE(flushedFrames, maxFlushFrames);
+    QVERIFY(flushOutput.isGuardIntact());
+    outputFrames += flushedFrames;
+
+    // nothing is kept after the flush
+    QCOMPARE(resampler.maxOutputFrames(0), 0);
+    GuardedOutput emptyOutput(outputFormat, 64);
+    QCOMPARE(resampler.flush(emptyOutput.span()), 0);
+
+    // all the input has been resampled
+    const qint64 expectedFrames = inputFrames * outputRate / inputRate;
+    QCOMPARE_LE(std::abs(outputFrames - expectedFrames), qint64(2));
+    QCOMPARE(resampler.samplesProcessed(), outputFrames);
+}
+
+void tst_QFFmpegResampler::maxOutputFrames_boundsOutput_withSampleCompensation()
+{
+    const QAudioFormat inputFormat = stereoFormat(QAudioFormat::Int16, 48000);
+    const QAudioFormat outputFormat = stereoFormat(QAudioFormat::Int16, 48000);
+    QFFmpegResampler resampler(inputFormat, outputFormat);
+
+    // the compensation changes the effective sample rate, and it ends in the middle of a chunk
+    resampler.setSampleCompensation(48, 1500);
+    QCOMPARE(resampler.activeSampleCompensationDelta(), 48);
+
+    for (int i = 0; i < 8; ++i) {
+        const std::vector<std::byte> input = makeInput(inputFormat, 1024, i);
+
+        const int maxFrames = resampler.maxOutputFrames(1024);
+        GuardedOutput output(outputFormat, maxFrames);
+        const int frames = resampler.resample(asSpan(input), output.span());
+
+        QCOMPARE_LE(frames, maxFrames);
+        QVERIFY2(output.isGuardIntact(), "the resampler wrote past maxOutputFrames");
+
+        if (i == 3)
+            resampler.setSampleCompensation(-48, 1500);
+    }
+
+    const int maxFlushFrames = resampler.maxOutputFrames(0);
+    GuardedOutput flushOutput(outputFormat, maxFlushFrames);
+    QCOMPARE_LE(resampler.flush(flushOutput.span()), maxFlushFrames);
+    QVERIFY(flushOutput.isGuardIntact());
+}
+
+void tst_QFFmpegResampler::resampleBuffer_reusesPooledBuffer_whenReleased()
+{
+    const QAudioFormat format = stereoFormat(QAudioFormat::Int16, 48000);
+    QFFmpegResampler resampler(format, format);
+    const std::vector<std::byte> input = makeInput(format, 480);
+    const auto *inputData = reinterpret_cast<const char *>(input.data());
+
+    QAudioBuffer buffer = resampler.resample(inputData, input.size());
+    QVERIFY(buffer.isValid());
+    const void *data = buffer.constData();
+
+    buffer = {};
+    const QAudioBuffer nextBuffer = resampler.resample(inputData, input.size());
+
+    QCOMPARE(nextBuffer.constData(), data);
+    QCOMPARE(nextBuffer.byteCount(), qsizetype(input.size()));
+}
+
+void tst_QFFmpegResampler::resampleBuffer_doesNotReusePooledBuffer_whileConsumerHoldsCopy()
+{
+    const QAudioFormat format = stereoFormat(QAudioFormat::Int16, 48000);
+    QFFmpegResampler resampler(format, format);
+
+    // the identity conversion keeps the input, so every buffer has its own content
+    std::vector<std::vector<std::byte>> inputs;
+    std::vector<QAudioBuffer> heldBuffers;
+    for (int i = 0; i < 3; ++i) {
+        inputs.push_back(makeInput(format, 480, i));
+        QAudioBuffer buffer = resampler.resample(
+                reinterpret_cast<const char *>(inputs.back().data()), inputs.back().size());
+        QVERIFY(buffer.isValid());
+
+        // a copy keeps the data referenced, like a consumer queueing the buffer
+        heldBuffers.push_back(QAudioBuffer(buffer));
+    }
+
+    // more buffers than the pool holds, so that each pooled buffer is looked at
+    for (int i = 0; i < 8; ++i) {
+        const std::vector<std::byte> input = makeInput(format, 480, 100 + i);
+        const QAudioBuffer buffer =
+                resampler.resample(reinterpret_cast<const char *>(input.data()), input.size());
+
+        for (const QAudioBuffer &heldBuffer : heldBuffers)
+            QCOMPARE_NE(buffer.constData(), heldBuffer.constData());
+    }
+
+    for (size_t i = 0; i < heldBuffers.size(); ++i) {
+        const QAudioBuffer &heldBuffer = heldBuffers[i];
+        QCOMPARE(heldBuffer.byteCount(), qsizetype(inputs[i].size()));
+        QVERIFY(std::memcmp(heldBuffer.constData(), inputs[i].data(), inputs[i].size()) == 0);
+    }
+}
+
+void tst_QFFmpegResampler::resampleBuffer_allocatesBuffer_whenAllPooledBuffersAreHeld()
+{
+    const QAudioFormat format = stereoFormat(QAudioFormat::Int16, 48000);
+    QFFmpegResampler resampler(format, format);
+    const std::vector<std::byte> input = makeInput(format, 480);
+    const auto *inputData = reinterpret_cast<const char *>(input.data());
+
+    // the pool holds 4 buffers
+    std::vector<QAudioBuffer> buffers;
+    QSet<const void *> dataPointers;
+    for (int i = 0; i < 6; ++i) {
+        buffers.push_back(resampler.resample(inputData, input.size()));
+        QVERIFY(buffers.back().isValid());
+        dataPointers.insert(buffers.back().constData());
+    }
+    QCOMPARE(dataPointers.size(), qsizetype(6));
+
+    // one of the pooled buffers gets back into use once released
+    const QSet<const void *> pooledData = { buffers[0].constData(), buffers[1].constData(),
+                                            buffers[2].constData(), buffers[3].constData() };
+    buffers[1] = {};
+
+    const QAudioBuffer buffer = resampler.resample(inputData, input.size());
+    QVERIFY(pooledData.contains(buffer.constData()));
+    QCOMPARE_NE(buffer.constData(), buffers[0].constData());
+}
+
+// NOLINTEND(readability-convert-member-functions-to-static)
+
+QTEST_GUILESS_MAIN(tst_QFFmpegResampler)
+
+#include "tst_qffmpegresampler.moc"
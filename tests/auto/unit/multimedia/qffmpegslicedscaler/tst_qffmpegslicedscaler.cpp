@@ -0,0 +1,191 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QtTest/QtTest>
+
+#include "qffmpegslicedscaler_p.h"
+
+extern "C" {
+#include <libavutil/imgutils.h>
+}
+
+#include <cstring>
+#include <random>
+
+// NOLINTBEGIN(readability-convert-member-functions-to-static)
+
+QT_USE_NAMESPACE
+
+using namespace QFFmpeg;
+
+namespace {
+
+// The conversion type of the video frame encoder
+constexpr int ConversionType = SWS_FAST_BILINEAR;
+
+AVFrameUPtr createFrame(AVPixelFormat format, QSize size)
+{
+    AVFrameUPtr frame = makeAVFrame();
+    frame->format = format;
+    frame->width = size.width();
+    frame->height = size.height();
+    if (av_frame_get_buffer(frame.get(), 0) < 0)
+        return nullptr;
+    return frame;
+}
+
+// Fills the planes with a noisy gradient, so that the vertical filters
+// see different values in the neighboring rows
+void fillFrame(AVFrame &frame)
+{
+    std::mt19937 generator(42); // NOLINT(cert-msc51-cpp): reproducible content
+    std::uniform_int_distribution<int> noise(0, 63);
+
+    const auto format = AVPixelFormat(frame.format);
+    const AVPixFmtDescriptor *desc = av_pix_fmt_desc_get(format);
+
+    for (int plane = 0; plane < av_pix_fmt_count_planes(format); ++plane) {
+        const int shift = plane == 1 || plane == 2 ? desc->log2_chroma_h : 0;
+        const int rowCount = AV_CEIL_RSHIFT(frame.height, shift);
+        const int bytesPerLine = av_image_get_linesize(format, frame.width, plane);
+
+        for (int y = 0; y < rowCount; ++y) {
+            uint8_t *line = frame.data[plane] + qsizetype(y) * frame.linesize[plane];
+            for (int x = 0; x < bytesPerLine; ++x)
+                line[x] = uint8_t(x + y * 3 + noise(generator));
+        }
+    }
+}
+
+// Compares the meaningful bytes of the planes, ignoring the line paddings
+bool equalFrames(const AVFrame &actual, const AVFrame &expected, QString &mismatch)
+{
+    const auto format = AVPixelFormat(expected.format);
+    const AVPixFmtDescriptor *desc = av_pix_fmt_desc_get(format);
+
+    for (int plane = 0; plane < av_pix_fmt_count_planes(format); ++plane) {
+        const int shift = plane == 1 || plane == 2 ? desc->log2_chroma_h : 0;
+        const int rowCount = AV_CEIL_RSHIFT(expected.height, shift);
+        const int bytesPerLine = av_image_get_linesize(format, expected.width, plane);
+
+        for (int y = 0; y < rowCount; ++y) {
+            const uint8_t *actualLine = actual.data[plane] + qsizetype(y) * actual.linesize[plane];
+            const uint8_t *expectedLine =
+                    expected.data[plane] + qsizetype(y) * expected.linesize[plane];
+            if (std::memcmp(actualLine, expectedLine, bytesPerLine) != 0) {
+                mismatch = QStringLiteral("plane %1, row %2").arg(plane).arg(y);
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+} // namespace
+
+class tst_QFFmpegSlicedScaler : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void scale_producesSameOutputAsSingleContext_data();
+    void scale_producesSameOutputAsSingleContext();
+    void constructor_createsSingleSlice_whenHeightChanges();
+    void constructor_createsSingleSlice_whenImageIsSmall();
+};
+
+void tst_QFFmpegSlicedScaler::scale_producesSameOutputAsSingleContext_data()
+{
+    QTest::addColumn<AVPixelFormat>("srcFormat");
+    QTest::addColumn<QSize>("srcSize");
+    QTest::addColumn<AVPixelFormat>("dstFormat");
+    QTest::addColumn<QSize>("dstSize");
+
+    // different vertical chroma subsampling; the slices convert overlapping rows
+    QTest::newRow("rgba -> yuv420p") << AV_PIX_FMT_RGBA << QSize(640, 512) << AV_PIX_FMT_YUV420P
+                                     << QSize(640, 512);
+    QTest::newRow("rgba -> yuv420p, horizontal scaling")
+            << AV_PIX_FMT_RGBA << QSize(640, 512) << AV_PIX_FMT_YUV420P << QSize(320, 512);
+    QTest::newRow("bgra -> nv12, uneven slices")
+            << AV_PIX_FMT_BGRA << QSize(352, 650) << AV_PIX_FMT_NV12 << QSize(352, 650);
+    QTest::newRow("nv12 -> rgba") << AV_PIX_FMT_NV12 << QSize(640, 512) << AV_PIX_FMT_RGBA
+                                  << QSize(640, 512);
+
+    // same vertical chroma subsampling; the slices convert adjacent rows
+    QTest::newRow("yuv420p -> nv12") << AV_PIX_FMT_YUV420P << QSize(640, 512) << AV_PIX_FMT_NV12
+                                     << QSize(640, 512);
+    QTest::newRow("rgba -> yuv422p") << AV_PIX_FMT_RGBA << QSize(640, 512) << AV_PIX_FMT_YUV422P
+                                     << QSize(640, 512);
+    QTest::newRow("bgra -> rgb24") << AV_PIX_FMT_BGRA << QSize(640, 512) << AV_PIX_FMT_RGB24
+                                   << QSize(640, 512);
+}
+
+void tst_QFFmpegSlicedScaler::scale_producesSameOutputAsSingleContext()
+{
+    QFETCH(const AVPixelFormat, srcFormat);
+    QFETCH(const QSize, srcSize);
+    QFETCH(const AVPixelFormat, dstFormat);
+    QFETCH(const QSize, dstSize);
+
+    // Arrange
+    AVFrameUPtr src = createFrame(srcFormat, srcSize);
+    QVERIFY(src);
+    fillFrame(*src);
+
+    SwsContextUPtr singleContext =
+            createSwsContext(srcSize, srcFormat, dstSize, dstFormat, ConversionType);
+    QVERIFY(singleContext);
+
+    AVFrameUPtr expected = createFrame(dstFormat, dstSize);
+    QVERIFY(expected);
+    QCOMPARE(sws_scale(singleContext.get(), src->data, src->linesize, 0, srcSize.height(),
+                       expected->data, expected->linesize),
+             dstSize.height());
+
+    SlicedScaler scaler(srcSize, srcFormat, dstSize, dstFormat, ConversionType, 4);
+    QVERIFY(scaler.isValid());
+    QCOMPARE(scaler.sliceCount(), 4);
+
+    AVFrameUPtr actual = createFrame(dstFormat, dstSize);
+    QVERIFY(actual);
+
+    // Act
+    QCOMPARE(scaler.scale(*src, *actual), dstSize.height());
+
+    // Assert
+    QString mismatch;
+    QVERIFY2(equalFrames(*actual, *expected, mismatch), qPrintable(mismatch));
+
+    // the slices can be reused for the next frame
+    fillFrame(*actual);
+    QCOMPARE(scaler.scale(*src, *actual), dstSize.height());
+    QVERIFY2(equalFrames(*actual, *expected, mismatch), qPrintable(mismatch));
+}
+
+void tst_QFFmpegSlicedScaler::constructor_createsSingleSlice_whenHeightChanges()
+{
+    const QSize srcSize(640, 512);
+    const QSize dstSize(320, 256);
+
+    SlicedScaler scaler(srcSize, AV_PIX_FMT_RGBA, dstSize, AV_PIX_FMT_YUV420P, ConversionType, 4);
+
+    QVERIFY(scaler.isValid());
+    QCOMPARE(scaler.sliceCount(), 1);
+}
+
+void tst_QFFmpegSlicedScaler::constructor_createsSingleSlice_whenImageIsSmall()
+{
+    const QSize size(640, 200);
+
+    SlicedScaler scaler(size, AV_PIX_FMT_RGBA, size, AV_PIX_FMT_YUV420P, ConversionType, 4);
+
+    QVERIFY(scaler.isValid());
+    QCOMPARE(scaler.sliceCount(), 1);
+}
+
+// NOLINTEND(readability-convert-member-functions-to-static)
+
+QTEST_GUILESS_MAIN(tst_QFFmpegSlicedScaler)
+
+#include "tst_qffmpegslicedscaler.moc"
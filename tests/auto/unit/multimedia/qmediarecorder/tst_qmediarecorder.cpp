@@ -7,6 +7,7 @@
 #include <private/qplatformmediarecorder_p.h>
 #include "private/qguiapplication_p.h"
 #include <qmediarecorder.h>
+#include <qrecordingstatistics.h>
 #include <qaudioformat.h>
 #include <qmockintegration.h>
 #include <qmediacapturesession.h>
@@ -34,6 +35,8 @@ private slots:
     void testNullControls();
     void testDeleteMediaCapture();
     void testError();
+    void testEncoderLoad();
+    void statistics_returnsNullStatistics_whenBackendDoesNotReportThem();
 
     void record_initializesActualLocation();
     void record_emitsSignals_whenSettingsChange();
@@ -213,6 +216,36 @@ void tst_QMediaRecorder::testError()
     QCOMPARE(spy.last()[0].value<QMediaRecorder::Error>(), QMediaRecorder::FormatError);
 }
 
+void tst_QMediaRecorder::testEncoderLoad()
+{
+    QSignalSpy spy(encoder.get(), &QMediaRecorder::encoderLoadChanged);
+
+    QCOMPARE(encoder->encoderLoad(), 0.);
+    QCOMPARE(encoder->droppedVideoFrames(), qint64(0));
+
+    mock->encoderLoadChanged(1.5, 3);
+    QCOMPARE(encoder->encoderLoad(), 1.5);
+    QCOMPARE(encoder->droppedVideoFrames(), qint64(3));
+    QCOMPARE(spy.size(), 1);
+
+    mock->encoderLoadChanged(1.5, 3);
+    QCOMPARE(spy.size(), 1);
+
+    mock->encoderLoadChanged(0.5, 3);
+    QCOMPARE(encoder->encoderLoad(), 0.5);
+    QCOMPARE(spy.size(), 2);
+}
+
+void tst_QMediaRecorder::statistics_returnsNullStatistics_whenBackendDoesNotReportThem()
+{
+    const QRecordingStatistics statistics = encoder->statistics();
+
+    QVERIFY(statistics.isNull());
+    QCOMPARE(statistics.videoEncoderQueueLength(), 0);
+    QCOMPARE(statistics.muxerQueueLength(), 0);
+    QCOMPARE(statistics.muxedBytes(), qint64(0));
+}
+
 void tst_QMediaRecorder::record_initializesActualLocation()
 {
     // Since the class uses a mock implementation, the test only verifies that
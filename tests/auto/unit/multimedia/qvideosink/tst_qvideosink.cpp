@@ -0,0 +1,190 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QtTest/QtTest>
+
+#include <QtCore/qthread.h>
+#include <QtMultimedia/qvideoframe.h>
+#include <QtMultimedia/qvideosink.h>
+#include <private/qplatformvideosink_p.h>
+
+#include "qmockintegration.h"
+
+#include <atomic>
+#include <memory>
+
+// NOLINTBEGIN(readability-convert-member-functions-to-static)
+
+QT_USE_NAMESPACE
+
+Q_ENABLE_MOCK_MULTIMEDIA_PLUGIN
+
+using namespace std::chrono_literals;
+
+namespace {
+
+QVideoFrame createFrame(QSize size = { 16, 8 })
+{
+    return QVideoFrame(QVideoFrameFormat(size, QVideoFrameFormat::Format_RGBA8888));
+}
+
+template <typename Functor>
+void runOnThread(Functor &&functor)
+{
+    std::unique_ptr<QThread> thread(QThread::create(std::forward<Functor>(functor)));
+    thread->start();
+    thread->wait();
+}
+
+} // namespace
+
+class tst_QVideoSink : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void setVideoFrame_emitsVideoFrameChanged_whenNoFrameCallbackIsSet();
+    void setVideoFrame_invokesFrameCallbackOnProducerThread_whenFrameCallbackIsSet();
+    void setVideoFrame_emitsVideoSizeChangedOnSinkThread_whenFrameCallbackIsSet();
+    void setFrameCallback_restoresVideoFrameChanged_whenCallbackIsCleared();
+    void setFrameCallback_emitsFrameCallbackChanged_onPlatformSink();
+    void destructor_waitsForRunningCallback_whenFrameIsDeliveredConcurrently();
+};
+
+void tst_QVideoSink::setVideoFrame_emitsVideoFrameChanged_whenNoFrameCallbackIsSet()
+{
+    QVideoSink sink;
+    QSignalSpy frameChangedSpy(&sink, &QVideoSink::videoFrameChanged);
+
+    const QVideoFrame frame = createFrame();
+    sink.setVideoFrame(frame);
+
+    QCOMPARE(frameChangedSpy.size(), 1);
+    QVERIFY(frameChangedSpy.front().front().value<QVideoFrame>() == frame);
+    QVERIFY(sink.videoFrame() == frame);
+}
+
+void tst_QVideoSink::setVideoFrame_invokesFrameCallbackOnProducerThread_whenFrameCallbackIsSet()
+{
+    QVideoSink sink;
+    QSignalSpy frameChangedSpy(&sink, &QVideoSink::videoFrameChanged);
+
+    QThread *callbackThread = nullptr;
+    QVideoFrame receivedFrame;
+    sink.setFrameCallback([&](const QVideoFrame &frame) {
+        callbackThread = QThread::currentThread();
+        receivedFrame = frame;
+    });
+
+    const QVideoFrame frame = createFrame();
+    QThread *producerThread = nullptr;
+    runOnThread([&] {
+        producerThread = QThread::currentThread();
+        sink.setVideoFrame(frame);
+    });
+
+    QCOMPARE(callbackThread, producerThread);
+    QVERIFY(receivedFrame == frame);
+    // the sink is updated before the callback is invoked
+    QVERIFY(sink.videoFrame() == frame);
+
+    QCoreApplication::processEvents();
+    QCOMPARE(frameChangedSpy.size(), 0);
+}
+
+void tst_QVideoSink::setVideoFrame_emitsVideoSizeChangedOnSinkThread_whenFrameCallbackIsSet()
+{
+    QVideoSink sink;
+    sink.setFrameCallback([](const QVideoFrame &) {});
+
+    QThread *signalThread = nullptr;
+    connect(&sink, &QVideoSink::videoSizeChanged, this,
+            [&] { signalThread = QThread::currentThread(); }, Qt::DirectConnection);
+
+    runOnThread([&] { sink.setVideoFrame(createFrame({ 32, 16 })); });
+
+    QCOMPARE(sink.videoSize(), QSize(32, 16));
+    QTRY_COMPARE(signalThread, QThread::currentThread());
+}
+
+void tst_QVideoSink::setFrameCallback_restoresVideoFrameChanged_whenCallbackIsCleared()
+{
+    QVideoSink sink;
+    QSignalSpy frameChangedSpy(&sink, &QVideoSink::videoFrameChanged);
+
+    int callCount = 0;
+    sink.setFrameCallback([&](const QVideoFrame &) { ++callCount; });
+    sink.setVideoFrame(createFrame());
+
+    QCOMPARE(callCount, 1);
+    QCOMPARE(frameChangedSpy.size(), 0);
+
+    sink.setFrameCallback({});
+
+    const QVideoFrame frame = createFrame();
+    sink.setVideoFrame(frame);
+
+    QCOMPARE(callCount, 1);
+    QCOMPARE(frameChangedSpy.size(), 1);
+    QVERIFY(frameChangedSpy.front().front().value<QVideoFrame>() == frame);
+}
+
+void tst_QVideoSink::setFrameCallback_emitsFrameCallbackChanged_onPlatformSink()
+{
+    QVideoSink sink;
+    QPlatformVideoSink *platformSink = sink.platformVideoSink();
+    QVERIFY(platformSink);
+
+    QSignalSpy callbackChangedSpy(platformSink, &QPlatformVideoSink::frameCallbackChanged);
+
+    sink.setFrameCallback([](const QVideoFrame &) {});
+    QVERIFY(platformSink->hasFrameCallback());
+
+    sink.setFrameCallback({});
+    QVERIFY(!platformSink->hasFrameCallback());
+
+    QCOMPARE(callbackChangedSpy.size(), 2);
+    QCOMPARE(callbackChangedSpy.at(0).at(0).toBool(), true);
+    QCOMPARE(callbackChangedSpy.at(1).at(0).toBool(), false);
+}
+
+void tst_QVideoSink::destructor_waitsForRunningCallback_whenFrameIsDeliveredConcurrently()
+{
+    auto sink = std::make_unique<QVideoSink>();
+
+    std::atomic_int callCount = 0;
+    sink->setFrameCallback([&](const QVideoFrame &) {
+        ++callCount;
+        QThread::sleep(1ms);
+    });
+
+    // the producer keeps the callback state, not the sink
+    const std::shared_ptr<QPlatformVideoSink::FrameCallbackState> state =
+            sink->platformVideoSink()->frameCallbackState();
+
+    std::atomic_bool stop = false;
+    std::unique_ptr<QThread> producer(QThread::create([&] {
+        while (!stop)
+            state->deliver(createFrame());
+    }));
+    producer->start();
+
+    QTRY_VERIFY(callCount > 0);
+    sink.reset();
+
+    // the callback is neither running nor invoked after the destruction
+    const int callsAfterDestruction = callCount;
+    QTest::qWait(20ms);
+    QCOMPARE(callCount, callsAfterDestruction);
+    QVERIFY(!state->hasCallback());
+    QVERIFY(!state->invokeCallback(createFrame()));
+
+    stop = true;
+    producer->wait();
+}
+
+// NOLINTEND(readability-convert-member-functions-to-static)
+
+QTEST_MAIN(tst_QVideoSink)
+
+#include "tst_qvideosink.moc"
@@ -11,6 +11,8 @@
 
 QT_USE_NAMESPACE
 
+using namespace Qt::StringLiterals;
+
 struct ColorSpaceCoeff
 {
     float a;
@@ -253,6 +255,27 @@ private slots:
             QVERIFY(fuzzyCompareWithTolerance(actualBlackRgb, expectedBlackRgb, 5e-4f));
         }
     }
+
+    void subtitleLayout_reusesLayoutAndImage_whenTextAndSizeAreUnchanged()
+    {
+        QVideoTextureHelper::SubtitleLayout layout;
+        QVERIFY(layout.update({ 640, 480 }, u"Subtitle"_s));
+
+        const QImage image = layout.toImage();
+        QVERIFY(!image.isNull());
+
+        // Act & Assert: neither the shaping nor the rasterization is repeated
+        QVERIFY(!layout.update({ 640, 480 }, u"Subtitle"_s));
+        QCOMPARE(layout.toImage().cacheKey(), image.cacheKey());
+
+        // Act & Assert: a new text or size invalidates the cache
+        QVERIFY(layout.update({ 640, 480 }, u"Another subtitle"_s));
+        QCOMPARE_NE(layout.toImage().cacheKey(), image.cacheKey());
+
+        const qint64 previousKey = layout.toImage().cacheKey();
+        QVERIFY(layout.update({ 1280, 960 }, u"Another subtitle"_s));
+        QCOMPARE_NE(layout.toImage().cacheKey(), previousKey);
+    }
 };
 
 QTEST_MAIN(tst_qvideotexturehelper)
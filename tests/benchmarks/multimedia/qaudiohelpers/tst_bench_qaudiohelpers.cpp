@@ -0,0 +1,184 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QtTest/QtTest>
+
+#include <QtMultimedia/private/qaudiohelpers_p.h>
+
+#include <vector>
+
+QT_USE_NAMESPACE
+
+using namespace QAudioHelperInternal;
+
+// Measures the sample kernels on a 10 ms stereo period at 48 kHz, the typical amount of
+// data processed by an audio callback
+class tst_QAudioHelpersBenchmark : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void applyVolume_data();
+    void applyVolume();
+    void applyVolumeRamp_data() { applyVolume_data(); }
+    void applyVolumeRamp();
+
+    void convertInt16ToFloat();
+    void convertFloatToInt16();
+
+    void mixAccumulate_data() { applyVolume_data(); }
+    void mixAccumulate();
+    void mix_data() { applyVolume_data(); }
+    void mix();
+
+    void deinterleaveStereo();
+    void interleaveStereo();
+};
+
+namespace {
+
+constexpr int ChannelCount = 2;
+constexpr qsizetype FrameCount = 480;
+constexpr qsizetype SampleCount = FrameCount * ChannelCount;
+
+QAudioFormat makeFormat(QAudioFormat::SampleFormat sampleFormat)
+{
+    QAudioFormat format;
+    format.setSampleFormat(sampleFormat);
+    format.setChannelCount(ChannelCount);
+    format.setSampleRate(48000);
+    return format;
+}
+
+// a period of the format, filled with a non-trivial signal
+QByteArray makePeriod(const QAudioFormat &format)
+{
+    std::vector<float> samples(SampleCount);
+    for (qsizetype i = 0; i < SampleCount; ++i)
+        samples[i] = float(i % 200) / 200.f - 0.5f;
+
+    QByteArray period(format.bytesForFrames(FrameCount), Qt::Uninitialized);
+    convertSamples(as_bytes(QSpan<const float>{ samples }), QAudioFormat::Float,
+                   as_writable_bytes(QSpan{ period }), format.sampleFormat());
+    return period;
+}
+
+} // namespace
+
+void tst_QAudioHelpersBenchmark::applyVolume_data()
+{
+    QTest::addColumn<QAudioFormat::SampleFormat>("sampleFormat");
+
+    QTest::newRow("uint8") << QAudioFormat::UInt8;
+    QTest::newRow("int16") << QAudioFormat::Int16;
+    QTest::newRow("int32") << QAudioFormat::Int32;
+    QTest::newRow("float") << QAudioFormat::Float;
+}
+
+void tst_QAudioHelpersBenchmark::applyVolume()
+{
+    QFETCH(QAudioFormat::SampleFormat, sampleFormat);
+
+    const QAudioFormat format = makeFormat(sampleFormat);
+    const QByteArray source = makePeriod(format);
+    QByteArray destination(source.size(), Qt::Uninitialized);
+
+    QBENCHMARK {
+        QAudioHelperInternal::applyVolume(0.5f, format, as_bytes(QSpan{ source }),
+                                          as_writable_bytes(QSpan{ destination }));
+    }
+}
+
+void tst_QAudioHelpersBenchmark::applyVolumeRamp()
+{
+    QFETCH(QAudioFormat::SampleFormat, sampleFormat);
+
+    const QAudioFormat format = makeFormat(sampleFormat);
+    const QByteArray source = makePeriod(format);
+    QByteArray destination(source.size(), Qt::Uninitialized);
+
+    QBENCHMARK {
+        QAudioHelperInternal::applyVolumeRamp(1.f, 0.5f, format, as_bytes(QSpan{ source }),
+                                              as_writable_bytes(QSpan{ destination }));
+    }
+}
+
+void tst_QAudioHelpersBenchmark::convertInt16ToFloat()
+{
+    const std::vector<qint16> source(SampleCount, 1234);
+    std::vector<float> destination(SampleCount);
+
+    QBENCHMARK {
+        convertSamples(QSpan<const qint16>{ source }, QSpan<float>{ destination });
+    }
+}
+
+void tst_QAudioHelpersBenchmark::convertFloatToInt16()
+{
+    const std::vector<float> source(SampleCount, 0.25f);
+    std::vector<qint16> destination(SampleCount);
+
+    QBENCHMARK {
+        convertSamples(QSpan<const float>{ source }, QSpan<qint16>{ destination });
+    }
+}
+
+void tst_QAudioHelpersBenchmark::mixAccumulate()
+{
+    QFETCH(QAudioFormat::SampleFormat, sampleFormat);
+
+    const QAudioFormat format = makeFormat(sampleFormat);
+    const QByteArray source = makePeriod(format);
+    QByteArray destination = makePeriod(format);
+
+    QBENCHMARK {
+        QAudioHelperInternal::mixAccumulate(format, as_bytes(QSpan{ source }),
+                                            as_writable_bytes(QSpan{ destination }), 0.5f);
+    }
+}
+
+void tst_QAudioHelpersBenchmark::mix()
+{
+    QFETCH(QAudioFormat::SampleFormat, sampleFormat);
+
+    const QAudioFormat format = makeFormat(sampleFormat);
+    const QByteArray source = makePeriod(format);
+    QByteArray destination(source.size(), Qt::Uninitialized);
+
+    // mixing 4 voices
+    const QSpan<const std::byte> sourceBytes = as_bytes(QSpan{ source });
+    const QSpan<const std::byte> sources[] = { sourceBytes, sourceBytes, sourceBytes,
+                                               sourceBytes };
+
+    QBENCHMARK {
+        QAudioHelperInternal::mix(format, sources, as_writable_bytes(QSpan{ destination }));
+    }
+}
+
+void tst_QAudioHelpersBenchmark::deinterleaveStereo()
+{
+    const std::vector<float> interleaved(SampleCount, 0.25f);
+    std::vector<float> left(FrameCount);
+    std::vector<float> right(FrameCount);
+    float *const channels[] = { left.data(), right.data() };
+
+    QBENCHMARK {
+        deinterleave(interleaved, channels);
+    }
+}
+
+void tst_QAudioHelpersBenchmark::interleaveStereo()
+{
+    const std::vector<float> left(FrameCount, 0.25f);
+    const std::vector<float> right(FrameCount, -0.25f);
+    const float *const channels[] = { left.data(), right.data() };
+    std::vector<float> interleaved(SampleCount);
+
+    QBENCHMARK {
+        interleave(channels, interleaved);
+    }
+}
+
+QTEST_APPLESS_MAIN(tst_QAudioHelpersBenchmark)
+
+#include "tst_bench_qaudiohelpers.moc"
@@ -0,0 +1,135 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QtTest/QtTest>
+
+#include <QtMultimedia/private/qaudioringbuffer_p.h>
+
+#include <thread>
+#include <vector>
+
+QT_USE_NAMESPACE
+
+// Measures the time to transfer a fixed amount of data through the ring buffers, with the
+// producers and the consumer on different threads
+class tst_QAudioRingBufferBenchmark : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void spscTransfer_data();
+    void spscTransfer();
+
+    void mpscTransfer_data();
+    void mpscTransfer();
+};
+
+namespace {
+
+constexpr qsizetype BytesToTransfer = 16 * 1024 * 1024;
+constexpr qsizetype RingBufferSize = 16 * 1024;
+
+template <typename Producer>
+void produce(Producer &producer, qsizetype chunkSize, qsizetype bytes)
+{
+    const std::vector<std::byte> chunk(chunkSize, std::byte{ 0x55 });
+    while (bytes > 0) {
+        QSpan<const std::byte> region = QSpan<const std::byte>{ chunk }.first(
+                std::min(chunkSize, bytes));
+        bytes -= region.size();
+        while (!region.isEmpty()) {
+            const qsizetype written = producer.write(region);
+            if (written == 0)
+                std::this_thread::yield();
+            region = region.subspan(written);
+        }
+    }
+}
+
+} // namespace
+
+void tst_QAudioRingBufferBenchmark::spscTransfer_data()
+{
+    QTest::addColumn<qsizetype>("chunkSize");
+
+    // typical period sizes
+    QTest::newRow("256 bytes") << qsizetype(256);
+    QTest::newRow("1920 bytes") << qsizetype(1920);
+    QTest::newRow("4096 bytes") << qsizetype(4096);
+}
+
+void tst_QAudioRingBufferBenchmark::spscTransfer()
+{
+    QFETCH(qsizetype, chunkSize);
+
+    QtPrivate::QAudioRingBuffer<std::byte> ringBuffer(RingBufferSize);
+    std::vector<std::byte> output(chunkSize);
+
+    QBENCHMARK {
+        ringBuffer.reset();
+        std::thread producer([&] { produce(ringBuffer, chunkSize, BytesToTransfer); });
+
+        qsizetype consumed = 0;
+        while (consumed < BytesToTransfer) {
+            qsizetype offset = 0;
+            const qsizetype bytes = ringBuffer.consume(chunkSize, [&](QSpan<const std::byte> r) {
+                std::copy(r.begin(), r.end(), output.begin() + offset);
+                offset += r.size();
+            });
+            if (bytes == 0)
+                std::this_thread::yield();
+            consumed += bytes;
+        }
+
+        producer.join();
+    }
+}
+
+void tst_QAudioRingBufferBenchmark::mpscTransfer_data()
+{
+    QTest::addColumn<int>("producerCount");
+
+    QTest::newRow("2 producers") << 2;
+    QTest::newRow("4 producers") << 4;
+}
+
+void tst_QAudioRingBufferBenchmark::mpscTransfer()
+{
+    QFETCH(int, producerCount);
+
+    constexpr qsizetype chunkSize = 1920;
+    const qsizetype bytesPerProducer = BytesToTransfer / producerCount;
+
+    QtPrivate::QAudioMpscRingBuffer<std::byte> ringBuffer(producerCount, RingBufferSize);
+    std::vector<std::byte> mix(chunkSize);
+
+    QBENCHMARK {
+        std::vector<std::thread> producers;
+        for (int i = 0; i < producerCount; ++i) {
+            producers.emplace_back([&] {
+                auto producer = ringBuffer.acquireProducer();
+                produce(producer, chunkSize, bytesPerProducer);
+            });
+        }
+
+        qsizetype consumed = 0;
+        while (consumed < bytesPerProducer * producerCount) {
+            qsizetype bytes = 0;
+            ringBuffer.consume(chunkSize, [&](int, qsizetype offset, QSpan<const std::byte> r) {
+                for (qsizetype i = 0; i < r.size(); ++i)
+                    mix[offset + i] ^= r[i];
+                bytes += r.size();
+            });
+            if (bytes == 0)
+                std::this_thread::yield();
+            consumed += bytes;
+        }
+
+        for (std::thread &producer : producers)
+            producer.join();
+    }
+}
+
+QTEST_APPLESS_MAIN(tst_QAudioRingBufferBenchmark)
+
+#include "tst_bench_qaudioringbuffer.moc"
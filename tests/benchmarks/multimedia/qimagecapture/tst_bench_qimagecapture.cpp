@@ -0,0 +1,202 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QtTest/QtTest>
+
+#include <QtMultimedia/qimagecapture.h>
+#include <QtMultimedia/qmediacapturesession.h>
+#include <QtMultimedia/qvideoframe.h>
+#include <QtMultimedia/qvideoframeinput.h>
+#include <QtMultimedia/qvideosink.h>
+#include <QtCore/qdir.h>
+#include <QtCore/qelapsedtimer.h>
+#include <QtCore/qtemporarydir.h>
+#include <private/framegenerator_p.h>
+#include <private/mediabackendutils_p.h>
+
+#include <chrono>
+#include <ctime>
+
+QT_USE_NAMESPACE
+
+using namespace std::chrono_literals;
+
+namespace {
+
+constexpr int DefaultShotCount = 40;
+
+int shotCount()
+{
+    bool ok = false;
+    const int count = qEnvironmentVariableIntValue("QT_MEDIA_BENCHMARK_FRAMES", &ok);
+    return ok && count > 0 ? count : DefaultShotCount;
+}
+
+/*!
+    A burst of captures from a frame input. A new capture is requested, and a frame is sent
+    for it, as soon as the image capture is ready, so the shot rate is bounded by the encoding.
+ */
+class BurstCapture : public QObject
+{
+public:
+    BurstCapture(const QVideoFrame &frame, const QString &directory, int shotCount)
+        : m_frame(frame), m_directory(directory), m_shotCount(shotCount)
+    {
+        m_capture.setFileFormat(QImageCapture::JPEG);
+        m_capture.setQuality(QImageCapture::NormalQuality);
+
+        // the frame input only sends frames if they have a destination
+        m_session.setVideoFrameInput(&m_input);
+        m_session.setVideoSink(&m_sink);
+        m_session.setImageCapture(&m_capture);
+
+        connect(&m_capture, &QImageCapture::readyForCaptureChanged, this,
+                &BurstCapture::requestShots);
+        connect(&m_capture, &QImageCapture::imageSaved, this, [this] {
+            ++m_savedShots;
+            requestShots();
+        });
+        connect(&m_capture, &QImageCapture::errorOccurred, this,
+                [this](int, QImageCapture::Error, const QString &errorString) {
+                    m_errorString = errorString;
+                });
+    }
+
+    void start() { requestShots(); }
+
+    bool isDone() const { return m_savedShots == m_shotCount || !m_errorString.isEmpty(); }
+
+    int savedShots() const { return m_savedShots; }
+
+    const QString &errorString() const { return m_errorString; }
+
+private:
+    void requestShots()
+    {
+        while (m_requestedShots < m_shotCount && m_capture.isReadyForCapture()) {
+            const QString fileName =
+                    m_directory.filePath(QStringLiteral("shot%1.jpg").arg(m_requestedShots));
+            if (m_capture.captureToFile(fileName) < 0)
+                return;
+
+            ++m_requestedShots;
+            if (!m_input.sendVideoFrame(m_frame)) {
+                m_errorString = QStringLiteral("The frame input refused a frame");
+                return;
+            }
+        }
+    }
+
+private:
+    const QVideoFrame m_frame;
+    const QDir m_directory;
+    const int m_shotCount;
+
+    QVideoFrameInput m_input;
+    QVideoSink m_sink;
+    QImageCapture m_capture;
+    QMediaCaptureSession m_session;
+
+    int m_requestedShots = 0;
+    int m_savedShots = 0;
+    QString m_errorString;
+};
+
+} // namespace
+
+// Measures how many images per second a burst of captures saves. QT_MEDIA_BENCHMARK_FRAMES
+// overrides the number of shots per burst.
+class tst_QImageCaptureBenchmark : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void cleanup();
+
+    void burstCapture_data();
+    void burstCapture();
+};
+
+void tst_QImageCaptureBenchmark::initTestCase()
+{
+    QSKIP_IF_NOT_FFMPEG("The benchmark measures the FFmpeg image capture");
+}
+
+void tst_QImageCaptureBenchmark::cleanup()
+{
+    qunsetenv("QT_FFMPEG_IMAGE_CAPTURE_QUEUE_DEPTH");
+}
+
+void tst_QImageCaptureBenchmark::burstCapture_data()
+{
+    QTest::addColumn<QSize>("frameSize");
+    QTest::addColumn<QVideoFrameFormat::PixelFormat>("pixelFormat");
+    QTest::addColumn<int>("queueDepth");
+
+    const std::pair<QSize, const char *> sizes[] = {
+        { QSize(1920, 1080), "1080p" },
+        { QSize(4000, 3000), "12MP" },
+    };
+
+    // NV12 is encoded by the mjpeg encoder; BGRA8888 goes through QImageWriter
+    for (const auto &[frameSize, sizeName] : sizes) {
+        for (const auto pixelFormat :
+             { QVideoFrameFormat::Format_NV12, QVideoFrameFormat::Format_BGRA8888 }) {
+            for (const int queueDepth : { 1, 4 }) {
+                QTest::addRow("%s, %s, queue depth %d", sizeName,
+                              qPrintable(QVideoFrameFormat::pixelFormatToString(pixelFormat)),
+                              queueDepth)
+                        << frameSize << pixelFormat << queueDepth;
+            }
+        }
+    }
+}
+
+void tst_QImageCaptureBenchmark::burstCapture()
+{
+    QFETCH(QSize, frameSize);
+    QFETCH(QVideoFrameFormat::PixelFormat, pixelFormat);
+    QFETCH(int, queueDepth);
+
+    // read when the image capture is created
+    qputenv("QT_FFMPEG_IMAGE_CAPTURE_QUEUE_DEPTH", QByteArray::number(queueDepth));
+
+    VideoGenerator videoGenerator;
+    videoGenerator.setPattern(ImagePattern::ColoredSquares);
+    videoGenerator.setSize(frameSize);
+    videoGenerator.setPixelFormat(pixelFormat);
+    const QVideoFrame frame = videoGenerator.createFrame();
+    QVERIFY(frame.isValid());
+
+    QTemporaryDir tempDir;
+    QVERIFY(tempDir.isValid());
+
+    const int shots = shotCount();
+    BurstCapture burst(frame, tempDir.path(), shots);
+
+    const std::clock_t processCpuStart = std::clock();
+    QElapsedTimer timer;
+    timer.start();
+
+    burst.start();
+    const bool done = QTest::qWaitFor([&] { return burst.isDone(); }, 10min);
+
+    const qreal elapsedSeconds = std::max<qint64>(timer.elapsed(), 1) / 1000.;
+    const qreal processCpuSeconds = qreal(std::clock() - processCpuStart) / CLOCKS_PER_SEC;
+
+    QVERIFY(done);
+    QVERIFY2(burst.errorString().isEmpty(), qPrintable(burst.errorString()));
+    QCOMPARE(burst.savedShots(), shots);
+
+    qInfo().noquote() << QStringLiteral("saved images: %1, elapsed: %2 s, CPU: %3 s")
+                                 .arg(burst.savedShots())
+                                 .arg(elapsedSeconds, 0, 'f', 2)
+                                 .arg(processCpuSeconds, 0, 'f', 2);
+
+    QTest::setBenchmarkResult(burst.savedShots() / elapsedSeconds, QTest::FramesPerSecond);
+}
+
+QTEST_GUILESS_MAIN(tst_QImageCaptureBenchmark)
+
+#include "tst_bench_qimagecapture.moc"
@@ -0,0 +1,108 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QtTest/QtTest>
+
+#include <QtMultimedia/qaudiobuffer.h>
+#include <QtMultimedia/qaudiobufferoutput.h>
+#include <QtMultimedia/qmediaplayer.h>
+#include <QtMultimedia/qvideoframe.h>
+#include <QtMultimedia/qvideosink.h>
+#include <QtMultimedia/private/qmediaplayer_p.h>
+#include <QtCore/qelapsedtimer.h>
+
+#include <chrono>
+
+QT_USE_NAMESPACE
+
+using namespace std::chrono_literals;
+
+// Measures how fast a free-running playback decodes and delivers a reference file.
+// QT_MEDIA_BENCHMARK_SOURCE overrides the reference file.
+class tst_QMediaPlayerBenchmark : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+
+    void freeRunningPlayback_data();
+    void freeRunningPlayback();
+
+private:
+    QUrl m_source;
+};
+
+void tst_QMediaPlayerBenchmark::initTestCase()
+{
+    const QString source = qEnvironmentVariable("QT_MEDIA_BENCHMARK_SOURCE");
+    m_source = source.isEmpty() ? QUrl(QStringLiteral("qrc:/testdata/15s.mkv"))
+                                : QUrl::fromUserInput(source);
+}
+
+void tst_QMediaPlayerBenchmark::freeRunningPlayback_data()
+{
+    QTest::addColumn<bool>("withAudio");
+
+    QTest::newRow("video") << false;
+    QTest::newRow("audio and video") << true;
+}
+
+void tst_QMediaPlayerBenchmark::freeRunningPlayback()
+{
+    QFETCH(bool, withAudio);
+
+    QMediaPlayer player;
+    QVideoSink sink;
+    QAudioBufferOutput audioOutput;
+    player.setVideoSink(&sink);
+    if (withAudio)
+        player.setAudioBufferOutput(&audioOutput);
+
+    if (!QMediaPlayerPrivate::get(&player)->setFreeRunning(true))
+        QSKIP("Free-running playback is not supported by the backend");
+
+    player.setSource(m_source);
+    QTRY_COMPARE_WITH_TIMEOUT(player.mediaStatus(), QMediaPlayer::LoadedMedia, 10s);
+
+    if (withAudio && !player.hasAudio())
+        QSKIP("The source has no audio");
+
+    qint64 videoFrames = 0;
+    qint64 lastVideoTime = 0;
+    qint64 lastAudioTime = 0;
+    qint64 maxDrift = 0;
+
+    connect(&sink, &QVideoSink::videoFrameChanged, this, [&](const QVideoFrame &frame) {
+        if (!frame.isValid())
+            return;
+
+        ++videoFrames;
+        lastVideoTime = frame.startTime();
+        if (withAudio && lastAudioTime > 0)
+            maxDrift = std::max(maxDrift, qAbs(lastVideoTime - lastAudioTime));
+    });
+    connect(&audioOutput, &QAudioBufferOutput::audioBufferReceived, this,
+            [&](const QAudioBuffer &buffer) {
+                if (buffer.isValid())
+                    lastAudioTime = buffer.startTime();
+            });
+
+    QElapsedTimer timer;
+    timer.start();
+
+    player.play();
+    QTRY_COMPARE_WITH_TIMEOUT(player.mediaStatus(), QMediaPlayer::EndOfMedia, 60s);
+
+    const qint64 elapsedMs = std::max<qint64>(timer.elapsed(), 1);
+
+    QCOMPARE_GT(videoFrames, 0);
+    // the renderers wait for each other; they only differ by about a frame
+    QCOMPARE_LT(maxDrift, qint64(200'000));
+
+    QTest::setBenchmarkResult(videoFrames * 1000. / elapsedMs, QTest::FramesPerSecond);
+}
+
+QTEST_MAIN(tst_QMediaPlayerBenchmark)
+
+#include "tst_bench_qmediaplayer.moc"
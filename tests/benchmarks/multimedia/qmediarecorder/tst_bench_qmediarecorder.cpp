@@ -0,0 +1,475 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QtTest/QtTest>
+
+#include <QtMultimedia/qaudiobuffer.h>
+#include <QtMultimedia/qaudiobufferinput.h>
+#include <QtMultimedia/qmediacapturesession.h>
+#include <QtMultimedia/qmediaformat.h>
+#include <QtMultimedia/qmediarecorder.h>
+#include <QtMultimedia/qrecordingstatistics.h>
+#include <QtMultimedia/qvideoframe.h>
+#include <QtMultimedia/qvideoframeinput.h>
+#include <QtCore/qelapsedtimer.h>
+#include <QtCore/qfile.h>
+#include <QtCore/qtemporarydir.h>
+#include <QtCore/qtimer.h>
+#include <private/audiogenerationutils_p.h>
+#include <private/framegenerator_p.h>
+#include <private/mediabackendutils_p.h>
+
+#include <algorithm>
+#include <chrono>
+#include <ctime>
+#include <map>
+#include <memory>
+#include <vector>
+
+#ifdef Q_OS_LINUX
+#  include <QtCore/qdir.h>
+#  include <unistd.h>
+#endif
+
+QT_USE_NAMESPACE
+
+using namespace std::chrono_literals;
+
+namespace {
+
+constexpr int DefaultFrameCount = 150;
+constexpr qreal NominalFrameRate = 30.;
+
+int frameCountPerStream()
+{
+    bool ok = false;
+    const int count = qEnvironmentVariableIntValue("QT_MEDIA_BENCHMARK_FRAMES", &ok);
+    return ok && count > 0 ? count : DefaultFrameCount;
+}
+
+/*!
+    Accumulates the CPU time of the threads of the process, grouped by the thread names
+    that the recording engine assigns to its stages. Threads created by a stage, e.g.
+    the worker threads of the codec, inherit its name on Linux.
+ */
+class StageCpuTimer
+{
+public:
+    static constexpr std::pair<const char *, const char *> Stages[] = {
+        { "VideoFrameConve", "converter" }, // "VideoFrameConverter", truncated by the kernel
+        { "VideoEncoder", "video encoder" },
+        { "AudioEncoder", "audio encoder" },
+        { "Muxer", "muxer" },
+    };
+
+    static bool isSupported()
+    {
+#ifdef Q_OS_LINUX
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    void start()
+    {
+        m_threads.clear();
+        sample();
+        for (auto &[tid, thread] : m_threads)
+            thread.baseTicks = thread.ticks;
+    }
+
+    // Samples the threads; the ones that have finished since the last call are
+    // accounted with their last sample, so the owner should call it frequently.
+    void sample()
+    {
+#ifdef Q_OS_LINUX
+        const QDir tasks(QStringLiteral("/proc/self/task"));
+        for (const QString &tid : tasks.entryList(QDir::Dirs | QDir::NoDotAndDotDot)) {
+            QFile stat(tasks.filePath(tid + QStringLiteral("/stat")));
+            if (!stat.open(QIODevice::ReadOnly))
+                continue;
+
+            // "tid (name) state ppid ..."; utime and stime are the fields 14 and 15
+            const QByteArray line = stat.readAll();
+            const qsizetype nameBegin = line.indexOf('(');
+            const qsizetype nameEnd = line.lastIndexOf(')');
+            if (nameBegin < 0 || nameEnd < nameBegin)
+                continue;
+
+            const QList<QByteArray> fields = line.mid(nameEnd + 2).split(' ');
+            if (fields.size() < 13)
+                continue;
+
+            Thread &thread = m_threads[tid.toLongLong()];
+            thread.name = line.mid(nameBegin + 1, nameEnd - nameBegin - 1);
+            thread.ticks = fields[11].toLongLong() + fields[12].toLongLong();
+        }
+#endif
+    }
+
+    qreal cpuSeconds(const char *stage) const
+    {
+#ifdef Q_OS_LINUX
+        static const long ticksPerSecond = sysconf(_SC_CLK_TCK);
+        qint64 ticks = 0;
+        for (const auto &[tid, thread] : m_threads) {
+            if (thread.name.startsWith(stage))
+                ticks += thread.ticks - thread.baseTicks;
+        }
+        return qreal(ticks) / ticksPerSecond;
+#else
+        Q_UNUSED(stage);
+        return 0.;
+#endif
+    }
+
+private:
+    struct Thread
+    {
+        QByteArray name;
+        qint64 ticks = 0;
+        qint64 baseTicks = 0;
+    };
+
+    std::map<qint64, Thread> m_threads;
+};
+
+/*!
+    A recording fed from a frame input and an audio buffer input. It sends the same
+    generated frame and audio buffer repeatedly, so the source costs next to nothing;
+    each video frame is accompanied by an audio buffer of the same duration.
+
+    With a frame rate, the frames are sent on a timer, and the frames that the input
+    isn't ready for are dropped, like a live source would. Otherwise, the frames are sent
+    as fast as the engine takes them.
+ */
+class RecordingStream : public QObject
+{
+public:
+    RecordingStream(const QVideoFrame &frame, const QAudioBuffer &audioBuffer,
+                    const QUrl &location, int frameCount, qreal frameRate)
+        : m_frame(frame),
+          m_audioBuffer(audioBuffer),
+          m_audioInput(audioBuffer.format()),
+          m_frameCount(frameCount),
+          m_frameRate(frameRate)
+    {
+        m_session.setVideoFrameInput(&m_videoInput);
+        m_session.setAudioBufferInput(&m_audioInput);
+        m_session.setRecorder(&m_recorder);
+
+        QMediaFormat format(QMediaFormat::MPEG4);
+        format.setVideoCodec(QMediaFormat::VideoCodec::H264);
+        format.setAudioCodec(QMediaFormat::AudioCodec::AAC);
+        m_recorder.setMediaFormat(format);
+        m_recorder.setQuality(QMediaRecorder::NormalQuality);
+        m_recorder.setOutputLocation(location);
+        m_recorder.setAutoStop(true);
+
+        connect(&m_recorder, &QMediaRecorder::recorderStateChanged, this,
+                [this](QMediaRecorder::RecorderState state) {
+                    if (state == QMediaRecorder::StoppedState)
+                        m_stopped = true;
+                });
+        connect(&m_audioInput, &QAudioBufferInput::readyToSendAudioBuffer, this,
+                &RecordingStream::sendAudio);
+
+        connect(&m_videoInput, &QVideoFrameInput::readyToSendVideoFrame, this,
+                &RecordingStream::onReadyToSendVideoFrame);
+
+        if (isPaced()) {
+            m_timer.setTimerType(Qt::PreciseTimer);
+            m_timer.setInterval(qRound(1000 / m_frameRate));
+            connect(&m_timer, &QTimer::timeout, this, &RecordingStream::onTimeout);
+        }
+    }
+
+    void start() { m_recorder.record(); }
+
+    bool isStopped() const { return m_stopped; }
+
+    const QMediaRecorder &recorder() const { return m_recorder; }
+
+    // frames taken by the frame input; the engine encodes them unless its load control
+    // drops them, see droppedFrames()
+    int acceptedFrames() const { return m_sentFrames; }
+
+    // frames dropped by the source and by the load control of the engine
+    qint64 droppedFrames() const { return m_refusedFrames + m_recorder.droppedVideoFrames(); }
+
+    // Samples the length of the video encoder queue, as reported by the engine
+    void sampleQueueDepth()
+    {
+        const QRecordingStatistics statistics = m_recorder.statistics();
+        if (statistics.isNull())
+            return;
+
+        const int queueDepth = statistics.videoEncoderQueueLength();
+        m_maxQueueDepth = std::max(m_maxQueueDepth, queueDepth);
+        m_queueDepthSum += queueDepth;
+        ++m_queueDepthSamples;
+    }
+
+    int maxQueueDepth() const { return m_maxQueueDepth; }
+
+    qreal averageQueueDepth() const
+    {
+        return m_queueDepthSamples ? qreal(m_queueDepthSum) / m_queueDepthSamples : 0.;
+    }
+
+private:
+    bool isPaced() const { return m_frameRate > 0; }
+
+    void onReadyToSendVideoFrame()
+    {
+        if (isPaced()) {
+            // don't count the frames refused before the encoder has been initialized
+            if (m_sourceFrames == 0 && !m_timer.isActive())
+                m_timer.start();
+        } else {
+            while (m_sourceFrames < m_frameCount && sendFrame()) { }
+        }
+
+        sendEndOfStream();
+    }
+
+    void onTimeout()
+    {
+        sendFrame();
+
+        if (m_sourceFrames == m_frameCount) {
+            m_timer.stop();
+            sendEndOfStream();
+        }
+    }
+
+    bool sendFrame()
+    {
+        const bool sent = m_videoInput.sendVideoFrame(m_frame);
+        if (!sent && !isPaced())
+            return false; // the input signals when it's ready again
+
+        ++m_sourceFrames;
+        if (!sent) {
+            ++m_refusedFrames;
+            return false;
+        }
+
+        ++m_sentFrames;
+        ++m_pendingAudioBuffers;
+        sendAudio();
+        return true;
+    }
+
+    void sendEndOfStream()
+    {
+        if (m_sourceFrames < m_frameCount || m_videoEnded)
+            return;
+
+        // the empty frame is refused, too, while the queue is full
+        m_videoEnded = m_videoInput.sendVideoFrame({});
+        sendAudio();
+    }
+
+    void sendAudio()
+    {
+        while (m_pendingAudioBuffers > 0 && m_audioInput.sendAudioBuffer(m_audioBuffer))
+            --m_pendingAudioBuffers;
+
+        if (m_videoEnded && m_pendingAudioBuffers == 0 && !m_audioEnded)
+            m_audioEnded = m_audioInput.sendAudioBuffer({});
+    }
+
+private:
+    const QVideoFrame m_frame;
+    const QAudioBuffer m_audioBuffer;
+
+    QVideoFrameInput m_videoInput;
+    QAudioBufferInput m_audioInput;
+    QMediaCaptureSession m_session;
+    QMediaRecorder m_recorder;
+    QTimer m_timer;
+
+    const int m_frameCount;
+    const qreal m_frameRate;
+
+    int m_sourceFrames = 0;
+    int m_sentFrames = 0;
+    int m_refusedFrames = 0;
+    int m_pendingAudioBuffers = 0;
+    int m_maxQueueDepth = 0;
+    qint64 m_queueDepthSum = 0;
+    int m_queueDepthSamples = 0;
+    bool m_videoEnded = false;
+    bool m_audioEnded = false;
+    bool m_stopped = false;
+};
+
+} // namespace
+
+// Measures how many frames per second the recording engine takes from its frame inputs,
+// with one or more concurrent recordings fed by synthetic sources. The hardware encoders are disabled
+// unless QT_FFMPEG_ENCODING_HW_DEVICE_TYPES is set; QT_MEDIA_BENCHMARK_FRAMES
+// overrides the number of frames per recording.
+class tst_QMediaRecorderBenchmark : public QObject
+{
+    Q_OBJECT
+
+public:
+    static void initMain()
+    {
+        if (!qEnvironmentVariableIsSet("QT_FFMPEG_ENCODING_HW_DEVICE_TYPES"))
+            qputenv("QT_FFMPEG_ENCODING_HW_DEVICE_TYPES", ","); // an empty list
+    }
+
+private slots:
+    void initTestCase();
+
+    void record_data();
+    void record();
+};
+
+void tst_QMediaRecorderBenchmark::initTestCase()
+{
+    QSKIP_IF_NOT_FFMPEG("The benchmark measures the FFmpeg recording engine");
+}
+
+void tst_QMediaRecorderBenchmark::record_data()
+{
+    QTest::addColumn<QSize>("frameSize");
+    QTest::addColumn<QVideoFrameFormat::PixelFormat>("pixelFormat");
+    QTest::addColumn<qreal>("frameRate");
+    QTest::addColumn<int>("streamCount");
+
+    const std::pair<QSize, const char *> sizes[] = {
+        { QSize(1920, 1080), "1080p" },
+        { QSize(3840, 2160), "2160p" },
+    };
+
+    // YUV420P is encoded as is; BGRA8888 goes through the converter
+    for (const auto &[frameSize, sizeName] : sizes) {
+        for (const auto pixelFormat :
+             { QVideoFrameFormat::Format_YUV420P, QVideoFrameFormat::Format_BGRA8888 }) {
+            for (const qreal frameRate : { 0., NominalFrameRate }) {
+                for (const int streamCount : { 1, 4 }) {
+                    QTest::addRow("%s, %s, %s, %d streams", sizeName,
+                                  qPrintable(QVideoFrameFormat::pixelFormatToString(pixelFormat)),
+                                  frameRate > 0 ? "30 fps" : "unbounded", streamCount)
+                            << frameSize << pixelFormat << frameRate << streamCount;
+                }
+            }
+        }
+    }
+}
+
+void tst_QMediaRecorderBenchmark::record()
+{
+    QFETCH(QSize, frameSize);
+    QFETCH(QVideoFrameFormat::PixelFormat, pixelFormat);
+    QFETCH(qreal, frameRate);
+    QFETCH(int, streamCount);
+
+    VideoGenerator videoGenerator;
+    videoGenerator.setPattern(ImagePattern::ColoredSquares);
+    videoGenerator.setSize(frameSize);
+    videoGenerator.setPixelFormat(pixelFormat);
+    videoGenerator.setFrameRate(NominalFrameRate);
+    const QVideoFrame frame = videoGenerator.createFrame();
+    QVERIFY(frame.isValid());
+
+    QAudioFormat audioFormat;
+    audioFormat.setSampleFormat(QAudioFormat::Float);
+    audioFormat.setSampleRate(48000);
+    audioFormat.setChannelConfig(QAudioFormat::ChannelConfigStereo);
+
+    AudioGenerator audioGenerator;
+    audioGenerator.setFormat(audioFormat);
+    audioGenerator.setDuration(std::chrono::microseconds(qRound64(1'000'000 / NominalFrameRate)));
+    const QAudioBuffer audioBuffer = audioGenerator.createAudioBuffer();
+
+    const int frameCount = frameCountPerStream();
+
+    QTemporaryDir tempDir;
+    QVERIFY(tempDir.isValid());
+
+    std::vector<std::unique_ptr<RecordingStream>> streams;
+    for (int i = 0; i < streamCount; ++i) {
+        const QUrl location =
+                QUrl::fromLocalFile(tempDir.filePath(QStringLiteral("stream%1.mp4").arg(i)));
+        streams.push_back(std::make_unique<RecordingStream>(frame, audioBuffer, location,
+                                                            frameCount, frameRate));
+    }
+
+    StageCpuTimer stageCpuTimer;
+    QTimer samplingTimer;
+    connect(&samplingTimer, &QTimer::timeout, this, [&] {
+        stageCpuTimer.sample();
+        for (auto &stream : streams)
+            stream->sampleQueueDepth();
+    });
+
+    stageCpuTimer.start();
+    samplingTimer.start(20ms);
+    const std::clock_t processCpuStart = std::clock();
+    QElapsedTimer timer;
+    timer.start();
+
+    for (auto &stream : streams)
+        stream->start();
+
+    const bool stopped = QTest::qWaitFor(
+            [&] {
+                return std::all_of(streams.begin(), streams.end(),
+                                   [](const auto &stream) { return stream->isStopped(); });
+            },
+            10min);
+
+    const qreal elapsedSeconds = std::max<qint64>(timer.elapsed(), 1) / 1000.;
+    const qreal processCpuSeconds = qreal(std::clock() - processCpuStart) / CLOCKS_PER_SEC;
+    stageCpuTimer.sample();
+
+    QVERIFY(stopped);
+
+    int acceptedFrames = 0;
+    qint64 droppedFrames = 0;
+    int maxQueueDepth = 0;
+    qreal averageQueueDepth = 0.;
+    for (const auto &stream : streams) {
+        QVERIFY2(stream->recorder().error() == QMediaRecorder::NoError,
+                 qPrintable(stream->recorder().errorString()));
+
+        acceptedFrames += stream->acceptedFrames();
+        droppedFrames += stream->droppedFrames();
+        maxQueueDepth = std::max(maxQueueDepth, stream->maxQueueDepth());
+        averageQueueDepth += stream->averageQueueDepth() / streamCount;
+    }
+
+    const qreal framesPerCpuSecond = acceptedFrames / std::max(processCpuSeconds, qreal(0.001));
+
+    QString report = QStringLiteral("accepted frames: %1, dropped frames: %2, "
+                                    "queue depth: %3 avg, %4 max, "
+                                    "CPU: %5 s, %6 frames per CPU second")
+                             .arg(acceptedFrames)
+                             .arg(droppedFrames)
+                             .arg(averageQueueDepth, 0, 'f', 1)
+                             .arg(maxQueueDepth)
+                             .arg(processCpuSeconds, 0, 'f', 2)
+                             .arg(framesPerCpuSecond, 0, 'f', 1);
+
+    if (StageCpuTimer::isSupported()) {
+        for (const auto &[threadName, stageName] : StageCpuTimer::Stages) {
+            report += QStringLiteral(", %1: %2 s")
+                              .arg(QLatin1StringView(stageName))
+                              .arg(stageCpuTimer.cpuSeconds(threadName), 0, 'f', 2);
+        }
+    }
+
+    qInfo().noquote() << report;
+
+    QTest::setBenchmarkResult(acceptedFrames / elapsedSeconds, QTest::FramesPerSecond);
+}
+
+QTEST_GUILESS_MAIN(tst_QMediaRecorderBenchmark)
+
+#include "tst_bench_qmediarecorder.moc"
@@ -0,0 +1,305 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QtTest/QtTest>
+
+#include <QtMultimedia/qmediaplayer.h>
+#include <QtMultimedia/qvideoframe.h>
+#include <QtMultimedia/qvideosink.h>
+#include <QtMultimedia/private/qhwvideobuffer_p.h>
+#include <QtMultimedia/private/qmemoryvideobuffer_p.h>
+#include <QtMultimedia/private/qvideoframe_p.h>
+#include <QtMultimedia/private/qvideoframeconversionhelper_p.h>
+#include <QtMultimedia/private/qvideotexturehelper_p.h>
+#include <QtGui/qimage.h>
+#include <QtGui/qoffscreensurface.h>
+#include <rhi/qrhi.h>
+#include <private/framegenerator_p.h>
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+QT_USE_NAMESPACE
+
+using namespace std::chrono_literals;
+
+namespace {
+
+const QSize FrameSize(1920, 1080);
+
+QVideoFrame generateFrame(QVideoFrameFormat::PixelFormat pixelFormat)
+{
+    VideoGenerator generator;
+    generator.setPattern(ImagePattern::ColoredSquares);
+    generator.setSize(FrameSize);
+    generator.setPixelFormat(pixelFormat);
+    return generator.createFrame();
+}
+
+struct RhiHolder
+{
+    // the rhi must be destroyed before its surface
+    std::unique_ptr<QOffscreenSurface> surface;
+    std::unique_ptr<QRhi> rhi;
+};
+
+RhiHolder createRhi(QRhi::Implementation backend)
+{
+    RhiHolder result;
+
+    switch (backend) {
+    case QRhi::Null: {
+        QRhiNullInitParams params;
+        result.rhi.reset(QRhi::create(QRhi::Null, &params));
+        break;
+    }
+#if QT_CONFIG(opengl)
+    case QRhi::OpenGLES2: {
+        result.surface.reset(QRhiGles2InitParams::newFallbackSurface());
+        QRhiGles2InitParams params;
+        params.fallbackSurface = result.surface.get();
+        result.rhi.reset(QRhi::create(QRhi::OpenGLES2, &params));
+        break;
+    }
+#endif
+    default:
+        break;
+    }
+
+    return result;
+}
+
+} // namespace
+
+// Measures the CPU side of the video frame conversions and uploads.
+// The results can be tracked over time with the machine-readable outputs
+// of QTest, e.g. "-o results.csv,csv" or "-o results.xml,xml".
+class tst_QVideoFrameBenchmark : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+
+    void convertToImage_data();
+    void convertToImage();
+
+    void copyPixelsWithMask_data();
+    void copyPixelsWithMask();
+
+    void copyPixelsWithAlphaMask_data();
+    void copyPixelsWithAlphaMask();
+
+    void mapUnmap_data();
+    void mapUnmap();
+
+    void createTextures_data();
+    void createTextures();
+
+private:
+    QVideoFrame decodeFrame();
+
+    QVideoFrame m_decodedFrame;
+    QList<PixelsCopyFuncVariant> m_copyVariants;
+};
+
+void tst_QVideoFrameBenchmark::initTestCase()
+{
+    m_copyVariants = qPixelsCopyFuncVariants();
+    m_decodedFrame = decodeFrame();
+}
+
+QVideoFrame tst_QVideoFrameBenchmark::decodeFrame()
+{
+    QMediaPlayer player;
+    QVideoSink sink;
+    player.setVideoSink(&sink);
+
+    QVideoFrame result;
+    connect(&sink, &QVideoSink::videoFrameChanged, this, [&result](const QVideoFrame &frame) {
+        if (frame.isValid() && !result.isValid())
+            result = frame;
+    });
+
+    player.setSource(QUrl(QStringLiteral("qrc:/testdata/15s.mkv")));
+    player.play();
+    QTest::qWaitFor([&result] { return result.isValid(); }, 10s);
+    player.stop();
+
+    return result;
+}
+
+void tst_QVideoFrameBenchmark::convertToImage_data()
+{
+    QTest::addColumn<QVideoFrameFormat::PixelFormat>("pixelFormat");
+
+    for (int i = QVideoFrameFormat::Format_Invalid + 1; i < QVideoFrameFormat::NPixelFormats;
+         ++i) {
+        const auto pixelFormat = QVideoFrameFormat::PixelFormat(i);
+        if (qConverterForFormat(pixelFormat))
+            QTest::newRow(qPrintable(QVideoFrameFormat::pixelFormatToString(pixelFormat)))
+                    << pixelFormat;
+    }
+}
+
+void tst_QVideoFrameBenchmark::convertToImage()
+{
+    QFETCH(QVideoFrameFormat::PixelFormat, pixelFormat);
+
+    QVideoFrame frame = generateFrame(pixelFormat);
+    if (!frame.isValid())
+        QSKIP("The backend cannot generate frames of the pixel format");
+
+    const VideoFrameConvertFunc convert = qConverterForFormat(pixelFormat);
+    std::vector<uchar> output(FrameSize.width() * FrameSize.height() * 4);
+
+    QVERIFY(frame.map(QVideoFrame::ReadOnly));
+    QBENCHMARK {
+        convert(frame, output.data());
+    }
+    frame.unmap();
+}
+
+void tst_QVideoFrameBenchmark::copyPixelsWithMask_data()
+{
+    QTest::addColumn<int>("variantIndex");
+
+    for (int i = 0; i < m_copyVariants.size(); ++i)
+        QTest::newRow(m_copyVariants[i].name) << i;
+}
+
+void tst_QVideoFrameBenchmark::copyPixelsWithMask()
+{
+    QFETCH(int, variantIndex);
+
+    const PixelsCopyFunc copy = m_copyVariants[variantIndex].func;
+    const size_t size = FrameSize.width() * FrameSize.height();
+    const std::vector<uint32_t> src(size, 0x00808080);
+    std::vector<uint32_t> dst(size);
+    const uint32_t mask = qAlphaMask(QVideoFrameFormat::Format_BGRA8888);
+
+    QBENCHMARK {
+        copy(dst.data(), src.data(), size, mask);
+    }
+
+    QCOMPARE(dst.front(), src.front() | mask);
+}
+
+void tst_QVideoFrameBenchmark::copyPixelsWithAlphaMask_data()
+{
+    QTest::addColumn<bool>("opaque");
+
+    // opaque sources are copied with memcpy
+    QTest::newRow("opaque") << true;
+    QTest::newRow("transparent") << false;
+}
+
+void tst_QVideoFrameBenchmark::copyPixelsWithAlphaMask()
+{
+    QFETCH(bool, opaque);
+
+    constexpr auto pixelFormat = QVideoFrameFormat::Format_BGRA8888;
+    const uint32_t mask = qAlphaMask(pixelFormat);
+    const size_t size = FrameSize.width() * FrameSize.height();
+    const std::vector<uint32_t> src(size, opaque ? 0x00808080 | mask : 0x00808080);
+    std::vector<uint32_t> dst(size);
+
+    QBENCHMARK {
+        qCopyPixelsWithAlphaMask(dst.data(), src.data(), size, pixelFormat, !opaque);
+    }
+}
+
+void tst_QVideoFrameBenchmark::mapUnmap_data()
+{
+    QTest::addColumn<QVideoFrame>("frame");
+    QTest::addColumn<QVideoFrame::MapMode>("mapMode");
+
+    const QVideoFrameFormat format(FrameSize, QVideoFrameFormat::Format_BGRA8888);
+    const int bytesPerLine = FrameSize.width() * 4;
+    const QVideoFrame memoryFrame = QVideoFramePrivate::createFrame(
+            std::make_unique<QMemoryVideoBuffer>(
+                    QByteArray(bytesPerLine * FrameSize.height(), '\0'), bytesPerLine),
+            format);
+
+    QImage image(FrameSize, QImage::Format_ARGB32);
+    image.fill(Qt::red);
+    const QVideoFrame imageFrame(image);
+
+    QTest::newRow("QMemoryVideoBuffer, ReadOnly") << memoryFrame << QVideoFrame::ReadOnly;
+    QTest::newRow("QMemoryVideoBuffer, ReadWrite") << memoryFrame << QVideoFrame::ReadWrite;
+    QTest::newRow("QImageVideoBuffer, ReadOnly") << imageFrame << QVideoFrame::ReadOnly;
+    QTest::newRow("QImageVideoBuffer, ReadWrite") << imageFrame << QVideoFrame::ReadWrite;
+    // QFFmpegVideoBuffer with the FFmpeg backend
+    QTest::newRow("decoded, ReadOnly") << m_decodedFrame << QVideoFrame::ReadOnly;
+}
+
+void tst_QVideoFrameBenchmark::mapUnmap()
+{
+    QFETCH(QVideoFrame, frame);
+    QFETCH(QVideoFrame::MapMode, mapMode);
+
+    if (!frame.isValid())
+        QSKIP("The backend did not decode the reference file");
+
+    QBENCHMARK {
+        QVERIFY(frame.map(mapMode));
+        frame.unmap();
+    }
+}
+
+void tst_QVideoFrameBenchmark::createTextures_data()
+{
+    QTest::addColumn<int>("backend");
+    QTest::addColumn<QVideoFrameFormat::PixelFormat>("pixelFormat");
+
+    const std::pair<QRhi::Implementation, const char *> backends[] = {
+        { QRhi::Null, "Null" },
+        { QRhi::OpenGLES2, "OpenGLES2" },
+    };
+
+    for (const auto &[backend, backendName] : backends) {
+        for (const auto pixelFormat :
+             { QVideoFrameFormat::Format_BGRA8888, QVideoFrameFormat::Format_YUV420P,
+               QVideoFrameFormat::Format_NV12, QVideoFrameFormat::Format_P010 }) {
+            QTest::addRow("%s, %s", backendName,
+                          qPrintable(QVideoFrameFormat::pixelFormatToString(pixelFormat)))
+                    << int(backend) << pixelFormat;
+        }
+    }
+}
+
+void tst_QVideoFrameBenchmark::createTextures()
+{
+    QFETCH(int, backend);
+    QFETCH(QVideoFrameFormat::PixelFormat, pixelFormat);
+
+    const RhiHolder holder = createRhi(QRhi::Implementation(backend));
+    if (!holder.rhi)
+        QSKIP("The rhi backend is not available");
+
+    const QVideoFrame frame = generateFrame(pixelFormat);
+    if (!frame.isValid())
+        QSKIP("The backend cannot generate frames of the pixel format");
+
+    QRhi &rhi = *holder.rhi;
+    QVideoFrameTexturesUPtr textures;
+
+    // the textures are reused from the previous iteration, as in the video sinks
+    QBENCHMARK {
+        QRhiCommandBuffer *cb = nullptr;
+        QCOMPARE(rhi.beginOffscreenFrame(&cb), QRhi::FrameOpSuccess);
+
+        QRhiResourceUpdateBatch *rub = rhi.nextResourceUpdateBatch();
+        textures = QVideoTextureHelper::createTextures(frame, rhi, *rub, std::move(textures));
+        cb->resourceUpdate(rub);
+
+        QCOMPARE(rhi.endOffscreenFrame(), QRhi::FrameOpSuccess);
+    }
+
+    QVERIFY(textures);
+}
+
+QTEST_MAIN(tst_QVideoFrameBenchmark)
+
+#include "tst_bench_qvideoframe.moc"
@@ -0,0 +1,95 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QtTest/QtTest>
+
+#include <QtMultimedia/qvideoframe.h>
+#include <QtMultimedia/qvideoframeformat.h>
+#include <QtMultimedia/qvideosink.h>
+#include <QtCore/qeventloop.h>
+#include <QtCore/qsemaphore.h>
+#include <QtCore/qthread.h>
+
+#include <array>
+
+QT_USE_NAMESPACE
+
+// Measures the latency between a frame being produced on a backend thread
+// and the frame reaching the application.
+class tst_QVideoSinkBenchmark : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+
+    void queuedDelivery();
+    void directDelivery();
+
+private:
+    QVideoFrame nextFrame() { return m_frames[m_frameIndex++ % m_frames.size()]; }
+
+    template <typename Functor>
+    void produce(Functor &&f)
+    {
+        QMetaObject::invokeMethod(&m_producer, std::forward<Functor>(f));
+    }
+
+private:
+    QThread m_producerThread;
+    QObject m_producer;
+    // frames must differ from the current one; otherwise, they're not delivered
+    std::array<QVideoFrame, 2> m_frames;
+    size_t m_frameIndex = 0;
+};
+
+void tst_QVideoSinkBenchmark::initTestCase()
+{
+    const QVideoFrameFormat format(QSize(640, 480), QVideoFrameFormat::Format_XRGB8888);
+    for (QVideoFrame &frame : m_frames)
+        frame = QVideoFrame(format);
+
+    m_producer.moveToThread(&m_producerThread);
+    m_producerThread.start();
+}
+
+void tst_QVideoSinkBenchmark::cleanupTestCase()
+{
+    m_producerThread.quit();
+    m_producerThread.wait();
+}
+
+void tst_QVideoSinkBenchmark::queuedDelivery()
+{
+    QVideoSink sink;
+    QEventLoop loop;
+    connect(&sink, &QVideoSink::videoFrameChanged, &loop, &QEventLoop::quit);
+
+    QBENCHMARK {
+        produce([&] {
+            // mimics the backends, which hand frames over to the sink's thread
+            QMetaObject::invokeMethod(&sink,
+                                      [&sink, frame = nextFrame()] { sink.setVideoFrame(frame); });
+        });
+        loop.exec();
+    }
+}
+
+void tst_QVideoSinkBenchmark::directDelivery()
+{
+    QVideoSink sink;
+    QSemaphore received;
+    sink.setFrameCallback([&received](const QVideoFrame &) { received.release(); });
+
+    QBENCHMARK {
+        produce([&] { sink.setVideoFrame(nextFrame()); });
+        received.acquire();
+    }
+
+    sink.setFrameCallback({});
+}
+
+QTEST_MAIN(tst_QVideoSinkBenchmark)
+
+#include "tst_bench_qvideosink.moc"